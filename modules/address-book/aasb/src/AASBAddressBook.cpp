@@ -25,6 +25,10 @@
 #include <AASB/Message/AddressBook/AddressBook/PostalAddress.h>
 #include <AASB/Message/AddressBook/AddressBook/RemoveAddressBookMessage.h>
 
+#include <nlohmann/json.hpp>
+
+#include <vector>
+
 namespace aasb {
 namespace engine {
 namespace addressBook {
@@ -140,44 +144,76 @@ bool AASBAddressBook::getEntries(
         if (addressBookIter != m_addressBookCache.end()) {
             const auto& addressBook = addressBookIter->second;
 
+            // The cached message lists names, phone numbers and postal addresses separately, so they are merged into
+            // one complete entry per entryId and provided with addEntry(). Unlike the deprecated per-field calls, a
+            // complete entry lets the Engine send each batch as soon as it is full.
+            std::vector<std::string> entryIds;
+            std::unordered_map<std::string, nlohmann::json> entries;
+            auto entryFor = [&entryIds, &entries](const std::string& entryId) -> nlohmann::json& {
+                auto it = entries.find(entryId);
+                if (it == entries.end()) {
+                    entryIds.push_back(entryId);
+                    nlohmann::json entry = {{"entryId", entryId}, {"name", nlohmann::json::object()}};
+                    it = entries.emplace(entryId, std::move(entry)).first;
+                }
+                return it->second;
+            };
+            auto addIfNotEmpty = [](nlohmann::json& node, const std::string& key, const std::string& value) {
+                if (!value.empty()) {
+                    node[key] = value;
+                }
+            };
+
             for (const auto& navName : addressBook.navigationNames) {
                 AACE_DEBUG(LX(TAG).d("navName:entryId", navName.entryId));
-                sp->addName(navName.entryId, navName.name, "", "", navName.phoneticName);
+                auto& name = entryFor(navName.entryId)["name"];
+                addIfNotEmpty(name, "firstName", navName.name);
+                addIfNotEmpty(name, "phoneticFirstName", navName.phoneticName);
             }
 
             for (const auto& contactName : addressBook.contactNames) {
                 AACE_DEBUG(LX(TAG).d("contactName:entryId", contactName.entryId));
-                sp->addName(
-                    contactName.entryId,
-                    contactName.firstName,
-                    contactName.lastName,
-                    contactName.nickname,
-                    contactName.phoneticFirstName,
-                    contactName.phoneticLastName);
+                auto& name = entryFor(contactName.entryId)["name"];
+                addIfNotEmpty(name, "firstName", contactName.firstName);
+                addIfNotEmpty(name, "lastName", contactName.lastName);
+                addIfNotEmpty(name, "nickName", contactName.nickname);
+                addIfNotEmpty(name, "phoneticFirstName", contactName.phoneticFirstName);
+                addIfNotEmpty(name, "phoneticLastName", contactName.phoneticLastName);
             }
 
             for (const auto& phone : addressBook.phoneData) {
                 AACE_DEBUG(LX(TAG).d("phone:entryId", phone.entryId).sensitive("label", phone.label));
-                sp->addPhone(phone.entryId, phone.label, phone.number);
+                nlohmann::json phoneNumber = nlohmann::json::object();
+                addIfNotEmpty(phoneNumber, "label", phone.label);
+                addIfNotEmpty(phoneNumber, "number", phone.number);
+                entryFor(phone.entryId)["phoneNumbers"].push_back(phoneNumber);
             }
 
             for (const auto& postalAddress : addressBook.postalAddresses) {
                 AACE_DEBUG(
                     LX(TAG).d("postalAddress:entryId", postalAddress.entryId).sensitive("label", postalAddress.label));
-                sp->addPostalAddress(
-                    postalAddress.entryId,
-                    postalAddress.label,
-                    postalAddress.addressLine1,
-                    postalAddress.addressLine2,
-                    postalAddress.addressLine3,
-                    postalAddress.city,
-                    postalAddress.stateOrRegion,
-                    postalAddress.districtOrCounty,
-                    postalAddress.postalCode,
-                    postalAddress.country,
-                    postalAddress.latitudeInDegrees,
-                    postalAddress.longitudeInDegrees,
-                    postalAddress.accuracyInMeters);
+                nlohmann::json address = {
+                    {"latitudeInDegrees", postalAddress.latitudeInDegrees},
+                    {"longitudeInDegrees", postalAddress.longitudeInDegrees},
+                    {"accuracyInMeters", postalAddress.accuracyInMeters}};
+                addIfNotEmpty(address, "label", postalAddress.label);
+                addIfNotEmpty(address, "addressLine1", postalAddress.addressLine1);
+                addIfNotEmpty(address, "addressLine2", postalAddress.addressLine2);
+                addIfNotEmpty(address, "addressLine3", postalAddress.addressLine3);
+                addIfNotEmpty(address, "city", postalAddress.city);
+                addIfNotEmpty(address, "stateOrRegion", postalAddress.stateOrRegion);
+                addIfNotEmpty(address, "districtOrCounty", postalAddress.districtOrCounty);
+                addIfNotEmpty(address, "postalCode", postalAddress.postalCode);
+                addIfNotEmpty(address, "countryCode", postalAddress.country);
+                entryFor(postalAddress.entryId)["postalAddresses"].push_back(address);
+            }
+
+            for (const auto& entryId : entryIds) {
+                auto it = entries.find(entryId);
+                if (!sp->addEntry(it->second.dump())) {
+                    AACE_WARN(LX(TAG).m("addEntryFailed").d("entryId", entryId));
+                }
+                entries.erase(it);
             }
         }
 
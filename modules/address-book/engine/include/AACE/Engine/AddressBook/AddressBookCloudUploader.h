@@ -19,11 +19,15 @@
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 
+#include <rapidjson/document.h>
+
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
@@ -34,10 +38,13 @@
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Network/NetworkInfoObserver.h>
 #include <AACE/Engine/Network/NetworkObservableInterface.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 
 #include "AddressBookObserver.h"
 #include "AddressBookServiceInterface.h"
 #include "AddressBookCloudUploaderRESTAgent.h"
+#include "AddressBookSyncIndex.h"
+#include "AddressBookUploadPipeline.h"
 
 namespace aace {
 namespace engine {
@@ -168,7 +175,9 @@ private:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        size_t maxUploadBatchesInFlight);
 
 public:
     static std::shared_ptr<AddressBookCloudUploader> create(
@@ -179,7 +188,9 @@ public:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage = nullptr,
+        size_t maxUploadBatchesInFlight = AddressBookUploadPipeline::DEFAULT_MAX_BATCHES_IN_FLIGHT);
 
     // AddressBookObserver
     bool addressBookAdded(std::shared_ptr<AddressBookEntity> addressBookEntity) override;
@@ -222,13 +233,58 @@ private:
         AddressBookOperationResultCode& result);
     bool handleRemove(std::shared_ptr<AddressBookEntity> addressBookEntity, AddressBookOperationResultCode& result);
 
+    /**
+     * Upload only the entries added since the last synchronized upload of the address book. Changed
+     * or removed entries, a different address book source, or a missing cloud address book require
+     * a full upload. The added entries are read from the platform again and sent as they are provided.
+     * @param [in] addressBookEntity Address book to upload
+     * @param [in,out] snapshot The synchronized state of the last upload, updated on success
+     * @param [in] entryHashes Content hash of every current entry
+     * @param [out] numBatches int reference to update with the number of batches uploaded
+     * @param [out] result AddressBookOperationResultCode reference to update with result of the upload
+     * @return @c true if the delta upload was attempted, @c false if a full upload is required
+     */
+    bool handleDeltaUpload(
+        std::shared_ptr<AddressBookEntity> addressBookEntity,
+        AddressBookSyncIndex::Snapshot& snapshot,
+        const AddressBookSyncIndex::EntryHashes& entryHashes,
+        int& numBatches,
+        AddressBookOperationResultCode& result);
+
+    /// Receives each batch of entries as soon as the platform has provided it
+    using EntriesSink = std::function<void(const rapidjson::Document& batch)>;
+
+    /**
+     * Read the entries of an address book from the platform, passing them to @c sink in batches.
+     * @param [in] addressBookEntity Address book to read
+     * @param [in] sink Receives each batch of entries
+     * @param [out] numberOfEntries The number of entries read
+     * @return @c true if the platform provided all the entries, @c false otherwise
+     */
+    bool readEntries(
+        std::shared_ptr<AddressBookEntity> addressBookEntity,
+        const EntriesSink& sink,
+        size_t& numberOfEntries);
+
     bool checkAndAutoProvisionAccount();
     AddressBookOperationResultCode prepareForUpload(
         std::shared_ptr<AddressBookEntity> addressBookEntity,
         std::string& cloudAddressBookId);
-    AddressBookOperationResultCode uploadEntries(
-        const std::string& cloudAddressBookId,
-        std::shared_ptr<rapidjson::Document> document);
+
+    /**
+     * Start sending batches of entries to a cloud address book through the upload pipeline.
+     * Batches are submitted to @c m_uploadPipeline until @c finishUpload is called.
+     * @param [in] cloudAddressBookId The cloud address book to add the entries to
+     */
+    void beginUpload(const std::string& cloudAddressBookId);
+
+    /**
+     * Wait for the submitted batches to be sent. The cloud address book is deleted if any batch fails.
+     * @param [in] cloudAddressBookId The cloud address book the entries were added to
+     * @param [out] numBatches int reference to update with the number of batches submitted
+     * @return The result of the upload
+     */
+    AddressBookOperationResultCode finishUpload(const std::string& cloudAddressBookId, int& numBatches);
 
     std::string createAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
     bool deleteAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
@@ -238,10 +294,6 @@ private:
 
     enum class UploadFlowState { POST, PARSE, ERROR, FINISH };
 
-    UploadFlowState handleUploadEntries(
-        const std::string& addressBookId,
-        std::shared_ptr<rapidjson::Document> document,
-        HTTPResponse& httpResponse);
     UploadFlowState handleParseHTTPResponse(const HTTPResponse& httpResponse);
     UploadFlowState handleError(const std::string& addressBookId);
 
@@ -294,6 +346,16 @@ private:
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
 
+    /// Content hashes of the uploaded address books, or @c nullptr if local storage is not available
+    std::shared_ptr<AddressBookSyncIndex> m_syncIndex;
+
+    /// Sends the batches of an upload
+    std::shared_ptr<AddressBookUploadPipeline> m_uploadPipeline;
+
+    /// Result of the last failed batch of an upload, serialized with @c m_batchResultMutex
+    AddressBookOperationResultCode m_batchFailureResult = AddressBookOperationResultCode::ERROR_UNKNOWN;
+    std::mutex m_batchResultMutex;
+
     bool m_isAuthRefreshed = false;
     NetworkInfoObserver::NetworkStatus m_networkStatus;
 
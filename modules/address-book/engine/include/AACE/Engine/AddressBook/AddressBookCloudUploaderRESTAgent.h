@@ -69,6 +69,16 @@ public:
     HTTPResponse uploadDocumentToCloud(
         std::shared_ptr<rapidjson::Document> document,
         const std::string& cloudAddressBookId);
+
+    /**
+     * Upload a batch of serialized address book entries with a single request. The request is not
+     * retried here; the caller decides whether to resend it. Safe to call concurrently.
+     * @param content The JSON request body holding the entries
+     * @param cloudAddressBookId The cloud address book to add the entries to
+     * @return The HTTP response with the status received from the cloud, or an undefined response
+     *         code if the request could not be sent
+     */
+    HTTPResponse uploadEntriesToCloud(const std::string& content, const std::string& cloudAddressBookId);
     bool parseCreateAddressBookEntryResponse(const HTTPResponse& response, std::queue<std::string>& failedEntries);
     std::string buildFailedEntriesJson(std::queue<std::string>& failedContact);
 
@@ -123,11 +133,17 @@ private:
 
     std::vector<std::string> buildCommonHTTPHeader();
 
+    /**
+     * Post @c data, resending it up to @c maxRetries times after a retryable response.
+     * @return Whether the request succeeded, and the last response received. The response code is
+     *         undefined if no response was received.
+     */
     std::pair<bool, HTTPResponse> doPost(
         const std::string& url,
         const std::vector<std::string> headerLines,
         const std::string& data,
-        std::chrono::seconds timeout);
+        std::chrono::seconds timeout,
+        int maxRetries);
     std::pair<bool, HTTPResponse> doGet(const std::string& url, const std::vector<std::string>& headers);
     std::pair<bool, HTTPResponse> doDelete(const std::string& url, const std::vector<std::string>& headers);
 
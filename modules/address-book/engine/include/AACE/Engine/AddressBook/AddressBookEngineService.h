@@ -54,6 +54,7 @@ private:
     std::shared_ptr<AddressBookEngineImpl> m_addressBookEngineImpl;
     std::shared_ptr<AddressBookCloudUploader> m_addressBookCloudUploader;
     bool m_cleanAllAddressBooksAtStart;
+    size_t m_maxUploadBatchesInFlight;
 };
 
 }  // namespace addressBook
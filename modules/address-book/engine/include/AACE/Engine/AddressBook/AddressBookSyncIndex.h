@@ -0,0 +1,131 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_INDEX_H
+#define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * Persists a content hash for every entry of the address book last uploaded to the cloud, so a
+ * later upload of the same address book source can be limited to the entries that differ.
+ *
+ * The cloud keeps one address book per device and address book type, so the index is keyed by
+ * the cloud address book type and records the source it was built from.
+ */
+class AddressBookSyncIndex {
+public:
+    /// Content hash by entry id
+    using EntryHashes = std::unordered_map<std::string, uint64_t>;
+
+    /// The persisted state of one cloud address book
+    struct Snapshot {
+        /// The source id of the uploaded address book
+        std::string sourceId;
+        /// The cloud address book id the entries were uploaded to
+        std::string cloudAddressBookId;
+        /// The content hash of every uploaded entry
+        EntryHashes entries;
+    };
+
+    /// The difference between a persisted @c Snapshot and the current address book content
+    struct Delta {
+        /// Entries not present in the snapshot
+        std::vector<std::string> added;
+        /// Entries present in the snapshot with different content
+        std::vector<std::string> changed;
+        /// Entries present in the snapshot but not in the current content
+        std::vector<std::string> removed;
+
+        /// @return @c true if the content matches the snapshot
+        bool isEmpty() const {
+            return added.empty() && changed.empty() && removed.empty();
+        }
+    };
+
+    static std::shared_ptr<AddressBookSyncIndex> create(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage);
+
+    /**
+     * Load the snapshot of a cloud address book.
+     *
+     * @param [in] addressBookType The cloud address book type
+     * @param [out] snapshot The loaded snapshot
+     * @return @c true if a valid snapshot was found, @c false otherwise
+     */
+    bool load(const std::string& addressBookType, Snapshot& snapshot);
+
+    /**
+     * Persist the snapshot of a cloud address book, replacing any previous one.
+     *
+     * @param addressBookType The cloud address book type
+     * @param snapshot The snapshot to persist
+     * @return @c true on success, @c false otherwise
+     */
+    bool save(const std::string& addressBookType, const Snapshot& snapshot);
+
+    /**
+     * Remove the snapshot of a cloud address book. This must be called before the cloud address
+     * book is modified so a failed upload is never mistaken for a synchronized one.
+     *
+     * @param addressBookType The cloud address book type
+     * @return @c true on success or if there was no snapshot, @c false otherwise
+     */
+    bool remove(const std::string& addressBookType);
+
+    /**
+     * Compute the content hash of a serialized entry.
+     *
+     * @param data The serialized entry
+     * @param length The length of @c data in bytes
+     * @return The 64-bit FNV-1a hash of @c data
+     */
+    static uint64_t hash(const char* data, size_t length);
+
+    /**
+     * Compute the difference between the previously uploaded and the current entries.
+     *
+     * @param previous The hashes of the previously uploaded entries
+     * @param current The hashes of the current entries
+     * @return The entries that were added, changed, or removed
+     */
+    static Delta diff(const EntryHashes& previous, const EntryHashes& current);
+
+private:
+    AddressBookSyncIndex(std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage);
+
+    /// Local storage holding the snapshots
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
+    /// Serializes access to the local storage table
+    std::mutex m_mutex;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_INDEX_H
@@ -0,0 +1,224 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
+#define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * Uploads the batches of an address book through a bounded producer/consumer pipeline.
+ *
+ * The producing thread writes the content of each batch into a pool of reusable buffers while
+ * worker threads send previously produced batches. At most @c maxBatchesInFlight buffers exist and
+ * @c submit() blocks until one is free, so the memory used by serialized batches does not depend on
+ * the number of entries. A batch that fails with a retryable error is resent by its worker with
+ * exponential backoff; this is the only retry layer for batches. When a batch fails permanently no
+ * further batches are accepted and the lowest failed batch index is reported.
+ *
+ * One upload runs at a time: @c begin(), any number of @c submit() calls and @c finish() are made
+ * from the same thread.
+ */
+class AddressBookUploadPipeline {
+public:
+    /// Result of sending a single batch
+    enum class SendResult {
+        /// The batch was accepted
+        SUCCESS,
+        /// The batch failed with an error that may succeed if sent again
+        RETRY,
+        /// The batch failed permanently
+        FAILURE
+    };
+
+    /**
+     * Fills @c content with the next batch. Called on the thread that calls @c submit() or @c run().
+     * @param [out] content The buffer to fill, which may hold a previously sent batch
+     * @return @c true if a batch was produced, @c false if there are no more batches
+     */
+    using BatchProducer = std::function<bool(std::string& content)>;
+
+    /**
+     * Sends one batch. Called concurrently from the worker threads.
+     * @param content The batch to send
+     * @return The result of sending the batch
+     */
+    using BatchSender = std::function<SendResult(const std::string& content)>;
+
+    /// Pipeline settings
+    struct Configuration {
+        /// Maximum number of batches produced but not yet sent
+        size_t maxBatchesInFlight;
+        /// Maximum number of times a batch is resent after a retryable error
+        unsigned int maxRetries;
+        /// Backoff before the first resend, doubled for every further resend
+        std::chrono::milliseconds initialBackoff;
+        /// Upper bound for the backoff
+        std::chrono::milliseconds maxBackoff;
+    };
+
+    /// Outcome of @c run()
+    struct Result {
+        /// @c true if every batch was sent successfully
+        bool success;
+        /// Number of batches produced
+        size_t numBatches;
+        /// Index of the first batch that failed, valid only when @c success is @c false
+        size_t failedBatch;
+        /// Number of batches resent after a retryable error
+        size_t numRetries;
+        /// Highest number of batches sent concurrently
+        size_t peakBatchesInFlight;
+    };
+
+    /// Default number of batches in flight
+    static constexpr size_t DEFAULT_MAX_BATCHES_IN_FLIGHT = 2;
+
+    /// Upper bound for the number of batches in flight
+    static constexpr size_t MAX_BATCHES_IN_FLIGHT_LIMIT = 8;
+
+    AddressBookUploadPipeline(const Configuration& configuration);
+
+    ~AddressBookUploadPipeline();
+
+    /**
+     * Classify the HTTP response code of a batch request. Only network failures, reported with an
+     * undefined response code, and server errors are retried. Client errors are permanent.
+     *
+     * @param httpResponseCode The response code of the request
+     * @return The result of sending the batch
+     */
+    static SendResult getSendResult(long httpResponseCode);
+
+    /**
+     * Start an upload. Batches passed to @c submit() are sent with @c sender on the worker threads.
+     *
+     * @param sender Sends a batch
+     */
+    void begin(const BatchSender& sender);
+
+    /**
+     * Wait for a free buffer and fill it with the next batch, which is then queued for sending.
+     *
+     * @param producer Produces the content of the batch
+     * @return @c true if a batch was queued, @c false if the producer had no batch or the upload has
+     *         failed or been cancelled
+     */
+    bool submit(const BatchProducer& producer);
+
+    /**
+     * Wait until every queued batch has been sent and stop the workers.
+     *
+     * @return The outcome of the upload
+     */
+    Result finish();
+
+    /**
+     * Produce and send batches until the producer is exhausted, a batch fails permanently, or the
+     * pipeline is cancelled. Returns after every started send has completed.
+     *
+     * @param producer Produces the content of each batch in order
+     * @param sender Sends a batch
+     * @return The outcome of the upload
+     */
+    Result run(const BatchProducer& producer, const BatchSender& sender);
+
+    /// Abort running and future uploads, interrupting any backoff.
+    void cancel();
+
+private:
+    /// Wait for the backoff of the specified resend. @return @c false if cancelled
+    bool waitForRetry(unsigned int retry);
+
+    /// Send a batch, converting an exception thrown by the sender to a failure
+    SendResult sendBatch(const std::string& content);
+
+    /// Send queued batches until the upload finishes
+    void workerLoop();
+
+    /// The pipeline settings
+    Configuration m_configuration;
+
+    /// Set when the pipeline is cancelled
+    std::atomic<bool> m_isCancelled;
+
+    /// Mutex used for backoff waits
+    std::mutex m_cancelMutex;
+
+    /// Wakes backoff waits on cancel
+    std::condition_variable m_cancelled;
+
+    /// Sends the batches of the current upload
+    BatchSender m_sender;
+
+    /// Batch buffers, owned by the producer while free and by a worker once queued
+    std::vector<std::string> m_buffers;
+
+    /// Indexes of the free buffers
+    std::deque<size_t> m_freeBuffers;
+
+    /// Queued batches as pairs of batch index and buffer index
+    std::deque<std::pair<size_t, size_t>> m_pendingBatches;
+
+    /// Serializes access to the state of the current upload
+    std::mutex m_mutex;
+
+    /// Notified whenever the state of the current upload changes
+    std::condition_variable m_stateChanged;
+
+    /// @c true while batches may still be submitted
+    bool m_isProducing;
+
+    /// @c true once a batch has failed permanently
+    bool m_hasFailed;
+
+    /// Index of the first batch that failed
+    size_t m_failedBatch;
+
+    /// Number of batches queued
+    size_t m_numBatches;
+
+    /// Number of batches resent after a retryable error
+    size_t m_numRetries;
+
+    /// Number of batches being sent
+    size_t m_batchesInFlight;
+
+    /// Highest number of batches sent concurrently
+    size_t m_peakBatchesInFlight;
+
+    /// Worker threads of the current upload
+    std::vector<std::thread> m_workers;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
@@ -13,9 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <sstream>
 #include <typeinfo>
+#include <unordered_set>
 
 #include <nlohmann/json.hpp>
 #include <rapidjson/error/en.h>
@@ -45,7 +48,7 @@ using namespace aace::engine::metrics;
 static const std::string TAG("aace.addressBook.addressBookCloudUploader");
 
 /// Upload entries batch size
-static const int UPLOAD_BATCH_SIZE = 100;
+static const size_t UPLOAD_BATCH_SIZE = 100;
 
 /// Max allowed phone numbers per entry
 static const int MAX_ALLOWED_ADDRESSES_PER_ENTRY = 30;
@@ -113,8 +116,36 @@ static const std::string METRIC_REQUEST_FAILURE_COUNT = "RequestFailureCount";
 /// Request failure type metric dimension key
 static const std::string METRIC_REQUEST_FAILURE_TYPE = "RequestFailureType";
 
+/// Max number of times a batch is resent after a server or network error
+static const unsigned int MAX_BATCH_RETRY = 3;
+
+/// Backoff before the first resend of a batch
+static const std::chrono::milliseconds INITIAL_BATCH_RETRY_BACKOFF = std::chrono::milliseconds(1000);
+
+/// Upper bound for the backoff between resends of a batch
+static const std::chrono::milliseconds MAX_BATCH_RETRY_BACKOFF = std::chrono::milliseconds(8000);
+
 using json = nlohmann::json;
 
+/// rapidjson output stream appending to a std::string, so batches are written straight into pipeline buffers
+class StringOutputStream {
+public:
+    typedef char Ch;
+
+    StringOutputStream(std::string& output) : m_output(output) {
+    }
+
+    void Put(char c) {
+        m_output.push_back(c);
+    }
+
+    void Flush() {
+    }
+
+private:
+    std::string& m_output;
+};
+
 AddressBookCloudUploader::AddressBookCloudUploader() :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG), m_isShuttingDown(false), m_isAuthRefreshed(false) {
 }
@@ -127,7 +158,9 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    size_t maxUploadBatchesInFlight) {
     try {
         auto addressBookCloudUploader = std::shared_ptr<AddressBookCloudUploader>(new AddressBookCloudUploader());
         ThrowIfNull(metricRecorder, "nullMetricRecorder");
@@ -140,7 +173,9 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
                 networkObserver,
                 alexaEndpoints,
                 metricRecorder,
-                cleanAllAddressBooksAtStart),
+                cleanAllAddressBooksAtStart,
+                localStorage,
+                maxUploadBatchesInFlight),
             "initializeAddressBookCloudUploaderFailed");
 
         return addressBookCloudUploader;
@@ -158,7 +193,9 @@ bool AddressBookCloudUploader::initialize(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    size_t maxUploadBatchesInFlight) {
     try {
         m_addressBookService = addressBookService;
         m_authDelegate = authDelegate;
@@ -167,6 +204,16 @@ bool AddressBookCloudUploader::initialize(
         m_networkObserver = networkObserver;
         m_metricRecorder = metricRecorder;
 
+        if (localStorage != nullptr) {
+            m_syncIndex = AddressBookSyncIndex::create(localStorage);
+            ThrowIfNull(m_syncIndex, "createAddressBookSyncIndexFailed");
+        } else {
+            AACE_DEBUG(LX(TAG).m("localStorageNotAvailable").d("deltaUpload", false));
+        }
+
+        m_uploadPipeline = std::make_shared<AddressBookUploadPipeline>(AddressBookUploadPipeline::Configuration{
+            maxUploadBatchesInFlight, MAX_BATCH_RETRY, INITIAL_BATCH_RETRY_BACKOFF, MAX_BATCH_RETRY_BACKOFF});
+
         m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
             authDelegate, m_deviceInfo, alexaEndpoints);
         ThrowIfNull(m_addressBookCloudUploaderRESTAgent, "createAddressBookCloudRESTAgentFailed");
@@ -192,6 +239,7 @@ bool AddressBookCloudUploader::initialize(
 void AddressBookCloudUploader::doShutdown() {
     m_isShuttingDown = true;
     m_waitForEvent.notify_all();
+    m_uploadPipeline->cancel();
 
     m_addressBookCloudUploaderRESTAgent->shutdown();
 
@@ -321,12 +369,29 @@ void AddressBookCloudUploader::removeMatchingAddEventFromQueueLocked(
     }
 }
 
+/**
+ * Collects the entries provided by the platform into batches of @c UPLOAD_BATCH_SIZE entries. A batch is
+ * passed to the sink as soon as it is full, unless it holds an entry added with the deprecated calls, which
+ * may add to any entry until getEntries() returns. Such batches, and the last partial batch, are passed on
+ * by @c flush().
+ */
 class AddressBookEntriesFactory : public aace::addressBook::AddressBook::IAddressBookEntriesFactory {
 public:
-    AddressBookEntriesFactory(
-        std::shared_ptr<AddressBookEntity> addressBookEntity,
-        std::vector<std::shared_ptr<rapidjson::Document>>& documents) :
-            m_addressBookEntity(std::move(addressBookEntity)), m_documents(documents) {
+    using EntriesSink = std::function<void(const rapidjson::Document& batch)>;
+
+    AddressBookEntriesFactory(std::shared_ptr<AddressBookEntity> addressBookEntity, EntriesSink sink) :
+            m_addressBookEntity(std::move(addressBookEntity)), m_sink(std::move(sink)) {
+    }
+
+    /// Pass every batch still held to the sink.
+    void flush() {
+        for (size_t bucketIndex = 0; bucketIndex < m_documents.size(); bucketIndex++) {
+            flushBucket(bucketIndex);
+        }
+    }
+
+    size_t getNumberOfEntries() {
+        return m_ids.size();
     }
 
 private:
@@ -351,6 +416,13 @@ private:
 
             // Check if bucket mapping to bucketIndex is new bucket to be created.
             if (bucketIndex + 1 > (m_documents.size())) {
+                // Entries added with addEntry() are complete, so the previous bucket can be sent unless a
+                // deprecated call may still add to one of its entries.
+                if (bucketIndex > 0 && !m_hasDeprecatedEntries[bucketIndex - 1]) {
+                    flushBucket(bucketIndex - 1);
+                }
+                m_hasDeprecatedEntries.push_back(false);
+
                 auto document = std::make_shared<rapidjson::Document>();
                 document->SetObject();
 
@@ -380,10 +452,23 @@ private:
         }
     }
 
+    void flushBucket(size_t bucketIndex) {
+        if (m_documents[bucketIndex] != nullptr) {
+            m_sink(*m_documents[bucketIndex]);
+            m_documents[bucketIndex].reset();
+        }
+    }
+
+    // Keeps the bucket of the entry until getEntries() returns, since deprecated calls may add to it later.
+    void markDeprecatedEntry(const std::string& entryId) {
+        m_hasDeprecatedEntries[m_ids[entryId] / UPLOAD_BATCH_SIZE] = true;
+    }
+
     rapidjson::Value& getEntryDataNode(const std::string& entryId) {
         auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
         auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
 
+        ThrowIfNull(m_documents[bucketIndex], "entryAlreadyUploaded");
         auto& document = *m_documents[bucketIndex];
         auto& entries = document["entries"];
 
@@ -392,6 +477,7 @@ private:
 
     rapidjson::Document::AllocatorType& GetAllocator(const std::string& entryId) {
         auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
+        ThrowIfNull(m_documents[bucketIndex], "entryAlreadyUploaded");
         auto& document = *m_documents[bucketIndex];
 
         return document.GetAllocator();
@@ -744,6 +830,7 @@ public:
                 createEntryDataField(entryId);
             }
             auto& data = getEntryDataNode(entryId);
+            markDeprecatedEntry(entryId);
             auto& allocator = GetAllocator(entryId);
             rapidjson::Value name(rapidjson::kObjectType);
 
@@ -776,6 +863,7 @@ public:
                 createEntryDataField(entryId);
             }
             auto& data = getEntryDataNode(entryId);
+            markDeprecatedEntry(entryId);
             auto& allocator = GetAllocator(entryId);
 
             if (!data.HasMember("addresses")) {
@@ -836,6 +924,7 @@ public:
                 createEntryDataField(entryId);
             }
             auto& data = getEntryDataNode(entryId);
+            markDeprecatedEntry(entryId);
             auto& allocator = GetAllocator(entryId);
 
             if (!data.HasMember("addresses")) {
@@ -903,10 +992,54 @@ public:
 
 private:
     std::shared_ptr<AddressBookEntity> m_addressBookEntity;
-    std::vector<std::shared_ptr<rapidjson::Document>>& m_documents;
+    EntriesSink m_sink;
+    // Buckets of entries, reset once passed to the sink
+    std::vector<std::shared_ptr<rapidjson::Document>> m_documents;
+    // Whether each bucket holds an entry added with the deprecated calls
+    std::vector<bool> m_hasDeprecatedEntries;
     std::unordered_map<std::string, rapidjson::SizeType> m_ids;
 };
 
+/**
+ * Serializes each entry of a batch and passes it to @c handler with its entry id.
+ */
+static void forEachSerializedEntry(
+    const rapidjson::Document& batch,
+    const std::function<void(const std::string& entryId, const std::string& entry)>& handler) {
+    auto entries = batch.FindMember("entries");
+    if (entries == batch.MemberEnd()) {
+        return;
+    }
+    std::string entry;
+    for (auto itr = entries->value.Begin(); itr != entries->value.End(); itr++) {
+        entry.clear();
+        StringOutputStream stream(entry);
+        rapidjson::Writer<StringOutputStream> writer(stream);
+        itr->Accept(writer);
+        handler((*itr)["entrySourceId"].GetString(), entry);
+    }
+}
+
+bool AddressBookCloudUploader::readEntries(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    const EntriesSink& sink,
+    size_t& numberOfEntries) {
+    auto addressBookSourceId = addressBookEntity->getSourceId();
+    auto factory = std::make_shared<AddressBookEntriesFactory>(addressBookEntity, sink);
+
+    AACE_INFO(LX(TAG).m("GettingAddressBookEntries").d("addressBookSourceId", addressBookSourceId));
+
+    bool success = m_addressBookService->getEntries(addressBookSourceId, factory);
+    factory->flush();
+    numberOfEntries = factory->getNumberOfEntries();
+    if (!success) {
+        // getEntries can return false, it probably means OEM was not successful in providing all the entries.
+        // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
+        AACE_WARN(LX(TAG, "readEntries").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
+    }
+    return success;
+}
+
 bool AddressBookCloudUploader::handleUpload(
     std::shared_ptr<AddressBookEntity> addressBookEntity,
     int& numBatches,
@@ -915,48 +1048,99 @@ bool AddressBookCloudUploader::handleUpload(
     try {
         result = AddressBookOperationResultCode::SUCCESS;
         addressBookSourceId = addressBookEntity->getSourceId();
-
-        std::vector<std::shared_ptr<rapidjson::Document>> documents;
-        auto factory = std::make_shared<AddressBookEntriesFactory>(addressBookEntity, documents);
-
-        AACE_INFO(LX(TAG).m("GettingAddressBookEntries").d("addressBookSourceId", addressBookSourceId));
-
-        if (!m_addressBookService->getEntries(addressBookSourceId, factory)) {
-            // getEntries can return false, it probably means OEM was not successful in providing all the entries.
-            // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
-            AACE_WARN(
-                LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
-            // Return true to drop this address book from retry.
-            return true;
+        auto addressBookType = addressBookEntity->toJSONAddressBookType();
+
+        // When this address book was uploaded before, read the entries once to find out whether only the new
+        // entries have to be uploaded. Only the entry hashes are kept.
+        AddressBookSyncIndex::Snapshot snapshot;
+        if (m_syncIndex != nullptr && m_syncIndex->load(addressBookType, snapshot)) {
+            if (snapshot.sourceId == addressBookSourceId) {
+                AddressBookSyncIndex::EntryHashes entryHashes;
+                size_t numberOfEntries = 0;
+                bool entriesRead = readEntries(
+                    addressBookEntity,
+                    [&entryHashes](const rapidjson::Document& batch) {
+                        forEachSerializedEntry(
+                            batch, [&entryHashes](const std::string& entryId, const std::string& entry) {
+                                entryHashes[entryId] = AddressBookSyncIndex::hash(entry.data(), entry.size());
+                            });
+                    },
+                    numberOfEntries);
+                if (!entriesRead) {
+                    // Return true to drop this address book from retry.
+                    return true;
+                }
+                if (handleDeltaUpload(addressBookEntity, snapshot, entryHashes, numBatches, result)) {
+                    ThrowIfNot(result == AddressBookOperationResultCode::SUCCESS, "deltaUploadFailed");
+                    return true;
+                }
+            } else {
+                AACE_DEBUG(LX(TAG).m("addressBookSourceChanged").d("addressBookSourceId", addressBookSourceId));
+            }
         }
 
-        numBatches = documents.size();
-        if (documents.size() <= 0) {
-            // Its the empty document.
-            AACE_WARN(LX(TAG, "handleUpload")
-                          .d("addressBookSourceId", addressBookSourceId)
-                          .d("reason", "emptyDocumentToUpload"));
+        // Replace the cloud address book, sending each batch of entries as soon as the platform has provided
+        // it. The cloud address book is only replaced once the first batch is available, so an empty address
+        // book leaves the previous upload in place.
+        std::string cloudAddressBookId;
+        bool uploadStarted = false;
+        AddressBookSyncIndex::EntryHashes entryHashes;
+        size_t numberOfEntries = 0;
+        bool entriesRead = readEntries(
+            addressBookEntity,
+            [&](const rapidjson::Document& batch) {
+                if (!uploadStarted) {
+                    uploadStarted = true;
+                    // Forget the previous upload before the cloud address book is replaced.
+                    if (m_syncIndex != nullptr) {
+                        m_syncIndex->remove(addressBookType);
+                    }
+                    result = prepareForUpload(addressBookEntity, cloudAddressBookId);
+                    if (!cloudAddressBookId.empty()) {
+                        beginUpload(cloudAddressBookId);
+                    }
+                }
+                if (cloudAddressBookId.empty()) {
+                    return;
+                }
+                if (m_syncIndex != nullptr) {
+                    forEachSerializedEntry(batch, [&entryHashes](const std::string& entryId, const std::string& entry) {
+                        entryHashes[entryId] = AddressBookSyncIndex::hash(entry.data(), entry.size());
+                    });
+                }
+                m_uploadPipeline->submit([&batch](std::string& content) {
+                    StringOutputStream stream(content);
+                    rapidjson::Writer<StringOutputStream> writer(stream);
+                    batch.Accept(writer);
+                    return true;
+                });
+            },
+            numberOfEntries);
+
+        if (!uploadStarted || (!entriesRead && cloudAddressBookId.empty())) {
+            if (entriesRead) {
+                // Its the empty document.
+                AACE_WARN(LX(TAG, "handleUpload")
+                              .d("addressBookSourceId", addressBookSourceId)
+                              .d("reason", "emptyDocumentToUpload"));
+            }
             // Return true to drop this address book from retry.
             return true;
         }
+        ThrowIf(cloudAddressBookId.empty(), "prepareUploadFailed");
 
-        int numberOfEntries = 0;
-        for (auto document : documents) {
-            auto entries = document->FindMember("entries");
-            if (entries != document->MemberEnd()) {
-                numberOfEntries += entries->value.Size();
+        result = finishUpload(cloudAddressBookId, numBatches);
+        if (!entriesRead) {
+            // Do not leave a partial address book in the cloud. Return true to drop this address book from retry.
+            if (result == AddressBookOperationResultCode::SUCCESS) {
+                handleError(cloudAddressBookId);
             }
+            return true;
         }
+        ThrowIfNot(result == AddressBookOperationResultCode::SUCCESS, "uploadDocumentFailed");
 
-        //Preparing for the upload
-        std::string cloudAddressBookId;
-        result = prepareForUpload(addressBookEntity, cloudAddressBookId);
-        ThrowIf(cloudAddressBookId.empty(), "prepareUploadFailed");
-
-        //Upload json document in a loop.
-        for (auto document : documents) {
-            result = uploadEntries(cloudAddressBookId, document);
-            ThrowIfNot(result == AddressBookOperationResultCode::SUCCESS, "uploadDocumentFailed");
+        if (m_syncIndex != nullptr) {
+            m_syncIndex->save(addressBookType, {addressBookSourceId, cloudAddressBookId, std::move(entryHashes)});
         }
 
         AACE_INFO(LX(TAG)
@@ -971,6 +1155,110 @@ bool AddressBookCloudUploader::handleUpload(
     }
 }
 
+bool AddressBookCloudUploader::handleDeltaUpload(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    AddressBookSyncIndex::Snapshot& snapshot,
+    const AddressBookSyncIndex::EntryHashes& entryHashes,
+    int& numBatches,
+    AddressBookOperationResultCode& result) {
+    auto addressBookSourceId = addressBookEntity->getSourceId();
+    auto addressBookType = addressBookEntity->toJSONAddressBookType();
+
+    auto delta = AddressBookSyncIndex::diff(snapshot.entries, entryHashes);
+    if (!delta.changed.empty() || !delta.removed.empty()) {
+        // The cloud address book has no entry update or delete, so it has to be replaced.
+        AACE_INFO(LX(TAG)
+                      .m("fullUploadRequired")
+                      .d("addressBookSourceId", addressBookSourceId)
+                      .d("changed", delta.changed.size())
+                      .d("removed", delta.removed.size()));
+        return false;
+    }
+    if (!m_addressBookCloudUploaderRESTAgent->isAccountProvisioned()) {
+        return false;
+    }
+
+    // The cloud address book may have expired or been deleted since the last upload.
+    std::string cloudAddressBookId;
+    if (!m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(
+            m_deviceInfo->getDeviceSerialNumber(), addressBookType, cloudAddressBookId) ||
+        cloudAddressBookId.empty() || cloudAddressBookId != snapshot.cloudAddressBookId) {
+        AACE_INFO(LX(TAG).m("cloudAddressBookChanged").d("addressBookSourceId", addressBookSourceId));
+        return false;
+    }
+
+    result = AddressBookOperationResultCode::SUCCESS;
+    if (delta.added.empty()) {
+        numBatches = 0;
+        AACE_INFO(LX(TAG).m("addressBookUnchanged").d("addressBookSourceId", addressBookSourceId));
+        return true;
+    }
+
+    // Forget the previous upload before the cloud address book is modified.
+    if (!m_syncIndex->remove(addressBookType)) {
+        return false;
+    }
+
+    // Read the entries again and send the added ones in batches as they are provided.
+    std::unordered_set<std::string> added(delta.added.begin(), delta.added.end());
+    AddressBookSyncIndex::EntryHashes currentHashes;
+    std::string pendingEntries;
+    size_t numPendingEntries = 0;
+    auto submitPendingEntries = [this, &pendingEntries, &numPendingEntries]() {
+        m_uploadPipeline->submit([&pendingEntries](std::string& content) {
+            content.append("{\"entries\":[");
+            content.append(pendingEntries);
+            content.append("]}");
+            return true;
+        });
+        pendingEntries.clear();
+        numPendingEntries = 0;
+    };
+
+    beginUpload(cloudAddressBookId);
+    size_t numberOfEntries = 0;
+    bool entriesRead = readEntries(
+        addressBookEntity,
+        [&](const rapidjson::Document& batch) {
+            forEachSerializedEntry(batch, [&](const std::string& entryId, const std::string& entry) {
+                currentHashes[entryId] = AddressBookSyncIndex::hash(entry.data(), entry.size());
+                if (added.count(entryId) == 0) {
+                    return;
+                }
+                if (numPendingEntries > 0) {
+                    pendingEntries.push_back(',');
+                }
+                pendingEntries.append(entry);
+                if (++numPendingEntries == UPLOAD_BATCH_SIZE) {
+                    submitPendingEntries();
+                }
+            });
+        },
+        numberOfEntries);
+    if (numPendingEntries > 0) {
+        submitPendingEntries();
+    }
+    result = finishUpload(cloudAddressBookId, numBatches);
+    if (result != AddressBookOperationResultCode::SUCCESS) {
+        return true;
+    }
+    if (!entriesRead || currentHashes != entryHashes) {
+        // The entries changed while they were read again, so the upload is not recorded and the next upload
+        // replaces the cloud address book.
+        AACE_WARN(LX(TAG).m("addressBookChangedDuringUpload").d("addressBookSourceId", addressBookSourceId));
+        return true;
+    }
+
+    snapshot.entries = entryHashes;
+    m_syncIndex->save(addressBookType, snapshot);
+
+    AACE_INFO(LX(TAG)
+                  .m("SuccessfullyUploadedDelta")
+                  .d("addressBookSourceId", addressBookSourceId)
+                  .d("numberOfEntries", delta.added.size()));
+    return true;
+}
+
 bool AddressBookCloudUploader::handleRemove(
     std::shared_ptr<AddressBookEntity> addressBookEntity,
     AddressBookOperationResultCode& result) {
@@ -989,6 +1277,10 @@ bool AddressBookCloudUploader::handleRemove(
             Throw("addressBookDeleteFailed");
         }
 
+        if (m_syncIndex != nullptr) {
+            m_syncIndex->remove(addressBookEntity->toJSONAddressBookType());
+        }
+
         AACE_INFO(LX(TAG, "handleRemove")
                       .m("Removed Successfully")
                       .d("addressBookType", addressBookEntity->getType())
@@ -1136,44 +1428,50 @@ AddressBookOperationResultCode AddressBookCloudUploader::prepareForUpload(
     return AddressBookOperationResultCode::SUCCESS;
 }
 
-AddressBookOperationResultCode AddressBookCloudUploader::uploadEntries(
-    const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
-    try {
-        AACE_DEBUG(LX(TAG).d("numEntries", document->FindMember("entries")->value.Size()));
-        HTTPResponse httpResponse;
-        auto flowState = UploadFlowState::POST;
-        AddressBookOperationResultCode resultCode = AddressBookOperationResultCode::SUCCESS;
-
-        while (!m_isShuttingDown && flowState != UploadFlowState::FINISH) {
-            auto nextFlowState = UploadFlowState::ERROR;
-
-            AACE_DEBUG(LX(TAG).d("flowState", flowState));
-
-            switch (flowState) {
-                case UploadFlowState::POST:
-                    nextFlowState = handleUploadEntries(cloudAddressBookId, document, httpResponse);
-                    resultCode = httpResponseCodeToResult((HTTPResponseCode)httpResponse.code);
-                    break;
-                case UploadFlowState::PARSE:
-                    nextFlowState = handleParseHTTPResponse(httpResponse);
-                    if (nextFlowState == UploadFlowState::ERROR) {
-                        resultCode = AddressBookOperationResultCode::ERROR_HTTP_PARSE_RESPONSE_FAILED;
-                    }
-                    break;
-                case UploadFlowState::ERROR:
-                    nextFlowState = handleError(cloudAddressBookId);
-                    break;
-                case UploadFlowState::FINISH:
-                    break;
+void AddressBookCloudUploader::beginUpload(const std::string& cloudAddressBookId) {
+    m_batchFailureResult = AddressBookOperationResultCode::ERROR_UNKNOWN;
+    m_uploadPipeline->begin([this, cloudAddressBookId](const std::string& content) {
+        auto httpResponse = m_addressBookCloudUploaderRESTAgent->uploadEntriesToCloud(content, cloudAddressBookId);
+        auto sendResult = AddressBookUploadPipeline::getSendResult(httpResponse.code);
+        auto resultCode = httpResponseCodeToResult((HTTPResponseCode)httpResponse.code);
+        if (sendResult == AddressBookUploadPipeline::SendResult::SUCCESS) {
+            if (handleParseHTTPResponse(httpResponse) == UploadFlowState::FINISH) {
+                return AddressBookUploadPipeline::SendResult::SUCCESS;
             }
-            flowState = nextFlowState;
+            resultCode = AddressBookOperationResultCode::ERROR_HTTP_PARSE_RESPONSE_FAILED;
+            sendResult = AddressBookUploadPipeline::SendResult::FAILURE;
         }
-        return resultCode;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "uploadEntries failed").d("reason", ex.what()));
-        return AddressBookOperationResultCode::ERROR_UNKNOWN;
+        std::lock_guard<std::mutex> lock(m_batchResultMutex);
+        m_batchFailureResult = resultCode;
+        return sendResult;
+    });
+}
+
+AddressBookOperationResultCode AddressBookCloudUploader::finishUpload(
+    const std::string& cloudAddressBookId,
+    int& numBatches) {
+    auto pipelineResult = m_uploadPipeline->finish();
+
+    numBatches = pipelineResult.numBatches;
+    AACE_DEBUG(LX(TAG)
+                   .d("success", pipelineResult.success)
+                   .d("numBatches", pipelineResult.numBatches)
+                   .d("numRetries", pipelineResult.numRetries)
+                   .d("peakBatchesInFlight", pipelineResult.peakBatchesInFlight));
+    if (pipelineResult.success) {
+        return AddressBookOperationResultCode::SUCCESS;
     }
+
+    AddressBookOperationResultCode failureResult;
+    {
+        std::lock_guard<std::mutex> lock(m_batchResultMutex);
+        failureResult = m_batchFailureResult;
+    }
+    AACE_ERROR(LX(TAG, "finishUploadFailed")
+                   .d("failedBatch", pipelineResult.failedBatch)
+                   .d("result", failureResult));
+    handleError(cloudAddressBookId);
+    return failureResult;
 }
 
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleError(const std::string& cloudAddressBookId) {
@@ -1188,27 +1486,6 @@ AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleError(
     return UploadFlowState::FINISH;
 }
 
-AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleUploadEntries(
-    const std::string& addressBookId,
-    std::shared_ptr<rapidjson::Document> document,
-    HTTPResponse& httpResponse) {
-    try {
-        httpResponse = m_addressBookCloudUploaderRESTAgent->uploadDocumentToCloud(document, addressBookId);
-
-        switch (httpResponse.code) {
-            case HTTPResponseCode::SUCCESS_OK:
-                return UploadFlowState::PARSE;
-            default:
-                Throw("handleUploadEntriesFailed:" + responseCodeToString((HTTPResponseCode)httpResponse.code));
-                break;
-        }
-        return UploadFlowState::ERROR;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "handleUploadEntries").d("reason", ex.what()));
-        return UploadFlowState::ERROR;
-    }
-}
-
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleParseHTTPResponse(
     const HTTPResponse& httpResponse) {
     try {
@@ -265,26 +265,31 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     const std::string& url,
     const std::vector<std::string> headerLines,
     const std::string& data,
-    std::chrono::seconds timeout) {
+    std::chrono::seconds timeout,
+    int maxRetries) {
     AACE_DEBUG(LX(TAG));
     try {
         int retry = 0;
+        AddressBookCloudUploaderRESTAgent::HTTPResponse httpResponse;
         do {
             // Creating the HttpPost on every doPost ensures most updated curl options set in libCurlUtils are used.
             auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
             ThrowIfNull(httpPost, "nullHttpPost");
 
-            auto httpResponse = httpPost->doPost(url, headerLines, data, timeout);
+            httpResponse = httpPost->doPost(url, headerLines, data, timeout);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
-            ThrowIf(status == HTTPResponseResult::FAILED, "doPostFailed");
+            if (status == HTTPResponseResult::FAILED) {
+                AACE_ERROR(LX(TAG).d("reason", "doPostFailed").d("code", httpResponse.code));
+                return std::make_pair(false, httpResponse);
+            }
 
             if (status == HTTPResponseResult::SUCCESS) {
                 return std::make_pair(true, httpResponse);
             }
 
-            if (retry < HTTP_RETRY_COUNT) {
+            if (retry < maxRetries) {
                 std::unique_lock<std::mutex> lock(m_wakeMutex);
                 m_wake.wait_until(
                     lock, calculateTimeToRetry(retry++), [this] { return m_isShuttingDown ? true : false; });
@@ -299,8 +304,8 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
             }
         } while (true);
 
-        AACE_INFO(LX(TAG).m("exceededRetries"));
-        return std::make_pair(false, AddressBookCloudUploaderRESTAgent::HTTPResponse());
+        AACE_INFO(LX(TAG).m("exceededRetries").d("code", httpResponse.code));
+        return std::make_pair(false, httpResponse);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return std::make_pair(false, AddressBookCloudUploaderRESTAgent::HTTPResponse());
@@ -528,7 +533,7 @@ std::string AddressBookCloudUploaderRESTAgent::createAndGetCloudAddressBook(
         auto url =
             m_acmsEndpoint + FORWARD_SLASH + USERS_PATH + FORWARD_SLASH + getPceId() + FORWARD_SLASH + ADDRESSBOOK_PATH;
 
-        auto result = doPost(url, httpHeaderData, addressDataJson, DEFAULT_HTTP_TIMEOUT);
+        auto result = doPost(url, httpHeaderData, addressDataJson, DEFAULT_HTTP_TIMEOUT, HTTP_RETRY_COUNT);
 
         ThrowIfNot(result.first, "doPostFailed:" + responseCodeToString((HTTPResponseCode)result.second.code));
 
@@ -675,6 +680,12 @@ static int gzip(const std::string& bytes, std::string& gzipped) {
 AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::uploadDocumentToCloud(
     std::shared_ptr<rapidjson::Document> document,
     const std::string& cloudAddressBookId) {
+    return uploadEntriesToCloud(aace::engine::utils::json::toString(*document), cloudAddressBookId);
+}
+
+AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::uploadEntriesToCloud(
+    const std::string& content,
+    const std::string& cloudAddressBookId) {
     AACE_DEBUG(LX(TAG));
     try {
         auto httpHeaderData = buildCommonHTTPHeader();
@@ -685,12 +696,10 @@ AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgen
         }
         httpHeaderData.insert(httpHeaderData.end(), CONTENT_TYPE_APPLICATION_JSON);
 
-        auto content = aace::engine::utils::json::toString(*document);
         std::string gzipped;
         int ret = gzip(content, gzipped);
         if (ret == Z_OK) {
             httpHeaderData.insert(httpHeaderData.end(), "Content-Encoding: gzip");
-            content = std::move(gzipped);
         } else {
             AACE_ERROR(LX(TAG, "failedToCompressContent").d("error", ret));
         }
@@ -698,9 +707,14 @@ AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgen
         auto url = m_acmsEndpoint + FORWARD_SLASH + USERS_PATH + FORWARD_SLASH + getPceId() + FORWARD_SLASH +
                    ADDRESSBOOK_PATH + FORWARD_SLASH + cloudAddressBookId + FORWARD_SLASH + ENTRIES_PATH;
 
-        auto result = doPost(url, httpHeaderData, content, DEFAULT_HTTP_TIMEOUT);
-
-        ThrowIfNot(result.first, "doPostFailed:" + responseCodeToString((HTTPResponseCode)result.second.code));
+        // Batches are resent by the upload pipeline, so a single attempt is made here and the response
+        // is returned as received, including client and server errors.
+        auto result = doPost(url, httpHeaderData, ret == Z_OK ? gzipped : content, DEFAULT_HTTP_TIMEOUT, 0);
+        if (!result.first) {
+            AACE_WARN(LX(TAG)
+                          .m("uploadEntriesFailed")
+                          .d("code", responseCodeToString((HTTPResponseCode)result.second.code)));
+        }
 
         return result.second;
 
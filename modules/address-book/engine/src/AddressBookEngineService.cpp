@@ -21,6 +21,7 @@
 #include <AACE/Engine/Alexa/AlexaEngineService.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Network/NetworkEngineService.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 
 #include <AACE/Engine/AddressBook/AddressBookEngineService.h>
 
@@ -35,7 +36,9 @@ static const std::string TAG("aace.addressBook.addressBookEngineService");
 REGISTER_SERVICE(AddressBookEngineService);
 
 AddressBookEngineService::AddressBookEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description), m_cleanAllAddressBooksAtStart(true) {
+        aace::engine::core::EngineService(description),
+        m_cleanAllAddressBooksAtStart(true),
+        m_maxUploadBatchesInFlight(AddressBookUploadPipeline::DEFAULT_MAX_BATCHES_IN_FLIGHT) {
 }
 
 AddressBookEngineService::~AddressBookEngineService() = default;
@@ -68,6 +71,18 @@ bool AddressBookEngineService::configure(std::shared_ptr<std::istream> configura
     try {
         auto config = nlohmann::json::parse(*configuration);
         m_cleanAllAddressBooksAtStart = config.value("cleanAllAddressBooksAtStart", m_cleanAllAddressBooksAtStart);
+        if (config.contains("maxUploadBatchesInFlight")) {
+            auto maxUploadBatchesInFlight = config["maxUploadBatchesInFlight"];
+            if (maxUploadBatchesInFlight.is_number_unsigned() && maxUploadBatchesInFlight.get<size_t>() >= 1 &&
+                maxUploadBatchesInFlight.get<size_t>() <= AddressBookUploadPipeline::MAX_BATCHES_IN_FLIGHT_LIMIT) {
+                m_maxUploadBatchesInFlight = maxUploadBatchesInFlight.get<size_t>();
+            } else {
+                AACE_WARN(LX(TAG)
+                              .m("invalidMaxUploadBatchesInFlight")
+                              .d("value", maxUploadBatchesInFlight.dump())
+                              .d("default", m_maxUploadBatchesInFlight));
+            }
+        }
     } catch (nlohmann::json::parse_error& ex) {
         AACE_ERROR(LX(TAG).m("configuration is not valid JSON").d("exception", ex.what()));
         return false;
@@ -120,6 +135,10 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::metrics::MetricRecorderServiceInterface>("aace.metrics");
         ThrowIfNull(metricService, "MetricRecorderServiceInterface is null");
 
+        // local storage is optional, without it every address book is uploaded in full
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+
         m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
             m_addressBookEngineImpl,
             authDelegate,
@@ -128,7 +147,9 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             networkObserver,
             alexaEndpoints,
             metricService,
-            m_cleanAllAddressBooksAtStart);
+            m_cleanAllAddressBooksAtStart,
+            localStorage,
+            m_maxUploadBatchesInFlight);
         ThrowIfNull(m_addressBookCloudUploader, "createAddressBookCloudUploaderFailed");
 
         // set the engine interface reference
@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/AddressBook/AddressBookSyncIndex.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.addressBook.addressBookSyncIndex");
+
+/// Local storage table holding the sync index
+static const std::string SYNC_INDEX_TABLE = "aace.addressBook.syncIndex";
+
+/// Version of the persisted snapshot format
+static const int SYNC_INDEX_VERSION = 1;
+
+/// FNV-1a 64-bit offset basis
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+/// FNV-1a 64-bit prime
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+using json = nlohmann::json;
+
+AddressBookSyncIndex::AddressBookSyncIndex(std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) :
+        m_localStorage(std::move(localStorage)) {
+}
+
+std::shared_ptr<AddressBookSyncIndex> AddressBookSyncIndex::create(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) {
+    try {
+        ThrowIfNull(localStorage, "invalidLocalStorage");
+        return std::shared_ptr<AddressBookSyncIndex>(new AddressBookSyncIndex(localStorage));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+bool AddressBookSyncIndex::load(const std::string& addressBookType, Snapshot& snapshot) {
+    try {
+        std::string value;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ReturnIfNot(m_localStorage->containsKey(SYNC_INDEX_TABLE, addressBookType), false);
+            value = m_localStorage->get(SYNC_INDEX_TABLE, addressBookType);
+        }
+        auto index = json::parse(value);
+        ThrowIfNot(index.value("version", 0) == SYNC_INDEX_VERSION, "unsupportedVersion");
+        ThrowIfNot(index.contains("sourceId") && index["sourceId"].is_string(), "invalidSourceId");
+        ThrowIfNot(
+            index.contains("cloudAddressBookId") && index["cloudAddressBookId"].is_string(),
+            "invalidCloudAddressBookId");
+        ThrowIfNot(index.contains("entries") && index["entries"].is_object(), "invalidEntries");
+
+        snapshot.sourceId = index["sourceId"];
+        snapshot.cloudAddressBookId = index["cloudAddressBookId"];
+        snapshot.entries.clear();
+        snapshot.entries.reserve(index["entries"].size());
+        for (auto& entry : index["entries"].items()) {
+            ThrowIfNot(entry.value().is_number_unsigned(), "invalidEntryHash");
+            snapshot.entries.emplace(entry.key(), entry.value().get<uint64_t>());
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG, "load").d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookSyncIndex::save(const std::string& addressBookType, const Snapshot& snapshot) {
+    try {
+        json entries = json::object();
+        for (auto& entry : snapshot.entries) {
+            entries[entry.first] = entry.second;
+        }
+        json index = {{"version", SYNC_INDEX_VERSION},
+                      {"sourceId", snapshot.sourceId},
+                      {"cloudAddressBookId", snapshot.cloudAddressBookId},
+                      {"entries", std::move(entries)}};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ThrowIfNot(m_localStorage->put(SYNC_INDEX_TABLE, addressBookType, index.dump()), "putFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "save").d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookSyncIndex::remove(const std::string& addressBookType) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_localStorage->containsKey(SYNC_INDEX_TABLE, addressBookType)) {
+            ThrowIfNot(m_localStorage->removeKey(SYNC_INDEX_TABLE, addressBookType), "removeKeyFailed");
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "remove").d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+uint64_t AddressBookSyncIndex::hash(const char* data, size_t length) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+AddressBookSyncIndex::Delta AddressBookSyncIndex::diff(const EntryHashes& previous, const EntryHashes& current) {
+    Delta delta;
+    for (auto& entry : current) {
+        auto it = previous.find(entry.first);
+        if (it == previous.end()) {
+            delta.added.push_back(entry.first);
+        } else if (it->second != entry.second) {
+            delta.changed.push_back(entry.first);
+        }
+    }
+    for (auto& entry : previous) {
+        if (current.find(entry.first) == current.end()) {
+            delta.removed.push_back(entry.first);
+        }
+    }
+    return delta;
+}
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
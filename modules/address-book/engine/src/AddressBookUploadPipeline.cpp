@@ -0,0 +1,229 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <AACE/Engine/AddressBook/AddressBookUploadPipeline.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.addressBook.addressBookUploadPipeline");
+
+constexpr size_t AddressBookUploadPipeline::DEFAULT_MAX_BATCHES_IN_FLIGHT;
+constexpr size_t AddressBookUploadPipeline::MAX_BATCHES_IN_FLIGHT_LIMIT;
+
+/// Response code reported when a request could not be sent
+static const long HTTP_RESPONSE_CODE_UNDEFINED = 0;
+
+/// Response code of an accepted batch
+static const long HTTP_RESPONSE_CODE_SUCCESS_OK = 200;
+
+/// Range of server error response codes
+static const long HTTP_RESPONSE_CODE_SERVER_ERROR_START = 500;
+static const long HTTP_RESPONSE_CODE_SERVER_ERROR_END = 599;
+
+AddressBookUploadPipeline::AddressBookUploadPipeline(const Configuration& configuration) :
+        m_configuration(configuration),
+        m_isCancelled(false),
+        m_isProducing(false),
+        m_hasFailed(false),
+        m_failedBatch(std::numeric_limits<size_t>::max()),
+        m_numBatches(0),
+        m_numRetries(0),
+        m_batchesInFlight(0),
+        m_peakBatchesInFlight(0) {
+    m_configuration.maxBatchesInFlight =
+        std::min(std::max(m_configuration.maxBatchesInFlight, static_cast<size_t>(1)), MAX_BATCHES_IN_FLIGHT_LIMIT);
+}
+
+AddressBookUploadPipeline::~AddressBookUploadPipeline() {
+    if (!m_workers.empty()) {
+        cancel();
+        finish();
+    }
+}
+
+AddressBookUploadPipeline::SendResult AddressBookUploadPipeline::getSendResult(long httpResponseCode) {
+    if (httpResponseCode == HTTP_RESPONSE_CODE_SUCCESS_OK) {
+        return SendResult::SUCCESS;
+    }
+    if (httpResponseCode == HTTP_RESPONSE_CODE_UNDEFINED ||
+        (httpResponseCode >= HTTP_RESPONSE_CODE_SERVER_ERROR_START &&
+         httpResponseCode <= HTTP_RESPONSE_CODE_SERVER_ERROR_END)) {
+        return SendResult::RETRY;
+    }
+    return SendResult::FAILURE;
+}
+
+void AddressBookUploadPipeline::cancel() {
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    m_isCancelled = true;
+    m_cancelled.notify_all();
+    // wake a producer waiting for a free buffer
+    std::lock_guard<std::mutex> stateLock(m_mutex);
+    m_stateChanged.notify_all();
+}
+
+bool AddressBookUploadPipeline::waitForRetry(unsigned int retry) {
+    auto backoff = m_configuration.initialBackoff * (static_cast<int64_t>(1) << std::min(retry, 16u));
+    backoff = std::min(backoff, m_configuration.maxBackoff);
+    std::unique_lock<std::mutex> lock(m_cancelMutex);
+    return !m_cancelled.wait_for(lock, backoff, [this] { return m_isCancelled.load(); });
+}
+
+AddressBookUploadPipeline::SendResult AddressBookUploadPipeline::sendBatch(const std::string& content) {
+    try {
+        return m_sender(content);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "sendBatch").d("reason", ex.what()));
+        return SendResult::FAILURE;
+    }
+}
+
+void AddressBookUploadPipeline::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_stateChanged.wait(lock, [this] { return !m_pendingBatches.empty() || !m_isProducing; });
+        if (m_pendingBatches.empty()) {
+            return;
+        }
+        auto batch = m_pendingBatches.front();
+        m_pendingBatches.pop_front();
+        if (m_hasFailed || m_isCancelled) {
+            m_freeBuffers.push_back(batch.second);
+            m_stateChanged.notify_all();
+            continue;
+        }
+        m_peakBatchesInFlight = std::max(m_peakBatchesInFlight, ++m_batchesInFlight);
+        lock.unlock();
+
+        const auto& content = m_buffers[batch.second];
+        auto result = sendBatch(content);
+        unsigned int retry = 0;
+        while (result == SendResult::RETRY && retry < m_configuration.maxRetries && waitForRetry(retry)) {
+            AACE_DEBUG(LX(TAG).m("retryingBatch").d("batch", batch.first).d("retry", retry + 1));
+            retry++;
+            result = sendBatch(content);
+        }
+
+        lock.lock();
+        m_batchesInFlight--;
+        m_numRetries += retry;
+        if (result != SendResult::SUCCESS) {
+            AACE_WARN(LX(TAG).m("batchFailed").d("batch", batch.first).d("retries", retry));
+            m_hasFailed = true;
+            m_failedBatch = std::min(m_failedBatch, batch.first);
+        }
+        m_freeBuffers.push_back(batch.second);
+        m_stateChanged.notify_all();
+    }
+}
+
+void AddressBookUploadPipeline::begin(const BatchSender& sender) {
+    const size_t window = m_configuration.maxBatchesInFlight;
+
+    m_sender = sender;
+    m_buffers.assign(window, std::string());
+    m_freeBuffers.clear();
+    for (size_t buffer = 0; buffer < window; buffer++) {
+        m_freeBuffers.push_back(buffer);
+    }
+    m_pendingBatches.clear();
+    m_isProducing = true;
+    m_hasFailed = false;
+    m_failedBatch = std::numeric_limits<size_t>::max();
+    m_numBatches = 0;
+    m_numRetries = 0;
+    m_batchesInFlight = 0;
+    m_peakBatchesInFlight = 0;
+
+    for (size_t i = 0; i < window; i++) {
+        m_workers.emplace_back(&AddressBookUploadPipeline::workerLoop, this);
+    }
+}
+
+bool AddressBookUploadPipeline::submit(const BatchProducer& producer) {
+    size_t buffer;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stateChanged.wait(lock, [this] { return !m_freeBuffers.empty() || m_hasFailed || m_isCancelled; });
+        if (m_hasFailed || m_isCancelled) {
+            return false;
+        }
+        buffer = m_freeBuffers.front();
+        m_freeBuffers.pop_front();
+    }
+
+    m_buffers[buffer].clear();
+    bool produced = false;
+    try {
+        produced = producer(m_buffers[buffer]);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "produceBatch").d("reason", ex.what()));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hasFailed = true;
+        m_failedBatch = std::min(m_failedBatch, m_numBatches);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!produced) {
+        m_freeBuffers.push_back(buffer);
+        m_stateChanged.notify_all();
+        return false;
+    }
+    m_pendingBatches.emplace_back(m_numBatches++, buffer);
+    m_stateChanged.notify_all();
+    return true;
+}
+
+AddressBookUploadPipeline::Result AddressBookUploadPipeline::finish() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isProducing = false;
+        m_stateChanged.notify_all();
+    }
+    for (auto& thread : m_workers) {
+        thread.join();
+    }
+    m_workers.clear();
+    m_buffers.clear();
+    m_sender = nullptr;
+
+    Result result;
+    result.success = !m_hasFailed && !m_isCancelled;
+    result.numBatches = m_numBatches;
+    result.failedBatch = m_hasFailed ? m_failedBatch : m_numBatches;
+    result.numRetries = m_numRetries;
+    result.peakBatchesInFlight = m_peakBatchesInFlight;
+    return result;
+}
+
+AddressBookUploadPipeline::Result AddressBookUploadPipeline::run(
+    const BatchProducer& producer,
+    const BatchSender& sender) {
+    begin(sender);
+    while (submit(producer)) {
+    }
+    return finish();
+}
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,140 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/AddressBook/AddressBookSyncIndex.h>
+
+using namespace aace::engine::addressBook;
+
+static const std::string CONTACT_ADDRESS_BOOK_TYPE = "automotive";
+
+/// In memory @c LocalStorageInterface
+class InMemoryLocalStorage : public aace::engine::storage::LocalStorageInterface {
+public:
+    bool put(const std::string& table, const std::string& key, const std::string& value) override {
+        m_tables[table][key] = value;
+        return true;
+    }
+    std::string get(const std::string& table, const std::string& key) override {
+        return m_tables[table][key];
+    }
+    std::string get(const std::string& table, const std::string& key, const std::string& defaultValue) override {
+        return containsKey(table, key) ? m_tables[table][key] : defaultValue;
+    }
+    bool removeKey(const std::string& table, const std::string& key) override {
+        return m_tables[table].erase(key) == 1;
+    }
+    bool removeTable(const std::string& table) override {
+        return m_tables.erase(table) == 1;
+    }
+    bool containsKey(const std::string& table, const std::string& key) override {
+        auto it = m_tables.find(table);
+        return it != m_tables.end() && it->second.find(key) != it->second.end();
+    }
+    bool containsTable(const std::string& table) override {
+        return m_tables.find(table) != m_tables.end();
+    }
+    std::vector<std::string> keys(const std::string& table) override {
+        std::vector<std::string> keys;
+        for (auto& item : m_tables[table]) {
+            keys.push_back(item.first);
+        }
+        return keys;
+    }
+    std::vector<KeyValuePair> list(const std::string& table) override {
+        return std::vector<KeyValuePair>(m_tables[table].begin(), m_tables[table].end());
+    }
+    bool begin() override {
+        return true;
+    }
+    bool commit() override {
+        return true;
+    }
+    bool cancel() override {
+        return true;
+    }
+
+    std::map<std::string, std::map<std::string, std::string>> m_tables;
+};
+
+class AddressBookSyncIndexTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_localStorage = std::make_shared<InMemoryLocalStorage>();
+        m_syncIndex = AddressBookSyncIndex::create(m_localStorage);
+    }
+
+    static uint64_t hashOf(const std::string& content) {
+        return AddressBookSyncIndex::hash(content.data(), content.size());
+    }
+
+    std::shared_ptr<InMemoryLocalStorage> m_localStorage;
+    std::shared_ptr<AddressBookSyncIndex> m_syncIndex;
+};
+
+TEST_F(AddressBookSyncIndexTest, createWithNullLocalStorageFails) {
+    EXPECT_EQ(nullptr, AddressBookSyncIndex::create(nullptr));
+}
+
+TEST_F(AddressBookSyncIndexTest, loadWithoutSnapshotFails) {
+    ASSERT_NE(nullptr, m_syncIndex);
+    AddressBookSyncIndex::Snapshot snapshot;
+    EXPECT_FALSE(m_syncIndex->load(CONTACT_ADDRESS_BOOK_TYPE, snapshot));
+}
+
+TEST_F(AddressBookSyncIndexTest, saveAndLoadSnapshot) {
+    ASSERT_NE(nullptr, m_syncIndex);
+    AddressBookSyncIndex::Snapshot saved{"1000", "cloud-id", {{"1", hashOf("a")}, {"2", UINT64_MAX}}};
+    ASSERT_TRUE(m_syncIndex->save(CONTACT_ADDRESS_BOOK_TYPE, saved));
+
+    AddressBookSyncIndex::Snapshot loaded;
+    ASSERT_TRUE(m_syncIndex->load(CONTACT_ADDRESS_BOOK_TYPE, loaded));
+    EXPECT_EQ("1000", loaded.sourceId);
+    EXPECT_EQ("cloud-id", loaded.cloudAddressBookId);
+    EXPECT_EQ(saved.entries, loaded.entries);
+
+    ASSERT_TRUE(m_syncIndex->remove(CONTACT_ADDRESS_BOOK_TYPE));
+    EXPECT_FALSE(m_syncIndex->load(CONTACT_ADDRESS_BOOK_TYPE, loaded));
+    EXPECT_TRUE(m_syncIndex->remove(CONTACT_ADDRESS_BOOK_TYPE));
+}
+
+TEST_F(AddressBookSyncIndexTest, loadCorruptSnapshotFails) {
+    ASSERT_NE(nullptr, m_syncIndex);
+    m_localStorage->put("aace.addressBook.syncIndex", CONTACT_ADDRESS_BOOK_TYPE, "{\"version\":1,\"entries\":[]}");
+    AddressBookSyncIndex::Snapshot snapshot;
+    EXPECT_FALSE(m_syncIndex->load(CONTACT_ADDRESS_BOOK_TYPE, snapshot));
+}
+
+TEST_F(AddressBookSyncIndexTest, hashDependsOnContent) {
+    EXPECT_EQ(hashOf("{\"entrySourceId\":\"1\"}"), hashOf("{\"entrySourceId\":\"1\"}"));
+    EXPECT_NE(hashOf("{\"entrySourceId\":\"1\"}"), hashOf("{\"entrySourceId\":\"2\"}"));
+}
+
+TEST_F(AddressBookSyncIndexTest, diffReportsAddedChangedAndRemovedEntries) {
+    AddressBookSyncIndex::EntryHashes previous = {{"1", 1}, {"2", 2}, {"3", 3}};
+    AddressBookSyncIndex::EntryHashes current = {{"1", 1}, {"2", 20}, {"4", 4}};
+
+    auto delta = AddressBookSyncIndex::diff(previous, current);
+    EXPECT_FALSE(delta.isEmpty());
+    EXPECT_EQ(std::vector<std::string>{"4"}, delta.added);
+    EXPECT_EQ(std::vector<std::string>{"2"}, delta.changed);
+    EXPECT_EQ(std::vector<std::string>{"3"}, delta.removed);
+
+    EXPECT_TRUE(AddressBookSyncIndex::diff(current, current).isEmpty());
+}
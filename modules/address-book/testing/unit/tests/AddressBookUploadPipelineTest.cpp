@@ -0,0 +1,541 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
+#include <AVSCommon/Utils/DeviceInfo.h>
+
+#include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/AddressBook/AddressBookCloudUploaderRESTAgent.h>
+#include <AACE/Engine/AddressBook/AddressBookUploadPipeline.h>
+
+using namespace aace::engine::addressBook;
+
+using SendResult = AddressBookUploadPipeline::SendResult;
+
+/// Number of entries per batch, matching the cloud uploader
+static const size_t BATCH_SIZE = 100;
+
+/// Simulated round trip time of the loopback endpoint
+static const std::chrono::milliseconds ENDPOINT_LATENCY(5);
+
+/// Mock token to be returned by @c getAuthToken
+static const std::string AUTH_TOKEN = "MockAuthToken";
+
+/// Cloud address book the batches are uploaded to
+static const std::string CLOUD_ADDRESS_BOOK_ID = "MockCloudAddressBookId";
+
+// clang-format off
+static const std::string CONFIG_JSON =
+    "{"
+    "    \"deviceInfo\":{"
+    "        \"deviceSerialNumber\":\"MockAddressBookTest\", "
+    "        \"clientId\":\"MockClientId\","
+    "        \"productId\":\"MockProductID\","
+    "        \"manufacturerName\":\"MockManufacturerName\","
+    "        \"description\":\"MockDescription\""
+    "    }"
+    " }";
+// clang-format on
+
+static AddressBookUploadPipeline::Configuration makeConfiguration(size_t maxBatchesInFlight) {
+    return {maxBatchesInFlight, 2, std::chrono::milliseconds(1), std::chrono::milliseconds(4)};
+}
+
+class MockAuthDelegateInterface : public alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface {
+public:
+    MOCK_METHOD1(
+        addAuthObserver,
+        void(std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface> observer));
+    MOCK_METHOD1(
+        removeAuthObserver,
+        void(std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface> observer));
+    MOCK_METHOD0(getAuthToken, std::string());
+    MOCK_METHOD1(onAuthFailure, void(const std::string& token));
+};
+
+class LoopbackAlexaEndpointInterface : public aace::engine::alexa::AlexaEndpointInterface {
+public:
+    LoopbackAlexaEndpointInterface(const std::string& acmsEndpoint) : m_acmsEndpoint(acmsEndpoint) {
+    }
+    std::string getAVSGateway() override {
+        // Not called.
+        return "";
+    }
+    std::string getLWAEndpoint() override {
+        // Not called.
+        return "";
+    }
+    std::string getACMSEndpoint() override {
+        return m_acmsEndpoint;
+    }
+    std::string getFeatureDiscoveryEndpoint() override {
+        return "";
+    }
+
+private:
+    std::string m_acmsEndpoint;
+};
+
+/// Produces batches of synthetic contact entries, converting each entry only when its batch is requested.
+class ContactBatchProducer {
+public:
+    ContactBatchProducer(size_t numEntries) : m_numEntries(numEntries), m_nextEntry(0) {
+    }
+
+    bool operator()(std::string& content) {
+        if (m_nextEntry >= m_numEntries) {
+            return false;
+        }
+        auto end = std::min(m_nextEntry + BATCH_SIZE, m_numEntries);
+        content.append("{\"entries\":[");
+        for (auto entry = m_nextEntry; entry < end; entry++) {
+            if (entry != m_nextEntry) {
+                content.push_back(',');
+            }
+            auto id = std::to_string(entry);
+            content.append("{\"entrySourceId\":\"" + id + "\",\"data\":{\"name\":{\"firstName\":\"First" + id +
+                           "\",\"lastName\":\"Last" + id +
+                           "\"},\"addresses\":[{\"addressType\":\"phonenumber\",\"rawType\":\"mobile\",\"value\":\"+1555" +
+                           id + "\"}]}}");
+        }
+        content.append("]}");
+        m_nextEntry = end;
+        return true;
+    }
+
+private:
+    size_t m_numEntries;
+    size_t m_nextEntry;
+};
+
+/**
+ * Stand-in for the cloud entries endpoint: an HTTP/1.1 server on the loopback interface that answers
+ * each request after @c ENDPOINT_LATENCY with the next configured status code.
+ */
+class LoopbackEndpoint {
+public:
+    LoopbackEndpoint() : m_listenSocket(-1), m_port(0) {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (m_listenSocket < 0 || bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            listen(m_listenSocket, SOMAXCONN) != 0 ||
+            getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            ADD_FAILURE() << "Failed to start the loopback endpoint: " << std::strerror(errno);
+            return;
+        }
+        m_port = ntohs(address.sin_port);
+        m_acceptThread = std::thread(&LoopbackEndpoint::acceptLoop, this);
+    }
+
+    ~LoopbackEndpoint() {
+        if (m_listenSocket >= 0) {
+            ::shutdown(m_listenSocket, SHUT_RDWR);
+            close(m_listenSocket);
+        }
+        if (m_acceptThread.joinable()) {
+            m_acceptThread.join();
+        }
+        for (auto& thread : m_connectionThreads) {
+            thread.join();
+        }
+    }
+
+    std::string getUrl() const {
+        return "http://127.0.0.1:" + std::to_string(m_port);
+    }
+
+    /// Answer the next requests with @c statusCodes in order, and any further request with the last one.
+    void setStatusCodes(const std::deque<long>& statusCodes) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statusCodes = statusCodes;
+    }
+
+    size_t getNumRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numRequests;
+    }
+
+    int getPeakRequestsInFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_peakRequestsInFlight;
+    }
+
+    size_t getPeakRequestBytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_peakRequestBytes;
+    }
+
+private:
+    void acceptLoop() {
+        while (true) {
+            int connection = accept(m_listenSocket, nullptr, nullptr);
+            if (connection < 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_connectionThreads.emplace_back(&LoopbackEndpoint::handleConnection, this, connection);
+        }
+    }
+
+    static bool writeAll(int connection, const std::string& data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            auto result = send(connection, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return false;
+            }
+            written += result;
+        }
+        return true;
+    }
+
+    /// Return the value of a header from lowercased request headers, or an empty string.
+    static std::string getHeader(const std::string& headers, const std::string& name) {
+        auto start = headers.find("\r\n" + name + ":");
+        if (start == std::string::npos) {
+            return "";
+        }
+        start += name.size() + 3;
+        auto end = headers.find("\r\n", start);
+        auto value = headers.substr(start, end - start);
+        value.erase(0, value.find_first_not_of(' '));
+        return value;
+    }
+
+    void handleConnection(int connection) {
+        std::string request;
+        char buffer[16384];
+        size_t headerEnd = std::string::npos;
+        while (headerEnd == std::string::npos) {
+            auto received = recv(connection, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                close(connection);
+                return;
+            }
+            request.append(buffer, received);
+            headerEnd = request.find("\r\n\r\n");
+        }
+
+        auto headers = request.substr(0, headerEnd);
+        std::transform(headers.begin(), headers.end(), headers.begin(), ::tolower);
+        auto contentLength = getHeader(headers, "content-length");
+        size_t bodyLength = contentLength.empty() ? 0 : std::stoul(contentLength);
+        if (getHeader(headers, "expect") == "100-continue") {
+            writeAll(connection, "HTTP/1.1 100 Continue\r\n\r\n");
+        }
+        size_t bodyReceived = request.size() - headerEnd - 4;
+        while (bodyReceived < bodyLength) {
+            auto received = recv(connection, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                close(connection);
+                return;
+            }
+            bodyReceived += received;
+        }
+
+        long statusCode;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_numRequests++;
+            m_peakRequestsInFlight = std::max(m_peakRequestsInFlight, ++m_requestsInFlight);
+            m_peakRequestBytes = std::max(m_peakRequestBytes, bodyLength);
+            statusCode = m_statusCodes.empty() ? 200 : m_statusCodes.front();
+            if (m_statusCodes.size() > 1) {
+                m_statusCodes.pop_front();
+            }
+        }
+        std::this_thread::sleep_for(ENDPOINT_LATENCY);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requestsInFlight--;
+        }
+
+        std::ostringstream response;
+        response << "HTTP/1.1 " << statusCode << " Status\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        writeAll(connection, response.str());
+        close(connection);
+    }
+
+    int m_listenSocket;
+    int m_port;
+    std::thread m_acceptThread;
+    std::mutex m_mutex;
+    std::vector<std::thread> m_connectionThreads;
+    std::deque<long> m_statusCodes;
+    size_t m_numRequests = 0;
+    int m_requestsInFlight = 0;
+    int m_peakRequestsInFlight = 0;
+    size_t m_peakRequestBytes = 0;
+};
+
+static long getPeakRssKilobytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+class AddressBookUploadPipelineTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto inString = std::shared_ptr<std::istringstream>(new std::istringstream(CONFIG_JSON));
+        alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize({inString});
+
+        auto mockAuthDelegate = std::make_shared<testing::NiceMock<MockAuthDelegateInterface>>();
+        ON_CALL(*mockAuthDelegate, getAuthToken()).WillByDefault(testing::Return(AUTH_TOKEN));
+        auto deviceInfo = alexaClientSDK::avsCommon::utils::DeviceInfo::create(
+            alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot());
+
+        m_restAgent = AddressBookCloudUploaderRESTAgent::create(
+            mockAuthDelegate, deviceInfo, std::make_shared<LoopbackAlexaEndpointInterface>(m_endpoint.getUrl()));
+        ASSERT_NE(nullptr, m_restAgent);
+    }
+
+    void TearDown() override {
+        if (m_restAgent != nullptr) {
+            m_restAgent->shutdown();
+        }
+        if (alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::isInitialized()) {
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+        }
+    }
+
+    /// Sends a batch to the loopback endpoint the way the cloud uploader does.
+    SendResult sendToEndpoint(const std::string& content) {
+        auto response = m_restAgent->uploadEntriesToCloud(content, CLOUD_ADDRESS_BOOK_ID);
+        return AddressBookUploadPipeline::getSendResult(response.code);
+    }
+
+    /// Upload @c numEntries contacts to the loopback endpoint and return the elapsed time.
+    std::chrono::milliseconds upload(size_t numEntries, size_t maxBatchesInFlight) {
+        AddressBookUploadPipeline pipeline(makeConfiguration(maxBatchesInFlight));
+        ContactBatchProducer producer(numEntries);
+        auto requestsBefore = m_endpoint.getNumRequests();
+
+        auto start = std::chrono::steady_clock::now();
+        auto result = pipeline.run(std::ref(producer), [this](const std::string& content) {
+            return sendToEndpoint(content);
+        });
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        size_t expectedBatches = (numEntries + BATCH_SIZE - 1) / BATCH_SIZE;
+        EXPECT_TRUE(result.success);
+        EXPECT_EQ(expectedBatches, result.numBatches);
+        EXPECT_EQ(expectedBatches, m_endpoint.getNumRequests() - requestsBefore);
+        EXPECT_LE(result.peakBatchesInFlight, maxBatchesInFlight);
+
+        std::string prefix = "upload_" + std::to_string(numEntries) + "_window_" + std::to_string(maxBatchesInFlight);
+        RecordProperty(prefix + "_ms", static_cast<int>(elapsed.count()));
+        RecordProperty(prefix + "_peak_request_bytes", static_cast<int>(m_endpoint.getPeakRequestBytes()));
+        RecordProperty(prefix + "_peak_rss_kb", static_cast<int>(getPeakRssKilobytes()));
+        return elapsed;
+    }
+
+    /// Upload a single batch to the loopback endpoint.
+    AddressBookUploadPipeline::Result uploadSingleBatch() {
+        AddressBookUploadPipeline pipeline(makeConfiguration(1));
+        ContactBatchProducer producer(BATCH_SIZE);
+        return pipeline.run(std::ref(producer), [this](const std::string& content) {
+            return sendToEndpoint(content);
+        });
+    }
+
+    LoopbackEndpoint m_endpoint;
+    std::shared_ptr<AddressBookCloudUploaderRESTAgent> m_restAgent;
+};
+
+TEST(AddressBookUploadPipelineSendResultTest, onlyNetworkAndServerErrorsAreRetried) {
+    EXPECT_EQ(SendResult::SUCCESS, AddressBookUploadPipeline::getSendResult(200));
+    EXPECT_EQ(SendResult::RETRY, AddressBookUploadPipeline::getSendResult(0));
+    EXPECT_EQ(SendResult::RETRY, AddressBookUploadPipeline::getSendResult(500));
+    EXPECT_EQ(SendResult::RETRY, AddressBookUploadPipeline::getSendResult(503));
+    EXPECT_EQ(SendResult::FAILURE, AddressBookUploadPipeline::getSendResult(204));
+    EXPECT_EQ(SendResult::FAILURE, AddressBookUploadPipeline::getSendResult(400));
+    EXPECT_EQ(SendResult::FAILURE, AddressBookUploadPipeline::getSendResult(403));
+    EXPECT_EQ(SendResult::FAILURE, AddressBookUploadPipeline::getSendResult(429));
+}
+
+TEST_F(AddressBookUploadPipelineTest, singleBatchInFlightSendsBatchesInOrder) {
+    AddressBookUploadPipeline pipeline(makeConfiguration(1));
+    int next = 0;
+    std::vector<std::string> sent;
+    auto result = pipeline.run(
+        [&next](std::string& content) {
+            if (next == 5) {
+                return false;
+            }
+            content = std::to_string(next++);
+            return true;
+        },
+        [&sent](const std::string& content) {
+            sent.push_back(content);
+            return SendResult::SUCCESS;
+        });
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(5u, result.numBatches);
+    EXPECT_EQ((std::vector<std::string>{"0", "1", "2", "3", "4"}), sent);
+}
+
+TEST_F(AddressBookUploadPipelineTest, emptyProducerSendsNothing) {
+    AddressBookUploadPipeline pipeline(makeConfiguration(4));
+    std::atomic<int> sends{0};
+    auto result = pipeline.run([](std::string&) { return false; }, [&sends](const std::string&) {
+        sends++;
+        return SendResult::SUCCESS;
+    });
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(0u, result.numBatches);
+    EXPECT_EQ(0, sends);
+}
+
+TEST_F(AddressBookUploadPipelineTest, retryableErrorIsResent) {
+    AddressBookUploadPipeline pipeline(makeConfiguration(2));
+    int next = 0;
+    std::mutex mutex;
+    std::set<std::string> failedOnce;
+    auto result = pipeline.run(
+        [&next](std::string& content) {
+            if (next == 4) {
+                return false;
+            }
+            content = std::to_string(next++);
+            return true;
+        },
+        [&](const std::string& content) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return failedOnce.insert(content).second ? SendResult::RETRY : SendResult::SUCCESS;
+        });
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(4u, result.numBatches);
+    EXPECT_EQ(4u, result.numRetries);
+}
+
+TEST_F(AddressBookUploadPipelineTest, permanentFailureStopsProduction) {
+    AddressBookUploadPipeline pipeline(makeConfiguration(1));
+    int next = 0;
+    auto result = pipeline.run(
+        [&next](std::string& content) {
+            content = std::to_string(next++);
+            return true;
+        },
+        [](const std::string& content) { return content == "3" ? SendResult::FAILURE : SendResult::SUCCESS; });
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(3u, result.failedBatch);
+    EXPECT_LE(result.numBatches, 5u) << "Production must stop shortly after the failure";
+}
+
+TEST_F(AddressBookUploadPipelineTest, exhaustedRetriesFail) {
+    AddressBookUploadPipeline pipeline(makeConfiguration(1));
+    bool produced = false;
+    int sends = 0;
+    auto result = pipeline.run(
+        [&produced](std::string& content) {
+            if (produced) {
+                return false;
+            }
+            produced = true;
+            content = "0";
+            return true;
+        },
+        [&sends](const std::string&) {
+            sends++;
+            return SendResult::RETRY;
+        });
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(0u, result.failedBatch);
+    EXPECT_EQ(3, sends) << "One send and two retries";
+}
+
+TEST_F(AddressBookUploadPipelineTest, cancelInterruptsUpload) {
+    AddressBookUploadPipeline pipeline({1, 10, std::chrono::milliseconds(10000), std::chrono::milliseconds(10000)});
+    std::thread canceller([&pipeline] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        pipeline.cancel();
+    });
+    auto start = std::chrono::steady_clock::now();
+    auto result = pipeline.run(
+        [](std::string& content) {
+            content = "batch";
+            return true;
+        },
+        [](const std::string&) { return SendResult::RETRY; });
+    canceller.join();
+    EXPECT_FALSE(result.success);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(AddressBookUploadPipelineTest, clientErrorIsNotRetried) {
+    m_endpoint.setStatusCodes({400});
+    auto result = uploadSingleBatch();
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(0u, result.numRetries);
+    EXPECT_EQ(1u, m_endpoint.getNumRequests());
+}
+
+TEST_F(AddressBookUploadPipelineTest, throttlingIsNotRetried) {
+    m_endpoint.setStatusCodes({429});
+    auto result = uploadSingleBatch();
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(0u, result.numRetries);
+    EXPECT_EQ(1u, m_endpoint.getNumRequests());
+}
+
+TEST_F(AddressBookUploadPipelineTest, serverErrorIsRetried) {
+    m_endpoint.setStatusCodes({503, 200});
+    auto result = uploadSingleBatch();
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(1u, result.numRetries);
+    EXPECT_EQ(2u, m_endpoint.getNumRequests());
+}
+
+TEST_F(AddressBookUploadPipelineTest, upload5kContacts) {
+    auto sequential = upload(5000, 1);
+    auto pipelined = upload(5000, 4);
+    EXPECT_LT(pipelined, sequential);
+    EXPECT_LE(m_endpoint.getPeakRequestsInFlight(), 4);
+}
+
+TEST_F(AddressBookUploadPipelineTest, upload20kContacts) {
+    auto sequential = upload(20000, 1);
+    auto pipelined = upload(20000, 4);
+    EXPECT_LT(pipelined, sequential);
+    EXPECT_LE(m_endpoint.getPeakRequestsInFlight(), 4);
+}
@@ -26,6 +26,8 @@
 #include <vector>
 #include <atomic>
 
+#include <rapidjson/document.h>
+
 #include <ACL/AVSConnectionManager.h>
 #include <ACL/Transport/PostConnectSequencerFactory.h>
 #include <ACL/Transport/TransportFactoryInterface.h>
@@ -319,6 +321,7 @@ public:
 protected:
     bool initialize() override;
     bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(const nlohmann::json& configuration) override;
     bool preRegister() override;
     bool setup() override;
     bool start() override;
@@ -328,6 +331,7 @@ protected:
     bool engineStarted() override;
 
 private:
+    bool configureFromDocument(rapidjson::Document& document);
     bool configureDeviceSDK(std::shared_ptr<std::istream> configuration);
     bool connect();
     bool disconnect();
@@ -458,6 +462,7 @@ private:
     /// Holds the connection state to AVS before changing the network interface.
     bool m_previousAVSConnectionState = false;
     bool m_speakerManagerEnabled;
+    bool m_audioPlayerNonBlockingControl;
     std::string m_timezone;
 
     /// Holds the provider names in scenarios where application supports multiple authorizations.
@@ -19,6 +19,8 @@
 #include <istream>
 #include <set>
 #include <atomic>
+#include <functional>
+#include <mutex>
 
 #include <AVSCommon/SDKInterfaces/SpeakerInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerInterface.h>
@@ -66,6 +68,17 @@ public:
     int64_t getMediaPosition();
     int64_t getMediaDuration();
 
+    /**
+     * Sets whether the media player control operations return without waiting for the audio output channel. In the
+     * non-blocking mode @c setSource() returns the ID of the queued source, @c play(), @c stop(), @c pause() and
+     * @c resume() return once the operation is queued, and a failed operation is reported to the observers with
+     * @c MediaPlayerObserverInterface::onPlaybackError(). A pause followed by a resume of the same source is
+     * coalesced when neither has been executed yet. The mode is disabled by default.
+     *
+     * @param nonBlocking @c true to queue the control operations.
+     */
+    void setNonBlockingControl(bool nonBlocking);
+
     //
     // aace::audio::AudioOutputEngineInterface
     //
@@ -142,6 +155,12 @@ private:
 
     enum class DuckingStates { NONE, DUCKED_BY_ALEXA, DUCKED_BY_PLATFORM };
 
+    // a pause queued in the non-blocking mode, which a resume of the same source queued right after is coalesced with
+    struct QueuedPause {
+        SourceId id;
+        bool resumed;
+    };
+
     void sendPendingEvent();
     void sendEvent(PendingEventState state);
     void resetSource();
@@ -162,6 +181,7 @@ private:
     void executePlaybackError(SourceId id, MediaError error, const std::string& description);
     void executeBufferUnderrun(SourceId id);
     void executeBufferRefilled(SourceId id);
+    void executeOperationFailed(SourceId id, const std::string& description);
 
     friend std::ostream& operator<<(std::ostream& stream, const PendingEventState& state);
     friend std::ostream& operator<<(std::ostream& stream, const DuckingStates& state);
@@ -170,20 +190,24 @@ private:
     // MediaPlayerInterface implementation in executor
     //
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId execSetSource(
+        SourceId id,
         std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
         const alexaClientSDK::avsCommon::utils::AudioFormat* format,
         const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config);
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId execSetSource(
+        SourceId id,
         std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
         std::chrono::milliseconds offsetAdjustment,
         const alexaClientSDK::avsCommon::utils::AudioFormat* format,
         const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config);
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId execSetSource(
+        SourceId id,
         std::shared_ptr<std::istream> stream,
         bool repeat,
         const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
         alexaClientSDK::avsCommon::utils::MediaType format);
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId execSetSource(
+        SourceId id,
         const std::string& url,
         std::chrono::milliseconds offset,
         const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
@@ -193,6 +217,7 @@ private:
     bool execStop(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
     bool execPause(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
     bool execResume(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
+    void execPauseResume(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
     std::chrono::milliseconds execGetOffset(
         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
     uint64_t execGetNumBytesBuffered();
@@ -202,6 +227,13 @@ private:
     bool execStartDucking();
     bool execStopDucking();
 
+    //
+    // non-blocking control operations
+    //
+    bool queueOperation(std::function<void()> operation);
+    bool queuePause(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
+    bool queueResume(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
+
     static alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType convertErrorType(MediaError error);
 
 private:
@@ -235,13 +267,21 @@ private:
     // executor used to send asynchronous events back to observer
     alexaClientSDK::avsCommon::utils::threading::Executor m_callbackExecutor;
 
-    // global counter for media source id
-    static SourceId s_nextId;
+    // global counter for media source id, shared by the channels which allocate ids on their own threads
+    static std::atomic<SourceId> s_nextId;
 
     //variable for storing the mixability of the current stream
     bool m_mayDuck;
 
     DuckingStates m_duckingState;
+
+    // whether the control operations are queued without waiting for the executor
+    std::atomic<bool> m_nonBlockingControl;
+
+    // the last queued operation if it is a pause which has not been executed yet
+    std::shared_ptr<QueuedPause> m_queuedPause;
+    // serializes queuing the control operations with @c m_queuedPause
+    std::mutex m_queuedOperationMutex;
 };
 
 inline std::ostream& operator<<(std::ostream& stream, const AudioChannelEngineImpl::PendingEventState& state) {
@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_ALEXA_AUTHORIZATION_ADAPTER_INTERFACE_H
 #define AACE_ENGINE_ALEXA_AUTHORIZATION_ADAPTER_INTERFACE_H
 
+#include <chrono>
 #include <string>
 
 namespace aace {
@@ -42,6 +43,17 @@ public:
      */
     virtual std::string getAuthToken() = 0;
 
+    /**
+     * Get the time at which the current authorization token expires. The @c AuthorizationManager uses it to
+     * refresh its copy of the token before the token expires.
+     *
+     * @return The expiration time of the current authorization token, or @c time_point::max() if the
+     * adapter does not know when the token expires.
+     */
+    virtual std::chrono::steady_clock::time_point getAuthTokenExpirationTime() {
+        return std::chrono::steady_clock::time_point::max();
+    }
+
     /**
      * Notifies that an operation using the specified auth token experienced an authorization failure.
      *
@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_ALEXA_AUTHORIZATION_MANAGER_H
 #define AACE_ENGINE_ALEXA_AUTHORIZATION_MANAGER_H
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <unordered_map>
 
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
@@ -24,6 +27,7 @@
 #include <RegistrationManager/RegistrationManagerInterface.h>
 
 #include <AACE/Engine/Metrics/MetricsEmissionInterface.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
 #include "AuthorizationManagerInterface.h"
 #include "AuthorizationManagerStorage.h"
 
@@ -147,7 +151,38 @@ private:
      */
     bool clearAdapterStateLocked();
 
+    /**
+     * Gets the authorization token from the active adapter and replaces the token snapshot with it, unless the
+     * snapshot was cleared while the token was requested.
+     *
+     * @return The authorization token, or an empty string if there is no active authorization.
+     */
+    std::string fetchAuthToken();
+
+    /**
+     * Refreshes the token snapshot on the executor, unless a refresh is already pending.
+     */
+    void refreshAuthTokenSnapshot();
+
+    /**
+     * Clears the token snapshot, so the next @c getAuthToken() call gets the token from the active adapter.
+     */
+    void clearAuthTokenSnapshot();
+
 private:
+    /**
+     * An immutable copy of the authorization token of the active adapter. @c getAuthToken() serves the token
+     * from the snapshot without calling the adapter until the token expires.
+     */
+    struct TokenSnapshot {
+        /// The authorization token
+        std::string token;
+        /// The time at which the token expires
+        std::chrono::steady_clock::time_point expirationTime;
+        /// The time after which the snapshot is refreshed in the background
+        std::chrono::steady_clock::time_point refreshTime;
+    };
+
     /// Alias for @c AdapterState
     using AdapterState = AuthorizationManagerStorage::AdapterState;
 
@@ -187,6 +222,22 @@ private:
 
     /// To serialize the access to @c m_metricsEmissionListener
     std::mutex m_metricEmissionListenerMutex;
+
+    /// The snapshot of the active authorization token. Access is atomic, writes are serialized with
+    /// @c m_tokenSnapshotMutex.
+    std::shared_ptr<const TokenSnapshot> m_tokenSnapshot;
+
+    /// Incremented whenever @c m_tokenSnapshot is cleared. Access is synchronized with @c m_tokenSnapshotMutex.
+    uint64_t m_tokenSnapshotGeneration;
+
+    /// To serialize the writes of @c m_tokenSnapshot
+    std::mutex m_tokenSnapshotMutex;
+
+    /// Whether a refresh of @c m_tokenSnapshot is pending on @c m_executor
+    std::atomic<bool> m_tokenRefreshPending;
+
+    /// Executor refreshing @c m_tokenSnapshot off the request path
+    aace::engine::utils::threading::Executor m_executor;
 };
 
 }  // namespace alexa
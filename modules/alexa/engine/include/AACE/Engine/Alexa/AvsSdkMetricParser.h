@@ -17,8 +17,8 @@
 #define AACE_ENGINE_ALEXA_AVS_SDK_METRIC_PARSER_H
 
 #include <functional>
+#include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -104,18 +104,60 @@ public:
         const std::vector<std::string>& args);
 
 private:
+    /// A node of the prefix override trie
+    struct PrefixNode {
+        /// The index in @c m_prefixTrie of the child node for each next character
+        std::map<char, size_t> children;
+
+        /// Whether a prefix override ends at this node
+        bool terminal = false;
+    };
+
+    /**
+     * Adds a prefix to the prefix override trie.
+     *
+     * @param prefix The prefix of the sources to convert as-is
+     */
+    void addPrefixOverride(const std::string& prefix);
+
+    /**
+     * Checks whether a source matches a prefix override. This walks the trie
+     * once, so the cost does not grow with the number of prefixes.
+     *
+     * @param source The source name of the metric
+     * @return @c true if a prefix override is a prefix of @c source
+     */
+    bool hasPrefixOverride(const std::string& source) const;
+
+    /**
+     * Applies the transformation rules of a source to a data point.
+     *
+     * @param builder The builder of the converted metric
+     * @param drop Set to @c true if the whole metric must be dropped
+     * @param transformation The transformation rules of the metric source
+     * @param sourceDp The data point to convert
+     * @return @c true if the data point was converted
+     */
+    static bool transformDataPoint(
+        MetricEventBuilder& builder,
+        bool& drop,
+        const AvsSdkMetricTransformation& transformation,
+        const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp);
+
     /**
-     * Any metric with a source whose prefix is in this set will be allowed and
-     * converted with all data points as-is.
+     * The trie of prefixes. Any metric with a source whose prefix is in the
+     * trie will be allowed and converted with all data points as-is. The
+     * root node is at index 0.
      */
-    std::set<std::string> m_prefixOverrides;
+    std::vector<PrefixNode> m_prefixTrie;
 
     /**
      * Contains the allowed metric events keyed by source name. The value
      * is null if the metric data points are to be translated as-is. Nonnull
      * value specifies transformation rules to apply to the data points.
+     * The rules are built by @c configure() and not modified afterwards.
      */
-    std::unordered_map<std::string, std::unique_ptr<AvsSdkMetricTransformation>> m_allowedSources;
+    std::unordered_map<std::string, std::unique_ptr<const AvsSdkMetricTransformation>> m_allowedSources;
 };
 
 }  // namespace alexa
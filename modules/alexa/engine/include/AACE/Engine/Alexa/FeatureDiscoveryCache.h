@@ -0,0 +1,155 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
+#define AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Caches the features discovered from the cloud, keyed by locale and request URL. The URL holds the domain, event
+ * type, and limit of the request.
+ *
+ * A cached result is served as-is until it is older than the time to live. After that, and until it is older than
+ * the maximum stale age, it is still served while a refresh runs in the background. Concurrent fetches of the same
+ * result are coalesced into a single cloud request. Results are persisted in local storage, when available, so they
+ * survive a restart.
+ */
+class FeatureDiscoveryCache : public std::enable_shared_from_this<FeatureDiscoveryCache> {
+public:
+    using Features = std::vector<FeatureDiscoveryRESTAgent::LocalizedFeature>;
+
+    /// Fetches the features for a request URL and locale from the cloud, returning no features on failure.
+    using FetchFunction = std::function<Features(const std::string& url, const std::string& locale)>;
+
+    /// The default time for which a result is served without refreshing it.
+    static const std::chrono::milliseconds DEFAULT_TIME_TO_LIVE;
+
+    /// The default time after which a result is no longer served while it is refreshed.
+    static const std::chrono::milliseconds DEFAULT_MAX_STALE_AGE;
+
+    /**
+     * Creates a @c FeatureDiscoveryCache.
+     *
+     * @param fetch The function fetching the features from the cloud.
+     * @param localStorage The storage to persist the results in, or @c nullptr to only cache them in memory.
+     * @param timeToLive The time for which a result is served without refreshing it.
+     * @param maxStaleAge The time after which a result is no longer served while it is refreshed.
+     * @return The cache, or @c nullptr if the arguments are invalid.
+     */
+    static std::shared_ptr<FeatureDiscoveryCache> create(
+        FetchFunction fetch,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        std::chrono::milliseconds timeToLive = DEFAULT_TIME_TO_LIVE,
+        std::chrono::milliseconds maxStaleAge = DEFAULT_MAX_STALE_AGE);
+
+    /**
+     * Gets the features for a request, from the cache when possible. This blocks while the features are fetched
+     * from the cloud, unless a cached result can be served.
+     *
+     * @param url The request URL.
+     * @param locale The locale of the request.
+     * @return The features, or no features if they could not be fetched.
+     */
+    Features getFeatures(const std::string& url, const std::string& locale);
+
+    /**
+     * Removes every cached result, including the persisted ones. A fetch already in progress is not cached, so no
+     * result fetched before the call is served after it.
+     */
+    void clear();
+
+    /// Stops the background refreshes. Must be called before the cache is released.
+    void shutdown();
+
+private:
+    /// A cached result.
+    struct Entry {
+        /// The features.
+        Features features;
+        /// When the features were fetched.
+        std::chrono::system_clock::time_point fetchTime;
+    };
+
+    FeatureDiscoveryCache(
+        FetchFunction fetch,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        std::chrono::milliseconds timeToLive,
+        std::chrono::milliseconds maxStaleAge);
+
+    /// Loads the persisted results into @c m_entries.
+    void loadEntries();
+
+    /// Persists a result in local storage.
+    void persistEntry(const std::string& key, const Entry& entry);
+
+    /**
+     * Fetches the features for a request from the cloud and caches them. If the same request is already being
+     * fetched, this waits for its result instead.
+     */
+    Features fetchCoalesced(const std::string& key, const std::string& url, const std::string& locale);
+
+    /// Refreshes a cached result on the refresh executor, unless it is already being fetched.
+    void refreshInBackground(const std::string& key, const std::string& url, const std::string& locale);
+
+    /// The function fetching the features from the cloud.
+    FetchFunction m_fetch;
+
+    /// The storage to persist the results in, if any.
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
+    /// The time for which a result is served without refreshing it.
+    const std::chrono::milliseconds m_timeToLive;
+
+    /// The time after which a result is no longer served while it is refreshed.
+    const std::chrono::milliseconds m_maxStaleAge;
+
+    /// The cached results, keyed by locale and request URL.
+    std::unordered_map<std::string, Entry> m_entries;
+
+    /// The results being fetched, keyed by locale and request URL.
+    std::unordered_map<std::string, std::shared_future<Features>> m_pendingFetches;
+
+    /// Incremented by @c clear(), so a fetch started before it does not cache its result.
+    uint64_t m_generation = 0;
+
+    /// Serializes access to @c m_entries, @c m_pendingFetches and @c m_generation.
+    std::mutex m_mutex;
+
+    /// The executor running the background refreshes.
+    aace::engine::utils::threading::Executor m_refreshExecutor;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
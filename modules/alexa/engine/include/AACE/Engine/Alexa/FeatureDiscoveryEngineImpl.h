@@ -20,10 +20,12 @@
 #include <unordered_set>
 
 #include <AVSCommon/Utils/RequiresShutdown.h>
+#include <RegistrationManager/CustomerDataHandler.h>
 #include <AACE/Alexa/FeatureDiscovery.h>
 #include <AACE/Engine/Core/EngineService.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
 #include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
@@ -34,9 +36,12 @@ namespace alexa {
 class FeatureDiscoveryEngineImpl
         : public aace::alexa::FeatureDiscoveryEngineInterface
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
+        , public alexaClientSDK::registrationManager::CustomerDataHandler
         , public std::enable_shared_from_this<FeatureDiscoveryEngineImpl> {
 private:
-    FeatureDiscoveryEngineImpl(std::shared_ptr<aace::alexa::FeatureDiscovery> platfromInterface);
+    FeatureDiscoveryEngineImpl(
+        std::shared_ptr<aace::alexa::FeatureDiscovery> platfromInterface,
+        std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManagerInterface> customerDataManager);
 
 public:
     static std::shared_ptr<FeatureDiscoveryEngineImpl> create(
@@ -54,10 +59,14 @@ private:
 public:
     bool onGetFeatures(const std::string& requestId, const std::string& discoveryRequests) override;
 
+    /// Removes the cached features of the user who logged out.
+    void clearData() override;
+
 private:
     std::weak_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> m_propertyManager;
     std::shared_ptr<aace::alexa::FeatureDiscovery> m_featureDiscoveryPlatformInterface;
     std::shared_ptr<aace::engine::alexa::FeatureDiscoveryRESTAgent> m_featureDiscoveryRESTAgent;
+    std::shared_ptr<aace::engine::alexa::FeatureDiscoveryCache> m_featureDiscoveryCache;
     std::weak_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
     std::string m_tag;
     std::unordered_set<std::string> m_validCombinations;
@@ -41,7 +41,6 @@
 
 #include <AVSCommon/SDKInterfaces/SystemSoundPlayerInterface.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
-#include <AVSCommon/Utils/Threading/Executor.h>
 #include <ACL/AVSConnectionManager.h>
 #include <ContextManager/ContextManager.h>
 #include <acsdkKWDImplementations/AbstractKeywordDetector.h>
@@ -54,6 +53,7 @@
 #include <AACE/Engine/Arbitrator/ArbitratorServiceInterface.h>
 #include <AACE/Engine/Audio/AudioManagerInterface.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
 #include "AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h"
 #include "AACE/Engine/Wakeword/WakewordManagerServiceInterface.h"
 #include "AACE/Engine/Wakeword/WakewordManagerDelegateInterface.h"
@@ -335,7 +335,9 @@ private:
     bool m_initialWakewordEnabledState = true;
 
     std::vector<std::shared_ptr<aace::engine::alexa::InitiatorVerifier>> m_initiatorVerifiers;
-    alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
+
+    // Handles a detected wakeword, which is latency critical.
+    aace::engine::utils::threading::Executor m_executor;
 
     // the aip state
     AudioInputProcessorObserverInterface::State m_state;
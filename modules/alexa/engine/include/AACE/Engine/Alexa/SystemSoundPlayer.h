@@ -17,12 +17,14 @@
 #define AACE_ENGINE_ALEXA_SYSTEM_SOUND_PLAYER_H
 
 #include <future>
+#include <map>
 #include <memory>
 
 #include <AVSCommon/SDKInterfaces/Audio/SystemSoundAudioFactoryInterface.h>
 #include <AVSCommon/SDKInterfaces/SystemSoundPlayerInterface.h>
 
 #include <AACE/Engine/Audio/AudioManagerInterface.h>
+#include <AACE/Engine/Audio/SharedBufferAudioStream.h>
 #include <AACE/Audio/AudioEngineInterfaces.h>
 #include <AACE/Audio/AudioFormat.h>
 
@@ -44,12 +46,21 @@ private:
 
     std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> getAudioChannel();
 
+    /// Loads the tones into memory, so playing a tone does not read it from the audio factory again.
+    void loadTones();
+
 public:
     static std::shared_ptr<SystemSoundPlayer> create(
         std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface>
             audioFactory);
 
+    /**
+     * Opens the EARCON audio channel ahead of the first tone, so the first wake word notification does not pay for
+     * opening it. The audio output provider must be registered before this is called.
+     */
+    void primeAudioChannel();
+
     // aace::audio::AudioOutputEngineInterface
     void onMediaStateChanged(MediaState state) override;
     void onMediaError(MediaError error, const std::string& description) override;
@@ -63,6 +74,9 @@ private:
     std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> m_audioOutputChannel;
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> m_audioFactory;
 
+    /// The tones loaded into memory. A tone which could not be loaded is streamed from the audio factory instead.
+    std::map<Tone, std::shared_ptr<const aace::engine::audio::SharedBufferAudioStream::Buffer>> m_tones;
+
     std::shared_future<bool> m_sharedFuture;
     std::promise<bool> m_playTonePromise;
     std::mutex m_mutex;
@@ -89,6 +103,10 @@ public:
     bool isClosed() override;
     std::vector<aace::audio::AudioStreamProperty> getProperties() override;
 
+    /// @return The properties of the audio stream of a tone.
+    static std::vector<aace::audio::AudioStreamProperty> getToneProperties(
+        alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone);
+
 private:
     std::shared_ptr<std::istream> m_stream;
     alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone m_tone;
@@ -16,6 +16,7 @@
 #include "AACE/Engine/Alexa/AlexaEngineLocationStateProvider.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Utils/JSON/JSON.h"
+#include "AACE/Engine/Utils/Tracing/Tracer.h"
 
 namespace aace {
 namespace engine {
@@ -88,6 +89,7 @@ void AlexaEngineLocationStateProvider::onLocationServiceAccessChanged(LocationSe
 void AlexaEngineLocationStateProvider::executeProvideState(
     const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
     const unsigned int stateRequestToken) {
+    AACE_TRACE_SPAN("ContextProvider", "Location");
     try {
         ThrowIfNull(m_contextManager, "contextManagerIsNull");
 
@@ -15,6 +15,7 @@
 
 #include <climits>
 #include <iostream>
+#include <sstream>
 #include <typeinfo>
 
 #include <rapidjson/stringbuffer.h>
@@ -133,6 +134,7 @@ AlexaEngineService::AlexaEngineService(const aace::engine::core::ServiceDescript
         m_networkStatus(NetworkInfoObserver::NetworkStatus::UNKNOWN),
         m_externalMediaPlayerAgent(""),
         m_speakerManagerEnabled(true),
+        m_audioPlayerNonBlockingControl(false),
         m_duckingEnabled(false) {
     m_isShuttingDown = false;
 #ifdef DEBUG
@@ -422,11 +424,27 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
 }
 
 bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration) {
-    try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+    auto document = aace::engine::utils::json::parse(configuration);
+    if (document == nullptr) {
+        AACE_WARN(LX(TAG, "configure").d("reason", "parseConfigurationStreamFailed"));
+        return false;
+    }
+    return configureFromDocument(*document);
+}
 
-        auto alexaConfigRoot = document->GetObject();
+bool AlexaEngineService::configure(const nlohmann::json& configuration) {
+    // convert the parsed configuration node directly instead of serializing and parsing it again
+    auto document = aace::engine::utils::json::toDocument(configuration);
+    if (document == nullptr) {
+        AACE_WARN(LX(TAG, "configure").d("reason", "convertConfigurationFailed"));
+        return false;
+    }
+    return configureFromDocument(*document);
+}
+
+bool AlexaEngineService::configureFromDocument(rapidjson::Document& document) {
+    try {
+        auto alexaConfigRoot = document.GetObject();
 
         rapidjson::Document deviceSDKConfig(rapidjson::kObjectType);
         auto deviceSDKConfigRoot = deviceSDKConfig.GetObject();
@@ -500,6 +518,14 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
             }
         }
 
+        if (alexaConfigRoot.HasMember("audioPlayer") && alexaConfigRoot["audioPlayer"].IsObject()) {
+            auto audioPlayer = alexaConfigRoot["audioPlayer"].GetObject();
+
+            if (audioPlayer.HasMember("nonBlockingControl") && audioPlayer["nonBlockingControl"].IsBool()) {
+                m_audioPlayerNonBlockingControl = audioPlayer["nonBlockingControl"].GetBool();
+            }
+        }
+
         if (alexaConfigRoot.HasMember("speechRecognizer") && alexaConfigRoot["speechRecognizer"].IsObject()) {
             auto speechRecognizer = alexaConfigRoot["speechRecognizer"].GetObject();
 
@@ -828,15 +854,15 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
             registerServiceInterface<WakewordObservableInterface>(shared_from_this()),
             "registerWakewordObservableInterfaceFailed");
 
-        // configure the avs device sdk
+        // configure the avs device sdk with the config already serialized above
         ThrowIfNot(
-            configureDeviceSDK(aace::engine::utils::json::toStream(deviceSDKConfig)), "configureDeviceSDKFailed");
+            configureDeviceSDK(std::make_shared<std::stringstream>(buffer.GetString())), "configureDeviceSDKFailed");
 
         m_configured = true;
 
         return true;
     } catch (std::exception& ex) {
-        AACE_WARN(LX(TAG, "configure").d("reason", ex.what()));
+        AACE_WARN(LX(TAG, "configureFromDocument").d("reason", ex.what()));
         return false;
     }
 }
@@ -1257,6 +1283,11 @@ bool AlexaEngineService::engineStarted() {
             ThrowIfNot(m_speechRecognizerEngineImpl->enableWakewordDetection(), "enabledWakewordDetectionFailed");
         }
 
+        // open the earcon channel now, rather than when the first wake word notification is played
+        if (m_systemSoundPlayer != nullptr) {
+            m_systemSoundPlayer->primeAudioChannel();
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "start").d("reason", ex.what()));
@@ -2279,6 +2310,7 @@ bool AlexaEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::ale
             m_captionManager,
             m_mediaPlayerFingerprint);
         ThrowIfNull(m_audioPlayerEngineImpl, "createAudioPlayerEngineImplFailed");
+        m_audioPlayerEngineImpl->setNonBlockingControl(m_audioPlayerNonBlockingControl);
         m_renderPlayerInfoCardsProviderInterfaces.insert(m_audioPlayerEngineImpl);
 
         // if a template interface has been registered it needs to know about the
@@ -16,6 +16,7 @@
 #include "AACE/Engine/Alexa/AudioChannelEngineImpl.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Alexa/ChannelVolumeManager.h"
+#include "AACE/Engine/Utils/Tracing/Tracer.h"
 
 #include <stdexcept>
 
@@ -32,8 +33,8 @@ static const std::string TAG("aace.alexa.AudioChannelEngineImpl");
 
 #define LXT LX(TAG).d("name", m_name)
 
-alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::s_nextId =
-    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::ERROR;
+std::atomic<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId>
+    AudioChannelEngineImpl::s_nextId{alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::ERROR};
 
 AudioChannelEngineImpl::AudioChannelEngineImpl(
     alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface::Type channelVolumeType,
@@ -49,7 +50,8 @@ AudioChannelEngineImpl::AudioChannelEngineImpl(
         m_currentMediaState(MediaState::STOPPED),
         m_mediaStateChangeInitiator(MediaStateChangeInitiator::NONE),
         m_mayDuck(false),
-        m_duckingState(DuckingStates::NONE) {
+        m_duckingState(DuckingStates::NONE),
+        m_nonBlockingControl(false) {
 }
 
 bool AudioChannelEngineImpl::initializeAudioChannel(
@@ -137,6 +139,11 @@ int64_t AudioChannelEngineImpl::getMediaDuration() {
     return m_audioOutputChannel->getDuration();
 }
 
+void AudioChannelEngineImpl::setNonBlockingControl(bool nonBlocking) {
+    AACE_INFO(LXT.d("nonBlocking", nonBlocking));
+    m_nonBlockingControl = nonBlocking;
+}
+
 std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface> AudioChannelEngineImpl::
     getChannelVolumeInterface() {
     if (!m_channelVolumeInterface) {
@@ -354,6 +361,7 @@ void AudioChannelEngineImpl::executeMediaError(SourceId id, MediaError error, co
 void AudioChannelEngineImpl::executePlaybackStarted(SourceId id) {
     try {
         ThrowIf(id == ERROR, "invalidSource");
+        AACE_TRACE_INSTANT("AudioChannel", "PlaybackStarted");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
         m_callbackExecutor.submit([this, id, offset] {
@@ -510,6 +518,28 @@ void AudioChannelEngineImpl::executeBufferRefilled(SourceId id) {
     }
 }
 
+void AudioChannelEngineImpl::executeOperationFailed(SourceId id, const std::string& description) {
+    // the caller of a blocking operation is told of the failure by its return value
+    if (!m_nonBlockingControl || id == ERROR) {
+        return;
+    }
+    auto offset = m_savedOffset;
+    if (id == m_currentId && m_audioOutputChannel != nullptr) {
+        offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+    }
+    m_callbackExecutor.submit([this, id, description, offset] {
+        for (auto&& observer : m_mediaPlayerObservers) {
+            if (auto observer_lock = observer.lock()) {
+                observer_lock->onPlaybackError(
+                    id,
+                    alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR,
+                    description,
+                    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{offset});
+            }
+        }
+    });
+}
+
 void AudioChannelEngineImpl::resetSource() {
     AACE_DEBUG(LXT);
     m_currentId = ERROR;
@@ -559,21 +589,38 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     const alexaClientSDK::avsCommon::utils::AudioFormat* format,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) {
     AACE_INFO(LXT.d("type", "attachment"));
+    auto id = nextId();
+    if (m_nonBlockingControl) {
+        // the format is owned by the caller, so the queued operation keeps a copy
+        auto formatCopy =
+            format != nullptr ? std::make_shared<alexaClientSDK::avsCommon::utils::AudioFormat>(*format) : nullptr;
+        auto queued = queueOperation([this, id, attachmentReader, formatCopy, config] {
+            execSetSource(id, attachmentReader, formatCopy.get(), config);
+        });
+        if (!queued) {
+            return ERROR;
+        }
+        return id;
+    }
     return m_executor
-        .submit([this, attachmentReader, format, config] { return execSetSource(attachmentReader, format, config); })
+        .submit([this, id, attachmentReader, format, config] {
+            return execSetSource(id, attachmentReader, format, config);
+        })
         .get();
 }
 
 alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::execSetSource(
+    SourceId id,
     std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
     const alexaClientSDK::avsCommon::utils::AudioFormat* format,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) {
     try {
+        AACE_TRACE_SPAN("AudioChannel", "SetSource");
         AACE_DEBUG(LXT.d("type", "attachment"));
 
         resetSource();
 
-        m_currentId = nextId();
+        m_currentId = id;
 
         auto outputChannel = m_audioOutputChannel;
         if (outputChannel != nullptr) {
@@ -584,6 +631,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", m_currentId).d("type", "attachment"));
         resetSource();
+        executeOperationFailed(id, ex.what());
     }
 
     return m_currentId;
@@ -595,24 +643,39 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     const alexaClientSDK::avsCommon::utils::AudioFormat* format,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) {
     AACE_INFO(LXT.d("type", "attachmentWithOffset").d("offsetAdjustment", offsetAdjustment.count()));
+    auto id = nextId();
+    if (m_nonBlockingControl) {
+        // the format is owned by the caller, so the queued operation keeps a copy
+        auto formatCopy =
+            format != nullptr ? std::make_shared<alexaClientSDK::avsCommon::utils::AudioFormat>(*format) : nullptr;
+        auto queued = queueOperation([this, id, attachmentReader, offsetAdjustment, formatCopy, config] {
+            execSetSource(id, attachmentReader, offsetAdjustment, formatCopy.get(), config);
+        });
+        if (!queued) {
+            return ERROR;
+        }
+        return id;
+    }
     return m_executor
-        .submit([this, attachmentReader, offsetAdjustment, format, config] {
-            return execSetSource(attachmentReader, offsetAdjustment, format, config);
+        .submit([this, id, attachmentReader, offsetAdjustment, format, config] {
+            return execSetSource(id, attachmentReader, offsetAdjustment, format, config);
         })
         .get();
 }
 
 alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::execSetSource(
+    SourceId id,
     std::shared_ptr<alexaClientSDK::avsCommon::avs::attachment::AttachmentReader> attachmentReader,
     std::chrono::milliseconds offsetAdjustment,
     const alexaClientSDK::avsCommon::utils::AudioFormat* format,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config) {
     try {
+        AACE_TRACE_SPAN("AudioChannel", "SetSource");
         AACE_DEBUG(LXT.d("type", "attachmentWithOffset").d("offsetAdjustment", offsetAdjustment.count()));
 
         resetSource();
 
-        m_currentId = nextId();
+        m_currentId = id;
 
         auto outputChannel = m_audioOutputChannel;
         if (outputChannel != nullptr) {
@@ -624,6 +687,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", m_currentId).d("type", "attachment"));
         resetSource();
+        executeOperationFailed(id, ex.what());
     }
 
     return m_currentId;
@@ -635,23 +699,37 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
     alexaClientSDK::avsCommon::utils::MediaType format) {
     AACE_INFO(LXT.d("type", "stream"));
+    auto id = nextId();
+    if (m_nonBlockingControl) {
+        auto queued = queueOperation([this, id, stream, repeat, config, format] {
+            execSetSource(id, stream, repeat, config, format);
+        });
+        if (!queued) {
+            return ERROR;
+        }
+        return id;
+    }
     return m_executor
-        .submit([this, stream, repeat, config, format] { return execSetSource(stream, repeat, config, format); })
+        .submit([this, id, stream, repeat, config, format] {
+            return execSetSource(id, stream, repeat, config, format);
+        })
         .get();
 }
 
 alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::execSetSource(
+    SourceId id,
     std::shared_ptr<std::istream> stream,
     bool repeat,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
     alexaClientSDK::avsCommon::utils::MediaType format) {
     try {
+        AACE_TRACE_SPAN("AudioChannel", "SetSource");
         AACE_DEBUG(LXT.d("type", "stream"));
 
         resetSource();
 
         ThrowIfNot(stream->good(), "invalidStream");
-        m_currentId = nextId();
+        m_currentId = id;
         auto outputChannel = m_audioOutputChannel;
 
         aace::audio::AudioFormat::Encoding encoding;
@@ -688,6 +766,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
                        .d("repeat", repeat)
                        .d("id", m_currentId));
         resetSource();
+        executeOperationFailed(id, ex.what());
     }
 
     return m_currentId;
@@ -700,26 +779,38 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     bool repeat,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext& playbackContext) {
     AACE_INFO(LXT.sensitive("url", url));
+    auto id = nextId();
+    if (m_nonBlockingControl) {
+        auto queued = queueOperation([this, id, url, offset, config, repeat, playbackContext] {
+            execSetSource(id, url, offset, config, repeat, playbackContext);
+        });
+        if (!queued) {
+            return ERROR;
+        }
+        return id;
+    }
     return m_executor
-        .submit([this, url, offset, config, repeat, playbackContext] {
-            return execSetSource(url, offset, config, repeat, playbackContext);
+        .submit([this, id, url, offset, config, repeat, playbackContext] {
+            return execSetSource(id, url, offset, config, repeat, playbackContext);
         })
         .get();
 }
 
 alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::execSetSource(
+    SourceId id,
     const std::string& url,
     std::chrono::milliseconds offset,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::SourceConfig& config,
     bool repeat,
     const alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext& playbackContext) {
     try {
+        AACE_TRACE_SPAN("AudioChannel", "SetSource");
         AACE_DEBUG(LXT.d("type", "url").sensitive("url", url));
 
         resetSource();
 
         m_url = url;
-        m_currentId = nextId();
+        m_currentId = id;
 
         audio::AudioOutputChannelInterface::PlaybackContext ctx;
         ctx.audioSegmentConfig = playbackContext.audioSegmentConfig;
@@ -741,6 +832,7 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("url", url).d("repeat", repeat).d("id", m_currentId));
         resetSource();
+        executeOperationFailed(id, ex.what());
     }
 
     return m_currentId;
@@ -748,6 +840,9 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
 
 bool AudioChannelEngineImpl::play(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     AACE_INFO(LXT.d("id", id));
+    if (m_nonBlockingControl) {
+        return queueOperation([this, id] { execPlay(id); });
+    }
     return m_executor.submit([this, id] { return execPlay(id); }).get();
 }
 
@@ -755,6 +850,7 @@ bool AudioChannelEngineImpl::execPlay(
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     try {
         AACE_VERBOSE(LXT.d("id", id));
+        AACE_TRACE_SPAN("AudioChannel", "Play");
 
         ThrowIfNot(validateSource(id), "invalidSource");
 
@@ -776,12 +872,16 @@ bool AudioChannelEngineImpl::execPlay(
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState).d("id", id));
+        executeOperationFailed(id, ex.what());
         return false;
     }
 }
 
 bool AudioChannelEngineImpl::stop(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     AACE_INFO(LXT.d("id", id));
+    if (m_nonBlockingControl) {
+        return queueOperation([this, id] { execStop(id); });
+    }
     auto future = m_executor.submit([this, id] { return execStop(id); });
     return future.valid() ? future.get() : false;
 }
@@ -808,12 +908,16 @@ bool AudioChannelEngineImpl::execStop(
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState));
+        executeOperationFailed(id, ex.what());
         return false;
     }
 }
 
 bool AudioChannelEngineImpl::pause(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     AACE_INFO(LXT.d("id", id));
+    if (m_nonBlockingControl) {
+        return queuePause(id);
+    }
     return m_executor.submit([this, id] { return execPause(id); }).get();
 }
 
@@ -846,12 +950,16 @@ bool AudioChannelEngineImpl::execPause(
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState).d("id", id));
+        executeOperationFailed(id, ex.what());
         return false;
     }
 }
 
 bool AudioChannelEngineImpl::resume(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     AACE_INFO(LXT.d("id", id));
+    if (m_nonBlockingControl) {
+        return queueResume(id);
+    }
     return m_executor.submit([this, id] { return execResume(id); }).get();
 }
 
@@ -880,10 +988,80 @@ bool AudioChannelEngineImpl::execResume(
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState).d("id", id));
+        executeOperationFailed(id, ex.what());
         return false;
     }
 }
 
+void AudioChannelEngineImpl::execPauseResume(
+    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
+    try {
+        AACE_VERBOSE(LXT.d("id", id));
+
+        ThrowIfNot(validateSource(id), "invalidSource");
+
+        // the pair only cancels out while the media is playing with no pending event, otherwise
+        // the pause and resume are executed as they were queued
+        if (m_currentMediaState != MediaState::PLAYING || m_pendingEventState != PendingEventState::NONE) {
+            execPause(id);
+            execResume(id);
+            return;
+        }
+
+        // report the events the platform would have caused without pausing the audio output channel
+        executePlaybackPaused(id);
+        setMediaStateChangeInitiator(MediaStateChangeInitiator::RESUME);
+        executePlaybackResumed(id);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState).d("id", id));
+        executeOperationFailed(id, ex.what());
+    }
+}
+
+bool AudioChannelEngineImpl::queueOperation(std::function<void()> operation) {
+    std::lock_guard<std::mutex> lock(m_queuedOperationMutex);
+    m_queuedPause.reset();
+    return m_executor.submit(operation).valid();
+}
+
+bool AudioChannelEngineImpl::queuePause(
+    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
+    std::lock_guard<std::mutex> lock(m_queuedOperationMutex);
+    auto queuedPause = std::make_shared<QueuedPause>(QueuedPause{id, false});
+    m_queuedPause = queuedPause;
+    return m_executor
+        .submit([this, queuedPause] {
+            bool resumed;
+            {
+                // a resume can no longer be coalesced once the pause is executed
+                std::lock_guard<std::mutex> lock(m_queuedOperationMutex);
+                if (m_queuedPause == queuedPause) {
+                    m_queuedPause.reset();
+                }
+                resumed = queuedPause->resumed;
+            }
+            if (resumed) {
+                execPauseResume(queuedPause->id);
+            } else {
+                execPause(queuedPause->id);
+            }
+        })
+        .valid();
+}
+
+bool AudioChannelEngineImpl::queueResume(
+    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
+    std::lock_guard<std::mutex> lock(m_queuedOperationMutex);
+    if (m_queuedPause != nullptr && m_queuedPause->id == id) {
+        AACE_VERBOSE(LXT.m("coalescedWithQueuedPause").d("id", id));
+        m_queuedPause->resumed = true;
+        m_queuedPause.reset();
+        return true;
+    }
+    m_queuedPause.reset();
+    return m_executor.submit([this, id] { execResume(id); }).valid();
+}
+
 std::chrono::milliseconds AudioChannelEngineImpl::getOffset(
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
     return m_executor.submit([this, id] { return execGetOffset(id); }).get();
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <AACE/Engine/Core/EngineMacros.h>
 
 #include "AACE/Engine/Alexa/AuthorizationManager.h"
@@ -24,6 +26,15 @@ namespace alexa {
 /// String to identify log entries originating from this file.
 static const std::string TAG("AuthorizationManager");
 
+/// How long before the token expires the token snapshot is refreshed.
+static const std::chrono::seconds TOKEN_REFRESH_HEAD_START = std::chrono::seconds(30);
+
+/// How long a snapshot of a token with an unknown expiration time is used before it is refreshed.
+static const std::chrono::minutes TOKEN_SNAPSHOT_MAX_AGE = std::chrono::minutes(1);
+
+/// The minimum interval between two refreshes of the token snapshot.
+static const std::chrono::seconds TOKEN_SNAPSHOT_MIN_REFRESH_INTERVAL = std::chrono::seconds(5);
+
 using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 
 std::shared_ptr<AuthorizationManager> AuthorizationManager::create(
@@ -47,7 +58,9 @@ AuthorizationManager::AuthorizationManager(std::shared_ptr<AuthorizationManagerS
         m_activeAdapter{"", ""},
         m_authState{AuthObserverInterface::State::UNINITIALIZED},
         m_authError{AuthObserverInterface::Error::SUCCESS},
-        m_storage(storage) {
+        m_storage(storage),
+        m_tokenSnapshotGeneration{0},
+        m_tokenRefreshPending{false} {
 }
 
 bool AuthorizationManager::initialize() {
@@ -126,6 +139,7 @@ AuthorizationManager::StartAuthorizationResult AuthorizationManager::startAuthor
                 activeAdapterLock.lock();
                 performDeregisterLocked();
                 m_activeAdapter = {service, "NOT_AUTHORIZED"};
+                clearAuthTokenSnapshot();
                 ThrowIfNot(saveCurrentAdapterStateLocked(), "saveCurrentAdapterStateLockedFailed");
 
                 return StartAuthorizationResult::AUTHORIZE;
@@ -236,6 +250,14 @@ void AuthorizationManager::authStateChanged(const std::string& service, State st
                 m_activeAdapter = {m_activeAdapter.first, "AUTHORIZED"};
                 ThrowIfNot(saveCurrentAdapterStateLocked(), "saveCurrentAdapterStateLockedFailed");
             }
+            if (state == State::REFRESHED) {
+                // Keep serving the current token until the refreshed token replaces it
+                if (std::atomic_load(&m_tokenSnapshot) != nullptr) {
+                    refreshAuthTokenSnapshot();
+                }
+            } else {
+                clearAuthTokenSnapshot();
+            }
             // Unlock the activeAdapterLock function of AuthDelegateInterface could get called.
             activeAdapterLock.unlock();
             updateAuthStateAndNotifyAuthObservers(state, reason);
@@ -269,6 +291,7 @@ bool AuthorizationManager::logout(const std::string& service) {
             // Lock activeAdapterLock, as we are using m_activeAdapter
             activeAdapterLock.lock();
             m_activeAdapter = {"", ""};
+            clearAuthTokenSnapshot();
             ThrowIfNot(clearAdapterStateLocked(), "clearAdapterStateFailed");
 
             return true;
@@ -332,6 +355,21 @@ void AuthorizationManager::removeListener(
 }
 
 std::string AuthorizationManager::getAuthToken() {
+    // Serve the token from the snapshot so the request path does not wait for the adapter
+    auto snapshot = std::atomic_load(&m_tokenSnapshot);
+    if (snapshot != nullptr) {
+        auto now = std::chrono::steady_clock::now();
+        if (now < snapshot->expirationTime) {
+            if (now >= snapshot->refreshTime) {
+                refreshAuthTokenSnapshot();
+            }
+            return snapshot->token;
+        }
+    }
+    return fetchAuthToken();
+}
+
+std::string AuthorizationManager::fetchAuthToken() {
     try {
         std::lock_guard<std::mutex> lock(m_activeAdapterMutex);
         ThrowIf(m_activeAdapter.first.empty(), "noActiveAuthorization");
@@ -341,13 +379,53 @@ std::string AuthorizationManager::getAuthToken() {
                 m_serviceAndAuthorizationAdapterMap.end(),
             "adapterNotRegistered");
 
-        return m_serviceAndAuthorizationAdapterMap.at(m_activeAdapter.first)->getAuthToken();
+        std::unique_lock<std::mutex> snapshotLock(m_tokenSnapshotMutex);
+        auto generation = m_tokenSnapshotGeneration;
+        snapshotLock.unlock();
+
+        // Get the expiration time first, so a token replaced in between is refreshed early rather than late
+        auto adapter = m_serviceAndAuthorizationAdapterMap.at(m_activeAdapter.first);
+        auto expirationTime = adapter->getAuthTokenExpirationTime();
+        auto token = adapter->getAuthToken();
+        if (token.empty()) {
+            return token;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto refreshTime = now + TOKEN_SNAPSHOT_MAX_AGE;
+        if (expirationTime - now < TOKEN_SNAPSHOT_MAX_AGE + TOKEN_REFRESH_HEAD_START) {
+            refreshTime =
+                std::max(expirationTime - TOKEN_REFRESH_HEAD_START, now + TOKEN_SNAPSHOT_MIN_REFRESH_INTERVAL);
+        }
+
+        snapshotLock.lock();
+        if (generation == m_tokenSnapshotGeneration) {
+            std::atomic_store(
+                &m_tokenSnapshot,
+                std::shared_ptr<const TokenSnapshot>(new TokenSnapshot{token, expirationTime, refreshTime}));
+        }
+        return token;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("activeAdapter", m_activeAdapter.first));
         return "";
     }
 }
 
+void AuthorizationManager::refreshAuthTokenSnapshot() {
+    if (!m_tokenRefreshPending.exchange(true)) {
+        m_executor.submit([this]() {
+            fetchAuthToken();
+            m_tokenRefreshPending = false;
+        });
+    }
+}
+
+void AuthorizationManager::clearAuthTokenSnapshot() {
+    std::lock_guard<std::mutex> lock(m_tokenSnapshotMutex);
+    m_tokenSnapshotGeneration++;
+    std::atomic_store(&m_tokenSnapshot, std::shared_ptr<const TokenSnapshot>());
+}
+
 void AuthorizationManager::onAuthFailure(const std::string& token) {
     AACE_DEBUG(LX(TAG));
     try {
@@ -359,6 +437,10 @@ void AuthorizationManager::onAuthFailure(const std::string& token) {
                 m_serviceAndAuthorizationAdapterMap.end(),
             "adapterNotRegistered");
 
+        auto snapshot = std::atomic_load(&m_tokenSnapshot);
+        if (snapshot != nullptr && (token.empty() || token == snapshot->token)) {
+            clearAuthTokenSnapshot();
+        }
         m_serviceAndAuthorizationAdapterMap.at(m_activeAdapter.first)->onAuthFailure(token);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("activeAdapter", m_activeAdapter.first));
@@ -367,6 +449,8 @@ void AuthorizationManager::onAuthFailure(const std::string& token) {
 
 void AuthorizationManager::doShutdown() {
     AACE_DEBUG(LX(TAG));
+    m_executor.shutdown();
+    clearAuthTokenSnapshot();
     std::unique_lock<std::mutex> lock(m_callMutex);
     m_registrationManager.reset();
     m_authDelegateObservers.clear();
@@ -54,29 +54,43 @@ DataType convertDataType(alexaClientSDK::avsCommon::utils::metrics::DataType typ
     }
 }
 
+/**
+ * Checks whether a counter value is zero without converting it to a number.
+ *
+ * @param value The counter value, which must be a string of decimal digits
+ * @param isZero Set to whether the counter value is zero
+ * @return @c true if @c value is a valid counter value
+ */
+static bool isZeroCount(const std::string& value, bool& isZero) {
+    if (value.empty()) {
+        return false;
+    }
+    isZero = true;
+    for (char c : value) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        isZero = isZero && c == '0';
+    }
+    return true;
+}
+
 std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricEvent> metricEvent) {
     ThrowIfNull(metricEvent, "MetricEvent is null");
     const std::string activityName = metricEvent->getActivityName();
-    bool useAsIs = false;
 
-    for (const std::string& prefix : m_prefixOverrides) {
-        if (activityName.rfind(prefix, 0) == 0) {
-            AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
-            useAsIs = true;
-            break;
-        }
-    }
+    // the transformation rules of the source, or null if the data points are converted as-is
+    const AvsSdkMetricTransformation* transformation = nullptr;
     auto sourceItr = m_allowedSources.find(activityName);
-    if (!useAsIs) {
-        if (sourceItr == m_allowedSources.end()) {
-            AACE_VERBOSE(LX(TAG).m("Dropping unused metric").d("source", activityName));
-            return nullptr;
-        }
-        if (sourceItr->second == nullptr) {
-            useAsIs = true;
-            AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
-        }
+    if (sourceItr != m_allowedSources.end()) {
+        transformation = sourceItr->second.get();
+    } else if (!hasPrefixOverride(activityName)) {
+        AACE_VERBOSE(LX(TAG).m("Dropping unused metric").d("source", activityName));
+        return nullptr;
+    }
+    if (transformation == nullptr) {
+        AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
     }
 
     auto metricBuilder = MetricEventBuilder().withSourceName(activityName);
@@ -87,69 +101,24 @@ std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     metricBuilder.withAgentId(metricEvent->getMetricContext().agentId);
 
     for (const auto& datapoint : metricEvent->getDataPoints()) {
-        if (datapoint.isValid()) {
-            auto datatype = datapoint.getDataType();
-            auto name = datapoint.getName();
-            auto value = datapoint.getValue();
-
-            if (sourceItr != m_allowedSources.end() && sourceItr->second != nullptr) {
-                bool success = false;
-                AvsSdkMetricTransformation transformations = *(sourceItr->second);
-                auto iter = transformations.namedDataPoints.find(name);
-                bool dpHasNamedTransformation = iter != transformations.namedDataPoints.end();
-                bool hasAllCounterTransformation = !transformations.allCounters.empty();
-                if (dpHasNamedTransformation) {
-                    const DataPointTransformation transform = iter->second;
-                    DataPointTransformType type = transform.first;
-                    const std::vector<std::string>& args = transform.second;
-                    switch (type) {
-                        case DataPointTransformType::INSERT_DIMENSION:
-                            success = insertDimension(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::SWAP_NAME:
-                            success = swapName(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::SPLIT_NAME:
-                            success = splitName(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO: {
-                            bool drop = false;
-                            success = dropMetricIfCountZero(metricBuilder, drop, datapoint);
-                            if (drop) {
-                                return nullptr;
-                            }
-                        }
-                        case DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO: {
-                            bool drop = false;
-                            success = swapNameOrDropMetricIfCountZero(metricBuilder, drop, datapoint, args);
-                            if (drop) {
-                                return nullptr;
-                            }
-                        }
-                        default:
-                            continue;
-                    }
-                } else if (
-                    hasAllCounterTransformation &&
-                    datatype == alexaClientSDK::avsCommon::utils::metrics::DataType::DURATION) {
-                    for (const DataPointTransformation& dpt : transformations.allCounters) {
-                        const auto args = dpt.second;
-                        if (dpt.first == DataPointTransformType::RENAME_COUNTERS) {
-                            success = renameCounters(metricBuilder, datapoint, args);
-                        }
-                    }
-                } else {
-                    success = convertWithoutChanges(metricBuilder, datapoint);
-                }
-                if (!success) {
-                    AACE_WARN(LX(TAG).m("Issue transforming data point").d("source", activityName).d("name", name));
-                    continue;
-                }
-            } else {
-                convertWithoutChanges(metricBuilder, datapoint);
-            }
-        } else {
+        if (!datapoint.isValid()) {
             AACE_WARN(LX(TAG).m("Dropping invalid data point"));
+            continue;
+        }
+        if (transformation == nullptr) {
+            convertWithoutChanges(metricBuilder, datapoint);
+            continue;
+        }
+        bool drop = false;
+        bool success = transformDataPoint(metricBuilder, drop, *transformation, datapoint);
+        if (drop) {
+            return nullptr;
+        }
+        if (!success) {
+            AACE_WARN(LX(TAG)
+                          .m("Issue transforming data point")
+                          .d("source", activityName)
+                          .d("name", datapoint.getName()));
         }
     }
     try {
@@ -160,6 +129,79 @@ std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     }
 }
 
+bool AvsSdkMetricParser::transformDataPoint(
+    MetricEventBuilder& builder,
+    bool& drop,
+    const AvsSdkMetricTransformation& transformation,
+    const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp) {
+    auto iter = transformation.namedDataPoints.find(sourceDp.getName());
+    if (iter != transformation.namedDataPoints.end()) {
+        const DataPointTransformation& transform = iter->second;
+        const std::vector<std::string>& args = transform.second;
+        switch (transform.first) {
+            case DataPointTransformType::INSERT_DIMENSION:
+                return insertDimension(builder, sourceDp, args);
+            case DataPointTransformType::SWAP_NAME:
+                return swapName(builder, sourceDp, args);
+            case DataPointTransformType::SPLIT_NAME:
+                return splitName(builder, sourceDp, args);
+            case DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO:
+                return dropMetricIfCountZero(builder, drop, sourceDp);
+            case DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO:
+                return swapNameOrDropMetricIfCountZero(builder, drop, sourceDp, args);
+            default:
+                return false;
+        }
+    }
+    if (!transformation.allCounters.empty() &&
+        sourceDp.getDataType() == alexaClientSDK::avsCommon::utils::metrics::DataType::DURATION) {
+        bool success = false;
+        for (const DataPointTransformation& dpt : transformation.allCounters) {
+            if (dpt.first == DataPointTransformType::RENAME_COUNTERS) {
+                success = renameCounters(builder, sourceDp, dpt.second);
+            }
+        }
+        return success;
+    }
+    return convertWithoutChanges(builder, sourceDp);
+}
+
+void AvsSdkMetricParser::addPrefixOverride(const std::string& prefix) {
+    if (m_prefixTrie.empty()) {
+        m_prefixTrie.emplace_back();
+    }
+    size_t node = 0;
+    for (char c : prefix) {
+        auto it = m_prefixTrie[node].children.find(c);
+        if (it != m_prefixTrie[node].children.end()) {
+            node = it->second;
+        } else {
+            m_prefixTrie.emplace_back();
+            m_prefixTrie[node].children.emplace(c, m_prefixTrie.size() - 1);
+            node = m_prefixTrie.size() - 1;
+        }
+    }
+    m_prefixTrie[node].terminal = true;
+}
+
+bool AvsSdkMetricParser::hasPrefixOverride(const std::string& source) const {
+    if (m_prefixTrie.empty()) {
+        return false;
+    }
+    size_t node = 0;
+    for (char c : source) {
+        if (m_prefixTrie[node].terminal) {
+            return true;
+        }
+        auto it = m_prefixTrie[node].children.find(c);
+        if (it == m_prefixTrie[node].children.end()) {
+            return false;
+        }
+        node = it->second;
+    }
+    return m_prefixTrie[node].terminal;
+}
+
 bool AvsSdkMetricParser::configure() {
     try {
         std::stringstream stream(AVS_SDK_METRIC_RULES);
@@ -170,7 +212,7 @@ bool AvsSdkMetricParser::configure() {
             ThrowIfNot(prefixArray.is_array(), "prefixOverride is not an array");
             for (auto& prefixItr : prefixArray.items()) {
                 std::string prefix = prefixItr.value();
-                m_prefixOverrides.emplace(prefix);
+                addPrefixOverride(prefix);
                 AACE_VERBOSE(LX(TAG).m("All metrics with prefix used without changes").d("prefix", prefix));
             }
         }
@@ -192,7 +234,7 @@ bool AvsSdkMetricParser::configure() {
                 continue;
             }
             json rules = object.at("transformRules");
-            std::unique_ptr<AvsSdkMetricTransformation> transformations =
+            auto transformations =
                 std::unique_ptr<AvsSdkMetricTransformation>(new AvsSdkMetricTransformation());
             for (auto& ruleItr : rules.items()) {
                 const json ruleObject = ruleItr.value();
@@ -255,7 +297,8 @@ bool AvsSdkMetricParser::configure() {
                             std::vector<std::string>{asValueOf, asDimension}));
                 }
             }
-            m_allowedSources.emplace(std::make_pair(source, std::move(transformations)));
+            m_allowedSources.emplace(
+                source, std::unique_ptr<const AvsSdkMetricTransformation>(std::move(transformations)));
         }
         return true;
     } catch (std::exception& ex) {
@@ -284,7 +327,7 @@ bool AvsSdkMetricParser::insertDimension(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
     const std::vector<std::string>& args) {
     try {
-        const std::string asDimension = args[0];
+        const std::string& asDimension = args.at(0);
         if (asDimension.empty()) {
             AACE_ERROR(LX(TAG).m("Invalid rules"));
             return false;
@@ -304,8 +347,8 @@ bool AvsSdkMetricParser::swapName(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
     const std::vector<std::string>& args) {
     try {
-        const std::string asValueOf = args[0];
-        const std::string asDimension = args[1];
+        const std::string& asValueOf = args.at(0);
+        const std::string& asDimension = args.at(1);
         if (asValueOf.empty() || asDimension.empty()) {
             AACE_ERROR(LX(TAG).m("Invalid rules for swapName"));
             return false;
@@ -325,9 +368,9 @@ bool AvsSdkMetricParser::splitName(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
     const std::vector<std::string>& args) {
     try {
-        const std::string delimeter = args[0];
-        const std::string asValueOf = args[1];
-        const std::string suffixAsDimension = args[2];
+        const std::string& delimeter = args.at(0);
+        const std::string& asValueOf = args.at(1);
+        const std::string& suffixAsDimension = args.at(2);
         if (delimeter.empty() || asValueOf.empty() || suffixAsDimension.empty()) {
             AACE_ERROR(LX(TAG).m("Invalid rules for splitName"));
             return false;
@@ -358,8 +401,8 @@ bool AvsSdkMetricParser::renameCounters(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
     const std::vector<std::string>& args) {
     try {
-        const std::string newName = args[0];
-        const std::string asValueOf = args[1];
+        const std::string& newName = args.at(0);
+        const std::string& asValueOf = args.at(1);
         if (newName.empty() || asValueOf.empty()) {
             AACE_ERROR(LX(TAG).m("Invalid rules for renameCounters"));
             return false;
@@ -389,8 +432,9 @@ bool AvsSdkMetricParser::dropMetricIfCountZero(
             return false;
         }
         const std::string val = sourceDp.getValue();
-        long count = std::stoul(val);
-        if (count == 0) {
+        bool isZero = false;
+        ThrowIfNot(isZeroCount(val, isZero), "invalidCount");
+        if (isZero) {
             drop = true;
             return true;
         }
@@ -409,14 +453,13 @@ bool AvsSdkMetricParser::swapNameOrDropMetricIfCountZero(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
     const std::vector<std::string>& args) {
     try {
-        const std::string name = sourceDp.getName();
         DataType type = convertDataType(sourceDp.getDataType());
         if (type != DataType::COUNTER) {
             return false;
         }
-        const std::string val = sourceDp.getValue();
-        long count = std::stoul(val);
-        if (count == 0) {
+        bool isZero = false;
+        ThrowIfNot(isZeroCount(sourceDp.getValue(), isZero), "invalidCount");
+        if (isZero) {
             drop = true;
             return true;
         }
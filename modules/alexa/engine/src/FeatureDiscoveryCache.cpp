@@ -0,0 +1,226 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+using json = nlohmann::json;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.FeatureDiscoveryCache");
+
+/// The local storage table of the cached results
+static const std::string FEATURE_DISCOVERY_CACHE_TABLE = "aace.alexa.featureDiscoveryCache";
+
+/// Separates the locale from the request URL in the cache keys
+static const std::string KEY_SEPARATOR = " ";
+
+static const std::string ENTRY_FETCH_TIME = "fetchTime";
+static const std::string ENTRY_FEATURES = "features";
+static const std::string ENTRY_UTTERANCE = "utteranceText";
+static const std::string ENTRY_DESCRIPTION = "descriptionText";
+
+// hints change at most daily, so a result is refreshed twice a day and served for up to a week while refreshing
+const std::chrono::milliseconds FeatureDiscoveryCache::DEFAULT_TIME_TO_LIVE = std::chrono::hours(12);
+const std::chrono::milliseconds FeatureDiscoveryCache::DEFAULT_MAX_STALE_AGE = std::chrono::hours(24 * 7);
+
+std::shared_ptr<FeatureDiscoveryCache> FeatureDiscoveryCache::create(
+    FetchFunction fetch,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    std::chrono::milliseconds timeToLive,
+    std::chrono::milliseconds maxStaleAge) {
+    try {
+        ThrowIfNot(fetch, "invalidFetchFunction");
+        ThrowIf(timeToLive.count() < 0 || maxStaleAge < timeToLive, "invalidTimeToLive");
+        auto cache = std::shared_ptr<FeatureDiscoveryCache>(
+            new FeatureDiscoveryCache(fetch, localStorage, timeToLive, maxStaleAge));
+        cache->loadEntries();
+        return cache;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+FeatureDiscoveryCache::FeatureDiscoveryCache(
+    FetchFunction fetch,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    std::chrono::milliseconds timeToLive,
+    std::chrono::milliseconds maxStaleAge) :
+        m_fetch(fetch),
+        m_localStorage(localStorage),
+        m_timeToLive(timeToLive),
+        m_maxStaleAge(maxStaleAge),
+        m_refreshExecutor(aace::engine::utils::threading::TaskPriority::LOW) {
+}
+
+void FeatureDiscoveryCache::loadEntries() {
+    if (m_localStorage == nullptr) {
+        return;
+    }
+    for (const auto& item : m_localStorage->list(FEATURE_DISCOVERY_CACHE_TABLE)) {
+        try {
+            auto entryJson = json::parse(item.second);
+            Entry entry;
+            entry.fetchTime = std::chrono::system_clock::time_point(
+                std::chrono::milliseconds(entryJson.at(ENTRY_FETCH_TIME).get<int64_t>()));
+            for (const auto& featureJson : entryJson.at(ENTRY_FEATURES)) {
+                FeatureDiscoveryRESTAgent::LocalizedFeature feature;
+                feature.utteranceText = featureJson.at(ENTRY_UTTERANCE).get<std::string>();
+                feature.descriptionText = featureJson.value(ENTRY_DESCRIPTION, "");
+                entry.features.push_back(feature);
+            }
+            m_entries[item.first] = std::move(entry);
+        } catch (std::exception& ex) {
+            AACE_WARN(LX(TAG).m("Dropping invalid cache entry").d("reason", ex.what()));
+            m_localStorage->removeKey(FEATURE_DISCOVERY_CACHE_TABLE, item.first);
+        }
+    }
+    AACE_DEBUG(LX(TAG).d("entries", m_entries.size()));
+}
+
+void FeatureDiscoveryCache::persistEntry(const std::string& key, const Entry& entry) {
+    if (m_localStorage == nullptr) {
+        return;
+    }
+    auto featuresJson = json::array();
+    for (const auto& feature : entry.features) {
+        featuresJson.push_back(
+            {{ENTRY_UTTERANCE, feature.utteranceText}, {ENTRY_DESCRIPTION, feature.descriptionText}});
+    }
+    json entryJson = {
+        {ENTRY_FETCH_TIME,
+         std::chrono::duration_cast<std::chrono::milliseconds>(entry.fetchTime.time_since_epoch()).count()},
+        {ENTRY_FEATURES, featuresJson}};
+    if (!m_localStorage->put(FEATURE_DISCOVERY_CACHE_TABLE, key, entryJson.dump())) {
+        AACE_WARN(LX(TAG).m("Failed to persist cache entry"));
+    }
+}
+
+FeatureDiscoveryCache::Features FeatureDiscoveryCache::getFeatures(const std::string& url, const std::string& locale) {
+    auto key = locale + KEY_SEPARATOR + url;
+    Features staleFeatures;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            auto age = std::chrono::system_clock::now() - it->second.fetchTime;
+            // a result fetched in the future is treated as expired, since the clock was moved back
+            if (age.count() >= 0 && age < m_timeToLive) {
+                AACE_DEBUG(LX(TAG).m("Serving cached features").d("locale", locale));
+                return it->second.features;
+            }
+            if (age.count() >= 0 && age < m_maxStaleAge) {
+                staleFeatures = it->second.features;
+            }
+        }
+    }
+    if (!staleFeatures.empty()) {
+        AACE_DEBUG(LX(TAG).m("Serving stale features while refreshing").d("locale", locale));
+        refreshInBackground(key, url, locale);
+        return staleFeatures;
+    }
+    return fetchCoalesced(key, url, locale);
+}
+
+FeatureDiscoveryCache::Features FeatureDiscoveryCache::fetchCoalesced(
+    const std::string& key,
+    const std::string& url,
+    const std::string& locale) {
+    std::shared_ptr<std::promise<Features>> promise;
+    std::shared_future<Features> future;
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        generation = m_generation;
+        auto it = m_pendingFetches.find(key);
+        if (it != m_pendingFetches.end()) {
+            future = it->second;
+        } else {
+            promise = std::make_shared<std::promise<Features>>();
+            future = promise->get_future().share();
+            m_pendingFetches.emplace(key, future);
+        }
+    }
+    if (promise == nullptr) {
+        AACE_DEBUG(LX(TAG).m("Waiting for pending fetch").d("locale", locale));
+        return future.get();
+    }
+
+    Features features;
+    try {
+        features = m_fetch(url, locale);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+    }
+    Entry entry{features, std::chrono::system_clock::now()};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // failed fetches are not cached, so the next request tries again. Neither is a fetch the cache was cleared
+        // during, since it may belong to the previous user, and a fetch started after the clear is now pending.
+        if (generation == m_generation) {
+            if (!features.empty()) {
+                m_entries[key] = entry;
+                persistEntry(key, entry);
+            }
+            m_pendingFetches.erase(key);
+        }
+    }
+    promise->set_value(features);
+    return features;
+}
+
+void FeatureDiscoveryCache::refreshInBackground(
+    const std::string& key,
+    const std::string& url,
+    const std::string& locale) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pendingFetches.find(key) != m_pendingFetches.end()) {
+            return;
+        }
+    }
+    std::weak_ptr<FeatureDiscoveryCache> wp = shared_from_this();
+    m_refreshExecutor.submit([wp, key, url, locale] {
+        if (auto sp = wp.lock()) {
+            sp->fetchCoalesced(key, url, locale);
+        }
+    });
+}
+
+void FeatureDiscoveryCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    AACE_INFO(LX(TAG).d("entries", m_entries.size()));
+    m_generation++;
+    m_entries.clear();
+    m_pendingFetches.clear();
+    if (m_localStorage != nullptr) {
+        m_localStorage->removeTable(FEATURE_DISCOVERY_CACHE_TABLE);
+    }
+}
+
+void FeatureDiscoveryCache::shutdown() {
+    m_refreshExecutor.shutdown();
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
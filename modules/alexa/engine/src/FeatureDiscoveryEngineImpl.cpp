@@ -22,6 +22,7 @@
 #include <AACE/Engine/Metrics/DurationDataPointBuilder.h>
 #include <AACE/Engine/Metrics/StringDataPointBuilder.h>
 #include <AACE/Engine/Metrics/MetricEventBuilder.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 #include <AACE/Engine/Utils/Agent/AgentId.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AACE/Engine/Alexa/AlexaComponentInterface.h>
@@ -183,8 +184,15 @@ std::shared_ptr<FeatureDiscoveryEngineImpl> FeatureDiscoveryEngineImpl::create(
     std::shared_ptr<aace::engine::core::EngineContext> engineContext) {
     try {
         ThrowIfNull(platformInterface, "nullPlatformInterface");
-        auto featureDiscoveryEngineImpl =
-            std::shared_ptr<FeatureDiscoveryEngineImpl>(new FeatureDiscoveryEngineImpl(platformInterface));
+        ThrowIfNull(engineContext, "nullEngineContext");
+        auto alexaComponents =
+            engineContext->getServiceInterface<aace::engine::alexa::AlexaComponentInterface>("aace.alexa");
+        ThrowIfNull(alexaComponents, "nullAlexaComponentInterface");
+        auto customerDataManager = alexaComponents->getCustomerDataManager();
+        ThrowIfNull(customerDataManager, "nullCustomerDataManager");
+
+        auto featureDiscoveryEngineImpl = std::shared_ptr<FeatureDiscoveryEngineImpl>(
+            new FeatureDiscoveryEngineImpl(platformInterface, customerDataManager));
         ThrowIfNull(featureDiscoveryEngineImpl, "featureDiscoveryEngineImplIsNull");
         ThrowIfNot(
             featureDiscoveryEngineImpl->initialize(engineContext), "failedToInitializeFeatureDiscoveryEngineImpl");
@@ -196,8 +204,11 @@ std::shared_ptr<FeatureDiscoveryEngineImpl> FeatureDiscoveryEngineImpl::create(
 }
 
 FeatureDiscoveryEngineImpl::FeatureDiscoveryEngineImpl(
-    std::shared_ptr<aace::alexa::FeatureDiscovery> platformInterface) :
-        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG), m_platformInterface(platformInterface) {
+    std::shared_ptr<aace::alexa::FeatureDiscovery> platformInterface,
+    std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManagerInterface> customerDataManager) :
+        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
+        alexaClientSDK::registrationManager::CustomerDataHandler(customerDataManager),
+        m_platformInterface(platformInterface) {
 }
 
 bool FeatureDiscoveryEngineImpl::initialize(std::shared_ptr<aace::engine::core::EngineContext> engineContext) {
@@ -228,6 +239,22 @@ bool FeatureDiscoveryEngineImpl::initialize(std::shared_ptr<aace::engine::core::
         m_featureDiscoveryRESTAgent = FeatureDiscoveryRESTAgent::create(authDelegate, alexaEndpoints);
         ThrowIfNull(m_featureDiscoveryRESTAgent, "nullFeatureDiscoveryRESTAgent");
 
+        // the cached features are only kept in memory if local storage is not available
+        auto localStorage =
+            engineContext->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+        std::weak_ptr<FeatureDiscoveryRESTAgent> restAgent = m_featureDiscoveryRESTAgent;
+        m_featureDiscoveryCache = FeatureDiscoveryCache::create(
+            [restAgent](const std::string& url, const std::string& locale) -> FeatureDiscoveryCache::Features {
+                auto agent = restAgent.lock();
+                if (agent == nullptr) {
+                    return {};
+                }
+                auto response = agent->getHTTPResponseFromCloud(url, locale);
+                return agent->getFeaturesFromHTTPResponse(response, locale);
+            },
+            localStorage);
+        ThrowIfNull(m_featureDiscoveryCache, "nullFeatureDiscoveryCache");
+
         // initialize the software version tag
         aace::engine::core::Version engineVersion = aace::engine::core::version::getEngineVersion();
 
@@ -336,9 +363,7 @@ void FeatureDiscoveryEngineImpl::executeOnGetFeatures(
                 AACE_ERROR(LX(TAG).d("reason", "discoveredFeaturesEmpty"));
                 continue;
             }
-            auto response = m_featureDiscoveryRESTAgent->getHTTPResponseFromCloud(queryString, selectedLocale);
-            auto discoveredFeatures =
-                m_featureDiscoveryRESTAgent->getFeaturesFromHTTPResponse(response, selectedLocale);
+            auto discoveredFeatures = m_featureDiscoveryCache->getFeatures(queryString, selectedLocale);
             if (discoveredFeatures.empty()) {
                 duration.stopTimer();
                 submitHintsRequestResultMetrics(
@@ -388,10 +413,21 @@ void FeatureDiscoveryEngineImpl::executeOnGetFeatures(
 void FeatureDiscoveryEngineImpl::doShutdown() {
     m_executor.waitForSubmittedTasks();
     m_executor.shutdown();
+    // the cache is kept, since the customer data manager may still clear it
+    if (m_featureDiscoveryCache != nullptr) {
+        m_featureDiscoveryCache->shutdown();
+    }
     m_validCombinations.clear();
     m_platformInterface.reset();
 }
 
+void FeatureDiscoveryEngineImpl::clearData() {
+    AACE_INFO(LX(TAG));
+    if (m_featureDiscoveryCache != nullptr) {
+        m_featureDiscoveryCache->clear();
+    }
+}
+
 }  // namespace alexa
 }  // namespace engine
 }  // namespace aace
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Utils/Agent/AgentId.h"
 #include "AACE/Engine/Utils/String/StringUtils.h"
+#include "AACE/Engine/Utils/Tracing/Tracer.h"
 
 namespace aace {
 namespace engine {
@@ -123,6 +124,7 @@ SpeechRecognizerEngineImpl::SpeechRecognizerEngineImpl(
         m_speechRecognizerPlatformInterface(speechRecognizerPlatformInterface),
         m_audioFormat(audioFormat),
         m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT),
+        m_executor(aace::engine::utils::threading::TaskPriority::CRITICAL),
         m_state(alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::IDLE) {
 }
 
@@ -488,6 +490,7 @@ bool SpeechRecognizerEngineImpl::onStartCapture(
     uint64_t keywordEnd,
     const std::string& keyword) {
     AACE_INFO(LX(TAG).d("initiator", initiator));
+    AACE_TRACE_SPAN("SpeechRecognizer", "StartCapture");
 
     std::lock_guard<std::mutex> lock(m_agentAvailabilityMutex);
     if (m_connectionStatus != aace::alexa::AlexaClient::ConnectionStatus::CONNECTED && m_availableAgents.empty()) {
@@ -626,6 +629,8 @@ void SpeechRecognizerEngineImpl::onKeyWordDetected(
     alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
     alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
     std::shared_ptr<const std::vector<char>> KWDMetadata) {
+    AACE_TRACE_INSTANT("SpeechRecognizer", "WakewordDetected");
+
     //Verify if this is external wakeword and it is enabled and call platform interface
     if (is3PWakewordEnabled(keyword)) {
         AACE_INFO(LX(TAG).d("Active 3P Wakeword is detected", keyword));
@@ -812,6 +817,12 @@ void SpeechRecognizerEngineImpl::onStateChanged(
 
     m_state = state;
 
+    if (state == alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::RECOGNIZING) {
+        AACE_TRACE_INSTANT("SpeechRecognizer", "Recognizing");
+    } else if (state == alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::BUSY) {
+        AACE_TRACE_INSTANT("SpeechRecognizer", "EndOfSpeech");
+    }
+
     // state changed to BUSY means that either the StopCapture directive has been received
     // or the speech recognizer was stopped manually
     if (state == alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::BUSY) {
@@ -47,6 +47,7 @@ bool SystemSoundPlayer::initialize(
     try {
         m_audioManager = audioManager;
         m_audioFactory = audioFactory;
+        loadTones();
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -54,6 +55,28 @@ bool SystemSoundPlayer::initialize(
     }
 }
 
+void SystemSoundPlayer::loadTones() {
+    using Tone = alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone;
+    for (auto tone : {Tone::WAKEWORD_NOTIFICATION, Tone::END_SPEECH}) {
+        std::shared_ptr<std::istream> stream;
+        auto streamFormat = alexaClientSDK::avsCommon::utils::MediaType::UNKNOWN;
+        switch (tone) {
+            case Tone::WAKEWORD_NOTIFICATION:
+                std::tie(stream, streamFormat) = m_audioFactory->wakeWordNotificationTone()();
+                break;
+            case Tone::END_SPEECH:
+                std::tie(stream, streamFormat) = m_audioFactory->endSpeechTone()();
+                break;
+        }
+        auto buffer = aace::engine::audio::SharedBufferAudioStream::load(stream);
+        if (buffer == nullptr) {
+            AACE_WARN(LX(TAG).m("Failed to load tone, it will be streamed instead").d("tone", static_cast<int>(tone)));
+            continue;
+        }
+        m_tones[tone] = buffer;
+    }
+}
+
 std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> SystemSoundPlayer::getAudioChannel() {
     try {
         // open the EARCON audio channel if it hasn't already been opened
@@ -75,6 +98,13 @@ std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> SystemSoundPla
     }
 }
 
+void SystemSoundPlayer::primeAudioChannel() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (getAudioChannel() == nullptr) {
+        AACE_WARN(LX(TAG).m("Failed to prime the audio channel"));
+    }
+}
+
 //
 // aace::audio::AudioOutputEngineInterface
 //
@@ -110,8 +140,15 @@ std::shared_future<bool> SystemSoundPlayer::playTone(Tone tone) {
         auto audioChannel = getAudioChannel();
         ThrowIfNull(audioChannel, "invalidAudioChannel");
 
-        // create the audio stream
-        auto stream = SystemSoundAudioStream::create(m_audioFactory, tone);
+        // create the audio stream, from memory when the tone is loaded
+        std::shared_ptr<aace::audio::AudioStream> stream;
+        auto it = m_tones.find(tone);
+        if (it != m_tones.end()) {
+            stream = aace::engine::audio::SharedBufferAudioStream::create(
+                it->second, aace::audio::AudioFormat::UNKNOWN, SystemSoundAudioStream::getToneProperties(tone));
+        } else {
+            stream = SystemSoundAudioStream::create(m_audioFactory, tone);
+        }
         ThrowIfNull(stream, "invalidAudioStream");
 
         // prepare the sound to play
@@ -198,8 +235,13 @@ bool SystemSoundAudioStream::isClosed() {
 }
 
 std::vector<aace::audio::AudioStreamProperty> SystemSoundAudioStream::getProperties() {
+    return getToneProperties(m_tone);
+}
+
+std::vector<aace::audio::AudioStreamProperty> SystemSoundAudioStream::getToneProperties(
+    alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone) {
     return {{"cache-policy", "ALWAYS"},
-            {"cache-id", "aace.alexa.SystemSoundPlayer#" + std::to_string(static_cast<int>(m_tone))}};
+            {"cache-id", "aace.alexa.SystemSoundPlayer#" + std::to_string(static_cast<int>(tone))}};
 }
 
 }  // namespace alexa
@@ -14,8 +14,10 @@
  */
 
 #include <functional>
+#include <future>
 #include <istream>
 #include <memory>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -36,6 +38,32 @@ static const std::string CONTENT_CHANNEL_NAME{"Content"};
 /// The interface name for AudioPlayer in AudioActivityTracker.
 static const std::string AUDIO_PLAYER_INTERFACE_NAME{"AudioPlayer"};
 
+/// The url of the media source set in the tests.
+static const std::string TEST_URL{"https://www.example.com/media.mp3"};
+
+/// The time to wait for the queued operations to be executed.
+static const std::chrono::seconds TIMEOUT{2};
+
+using MediaPlayerState = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState;
+using SourceId = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId;
+using ErrorType = alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType;
+
+/// The source id returned when a source could not be set.
+static const SourceId INVALID_SOURCE_ID = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::ERROR;
+
+/// Observer of the media player callbacks of the engine implementation
+class MockMediaPlayerObserver : public alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface {
+public:
+    MOCK_METHOD2(onFirstByteRead, void(SourceId id, const MediaPlayerState& state));
+    MOCK_METHOD2(onPlaybackStarted, void(SourceId id, const MediaPlayerState& state));
+    MOCK_METHOD2(onPlaybackFinished, void(SourceId id, const MediaPlayerState& state));
+    MOCK_METHOD4(
+        onPlaybackError,
+        void(SourceId id, const ErrorType& type, std::string error, const MediaPlayerState& state));
+    MOCK_METHOD2(onPlaybackPaused, void(SourceId id, const MediaPlayerState& state));
+    MOCK_METHOD2(onPlaybackResumed, void(SourceId id, const MediaPlayerState& state));
+};
+
 class AudioPlayerEngineImplTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -407,4 +435,108 @@ TEST_F(AudioPlayerEngineImplTest, testSetAsForegroundActivityCallsActivityTracke
         .Times(1);
 
     m_engineImpl->onSetAsForegroundActivity();
-}
\ No newline at end of file
+}
+
+/**
+ * Verifies that in the non-blocking mode the control operations return while the audio output channel is busy, and
+ * that a queued pause and resume are reported to the observers without pausing the audio output channel.
+ */
+TEST_F(AudioPlayerEngineImplTest, nonBlockingControlCoalescesPauseAndResume) {
+    auto audioOutputChannel = m_alexaMockFactory->getAudioOutputChannelMock();
+    auto observer = std::make_shared<testing::NiceMock<MockMediaPlayerObserver>>();
+    m_engineImpl->setNonBlockingControl(true);
+    m_engineImpl->addObserver(observer);
+
+    std::promise<void> prepareReleased;
+    std::shared_future<void> prepareReleasedFuture = prepareReleased.get_future().share();
+    std::promise<void> played;
+    std::promise<void> duckingStarted;
+    std::promise<void> duckingReleased;
+    std::shared_future<void> duckingReleasedFuture = duckingReleased.get_future().share();
+    EXPECT_CALL(*audioOutputChannel, prepare(TEST_URL, false, testing::_))
+        .WillOnce(testing::InvokeWithoutArgs([prepareReleasedFuture] {
+            prepareReleasedFuture.wait();
+            return true;
+        }));
+    EXPECT_CALL(*audioOutputChannel, setPosition(0)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*audioOutputChannel, play()).WillOnce(testing::InvokeWithoutArgs([&played] {
+        played.set_value();
+        return true;
+    }));
+    EXPECT_CALL(*audioOutputChannel, startDucking()).WillOnce(testing::InvokeWithoutArgs([&, duckingReleasedFuture] {
+        duckingStarted.set_value();
+        duckingReleasedFuture.wait();
+        return true;
+    }));
+    EXPECT_CALL(*audioOutputChannel, getPosition()).WillRepeatedly(testing::Return(0));
+    EXPECT_CALL(*audioOutputChannel, pause()).Times(0);
+    EXPECT_CALL(*audioOutputChannel, resume()).Times(0);
+
+    // the source and play are queued while the audio output channel prepares the source
+    auto id = m_engineImpl->setSource(
+        TEST_URL,
+        std::chrono::milliseconds(0),
+        alexaClientSDK::avsCommon::utils::mediaPlayer::emptySourceConfig(),
+        false,
+        alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext());
+    ASSERT_NE(INVALID_SOURCE_ID, id);
+    EXPECT_TRUE(m_engineImpl->play(id));
+    prepareReleased.set_value();
+    ASSERT_EQ(std::future_status::ready, played.get_future().wait_for(TIMEOUT));
+
+    std::promise<void> started;
+    EXPECT_CALL(*observer, onPlaybackStarted(id, testing::_)).WillOnce(testing::InvokeWithoutArgs([&started] {
+        started.set_value();
+    }));
+    m_engineImpl->onMediaStateChanged(aace::audio::AudioOutputEngineInterface::MediaState::PLAYING);
+    ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(TIMEOUT));
+
+    // hold the executor so the pause and resume are both queued before they are executed
+    std::thread ducking([this] { m_engineImpl->startDucking(); });
+    ASSERT_EQ(std::future_status::ready, duckingStarted.get_future().wait_for(TIMEOUT));
+
+    std::promise<void> resumed;
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(*observer, onPlaybackPaused(id, testing::_));
+        EXPECT_CALL(*observer, onPlaybackResumed(id, testing::_)).WillOnce(testing::InvokeWithoutArgs([&resumed] {
+            resumed.set_value();
+        }));
+    }
+    EXPECT_TRUE(m_engineImpl->pause(id));
+    EXPECT_TRUE(m_engineImpl->resume(id));
+    duckingReleased.set_value();
+    ducking.join();
+    EXPECT_EQ(std::future_status::ready, resumed.get_future().wait_for(TIMEOUT));
+}
+
+/**
+ * Verifies that in the non-blocking mode a source the audio output channel fails to prepare is reported to the
+ * observers as a playback error of the returned source id.
+ */
+TEST_F(AudioPlayerEngineImplTest, nonBlockingControlReportsFailedSource) {
+    auto audioOutputChannel = m_alexaMockFactory->getAudioOutputChannelMock();
+    auto observer = std::make_shared<testing::NiceMock<MockMediaPlayerObserver>>();
+    m_engineImpl->setNonBlockingControl(true);
+    m_engineImpl->addObserver(observer);
+
+    std::promise<SourceId> failed;
+    EXPECT_CALL(*audioOutputChannel, prepare(TEST_URL, false, testing::_)).WillOnce(testing::Return(false));
+    EXPECT_CALL(
+        *observer, onPlaybackError(testing::_, ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, testing::_, testing::_))
+        .WillOnce(testing::Invoke([&failed](SourceId id, const ErrorType&, std::string, const MediaPlayerState&) {
+            failed.set_value(id);
+        }));
+
+    auto id = m_engineImpl->setSource(
+        TEST_URL,
+        std::chrono::milliseconds(0),
+        alexaClientSDK::avsCommon::utils::mediaPlayer::emptySourceConfig(),
+        false,
+        alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext());
+    ASSERT_NE(INVALID_SOURCE_ID, id);
+
+    auto failedFuture = failed.get_future();
+    ASSERT_EQ(std::future_status::ready, failedFuture.wait_for(TIMEOUT));
+    EXPECT_EQ(id, failedFuture.get());
+}
@@ -16,6 +16,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include <AVSCommon/SDKInterfaces/test/Storage/StubMiscStorage.h>
 #include <AVSCommon/SDKInterfaces/test/MockAVSConnectionManager.h>
 #include <AVSCommon/SDKInterfaces/test/MockDirectiveSequencer.h>
@@ -41,6 +45,11 @@ public:
     MOCK_METHOD1(onAuthFailure, void(const std::string& token));
 };
 
+class MockExpiringAuthorizationAdapter : public MockAuthorizationAdapterInterface {
+public:
+    MOCK_METHOD0(getAuthTokenExpirationTime, std::chrono::steady_clock::time_point());
+};
+
 class MockAuthObserverInterface : public AuthObserverInterface {
 public:
     MOCK_METHOD2(onAuthStateChange, void(State newState, Error error));
@@ -343,3 +352,110 @@ TEST_F(AuthorizationManagerTest, test_verifyRegisteringDuplicatesOverwritesPrevi
     auto logoutResult = authorizationManager->logout("test");
     ASSERT_EQ(logoutResult, true) << "StartAuthorizationResult expected to be true";
 }
+
+TEST_F(AuthorizationManagerTest, test_authTokenIsServedFromSnapshot) {
+    auto authorizationManager = createAuthorizationManager();
+    ASSERT_NE(authorizationManager, nullptr) << "AuthorizationManager pointer expected to be not null";
+
+    auto adapter = std::make_shared<StrictMock<MockAuthorizationAdapterInterface>>();
+    authorizationManager->registerAuthorizationAdapter("test1", adapter);
+    ASSERT_EQ(
+        authorizationManager->startAuthorization("test1"), AuthorizationManager::StartAuthorizationResult::AUTHORIZE);
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::REFRESHED, AuthorizationManagerInterface::Error::SUCCESS);
+
+    // Only the first call is expected to reach the adapter
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(Return("TestAuthToken"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken");
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken");
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken");
+
+    EXPECT_CALL(*adapter, deregister()).Times(1);
+    ASSERT_TRUE(authorizationManager->logout("test1"));
+}
+
+TEST_F(AuthorizationManagerTest, test_authStateChangeAndAuthFailureClearSnapshot) {
+    auto authorizationManager = createAuthorizationManager();
+    ASSERT_NE(authorizationManager, nullptr) << "AuthorizationManager pointer expected to be not null";
+
+    auto adapter = std::make_shared<StrictMock<MockAuthorizationAdapterInterface>>();
+    authorizationManager->registerAuthorizationAdapter("test1", adapter);
+    ASSERT_EQ(
+        authorizationManager->startAuthorization("test1"), AuthorizationManager::StartAuthorizationResult::AUTHORIZE);
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::REFRESHED, AuthorizationManagerInterface::Error::SUCCESS);
+
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(Return("TestAuthToken1"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken1");
+
+    // An expired token is not served from the snapshot
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::EXPIRED, AuthorizationManagerInterface::Error::SUCCESS);
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(Return("TestAuthToken2"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken2");
+
+    // A token rejected by the cloud is not served from the snapshot
+    EXPECT_CALL(*adapter, onAuthFailure("TestAuthToken2")).Times(1);
+    authorizationManager->onAuthFailure("TestAuthToken2");
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(Return("TestAuthToken3"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken3");
+
+    EXPECT_CALL(*adapter, deregister()).Times(1);
+    ASSERT_TRUE(authorizationManager->logout("test1"));
+}
+
+TEST_F(AuthorizationManagerTest, test_refreshedAuthTokenReplacesSnapshotInBackground) {
+    auto authorizationManager = createAuthorizationManager();
+    ASSERT_NE(authorizationManager, nullptr) << "AuthorizationManager pointer expected to be not null";
+
+    auto adapter = std::make_shared<StrictMock<MockAuthorizationAdapterInterface>>();
+    authorizationManager->registerAuthorizationAdapter("test1", adapter);
+    ASSERT_EQ(
+        authorizationManager->startAuthorization("test1"), AuthorizationManager::StartAuthorizationResult::AUTHORIZE);
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::REFRESHED, AuthorizationManagerInterface::Error::SUCCESS);
+
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(Return("TestAuthToken1"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken1");
+
+    std::promise<void> fetched;
+    EXPECT_CALL(*adapter, getAuthToken()).WillOnce(InvokeWithoutArgs([&fetched]() {
+        fetched.set_value();
+        return "TestAuthToken2";
+    }));
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::REFRESHED, AuthorizationManagerInterface::Error::SUCCESS);
+    ASSERT_EQ(fetched.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready)
+        << "Refreshed token was not fetched";
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (authorizationManager->getAuthToken() != "TestAuthToken2" && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken2") << "Refreshed token should replace the snapshot";
+
+    EXPECT_CALL(*adapter, deregister()).Times(1);
+    ASSERT_TRUE(authorizationManager->logout("test1"));
+}
+
+TEST_F(AuthorizationManagerTest, test_expiredAuthTokenIsNotServedFromSnapshot) {
+    auto authorizationManager = createAuthorizationManager();
+    ASSERT_NE(authorizationManager, nullptr) << "AuthorizationManager pointer expected to be not null";
+
+    auto adapter = std::make_shared<StrictMock<MockExpiringAuthorizationAdapter>>();
+    authorizationManager->registerAuthorizationAdapter("test1", adapter);
+    ASSERT_EQ(
+        authorizationManager->startAuthorization("test1"), AuthorizationManager::StartAuthorizationResult::AUTHORIZE);
+    authorizationManager->authStateChanged(
+        "test1", AuthorizationManagerInterface::State::REFRESHED, AuthorizationManagerInterface::Error::SUCCESS);
+
+    EXPECT_CALL(*adapter, getAuthTokenExpirationTime())
+        .Times(2)
+        .WillRepeatedly(Return(std::chrono::steady_clock::now() - std::chrono::seconds(1)));
+    EXPECT_CALL(*adapter, getAuthToken()).Times(2).WillRepeatedly(Return("TestAuthToken"));
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken");
+    EXPECT_EQ(authorizationManager->getAuthToken(), "TestAuthToken");
+
+    EXPECT_CALL(*adapter, deregister()).Times(1);
+    ASSERT_TRUE(authorizationManager->logout("test1"));
+}
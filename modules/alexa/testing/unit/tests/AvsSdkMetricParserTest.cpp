@@ -0,0 +1,108 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+
+#include <AACE/Engine/Alexa/AvsSdkMetricParser.h>
+
+using namespace aace::engine::alexa;
+namespace avsMetrics = alexaClientSDK::avsCommon::utils::metrics;
+
+/// Test harness for @c AvsSdkMetricParser class
+class AvsSdkMetricParserTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(m_parser.configure());
+    }
+
+    /// Creates an AVS SDK metric with a single counter data point
+    static std::shared_ptr<avsMetrics::MetricEvent> createCounterMetric(
+        const std::string& source,
+        const std::string& name,
+        uint64_t count) {
+        return avsMetrics::MetricEventBuilder{}
+            .setActivityName(source)
+            .addDataPoint(avsMetrics::DataPointCounterBuilder{}.setName(name).increment(count).build())
+            .build();
+    }
+
+    /// @return The data points of a converted metric, keyed by name
+    static std::map<std::string, std::string> getDataPoints(const std::shared_ptr<MetricEvent>& metric) {
+        std::map<std::string, std::string> dataPoints;
+        for (const auto& dataPoint : metric->getDataPoints()) {
+            dataPoints[dataPoint.getName()] = dataPoint.getValue();
+        }
+        return dataPoints;
+    }
+
+protected:
+    AvsSdkMetricParser m_parser;
+};
+
+TEST_F(AvsSdkMetricParserTest, unknownSourceIsDropped) {
+    EXPECT_EQ(nullptr, m_parser.convertMetric(createCounterMetric("UNKNOWN-Source", "Count", 1)));
+}
+
+TEST_F(AvsSdkMetricParserTest, prefixOverrideIsConvertedAsIs) {
+    auto metric = m_parser.convertMetric(createCounterMetric("HybridRouter-Route", "Count", 2));
+    ASSERT_NE(nullptr, metric);
+    EXPECT_EQ("HybridRouter-Route", metric->getSourceName());
+    std::map<std::string, std::string> expected = {{"Count", "2"}};
+    EXPECT_EQ(expected, getDataPoints(metric));
+
+    EXPECT_EQ(nullptr, m_parser.convertMetric(createCounterMetric("HybridRoute", "Count", 2)))
+        << "A source shorter than the prefix should not match";
+}
+
+TEST_F(AvsSdkMetricParserTest, namedDataPointIsTransformed) {
+    auto metric = m_parser.convertMetric(avsMetrics::MetricEventBuilder{}
+                                             .setActivityName("UPL-MEDIA_STOP")
+                                             .addDataPoint(avsMetrics::DataPointDurationBuilder{}
+                                                               .setName("MediaStop")
+                                                               .setDuration(std::chrono::milliseconds(5))
+                                                               .build())
+                                             .build());
+    ASSERT_NE(nullptr, metric);
+    std::map<std::string, std::string> expected = {{"MediaStop", "5"}, {"MediaLatencyType", "MediaStop"}};
+    EXPECT_EQ(expected, getDataPoints(metric));
+}
+
+TEST_F(AvsSdkMetricParserTest, metricWithZeroCountIsDropped) {
+    EXPECT_EQ(
+        nullptr,
+        m_parser.convertMetric(createCounterMetric("AUDIO_PLAYER-MessageSentFailed", "MessageSentFailed", 0)));
+
+    auto metric =
+        m_parser.convertMetric(createCounterMetric("AUDIO_PLAYER-MessageSentFailed", "MessageSentFailed", 3));
+    ASSERT_NE(nullptr, metric);
+    std::map<std::string, std::string> expected = {{"AudioPlayerErrorCount", "3"},
+                                                   {"ErrorType", "MessageSentFailed"}};
+    EXPECT_EQ(expected, getDataPoints(metric));
+}
+
+TEST_F(AvsSdkMetricParserTest, splitNameUsesSuffixAsDimension) {
+    auto metric = m_parser.convertMetric(
+        createCounterMetric("SPEAKER_MANAGER-setVolumeSource_DIRECTIVE", "setVolumeSource_DIRECTIVE", 1));
+    ASSERT_NE(nullptr, metric);
+    std::map<std::string, std::string> expected = {{"SetVolumeCount", "1"}, {"Source", "DIRECTIVE"}};
+    EXPECT_EQ(expected, getDataPoints(metric));
+}
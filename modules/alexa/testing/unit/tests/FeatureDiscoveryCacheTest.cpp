@@ -0,0 +1,268 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
+
+using namespace aace::engine::alexa;
+using Features = FeatureDiscoveryCache::Features;
+
+static const std::string TEST_URL = "https://api.amazonalexa.com/v1/hints?domain=NEWS&eventType=THINGS_TO_TRY&limit=1";
+static const std::string TEST_LOCALE_EN_US = "en-US";
+static const std::string TEST_LOCALE_FR_CA = "fr-CA";
+static const std::chrono::seconds TIMEOUT{2};
+
+/// In memory @c LocalStorageInterface
+class InMemoryLocalStorage : public aace::engine::storage::LocalStorageInterface {
+public:
+    bool put(const std::string& table, const std::string& key, const std::string& value) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tables[table][key] = value;
+        return true;
+    }
+    std::string get(const std::string& table, const std::string& key) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables[table][key];
+    }
+    std::string get(const std::string& table, const std::string& key, const std::string& defaultValue) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables[table].find(key);
+        return it != m_tables[table].end() ? it->second : defaultValue;
+    }
+    bool removeKey(const std::string& table, const std::string& key) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables[table].erase(key) == 1;
+    }
+    bool removeTable(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables.erase(table) == 1;
+    }
+    bool containsKey(const std::string& table, const std::string& key) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables.find(table);
+        return it != m_tables.end() && it->second.find(key) != it->second.end();
+    }
+    bool containsTable(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables.find(table) != m_tables.end();
+    }
+    std::vector<std::string> keys(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> keys;
+        for (auto& item : m_tables[table]) {
+            keys.push_back(item.first);
+        }
+        return keys;
+    }
+    std::vector<KeyValuePair> list(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::vector<KeyValuePair>(m_tables[table].begin(), m_tables[table].end());
+    }
+    bool begin() override {
+        return true;
+    }
+    bool commit() override {
+        return true;
+    }
+    bool cancel() override {
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::map<std::string, std::string>> m_tables;
+};
+
+/// Test harness for @c FeatureDiscoveryCache class, which stands in for the cloud with a fetch function
+class FeatureDiscoveryCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_localStorage = std::make_shared<InMemoryLocalStorage>();
+    }
+
+    void TearDown() override {
+        if (m_cache != nullptr) {
+            m_cache->shutdown();
+        }
+    }
+
+    /// Creates the cache under test, whose fetches return the utterance "<locale> <fetch count>"
+    void createCache(std::chrono::milliseconds timeToLive, std::chrono::milliseconds maxStaleAge) {
+        m_cache = FeatureDiscoveryCache::create(
+            [this](const std::string& url, const std::string& locale) { return fetch(url, locale); },
+            m_localStorage,
+            timeToLive,
+            maxStaleAge);
+        ASSERT_NE(nullptr, m_cache);
+    }
+
+    Features fetch(const std::string&, const std::string& locale) {
+        auto count = ++m_fetchCount;
+        if (m_onFetch) {
+            m_onFetch();
+        }
+        if (m_failFetches) {
+            return {};
+        }
+        return {{locale + " " + std::to_string(count), ""}};
+    }
+
+    /// Waits until the fetch count reaches @c count
+    bool waitForFetchCount(int count) {
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (m_fetchCount < count) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    /// Requests the features, counting the request before it reaches the cache
+    Features request(const std::string& locale) {
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            m_requestCount++;
+        }
+        m_requestCondition.notify_all();
+        return m_cache->getFeatures(TEST_URL, locale);
+    }
+
+    /// Waits until @c count requests were made
+    bool waitForRequestCount(int count) {
+        std::unique_lock<std::mutex> lock(m_requestMutex);
+        return m_requestCondition.wait_for(lock, TIMEOUT, [this, count] { return m_requestCount >= count; });
+    }
+
+    static std::string utteranceOf(const Features& features) {
+        return features.empty() ? "" : features[0].utteranceText;
+    }
+
+protected:
+    std::shared_ptr<InMemoryLocalStorage> m_localStorage;
+    std::shared_ptr<FeatureDiscoveryCache> m_cache;
+    std::atomic<int> m_fetchCount{0};
+    std::atomic<bool> m_failFetches{false};
+    /// Called by every fetch before it returns
+    std::function<void()> m_onFetch;
+    std::mutex m_requestMutex;
+    std::condition_variable m_requestCondition;
+    int m_requestCount = 0;
+};
+
+TEST_F(FeatureDiscoveryCacheTest, cachedFeaturesAreServedWithoutFetching) {
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    EXPECT_EQ("fr-CA 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_FR_CA)))
+        << "Results should be cached per locale";
+    EXPECT_EQ(2, m_fetchCount);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, failedFetchIsNotCached) {
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    m_failFetches = true;
+    EXPECT_TRUE(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US).empty());
+    m_failFetches = false;
+    EXPECT_EQ("en-US 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+}
+
+TEST_F(FeatureDiscoveryCacheTest, concurrentRequestsAreCoalesced) {
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    // the fetch of the first request completes only once the second request is made, which either joins the fetch
+    // or, if it reaches the cache after the fetch completed, is served the cached result
+    std::promise<void> fetchStarted;
+    m_onFetch = [this, &fetchStarted] {
+        fetchStarted.set_value();
+        EXPECT_TRUE(waitForRequestCount(2));
+    };
+    auto first = std::async(std::launch::async, [this] { return request(TEST_LOCALE_EN_US); });
+    ASSERT_EQ(std::future_status::ready, fetchStarted.get_future().wait_for(TIMEOUT));
+    auto second = std::async(std::launch::async, [this] { return request(TEST_LOCALE_EN_US); });
+
+    EXPECT_EQ("en-US 1", utteranceOf(first.get()));
+    EXPECT_EQ("en-US 1", utteranceOf(second.get()));
+    EXPECT_EQ(1, m_fetchCount);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, staleFeaturesAreServedWhileRefreshing) {
+    createCache(std::chrono::milliseconds(0), std::chrono::hours(1));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)))
+        << "The stale result should be served";
+    ASSERT_TRUE(waitForFetchCount(2)) << "The stale result should be refreshed in the background";
+    m_cache->shutdown();
+
+    EXPECT_EQ("en-US 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+}
+
+TEST_F(FeatureDiscoveryCacheTest, expiredFeaturesAreFetchedAgain) {
+    createCache(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    EXPECT_EQ("en-US 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+}
+
+TEST_F(FeatureDiscoveryCacheTest, persistedFeaturesAreLoaded) {
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    m_cache->shutdown();
+
+    // a new cache with the same storage serves the result without fetching it
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    EXPECT_EQ(1, m_fetchCount);
+
+    m_cache->clear();
+    EXPECT_EQ("en-US 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+}
+
+TEST_F(FeatureDiscoveryCacheTest, fetchInProgressWhenClearedIsNotCached) {
+    createCache(std::chrono::hours(1), std::chrono::hours(2));
+    // the user logs out while the features of the first request are being fetched
+    bool cleared = false;
+    m_onFetch = [this, &cleared] {
+        if (!cleared) {
+            cleared = true;
+            m_cache->clear();
+        }
+    };
+    EXPECT_EQ("en-US 1", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+
+    EXPECT_EQ("en-US 2", utteranceOf(m_cache->getFeatures(TEST_URL, TEST_LOCALE_EN_US)));
+    EXPECT_EQ(1u, m_localStorage->list("aace.alexa.featureDiscoveryCache").size());
+}
+
+TEST_F(FeatureDiscoveryCacheTest, createWithInvalidArgumentsFails) {
+    EXPECT_EQ(nullptr, FeatureDiscoveryCache::create(nullptr, m_localStorage));
+    EXPECT_EQ(
+        nullptr,
+        FeatureDiscoveryCache::create(
+            [](const std::string&, const std::string&) { return Features(); },
+            nullptr,
+            std::chrono::hours(2),
+            std::chrono::hours(1)));
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_APL_APL_DOCUMENT_STATE_H
+#define AACE_ENGINE_APL_APL_DOCUMENT_STATE_H
+
+#include <memory>
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+/**
+ * An immutable snapshot of the rendered document state reported by the platform, which is the visual context of the
+ * APL document. The snapshot is shared with the tasks providing the context, so it is not copied for every request.
+ *
+ * When a maximum size is given and the serialized state exceeds it, non-essential parts of the visible components
+ * are pruned: first their layout attributes, then their deepest children, until the state fits.
+ */
+class APLDocumentState {
+private:
+    explicit APLDocumentState(const std::string& state);
+
+public:
+    /**
+     * Creates a snapshot of a rendered document state.
+     *
+     * @param state The rendered document state reported by the platform.
+     * @param maxSize The maximum size of the serialized state, or 0 if the state should not be pruned.
+     * @return The snapshot.
+     */
+    static std::shared_ptr<const APLDocumentState> create(const std::string& state, size_t maxSize = 0);
+
+    /// Returns @c true if @c state is the state this snapshot was created from.
+    bool isSameState(const std::string& state) const;
+
+    /// Returns the serialized state to report as the visual context.
+    const std::string& getState() const;
+
+    /// Returns @c true if components were pruned to fit the maximum size.
+    bool isPruned() const;
+
+private:
+    /// Prunes the visible components of the reported state into @c m_prunedState until it fits @c maxSize.
+    void prune(size_t maxSize);
+
+    /// The state reported by the platform.
+    std::string m_reportedState;
+
+    /// The state with its visible components pruned, which is only set if @c m_pruned is @c true.
+    std::string m_prunedState;
+
+    bool m_pruned;
+};
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
+
+#endif
@@ -31,6 +31,7 @@
 
 #include "AACE/APL/APL.h"
 #include "AACE/APL/APLEngineInterface.h"
+#include "AACE/Engine/APL/APLDocumentState.h"
 #include "AACE/Engine/APL/APLRuntimePropertyGenerator.h"
 
 namespace aace {
@@ -45,7 +46,7 @@ class APLEngineImpl
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<APLEngineImpl> {
 private:
-    APLEngineImpl(std::shared_ptr<aace::apl::APL> aplPlatformInterface);
+    APLEngineImpl(std::shared_ptr<aace::apl::APL> aplPlatformInterface, size_t maxDocumentStateSize);
 
     bool initialize(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
@@ -67,7 +68,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        std::shared_ptr<alexaClientSDK::avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator);
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator,
+        size_t maxDocumentStateSize = 0);
 
     // AlexaPresentationObserverInterface
     virtual void renderDocument(const std::string& jsonPayload, const std::string& token, const std::string& windowId)
@@ -132,8 +134,11 @@ private:
     /// Executor
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 
-    /// Rendered document state
-    std::string m_lastReportedDocumentState;
+    /// Snapshot of the last rendered document state reported by the platform
+    std::shared_ptr<const APLDocumentState> m_lastReportedDocumentState;
+
+    /// Maximum size of the reported document state, or 0 if it is not pruned
+    size_t m_maxDocumentStateSize;
 
     /// APL Runtime Property Generator
     APLRuntimePropertyGenerator m_aplRuntimePropertyGenerator;
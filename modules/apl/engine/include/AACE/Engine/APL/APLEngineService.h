@@ -37,6 +37,7 @@ public:
     virtual ~APLEngineService() = default;
 
 protected:
+    bool configure(const nlohmann::json& configuration) override;
     bool start() override;
     bool stop() override;
     bool shutdown() override;
@@ -54,6 +55,9 @@ private:
 
 private:
     std::shared_ptr<aace::engine::apl::APLEngineImpl> m_aplEngineImpl;
+
+    /// Maximum size of the reported document state, or 0 if it is not pruned
+    size_t m_maxDocumentStateSize;
 };
 
 }  // namespace apl
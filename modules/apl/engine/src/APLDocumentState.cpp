@@ -0,0 +1,163 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include "AACE/Engine/APL/APLDocumentState.h"
+
+using json = nlohmann::json;
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.apl.APLDocumentState");
+
+/// The key of the components visible on screen in the rendered document state.
+static const std::string VISIBLE_COMPONENTS_KEY = "componentsVisibleOnScreen";
+
+/// The key of the children of a visible component.
+static const std::string CHILDREN_KEY = "children";
+
+/// The layout attributes of a visible component, which are not needed to resolve an utterance.
+static const std::vector<std::string> LAYOUT_ATTRIBUTES = {"position", "transform", "visibility"};
+
+/// Removes the layout attributes of @c component and its children.
+static void removeLayoutAttributes(json& component) {
+    if (!component.is_object()) {
+        return;
+    }
+    for (const auto& attribute : LAYOUT_ATTRIBUTES) {
+        component.erase(attribute);
+    }
+    auto children = component.find(CHILDREN_KEY);
+    if (children != component.end() && children->is_array()) {
+        for (auto& child : *children) {
+            removeLayoutAttributes(child);
+        }
+    }
+}
+
+/// Returns the depth of the deepest children of @c component, 0 if it has no children.
+static size_t getChildrenDepth(const json& component) {
+    size_t depth = 0;
+    if (component.is_object()) {
+        auto children = component.find(CHILDREN_KEY);
+        if (children != component.end() && children->is_array()) {
+            for (const auto& child : *children) {
+                depth = std::max(depth, getChildrenDepth(child) + 1);
+            }
+        }
+    }
+    return depth;
+}
+
+/// Removes the children of @c component which are deeper than @c depth.
+static void removeChildren(json& component, size_t depth) {
+    if (!component.is_object()) {
+        return;
+    }
+    auto children = component.find(CHILDREN_KEY);
+    if (children == component.end() || !children->is_array()) {
+        return;
+    }
+    if (depth == 0) {
+        component.erase(children);
+        return;
+    }
+    for (auto& child : *children) {
+        removeChildren(child, depth - 1);
+    }
+}
+
+APLDocumentState::APLDocumentState(const std::string& state) : m_reportedState(state), m_pruned(false) {
+}
+
+std::shared_ptr<const APLDocumentState> APLDocumentState::create(const std::string& state, size_t maxSize) {
+    auto documentState = std::shared_ptr<APLDocumentState>(new APLDocumentState(state));
+    // the state is only parsed when it has to be pruned, since it is otherwise reported as given
+    if (maxSize > 0 && state.size() > maxSize) {
+        documentState->prune(maxSize);
+    }
+    return documentState;
+}
+
+bool APLDocumentState::isSameState(const std::string& state) const {
+    return state == m_reportedState;
+}
+
+const std::string& APLDocumentState::getState() const {
+    return m_pruned ? m_prunedState : m_reportedState;
+}
+
+bool APLDocumentState::isPruned() const {
+    return m_pruned;
+}
+
+void APLDocumentState::prune(size_t maxSize) {
+    json document;
+    try {
+        document = json::parse(m_reportedState);
+    } catch (std::exception& ex) {
+        // the state is still reported as given, since the platform owns its format
+        AACE_WARN(LX(TAG).d("reason", "parseDocumentStateFailed").d("error", ex.what()));
+        return;
+    }
+    auto components = document.is_object() ? document.find(VISIBLE_COMPONENTS_KEY) : document.end();
+    if (components == document.end() || !components->is_array()) {
+        AACE_WARN(LX(TAG).d("reason", "noVisibleComponents").d("size", m_reportedState.size()).d("maxSize", maxSize));
+        return;
+    }
+
+    for (auto& component : *components) {
+        removeLayoutAttributes(component);
+    }
+    m_prunedState = document.dump();
+    m_pruned = true;
+
+    size_t depth = 0;
+    for (const auto& component : *components) {
+        depth = std::max(depth, getChildrenDepth(component));
+    }
+    while (m_prunedState.size() > maxSize && depth > 0) {
+        depth--;
+        for (auto& component : *components) {
+            removeChildren(component, depth);
+        }
+        m_prunedState = document.dump();
+    }
+
+    if (m_prunedState.size() > maxSize) {
+        AACE_WARN(LX(TAG)
+                      .d("reason", "documentStateExceedsMaxSize")
+                      .d("size", m_prunedState.size())
+                      .d("maxSize", maxSize));
+    } else {
+        AACE_DEBUG(LX(TAG)
+                       .d("size", m_reportedState.size())
+                       .d("prunedSize", m_prunedState.size())
+                       .d("childrenDepth", depth));
+    }
+}
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
@@ -38,8 +38,12 @@ static const std::string METRIC_PROGRAM_NAME_SUFFIX = "APLEngineImpl";
 static const std::string METRIC_APL_RENDER_DOCUMENT_RESULT = "RenderDocumentResult";
 static const std::string METRIC_APL_EXECUTE_COMMANDS_RESULT = "ExecuteCommandsResult";
 
-APLEngineImpl::APLEngineImpl(std::shared_ptr<aace::apl::APL> aplPlatformInterface) :
-        avsCommon::utils::RequiresShutdown(TAG), m_aplPlatformInterface(aplPlatformInterface), m_stopDialog(false) {
+APLEngineImpl::APLEngineImpl(std::shared_ptr<aace::apl::APL> aplPlatformInterface, size_t maxDocumentStateSize) :
+        avsCommon::utils::RequiresShutdown(TAG),
+        m_aplPlatformInterface(aplPlatformInterface),
+        m_lastReportedDocumentState(APLDocumentState::create("")),
+        m_maxDocumentStateSize(maxDocumentStateSize),
+        m_stopDialog(false) {
 }
 
 bool APLEngineImpl::initialize(
@@ -97,13 +101,14 @@ std::shared_ptr<APLEngineImpl> APLEngineImpl::create(
     std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionSender,
     std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
     std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-    std::shared_ptr<avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator) {
+    std::shared_ptr<avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator,
+    size_t maxDocumentStateSize) {
     AACE_DEBUG(LX(TAG));
     try {
         ThrowIfNull(aplPlatformInterface, "invalidAPLPlatformInterface");
 
         std::shared_ptr<APLEngineImpl> aplEngineImpl =
-            std::shared_ptr<APLEngineImpl>(new APLEngineImpl(aplPlatformInterface));
+            std::shared_ptr<APLEngineImpl>(new APLEngineImpl(aplPlatformInterface, maxDocumentStateSize));
         ThrowIfNot(
             aplEngineImpl->initialize(
                 capabilitiesRegistrar,
@@ -146,14 +151,15 @@ void APLEngineImpl::doShutdown() {
 }
 
 void APLEngineImpl::provideState(const std::string& aplToken, const unsigned int stateRequestToken) {
-    AACE_DEBUG(LX(TAG)
-                   .sensitive("stateRequestToken", stateRequestToken)
-                   .sensitive("aplToken", aplToken)
-                   .d("context", m_lastReportedDocumentState));
+    AACE_DEBUG(LX(TAG).sensitive("stateRequestToken", stateRequestToken).sensitive("aplToken", aplToken));
     if (m_aplCapabilityAgent != nullptr) {
-        auto documentState = m_lastReportedDocumentState;
-        m_executor.submit([this, stateRequestToken, documentState]() {
-            m_aplCapabilityAgent->onVisualContextAvailable(stateRequestToken, documentState);
+        // the snapshot is read on the executor, after any state update submitted before this request
+        m_executor.submit([this, stateRequestToken]() {
+            auto documentState = m_lastReportedDocumentState;
+            AACE_DEBUG(LX(TAG, "provideState")
+                           .d("size", documentState->getState().size())
+                           .d("pruned", documentState->isPruned()));
+            m_aplCapabilityAgent->onVisualContextAvailable(stateRequestToken, documentState->getState());
         });
     }
 }
@@ -309,8 +315,15 @@ void APLEngineImpl::onProcessActivityEvent(const std::string& source, ActivityEv
 }
 
 void APLEngineImpl::onSendDocumentState(const std::string& state) {
-    AACE_INFO(LX(TAG).d("state", state));
-    m_executor.submit([this, state]() { m_lastReportedDocumentState = state; });
+    AACE_INFO(LX(TAG).d("size", state.size()));
+    m_executor.submit([this, state]() {
+        // the platform reports the state on every change of the document, even when the visual context is unchanged
+        if (m_lastReportedDocumentState->isSameState(state)) {
+            AACE_DEBUG(LX(TAG, "onSendDocumentState").m("documentStateUnchanged"));
+            return;
+        }
+        m_lastReportedDocumentState = APLDocumentState::create(state, m_maxDocumentStateSize);
+    });
 }
 
 void APLEngineImpl::onSendDeviceWindowState(const std::string& state) {
@@ -27,11 +27,30 @@ namespace apl {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.apl.APLEngineService");
 
+/// Configuration key of the maximum size of the reported document state
+static const std::string CONFIG_KEY_MAX_DOCUMENT_STATE_SIZE = "maxDocumentStateSize";
+
 // register the service
 REGISTER_SERVICE(APLEngineService);
 
 APLEngineService::APLEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description), m_maxDocumentStateSize(0) {
+}
+
+bool APLEngineService::configure(const nlohmann::json& configuration) {
+    try {
+        ThrowIfNot(configuration.is_object(), "invalidConfiguration");
+        auto maxDocumentStateSize = configuration.find(CONFIG_KEY_MAX_DOCUMENT_STATE_SIZE);
+        if (maxDocumentStateSize != configuration.end()) {
+            ThrowIfNot(maxDocumentStateSize->is_number_unsigned(), "invalidMaxDocumentStateSize");
+            m_maxDocumentStateSize = maxDocumentStateSize->get<size_t>();
+            AACE_DEBUG(LX(TAG).d("maxDocumentStateSize", m_maxDocumentStateSize));
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
+        return false;
+    }
 }
 
 bool APLEngineService::start() {
@@ -99,7 +118,8 @@ bool APLEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::apl::
             exceptionSender,
             messageSender,
             contextManager,
-            dialogUXStateAggregator);
+            dialogUXStateAggregator,
+            m_maxDocumentStateSize);
         ThrowIfNull(m_aplEngineImpl, "createAPLEngineImplFailed");
 
         return true;
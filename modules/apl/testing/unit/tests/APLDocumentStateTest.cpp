@@ -0,0 +1,170 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/APL/APLDocumentState.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace apl {
+
+using APLDocumentState = aace::engine::apl::APLDocumentState;
+using json = nlohmann::json;
+
+/// A visible component with layout attributes and @c depth levels of children
+static json createComponent(const std::string& id, size_t depth) {
+    json component = {
+        {"id", id},
+        {"role", "text"},
+        {"position", "1024x100+0+0:0"},
+        {"transform", {1, 0, 0, 1, 0, 0}},
+        {"visibility", 1}};
+    if (depth > 0) {
+        component["children"] = {createComponent(id + ".0", depth - 1), createComponent(id + ".1", depth - 1)};
+    }
+    return component;
+}
+
+/// A rendered document state with one visible component of @c depth levels of children
+static std::string createState(size_t depth) {
+    json state = {{"token", "token"}, {"version", "1.0"}, {"componentsVisibleOnScreen", {createComponent("a", depth)}}};
+    return state.dump();
+}
+
+/// Removes the layout attributes of @c component and its children, as pruning does
+static void stripLayoutAttributes(json& component) {
+    component.erase("position");
+    component.erase("transform");
+    component.erase("visibility");
+    if (component.contains("children")) {
+        for (auto& child : component["children"]) {
+            stripLayoutAttributes(child);
+        }
+    }
+}
+
+/// Returns the depth of the children of the first visible component of @c state
+static size_t getChildrenDepth(const std::string& state) {
+    json document = json::parse(state);
+    const json* component = &document.at("componentsVisibleOnScreen").at(0);
+    size_t depth = 0;
+    while (component->contains("children")) {
+        component = &component->at("children").at(0);
+        depth++;
+    }
+    return depth;
+}
+
+TEST(APLDocumentStateTest, sameStateIsRecognized) {
+    auto state = createState(2);
+    auto documentState = APLDocumentState::create(state);
+
+    EXPECT_TRUE(documentState->isSameState(state)) << "An unchanged state should not be reported again";
+    EXPECT_FALSE(documentState->isSameState(createState(1)));
+}
+
+TEST(APLDocumentStateTest, sameStateIsRecognizedWhenPruned) {
+    auto state = createState(3);
+    auto documentState = APLDocumentState::create(state, state.size() / 2);
+
+    ASSERT_TRUE(documentState->isPruned());
+    EXPECT_TRUE(documentState->isSameState(state)) << "The state should be compared with the reported state";
+    EXPECT_FALSE(documentState->isSameState(documentState->getState()));
+}
+
+TEST(APLDocumentStateTest, stateUnderMaxSizeIsReportedAsGiven) {
+    auto state = createState(2);
+
+    auto unbounded = APLDocumentState::create(state);
+    EXPECT_FALSE(unbounded->isPruned());
+    EXPECT_EQ(state, unbounded->getState());
+
+    auto bounded = APLDocumentState::create(state, state.size());
+    EXPECT_FALSE(bounded->isPruned());
+    EXPECT_EQ(state, bounded->getState()) << "The state should not be reformatted";
+}
+
+TEST(APLDocumentStateTest, layoutAttributesArePrunedBeforeChildren) {
+    auto state = createState(2);
+    json stripped = json::parse(state);
+    stripLayoutAttributes(stripped["componentsVisibleOnScreen"][0]);
+    auto strippedState = stripped.dump();
+
+    auto documentState = APLDocumentState::create(state, strippedState.size());
+    ASSERT_TRUE(documentState->isPruned());
+    EXPECT_EQ(strippedState, documentState->getState()) << "Every child should be kept";
+    EXPECT_EQ(2u, getChildrenDepth(documentState->getState()));
+}
+
+TEST(APLDocumentStateTest, childrenAreTrimmedByDepthUntilTheStateFits) {
+    auto state = createState(4);
+    json document = json::parse(state);
+    auto& component = document["componentsVisibleOnScreen"][0];
+
+    // the stripped state with two levels of children
+    component = createComponent("a", 2);
+    stripLayoutAttributes(component);
+    auto maxSize = document.dump().size();
+
+    auto documentState = APLDocumentState::create(state, maxSize);
+    ASSERT_TRUE(documentState->isPruned());
+    EXPECT_LE(documentState->getState().size(), maxSize);
+    EXPECT_EQ(2u, getChildrenDepth(documentState->getState())) << "Only the deepest children should be removed";
+    EXPECT_EQ(document.dump(), documentState->getState());
+}
+
+TEST(APLDocumentStateTest, stateTooLargeWithoutChildrenIsPrunedAsFarAsPossible) {
+    auto state = createState(3);
+
+    auto documentState = APLDocumentState::create(state, 10);
+    ASSERT_TRUE(documentState->isPruned());
+    EXPECT_EQ(0u, getChildrenDepth(documentState->getState()));
+    auto component = json::parse(documentState->getState())["componentsVisibleOnScreen"][0];
+    EXPECT_EQ("a", component["id"]);
+    EXPECT_FALSE(component.contains("position"));
+}
+
+TEST(APLDocumentStateTest, stateWhichIsNotJsonIsReportedAsGiven) {
+    std::string state(100, 'x');
+
+    auto documentState = APLDocumentState::create(state, 10);
+    EXPECT_FALSE(documentState->isPruned());
+    EXPECT_EQ(state, documentState->getState());
+    EXPECT_TRUE(documentState->isSameState(state));
+}
+
+TEST(APLDocumentStateTest, stateOfUnexpectedShapeIsReportedAsGiven) {
+    std::vector<std::string> states = {
+        json({{"token", "token"}, {"version", "1.0"}}).dump(),
+        json({{"componentsVisibleOnScreen", {{"id", "a"}}}}).dump(),
+        json::array({1, 2, 3}).dump()};
+    for (const auto& state : states) {
+        auto documentState = APLDocumentState::create(state, 5);
+        EXPECT_FALSE(documentState->isPruned()) << state;
+        EXPECT_EQ(state, documentState->getState());
+    }
+}
+
+}  // namespace apl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
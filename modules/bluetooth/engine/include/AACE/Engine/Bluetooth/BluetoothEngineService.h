@@ -57,6 +57,7 @@ protected:
     bool initialize() override;
     bool start() override;
     bool stop() override;
+    bool isConcurrentLifecycleSafe() override;
 
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
 
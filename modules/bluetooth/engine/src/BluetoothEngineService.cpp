@@ -46,6 +46,11 @@ bool BluetoothEngineService::initialize() {
     }
 }
 
+bool BluetoothEngineService::isConcurrentLifecycleSafe() {
+    // start and stop only drive the GATT server, which uses no other service
+    return true;
+}
+
 bool BluetoothEngineService::initializeGATTServer() {
     try {
         // attempt to initialize the gatt server if it hasn't already been initialized,
@@ -17,11 +17,17 @@
 #define AASB_ENGINE_CAR_CONTROL_AASB_CAR_CONTROL_H
 
 #include <AACE/CarControl/CarControl.h>
+#include <AACE/Engine/CarControl/ControllerStateCache.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+#include <AASB/Message/CarControl/CarControl/ControllerValue.h>
+#include <AASB/Message/CarControl/CarControl/SetControllerValuesMessage.h>
+#include <chrono>
 #include <future>
 #include <utility>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace aasb {
 namespace engine {
@@ -32,18 +38,41 @@ class AASBCarControl
         , public std::enable_shared_from_this<AASBCarControl> {
 private:
     using CarControlPromise = std::promise<bool>;
-    AASBCarControl(uint32_t asyncReplyTimeout);
+    using ControllerValue = aasb::message::carControl::carControl::ControllerValue;
+    using BatchReplyPayload = aasb::message::carControl::carControl::SetControllerValuesMessageReply::Payload;
+    using BatchPromise = std::promise<BatchReplyPayload>;
+
+    /// Controller values requested within one batch window, sent in a single @c SetControllerValues message
+    struct ValueBatch {
+        ValueBatch();
+        std::vector<ControllerValue> values;
+        std::promise<std::vector<bool>> promise;
+        std::shared_future<std::vector<bool>> results;
+    };
+
+    AASBCarControl(uint32_t asyncReplyTimeout, uint32_t batchWindow);
 
     bool initialize(std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker);
     void addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise);
     void removeReplyMessagePromise(const std::string& messageId);
-    bool waitForAsyncReply(const std::string& messageId);
+    bool publishAndWaitForAsyncReply(
+        std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+        const std::string& messageId,
+        const std::string& message);
     std::shared_ptr<CarControlPromise> getReplyMessagePromise(const std::string& messageId);
+    std::shared_ptr<BatchPromise> getBatchReplyPromise(const std::string& messageId);
+
+    bool setControllerValue(const ControllerValue& value);
+    bool sendControllerValue(const ControllerValue& value);
+    bool setBatchedControllerValue(const ControllerValue& value);
+    std::vector<bool> sendValueBatch(const std::vector<ControllerValue>& values);
+    void updateControllerStateCache(const ControllerValue& value);
 
 public:
     static std::shared_ptr<AASBCarControl> create(
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-        uint32_t asyncReplyTimeout);
+        uint32_t asyncReplyTimeout,
+        uint32_t batchWindow = 0);
 
     // aace::carControl
     bool turnPowerControllerOn(const std::string& endpointId) override;
@@ -73,6 +102,18 @@ private:
     uint32_t m_replyMessageTimeout;
     std::mutex m_promise_map_access_mutex;
     std::unordered_map<std::string, std::shared_ptr<CarControlPromise>> m_promiseMap;
+    std::unordered_map<std::string, std::shared_ptr<BatchPromise>> m_batchPromiseMap;
+
+    /// Time to collect concurrent set requests into one batch, or zero if batching is disabled
+    std::chrono::milliseconds m_batchWindow;
+    std::mutex m_batchMutex;
+    std::shared_ptr<ValueBatch> m_openBatch;
+
+    /// Last known controller values, answering state queries without a platform round trip
+    aace::engine::carControl::ControllerStateCache m_controllerStateCache;
+
+    /// Sends the batches in the order they were opened. Declared last so it is destroyed first.
+    aace::engine::utils::threading::Executor m_batchExecutor;
 };
 
 }  // namespace carControl
@@ -43,6 +43,7 @@ public:
 
 private:
     uint32_t m_asyncReplyTimeout = 5000;
+    uint32_t m_batchWindow = 0;
 };
 
 }  // namespace carControl
@@ -16,10 +16,15 @@
 #include <AASB/Engine/CarControl/AASBCarControl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
+#include <algorithm>
+#include <thread>
+
 #include <AASB/Message/CarControl/CarControl/AdjustControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/AdjustRangeControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/AdjustModeControllerValueMessage.h>
 
+#include <AASB/Message/CarControl/CarControl/ReportControllerValuesMessage.h>
+
 #include <AASB/Message/CarControl/CarControl/SetControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetRangeControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetModeControllerValueMessage.h>
@@ -35,20 +40,25 @@ static const std::string TAG("aasb.carControl.AASBCarControl");
 
 // aliases
 using Message = aace::engine::messageBroker::Message;
+using CapabilityType = aasb::message::carControl::carControl::CapabilityType;
+
+AASBCarControl::ValueBatch::ValueBatch() : results(promise.get_future()) {
+}
 
-AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout) {
-    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout));
+AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout, uint32_t batchWindow) : m_batchWindow(batchWindow) {
+    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout).d("batchWindow", batchWindow));
     m_replyMessageTimeout = asyncReplyTimeout;
 }
 
 std::shared_ptr<AASBCarControl> AASBCarControl::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-    uint32_t asyncReplyTimeout) {
+    uint32_t asyncReplyTimeout,
+    uint32_t batchWindow) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
         // create the car control platform handler
-        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout));
+        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout, batchWindow));
 
         // initialize the platform handler
         ThrowIfNot(carControl->initialize(messageBroker), "initializeAASBCarControlFailed");
@@ -109,6 +119,44 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::messageBroker::Mes
                     AACE_ERROR(LX(TAG, "AdjustControllerValueMessageReply").d("reason", ex.what()));
                 }
             });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::SetControllerValuesMessageReply::topic(),
+            aasb::message::carControl::carControl::SetControllerValuesMessageReply::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    auto promise = sp->getBatchReplyPromise(message.replyTo());
+                    ThrowIfNull(promise, "invalidPromise");
+
+                    BatchReplyPayload payload = nlohmann::json::parse(message.payload());
+                    promise->set_value(payload);
+                    AACE_VERBOSE(LX(TAG, "SetControllerValuesMessageReply").m("setControllerValuesReplyPromiseSet"));
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "SetControllerValuesMessageReply").d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::ReportControllerValuesMessage::topic(),
+            aasb::message::carControl::carControl::ReportControllerValuesMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::ReportControllerValuesMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    for (const auto& value : payload.values) {
+                        sp->updateControllerStateCache(value);
+                    }
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ReportControllerValuesMessage").d("reason", ex.what()));
+                }
+            });
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -124,50 +172,26 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::messageBroker::Mes
  * PowerController
  */
 bool AASBCarControl::turnPowerControllerOn(const std::string& endpointId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.turnOn = true;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    ControllerValue value;
+    value.capabilityType = CapabilityType::POWER;
+    value.endpointId = endpointId;
+    value.turnOn = true;
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::turnPowerControllerOff(const std::string& endpointId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.turnOn = false;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    ControllerValue value;
+    value.capabilityType = CapabilityType::POWER;
+    value.endpointId = endpointId;
+    value.turnOn = false;
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
+    if (!m_controllerStateCache.getPowerState(endpointId, isOn)) {
+        // nothing reported yet, so answer as before the cache existed
+        AACE_DEBUG(LX(TAG).m("powerStateNotReported").sensitive("endpointId", endpointId));
+    }
     return true;
 }
 
@@ -175,53 +199,31 @@ bool AASBCarControl::isPowerControllerOn(const std::string& endpointId, bool& is
  * ToggleController
  */
 bool AASBCarControl::turnToggleControllerOn(const std::string& endpointId, const std::string& controllerId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.instanceId = controllerId;
-        message.payload.turnOn = true;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    ControllerValue value;
+    value.capabilityType = CapabilityType::TOGGLE;
+    value.endpointId = endpointId;
+    value.instanceId = controllerId;
+    value.turnOn = true;
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::turnToggleControllerOff(const std::string& endpointId, const std::string& controllerId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
-        message.payload.turnOn = false;
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.instanceId = controllerId;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    ControllerValue value;
+    value.capabilityType = CapabilityType::TOGGLE;
+    value.endpointId = endpointId;
+    value.instanceId = controllerId;
+    value.turnOn = false;
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::isToggleControllerOn(const std::string& endpointId, const std::string& controllerId, bool& isOn) {
+    if (!m_controllerStateCache.getToggleState(endpointId, controllerId, isOn)) {
+        // nothing reported yet, so answer as before the cache existed
+        AACE_DEBUG(LX(TAG)
+                       .m("toggleStateNotReported")
+                       .sensitive("endpointId", endpointId)
+                       .sensitive("controllerId", controllerId));
+    }
     return true;
 }
 
@@ -232,33 +234,20 @@ bool AASBCarControl::setRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double value) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetRangeControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.instanceId = controllerId;
-        message.payload.value = value;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    ControllerValue controllerValue;
+    controllerValue.capabilityType = CapabilityType::RANGE;
+    controllerValue.endpointId = endpointId;
+    controllerValue.instanceId = controllerId;
+    controllerValue.rangeValue = value;
+    return setControllerValue(controllerValue);
 }
 
 bool AASBCarControl::adjustRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double delta) {
+    // the resulting value is unknown until the platform reports it
+    m_controllerStateCache.invalidate(endpointId, controllerId);
     try {
         AACE_VERBOSE(LX(TAG));
 
@@ -272,10 +261,7 @@ bool AASBCarControl::adjustRangeControllerValue(
         message.payload.instanceId = controllerId;
         message.payload.delta = delta;
 
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
+        return publishAndWaitForAsyncReply(m_messageBroker_lock, message.header.id, message.toString());
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
@@ -286,6 +272,13 @@ bool AASBCarControl::getRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double& value) {
+    if (!m_controllerStateCache.getRangeValue(endpointId, controllerId, value)) {
+        // nothing reported yet, so answer as before the cache existed
+        AACE_DEBUG(LX(TAG)
+                       .m("rangeValueNotReported")
+                       .sensitive("endpointId", endpointId)
+                       .sensitive("controllerId", controllerId));
+    }
     return true;
 }
 
@@ -296,64 +289,231 @@ bool AASBCarControl::setModeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     const std::string& value) {
+    ControllerValue controllerValue;
+    controllerValue.capabilityType = CapabilityType::MODE;
+    controllerValue.endpointId = endpointId;
+    controllerValue.instanceId = controllerId;
+    controllerValue.modeValue = value;
+    return setControllerValue(controllerValue);
+}
+
+bool AASBCarControl::adjustModeControllerValue(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    int delta) {
+    // the resulting mode is unknown until the platform reports it
+    m_controllerStateCache.invalidate(endpointId, controllerId);
     try {
         AACE_VERBOSE(LX(TAG));
 
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
-        aasb::message::carControl::carControl::SetModeControllerValueMessage message;
+        aasb::message::carControl::carControl::AdjustModeControllerValueMessage message;
 
         message.payload.endpointId = endpointId;
         message.payload.controllerId = controllerId;
         message.payload.instanceId = controllerId;
-        message.payload.value = value;
-
-        m_messageBroker_lock->publish(message.toString()).send();
+        message.payload.delta = delta;
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
+        return publishAndWaitForAsyncReply(m_messageBroker_lock, message.header.id, message.toString());
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
     }
 }
 
-bool AASBCarControl::adjustModeControllerValue(
+bool AASBCarControl::getModeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
-    int delta) {
+    std::string& value) {
+    if (!m_controllerStateCache.getModeValue(endpointId, controllerId, value)) {
+        // nothing reported yet, so answer as before the cache existed
+        AACE_DEBUG(LX(TAG)
+                       .m("modeValueNotReported")
+                       .sensitive("endpointId", endpointId)
+                       .sensitive("controllerId", controllerId));
+    }
+    return true;
+}
+
+//
+// Controller values
+//
+
+bool AASBCarControl::setControllerValue(const ControllerValue& value) {
+    bool success = m_batchWindow.count() > 0 ? setBatchedControllerValue(value) : sendControllerValue(value);
+    if (success) {
+        updateControllerStateCache(value);
+    } else {
+        m_controllerStateCache.invalidate(value.endpointId, value.instanceId);
+    }
+    return success;
+}
+
+bool AASBCarControl::sendControllerValue(const ControllerValue& value) {
     try {
-        AACE_VERBOSE(LX(TAG));
+        AACE_VERBOSE(LX(TAG).d("capabilityType", aasb::message::carControl::carControl::toString(value.capabilityType)));
 
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
-        aasb::message::carControl::carControl::AdjustModeControllerValueMessage message;
+        std::string messageId;
+        std::string serializedMessage;
+        switch (value.capabilityType) {
+            case CapabilityType::POWER: {
+                aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.turnOn = value.turnOn;
+                messageId = message.header.id;
+                serializedMessage = message.toString();
+                break;
+            }
+            case CapabilityType::TOGGLE: {
+                aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.instanceId;
+                message.payload.instanceId = value.instanceId;
+                message.payload.turnOn = value.turnOn;
+                messageId = message.header.id;
+                serializedMessage = message.toString();
+                break;
+            }
+            case CapabilityType::RANGE: {
+                aasb::message::carControl::carControl::SetRangeControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.instanceId;
+                message.payload.instanceId = value.instanceId;
+                message.payload.value = value.rangeValue;
+                messageId = message.header.id;
+                serializedMessage = message.toString();
+                break;
+            }
+            case CapabilityType::MODE: {
+                aasb::message::carControl::carControl::SetModeControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.instanceId;
+                message.payload.instanceId = value.instanceId;
+                message.payload.value = value.modeValue;
+                messageId = message.header.id;
+                serializedMessage = message.toString();
+                break;
+            }
+        }
+
+        return publishAndWaitForAsyncReply(m_messageBroker_lock, messageId, serializedMessage);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
 
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.instanceId = controllerId;
-        message.payload.delta = delta;
+bool AASBCarControl::setBatchedControllerValue(const ControllerValue& value) {
+    std::shared_ptr<ValueBatch> batch;
+    size_t index;
+    bool isFirst = false;
+    {
+        std::lock_guard<std::mutex> lock(m_batchMutex);
+        if (m_openBatch == nullptr) {
+            m_openBatch = std::make_shared<ValueBatch>();
+            isFirst = true;
+        }
+        batch = m_openBatch;
+        index = batch->values.size();
+        batch->values.push_back(value);
+    }
+
+    // the batch executor collects the requests of concurrent directives for the batch window and sends them, so
+    // the request which opened the batch waits no longer than the others
+    if (isFirst) {
+        m_batchExecutor.submit([this, batch] {
+            std::this_thread::sleep_for(m_batchWindow);
+            {
+                std::lock_guard<std::mutex> lock(m_batchMutex);
+                m_openBatch.reset();
+            }
+            batch->promise.set_value(sendValueBatch(batch->values));
+        });
+    }
+
+    auto results = batch->results.get();
+    return index < results.size() && results[index];
+}
+
+std::vector<bool> AASBCarControl::sendValueBatch(const std::vector<ControllerValue>& values) {
+    // a single value is sent with the message of its capability type
+    if (values.size() == 1) {
+        return {sendControllerValue(values.front())};
+    }
+
+    std::vector<bool> results(values.size(), false);
+    std::string messageId;
+    try {
+        AACE_VERBOSE(LX(TAG).d("values", values.size()));
+
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        aasb::message::carControl::carControl::SetControllerValuesMessage message;
+        message.payload.values = values;
+        messageId = message.header.id;
+
+        // register the promise before publishing since the reply may be published synchronously
+        auto promise = std::make_shared<BatchPromise>();
+        auto future = promise->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+            m_batchPromiseMap[messageId] = promise;
+        }
 
         m_messageBroker_lock->publish(message.toString()).send();
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
+        ThrowIfNot(
+            future.wait_for(std::chrono::milliseconds(m_replyMessageTimeout)) == std::future_status::ready,
+            "replyMessageTimeout:id=" + messageId);
+        auto reply = future.get();
+
+        for (size_t i = 0; i < values.size(); i++) {
+            // values not listed as failed were set, unless the platform failed the batch without listing any
+            results[i] = reply.success;
+            if (!reply.success && !reply.failedValues.empty()) {
+                results[i] = std::none_of(
+                    reply.failedValues.begin(), reply.failedValues.end(), [&values, i](const ControllerValue& failed) {
+                        return failed.capabilityType == values[i].capabilityType &&
+                               failed.endpointId == values[i].endpointId && failed.instanceId == values[i].instanceId;
+                    });
+            }
+        }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
     }
+
+    std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+    m_batchPromiseMap.erase(messageId);
+    return results;
 }
 
-bool AASBCarControl::getModeControllerValue(
-    const std::string& endpointId,
-    const std::string& controllerId,
-    std::string& value) {
-    return true;
+void AASBCarControl::updateControllerStateCache(const ControllerValue& value) {
+    switch (value.capabilityType) {
+        case CapabilityType::POWER:
+            m_controllerStateCache.setPowerState(value.endpointId, value.turnOn);
+            break;
+        case CapabilityType::TOGGLE:
+            m_controllerStateCache.setToggleState(value.endpointId, value.instanceId, value.turnOn);
+            break;
+        case CapabilityType::RANGE:
+            m_controllerStateCache.setRangeValue(value.endpointId, value.instanceId, value.rangeValue);
+            break;
+        case CapabilityType::MODE:
+            m_controllerStateCache.setModeValue(value.endpointId, value.instanceId, value.modeValue);
+            break;
+    }
 }
 
-bool AASBCarControl::waitForAsyncReply(const std::string& messageId) {
+bool AASBCarControl::publishAndWaitForAsyncReply(
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+    const std::string& messageId,
+    const std::string& message) {
     // create the promise for the car control reply message to fulfill
     std::shared_ptr<CarControlPromise> promise = std::make_shared<CarControlPromise>();
 
@@ -362,7 +522,9 @@ bool AASBCarControl::waitForAsyncReply(const std::string& messageId) {
 
     bool success = false;
     try {
+        // register the promise before publishing since the reply may arrive before the message is sent
         addReplyMessagePromise(messageId, promise);
+        messageBroker->publish(message).send();
         ThrowIfNot(
             future.wait_for(std::chrono::milliseconds(m_replyMessageTimeout)) == std::future_status::ready,
             "replyMessageTimeout:id=" + messageId);
@@ -418,6 +580,20 @@ std::shared_ptr<AASBCarControl::CarControlPromise> AASBCarControl::getReplyMessa
     }
 }
 
+std::shared_ptr<AASBCarControl::BatchPromise> AASBCarControl::getBatchReplyPromise(const std::string& messageId) {
+    try {
+        std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+
+        auto it = m_batchPromiseMap.find(messageId);
+        ThrowIf(it == m_batchPromiseMap.end(), "messageIdDoesNotExist");
+
+        return it->second;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("keys", m_batchPromiseMap.size()).d("messageId", messageId));
+        return nullptr;
+    }
+}
+
 }  // namespace carControl
 }  // namespace engine
 }  // namespace aasb
@@ -60,7 +60,12 @@ bool AASBCarControlEngineService::configureMessageInterface(
 bool AASBCarControlEngineService::configureCarControl(std::istream& configuration) {
     try {
         auto root = nlohmann::json::parse(configuration);
-        m_asyncReplyTimeout = root["/asyncReplyTimeout"_json_pointer];
+        if (root.contains("asyncReplyTimeout")) {
+            m_asyncReplyTimeout = root["/asyncReplyTimeout"_json_pointer];
+        }
+        if (root.contains("batchWindow")) {
+            m_batchWindow = root["/batchWindow"_json_pointer];
+        }
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -77,7 +82,8 @@ bool AASBCarControlEngineService::postRegister() {
 
         // CarControl
         if (isInterfaceEnabled("CarControl")) {
-            auto carControl = AASBCarControl::create(aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout);
+            auto carControl = AASBCarControl::create(
+                aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout, m_batchWindow);
             ThrowIfNull(carControl, "invalidCarControlHandler");
             getContext()->registerPlatformInterface(carControl);
         }
@@ -60,6 +60,15 @@ public:
      */
     const std::vector<NameLocalePair>& getFriendlyNames(const std::string& assetId) const;
 
+    /**
+     * Add the literal friendly names and locales of a single asset, such as
+     * an asset restored from a configuration snapshot.
+     *
+     * @param assetId The ID of the asset
+     * @param names A list of pairs of friendly name and locale strings for the asset
+     */
+    void addAsset(const std::string& assetId, const std::vector<NameLocalePair>& names);
+
     /**
      * Clear the contents of the AssetStore
      */
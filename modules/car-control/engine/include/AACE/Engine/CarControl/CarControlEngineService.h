@@ -16,9 +16,11 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 
+#include <functional>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
+#include <vector>
 
 #include "AACE/CarControl/CarControl.h"
 #include "AACE/Engine/CarControl/AssetStore.h"
@@ -78,6 +80,46 @@ private:
      */
     void translateConfigForZones(json& jconfiguration);
 
+    /**
+     * Restore the resolved configuration, the ZoneDefinitions capability configuration, and the
+     * referenced assets from the configuration snapshot, if the snapshot was built from the same
+     * configuration text and assets files.
+     *
+     * @param [in] localStorage The storage holding the snapshot index
+     * @param [in] configurationHash The hash of the configuration text
+     * @param [out] jconfiguration The resolved configuration
+     * @return @c true if the snapshot was restored
+     */
+    bool loadConfigurationSnapshot(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        uint64_t configurationHash,
+        json& jconfiguration);
+
+    /**
+     * Write the configuration snapshot to the configured 'snapshotPath' and record it in the
+     * snapshot index. Does nothing but clear the index if no 'snapshotPath' is configured.
+     *
+     * @param [in] localStorage The storage holding the snapshot index
+     * @param [in] configurationHash The hash of the configuration text
+     * @param [in] assetsPaths The paths of the assets files the configuration was resolved with
+     * @param [in] jconfiguration The resolved configuration
+     */
+    void saveConfigurationSnapshot(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        uint64_t configurationHash,
+        const std::vector<std::string>& assetsPaths,
+        const json& jconfiguration);
+
+    /// Chain the path, size and modification time of each assets file to @c configurationHash.
+    /// @return @c false if a file does not exist
+    static bool hashSnapshotInputs(
+        uint64_t configurationHash,
+        const std::vector<std::string>& assetsPaths,
+        uint64_t& inputHash);
+
+    /// Invoke @c callback for every asset ID referenced in @c node
+    static void collectAssetIds(const json& node, const std::function<void(const std::string&)>& callback);
+
     template <class T>
     bool registerPlatformInterfaceType(std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
         std::shared_ptr<T> typedPlatformInterface = std::dynamic_pointer_cast<T>(platformInterface);
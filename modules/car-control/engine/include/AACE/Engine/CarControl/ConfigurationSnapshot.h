@@ -0,0 +1,89 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
+#define AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Reads and writes the binary snapshot of a resolved car control configuration.
+ *
+ * A snapshot holds the configuration after translation together with the assets it references,
+ * encoded as CBOR behind a fixed header with a format version and the hash of the inputs the
+ * snapshot was built from. Reading checks the header first and memory-maps the file only when its
+ * version and input hash match, so a changed configuration or assets file is parsed again.
+ */
+class ConfigurationSnapshot {
+public:
+    /// The snapshot format version. Snapshots written with another version are ignored.
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /// The initial value for @c hash()
+    static constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+
+    /**
+     * Hash an input of the snapshot, such as the configuration text or the contents of an assets file.
+     *
+     * @param content The content to hash
+     * @param hash The hash of the preceding inputs to chain from
+     * @return The 64-bit FNV-1a hash
+     */
+    static uint64_t hash(const std::string& content, uint64_t hash = HASH_SEED);
+
+    /**
+     * Hash the path, size and modification time of an input file, such as an assets file, without
+     * reading its content.
+     *
+     * @param path The path of the file
+     * @param [in,out] hash The hash of the preceding inputs, chained with the file on return
+     * @return @c false if the file does not exist
+     */
+    static bool hashFile(const std::string& path, uint64_t& hash);
+
+    /**
+     * Write a snapshot of @c model to @c path, replacing any existing snapshot.
+     *
+     * @param path The path of the snapshot file
+     * @param inputHash The hash of the inputs @c model was built from
+     * @param model The resolved configuration model
+     * @return @c true if the snapshot was written
+     */
+    static bool write(const std::string& path, uint64_t inputHash, const nlohmann::json& model);
+
+    /**
+     * Read the snapshot at @c path if it was written with the current format version from inputs
+     * with the hash @c inputHash.
+     *
+     * @param path The path of the snapshot file
+     * @param inputHash The hash of the current inputs
+     * @param [out] model The resolved configuration model
+     * @return @c true if a matching snapshot was read
+     */
+    static bool read(const std::string& path, uint64_t inputHash, nlohmann::json& model);
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
@@ -0,0 +1,151 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
+#define AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Thread-safe cache of the last known value of each power, toggle, range, and mode controller.
+ *
+ * The cache is kept current by the values the platform reports and by the values it confirms when
+ * setting a controller, so state queries can be answered without a platform round trip. Power
+ * controllers are identified by endpoint only; primitive controllers by endpoint and instance.
+ */
+class ControllerStateCache {
+public:
+    /// The capability type of a cached value
+    enum class CapabilityType { POWER, TOGGLE, RANGE, MODE };
+
+    /**
+     * Cache the power state of the endpoint identified by @c endpointId.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] isOn The power state
+     */
+    void setPowerState(const std::string& endpointId, bool isOn);
+    /**
+     * Retrieve the cached power state of the endpoint identified by @c endpointId.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [out] isOn Set to the cached power state
+     * @return @c true if a power state is cached for the endpoint
+     */
+    bool getPowerState(const std::string& endpointId, bool& isOn);
+
+    /**
+     * Cache the toggle state of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [in] isOn The toggle state
+     */
+    void setToggleState(const std::string& endpointId, const std::string& instance, bool isOn);
+    /**
+     * Retrieve the cached toggle state of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [out] isOn Set to the cached toggle state
+     * @return @c true if a toggle state is cached for the setting
+     */
+    bool getToggleState(const std::string& endpointId, const std::string& instance, bool& isOn);
+
+    /**
+     * Cache the range value of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [in] value The range value
+     */
+    void setRangeValue(const std::string& endpointId, const std::string& instance, double value);
+    /**
+     * Retrieve the cached range value of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [out] value Set to the cached range value
+     * @return @c true if a range value is cached for the setting
+     */
+    bool getRangeValue(const std::string& endpointId, const std::string& instance, double& value);
+
+    /**
+     * Cache the mode of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [in] value The mode
+     */
+    void setModeValue(const std::string& endpointId, const std::string& instance, const std::string& value);
+    /**
+     * Retrieve the cached mode of the setting identified by @c endpointId and @c instance.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     * @param [out] value Set to the cached mode
+     * @return @c true if a mode is cached for the setting
+     */
+    bool getModeValue(const std::string& endpointId, const std::string& instance, std::string& value);
+
+    /**
+     * Discard the cached value of a controller whose value is no longer known, such as after a
+     * relative adjustment. Use an empty @c instance for the power controller of the endpoint.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint
+     * @param [in] instance The unique identifier of the setting
+     */
+    void invalidate(const std::string& endpointId, const std::string& instance);
+
+    /// Discard all cached values.
+    void clear();
+
+private:
+    /// A cached controller value
+    struct Entry {
+        CapabilityType type;
+        bool isOn;
+        double rangeValue;
+        std::string modeValue;
+    };
+
+    /// Identifies a controller by endpoint and instance
+    using Key = std::pair<std::string, std::string>;
+
+    /// Store @c entry for the controller identified by @c key
+    void put(Key key, Entry entry);
+
+    /// Find the cached entry of the specified type. @return @c nullptr if not cached
+    const Entry* find(const Key& key, CapabilityType type) const;
+
+    /// Guards @c m_entries
+    std::mutex m_mutex;
+
+    /// Cached values by controller
+    std::map<Key, Entry> m_entries;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_CACHE_H
@@ -91,6 +91,10 @@ const std::vector<AssetStore::NameLocalePair>& AssetStore::getFriendlyNames(cons
     }
 }
 
+void AssetStore::addAsset(const std::string& assetId, const std::vector<NameLocalePair>& names) {
+    m_assets.emplace(assetId, names);
+}
+
 void AssetStore::clear() {
     for (auto value : m_assets) {
         value.second.clear();
@@ -15,12 +15,14 @@
 
 #include "AACE/Engine/CarControl/CarControlEngineService.h"
 
+#include <iterator>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "AACE/Alexa/AlexaProperties.h"
 #include "AACE/Engine/Alexa/AlexaComponentInterface.h"
+#include "AACE/Engine/CarControl/ConfigurationSnapshot.h"
 #include "AACE/Engine/CarControl/Endpoint.h"
 #include "AACE/Engine/CarControl/ZoneDefinitions.h"
 #include "AACE/Engine/Core/EngineMacros.h"
@@ -42,6 +44,21 @@ static const std::string AACE_STORAGE_SERVICE_KEY = "aace.storage";
 static const std::string CAR_CONTROL_CONFIG_TABLE = "carControl";
 /// The key for the 'configuration' in the database 'carControl' table
 static const std::string CAR_CONTROL_CONFIG_KEY = "configuration";
+/// The key for the configuration snapshot index in the database 'carControl' table
+static const std::string CAR_CONTROL_SNAPSHOT_KEY = "snapshot";
+
+/// The key for the snapshot file path in the snapshot index
+static const std::string SNAPSHOT_INDEX_KEY_PATH = "path";
+/// The key for the hash of the configuration text in the snapshot index
+static const std::string SNAPSHOT_INDEX_KEY_CONFIGURATION_HASH = "configurationHash";
+/// The key for the assets file paths in the snapshot index
+static const std::string SNAPSHOT_INDEX_KEY_ASSETS_PATHS = "assetsPaths";
+/// The key for the resolved configuration in the snapshot
+static const std::string SNAPSHOT_KEY_CONFIGURATION = "configuration";
+/// The key for the ZoneDefinitions capability configuration in the snapshot
+static const std::string SNAPSHOT_KEY_ZONES = "zones";
+/// The key for the referenced assets in the snapshot
+static const std::string SNAPSHOT_KEY_ASSETS = "assets";
 
 /// The key for the 'endpoints' node of configuration
 static const std::string CONFIG_KEY_ENDPOINTS = "endpoints";
@@ -51,6 +68,10 @@ static const std::string CONFIG_KEY_ASSETS = "assets";
 static const std::string CONFIG_KEY_DEFAULT_ASSETS_PATH = "defaultAssetsPath";
 /// The key for the 'customAssetsPath' node of configuration
 static const std::string CONFIG_KEY_CUSTOM_ASSETS_PATH = "customAssetsPath";
+/// The key for the 'snapshotPath' node of configuration
+static const std::string CONFIG_KEY_SNAPSHOT_PATH = "snapshotPath";
+/// The key for asset references in configuration
+static const std::string CONFIG_KEY_ASSET_ID = "assetId";
 
 // The endpoint ID of the internal endpoint created for zones
 static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
@@ -84,34 +105,62 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
         AACE_DEBUG(LX(TAG).d("isLocalServiceAvailable", isLocalServiceAvailable()));
         ThrowIf(m_configured, "carControlEngineServiceAlreadyConfigured");
 
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
+        ThrowIfNull(localStorage, "invalidLocalStorage");
+
+        std::string configurationText(
+            (std::istreambuf_iterator<char>(*configuration)), std::istreambuf_iterator<char>());
+        auto configurationHash = ConfigurationSnapshot::hash(configurationText);
+
+        // Restore the resolved configuration and its assets from the snapshot if the inputs are unchanged,
+        // otherwise resolve the configuration and write a new snapshot.
         json jconfiguration;
-        jconfiguration = json::parse(*configuration);
-
-        // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore to
-        // facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint construction.
-        // Note: Default assets may be overridden for legacy backward compatibility, but this results in friendly name/
-        // locale pair expansion rather than using asset definitions stored in the cloud.
-
-        if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
-            auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
-            if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) && assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
-                std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
-                AACE_WARN(LX(TAG)
-                              .m("addingDefaultAssetsFromPath")
-                              .sensitive("path", path)
-                              .m("Assets in file override cloud definitions for matching IDs!"));
-                ThrowIfNot(m_assetStore.addAssets(path), "addDefaultAssetsFromPathFailed");
+        if (loadConfigurationSnapshot(localStorage, configurationHash, jconfiguration)) {
+            AACE_INFO(LX(TAG).m("restoredConfigurationSnapshot"));
+            if (!localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY)) {
+                localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, jconfiguration.dump());
             }
+        } else {
+            jconfiguration = json::parse(configurationText);
+
+            // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore to
+            // facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint construction.
+            // Note: Default assets may be overridden for legacy backward compatibility, but this results in friendly name/
+            // locale pair expansion rather than using asset definitions stored in the cloud.
+            std::vector<std::string> assetsPaths;
+
+            if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
+                auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
+                if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) &&
+                    assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
+                    std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
+                    AACE_WARN(LX(TAG)
+                                  .m("addingDefaultAssetsFromPath")
+                                  .sensitive("path", path)
+                                  .m("Assets in file override cloud definitions for matching IDs!"));
+                    ThrowIfNot(m_assetStore.addAssets(path), "addDefaultAssetsFromPathFailed");
+                    assetsPaths.push_back(path);
+                }
 
-            if (assets.contains(CONFIG_KEY_CUSTOM_ASSETS_PATH) && assets[CONFIG_KEY_CUSTOM_ASSETS_PATH].is_string()) {
-                std::string path = assets.at(CONFIG_KEY_CUSTOM_ASSETS_PATH);
-                AACE_DEBUG(LX(TAG).m("addingCustomAssetsFromPath").sensitive("path", path));
-                ThrowIfNot(m_assetStore.addAssets(path), "addCustomAssetsFromPathFailed");
+                if (assets.contains(CONFIG_KEY_CUSTOM_ASSETS_PATH) &&
+                    assets[CONFIG_KEY_CUSTOM_ASSETS_PATH].is_string()) {
+                    std::string path = assets.at(CONFIG_KEY_CUSTOM_ASSETS_PATH);
+                    AACE_DEBUG(LX(TAG).m("addingCustomAssetsFromPath").sensitive("path", path));
+                    ThrowIfNot(m_assetStore.addAssets(path), "addCustomAssetsFromPathFailed");
+                    assetsPaths.push_back(path);
+                }
             }
-        }
 
-        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
-        translateConfigForZones(jconfiguration);
+            // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
+            translateConfigForZones(jconfiguration);
+
+            // Write the configuration to storage for retrieval by the car control local service
+            std::string s = jconfiguration.dump();
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+
+            saveConfigurationSnapshot(localStorage, configurationHash, assetsPaths, jconfiguration);
+        }
 
         // Construct an object representation of each endpoint in configuration
         if (jconfiguration.contains(CONFIG_KEY_ENDPOINTS) && jconfiguration.at(CONFIG_KEY_ENDPOINTS).is_array()) {
@@ -123,13 +172,6 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
             }
         }
 
-        // Write the configuration to storage for retrieval by the car control local service
-        auto localStorage =
-            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
-        ThrowIfNull(localStorage, "invalidLocalStorage");
-        std::string s = jconfiguration.dump();
-        localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
-
         m_configured = true;
         return true;
     } catch (std::exception& ex) {
@@ -138,6 +180,111 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
     }
 }
 
+bool CarControlEngineService::loadConfigurationSnapshot(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    uint64_t configurationHash,
+    json& jconfiguration) {
+    try {
+        ReturnIfNot(localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_KEY), false);
+        auto index = json::parse(localStorage->get(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_KEY));
+        ReturnIf(index.at(SNAPSHOT_INDEX_KEY_CONFIGURATION_HASH).get<uint64_t>() != configurationHash, false);
+
+        // The snapshot is also invalidated by changes to the assets files referenced by the configuration
+        uint64_t inputHash;
+        ThrowIfNot(
+            hashSnapshotInputs(
+                configurationHash,
+                index.at(SNAPSHOT_INDEX_KEY_ASSETS_PATHS).get<std::vector<std::string>>(),
+                inputHash),
+            "readAssetsFailed");
+
+        json model;
+        std::string path = index.at(SNAPSHOT_INDEX_KEY_PATH);
+        ReturnIfNot(ConfigurationSnapshot::read(path, inputHash, model), false);
+
+        for (auto& asset : model.at(SNAPSHOT_KEY_ASSETS).items()) {
+            m_assetStore.addAsset(asset.key(), asset.value().get<std::vector<AssetStore::NameLocalePair>>());
+        }
+        m_zonesCapabilityConfig = model.at(SNAPSHOT_KEY_ZONES);
+        jconfiguration = std::move(model.at(SNAPSHOT_KEY_CONFIGURATION));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).m("configurationSnapshotNotRestored").d("reason", ex.what()));
+        m_assetStore.clear();
+        m_zonesCapabilityConfig = json();
+        return false;
+    }
+}
+
+void CarControlEngineService::saveConfigurationSnapshot(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    uint64_t configurationHash,
+    const std::vector<std::string>& assetsPaths,
+    const json& jconfiguration) {
+    try {
+        localStorage->removeKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_KEY);
+        ReturnIfNot(
+            jconfiguration.contains(CONFIG_KEY_SNAPSHOT_PATH) && jconfiguration.at(CONFIG_KEY_SNAPSHOT_PATH).is_string());
+        std::string path = jconfiguration.at(CONFIG_KEY_SNAPSHOT_PATH);
+
+        uint64_t inputHash;
+        ThrowIfNot(hashSnapshotInputs(configurationHash, assetsPaths, inputHash), "readAssetsFailed");
+
+        // Only the assets referenced by the configuration are needed to build the endpoints
+        json assets = json::object();
+        collectAssetIds(jconfiguration, [this, &assets](const std::string& assetId) {
+            auto& names = m_assetStore.getFriendlyNames(assetId);
+            if (!names.empty()) {
+                assets[assetId] = names;
+            }
+        });
+
+        json model = {
+            {SNAPSHOT_KEY_CONFIGURATION, jconfiguration},
+            {SNAPSHOT_KEY_ZONES, m_zonesCapabilityConfig},
+            {SNAPSHOT_KEY_ASSETS, assets}};
+        ThrowIfNot(ConfigurationSnapshot::write(path, inputHash, model), "writeSnapshotFailed");
+
+        json index = {
+            {SNAPSHOT_INDEX_KEY_PATH, path},
+            {SNAPSHOT_INDEX_KEY_CONFIGURATION_HASH, configurationHash},
+            {SNAPSHOT_INDEX_KEY_ASSETS_PATHS, assetsPaths}};
+        ThrowIfNot(
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_KEY, index.dump()), "writeIndexFailed");
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).m("configurationSnapshotNotSaved").d("reason", ex.what()));
+    }
+}
+
+bool CarControlEngineService::hashSnapshotInputs(
+    uint64_t configurationHash,
+    const std::vector<std::string>& assetsPaths,
+    uint64_t& inputHash) {
+    inputHash = configurationHash;
+    for (auto& path : assetsPaths) {
+        ReturnIfNot(ConfigurationSnapshot::hashFile(path, inputHash), false);
+    }
+    return true;
+}
+
+void CarControlEngineService::collectAssetIds(
+    const json& node,
+    const std::function<void(const std::string&)>& callback) {
+    if (node.is_object()) {
+        for (auto& item : node.items()) {
+            if (item.key() == CONFIG_KEY_ASSET_ID && item.value().is_string()) {
+                callback(item.value().get<std::string>());
+            } else {
+                collectAssetIds(item.value(), callback);
+            }
+        }
+    } else if (node.is_array()) {
+        for (auto& item : node) {
+            collectAssetIds(item, callback);
+        }
+    }
+}
+
 bool CarControlEngineService::setup() {
     try {
         if (m_carControlEngineImpl != nullptr) {
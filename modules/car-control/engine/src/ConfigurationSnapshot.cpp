@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/ConfigurationSnapshot.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file
+static const std::string TAG("aace.carControl.ConfigurationSnapshot");
+
+/// Identifies a car control configuration snapshot file
+static const char SNAPSHOT_MAGIC[4] = {'A', 'C', 'C', 'S'};
+
+/// The 64-bit FNV-1a prime
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/// The fixed header preceding the CBOR encoded model
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t inputHash;
+    uint64_t payloadSize;
+};
+
+constexpr uint32_t ConfigurationSnapshot::FORMAT_VERSION;
+constexpr uint64_t ConfigurationSnapshot::HASH_SEED;
+
+uint64_t ConfigurationSnapshot::hash(const std::string& content, uint64_t hash) {
+    for (unsigned char c : content) {
+        hash ^= c;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool ConfigurationSnapshot::hashFile(const std::string& path, uint64_t& hash) {
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0) {
+        return false;
+    }
+    hash = ConfigurationSnapshot::hash(path, hash);
+    hash = ConfigurationSnapshot::hash(std::to_string(info.st_size), hash);
+    hash = ConfigurationSnapshot::hash(std::to_string(info.st_mtime), hash);
+    return true;
+}
+
+bool ConfigurationSnapshot::write(const std::string& path, uint64_t inputHash, const nlohmann::json& model) {
+    std::string tempPath = path + ".tmp";
+    try {
+        std::vector<uint8_t> payload = nlohmann::json::to_cbor(model);
+
+        SnapshotHeader header;
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = FORMAT_VERSION;
+        header.inputHash = inputHash;
+        header.payloadSize = payload.size();
+
+        // write to a temporary file and rename it so a partially written snapshot is never read
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            ThrowIfNot(file.good(), "openSnapshotFailed");
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+            file.close();
+            ThrowIfNot(file.good(), "writeSnapshotFailed");
+        }
+        ThrowIf(std::rename(tempPath.c_str(), path.c_str()) != 0, "renameSnapshotFailed");
+
+        AACE_DEBUG(LX(TAG).sensitive("path", path).d("size", sizeof(header) + payload.size()));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        std::remove(tempPath.c_str());
+        return false;
+    }
+}
+
+bool ConfigurationSnapshot::read(const std::string& path, uint64_t inputHash, nlohmann::json& model) {
+    int fd = -1;
+    void* data = MAP_FAILED;
+    size_t size = 0;
+    bool success = false;
+    try {
+        fd = ::open(path.c_str(), O_RDONLY);
+        ReturnIf(fd < 0, false);
+
+        struct stat info;
+        ThrowIf(::fstat(fd, &info) != 0, "statSnapshotFailed");
+        size = static_cast<size_t>(info.st_size);
+        ThrowIf(size < sizeof(SnapshotHeader), "snapshotTooSmall");
+
+        // check the header before mapping, so an outdated snapshot costs a single small read
+        SnapshotHeader header;
+        ThrowIf(::pread(fd, &header, sizeof(header), 0) != sizeof(header), "readHeaderFailed");
+        ThrowIf(std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0, "invalidSnapshot");
+
+        if (header.version != FORMAT_VERSION || header.inputHash != inputHash) {
+            AACE_INFO(LX(TAG).m("snapshotOutdated").d("version", header.version));
+        } else {
+            ThrowIf(header.payloadSize != size - sizeof(header), "truncatedSnapshot");
+
+            data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ThrowIf(data == MAP_FAILED, "mapSnapshotFailed");
+
+            auto payload = static_cast<const uint8_t*>(data) + sizeof(header);
+            model = nlohmann::json::from_cbor(payload, payload + header.payloadSize);
+            success = true;
+        }
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+    }
+
+    if (data != MAP_FAILED) {
+        ::munmap(data, size);
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    return success;
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,109 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/ControllerStateCache.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+void ControllerStateCache::setPowerState(const std::string& endpointId, bool isOn) {
+    put({endpointId, ""}, {CapabilityType::POWER, isOn, 0, ""});
+}
+
+bool ControllerStateCache::getPowerState(const std::string& endpointId, bool& isOn) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = find({endpointId, ""}, CapabilityType::POWER);
+    if (entry == nullptr) {
+        return false;
+    }
+    isOn = entry->isOn;
+    return true;
+}
+
+void ControllerStateCache::setToggleState(const std::string& endpointId, const std::string& instance, bool isOn) {
+    put({endpointId, instance}, {CapabilityType::TOGGLE, isOn, 0, ""});
+}
+
+bool ControllerStateCache::getToggleState(const std::string& endpointId, const std::string& instance, bool& isOn) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = find({endpointId, instance}, CapabilityType::TOGGLE);
+    if (entry == nullptr) {
+        return false;
+    }
+    isOn = entry->isOn;
+    return true;
+}
+
+void ControllerStateCache::setRangeValue(const std::string& endpointId, const std::string& instance, double value) {
+    put({endpointId, instance}, {CapabilityType::RANGE, false, value, ""});
+}
+
+bool ControllerStateCache::getRangeValue(const std::string& endpointId, const std::string& instance, double& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = find({endpointId, instance}, CapabilityType::RANGE);
+    if (entry == nullptr) {
+        return false;
+    }
+    value = entry->rangeValue;
+    return true;
+}
+
+void ControllerStateCache::setModeValue(
+    const std::string& endpointId,
+    const std::string& instance,
+    const std::string& value) {
+    put({endpointId, instance}, {CapabilityType::MODE, false, 0, value});
+}
+
+bool ControllerStateCache::getModeValue(
+    const std::string& endpointId,
+    const std::string& instance,
+    std::string& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = find({endpointId, instance}, CapabilityType::MODE);
+    if (entry == nullptr) {
+        return false;
+    }
+    value = entry->modeValue;
+    return true;
+}
+
+void ControllerStateCache::invalidate(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase({endpointId, instance});
+}
+
+void ControllerStateCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+void ControllerStateCache::put(Key key, Entry entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[std::move(key)] = std::move(entry);
+}
+
+const ControllerStateCache::Entry* ControllerStateCache::find(const Key& key, CapabilityType type) const {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end() || it->second.type != type) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
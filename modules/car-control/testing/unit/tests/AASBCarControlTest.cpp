@@ -0,0 +1,224 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/MessageBroker/Message.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AASB/Engine/CarControl/AASBCarControl.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using Message = aace::engine::messageBroker::Message;
+using json = nlohmann::json;
+
+/// Test harness for @c AASBCarControl, which answers its messages as the platform would
+class AASBCarControlTest : public ::testing::Test {
+public:
+    void TearDown() override {
+        m_carControl.reset();
+        if (m_broker != nullptr) {
+            m_broker->shutdown();
+            m_broker.reset();
+        }
+    }
+
+protected:
+    /// A message the platform received from the Engine
+    struct Request {
+        std::string action;
+        json payload;
+    };
+
+    void create(uint32_t batchWindow, json replyPayload = {{"success", true}}) {
+        m_broker = aace::engine::messageBroker::MessageBrokerImpl::create();
+        ASSERT_NE(m_broker, nullptr);
+        m_carControl = aasb::engine::carControl::AASBCarControl::create(m_broker, 1000, batchWindow);
+        ASSERT_NE(m_carControl, nullptr);
+        m_replyPayload = replyPayload;
+        m_broker->subscribe(
+            "CarControl",
+            [this](const Message& message) {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_requests.push_back({message.action(), json::parse(message.payload())});
+                }
+                reply(message);
+            },
+            Message::Direction::OUTGOING);
+    }
+
+    void reply(const Message& message) {
+        json reply = {
+            {"header",
+             {{"id", message.messageId() + "-reply"},
+              {"messageType", "Reply"},
+              {"version", "4.0"},
+              {"messageDescription",
+               {{"topic", message.topic()}, {"action", message.action()}, {"replyToId", message.messageId()}}}}},
+            {"payload", m_replyPayload}};
+        m_broker->publish(reply.dump(), Message::Direction::INCOMING).send();
+    }
+
+    /// Publishes a @c ReportControllerValues message and returns once the Engine has handled it
+    void report(const json& values) {
+        // subscribers are notified in order on the same thread, so this one runs after the Engine's handler
+        auto handled = std::make_shared<std::promise<void>>();
+        m_broker->subscribe("CarControl", "ReportControllerValues", [handled](const Message&) {
+            handled->set_value();
+        });
+        json message = {
+            {"header",
+             {{"id", "report"},
+              {"messageType", "Publish"},
+              {"version", "4.0"},
+              {"messageDescription", {{"topic", "CarControl"}, {"action", "ReportControllerValues"}}}}},
+            {"payload", {{"values", values}}}};
+        m_broker->publish(message.dump(), Message::Direction::INCOMING).send();
+        ASSERT_EQ(std::future_status::ready, handled->get_future().wait_for(std::chrono::seconds(1)));
+    }
+
+    std::vector<Request> requests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests;
+    }
+
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerImpl> m_broker;
+    std::shared_ptr<aasb::engine::carControl::AASBCarControl> m_carControl;
+    json m_replyPayload;
+    std::mutex m_mutex;
+    std::vector<Request> m_requests;
+};
+
+TEST_F(AASBCarControlTest, stateQueriesFallBackWhenNothingIsReported) {
+    create(0);
+    bool isOn = true;
+    double rangeValue = 1;
+    std::string modeValue = "unchanged";
+    EXPECT_TRUE(m_carControl->isPowerControllerOn("heater", isOn));
+    EXPECT_TRUE(m_carControl->isToggleControllerOn("heater", "recirculate", isOn));
+    EXPECT_TRUE(m_carControl->getRangeControllerValue("heater", "temperature", rangeValue));
+    EXPECT_TRUE(m_carControl->getModeControllerValue("heater", "mode", modeValue));
+    EXPECT_TRUE(isOn);
+    EXPECT_EQ(1, rangeValue);
+    EXPECT_EQ("unchanged", modeValue);
+    EXPECT_TRUE(requests().empty());
+}
+
+TEST_F(AASBCarControlTest, reportedValuesAnswerStateQueries) {
+    create(0);
+    report(
+        {{{"capabilityType", "POWER"}, {"endpointId", "heater"}, {"turnOn", true}},
+         {{"capabilityType", "TOGGLE"}, {"endpointId", "heater"}, {"instanceId", "recirculate"}, {"turnOn", true}},
+         {{"capabilityType", "RANGE"}, {"endpointId", "heater"}, {"instanceId", "temperature"}, {"rangeValue", 21.5}},
+         {{"capabilityType", "MODE"}, {"endpointId", "heater"}, {"instanceId", "mode"}, {"modeValue", "AUTO"}}});
+
+    bool isOn = false;
+    ASSERT_TRUE(m_carControl->isPowerControllerOn("heater", isOn));
+    EXPECT_TRUE(isOn);
+    isOn = false;
+    ASSERT_TRUE(m_carControl->isToggleControllerOn("heater", "recirculate", isOn));
+    EXPECT_TRUE(isOn);
+    double rangeValue = 0;
+    ASSERT_TRUE(m_carControl->getRangeControllerValue("heater", "temperature", rangeValue));
+    EXPECT_EQ(21.5, rangeValue);
+    std::string modeValue;
+    ASSERT_TRUE(m_carControl->getModeControllerValue("heater", "mode", modeValue));
+    EXPECT_EQ("AUTO", modeValue);
+}
+
+TEST_F(AASBCarControlTest, confirmedValueAnswersStateQueries) {
+    create(0);
+    ASSERT_TRUE(m_carControl->setRangeControllerValue("heater", "temperature", 22));
+    double rangeValue = 0;
+    ASSERT_TRUE(m_carControl->getRangeControllerValue("heater", "temperature", rangeValue));
+    EXPECT_EQ(22, rangeValue);
+}
+
+TEST_F(AASBCarControlTest, failedValueIsNotCached) {
+    create(0, {{"success", false}});
+    EXPECT_FALSE(m_carControl->setRangeControllerValue("heater", "temperature", 22));
+    double rangeValue = 1;
+    ASSERT_TRUE(m_carControl->getRangeControllerValue("heater", "temperature", rangeValue));
+    EXPECT_EQ(1, rangeValue);
+}
+
+TEST_F(AASBCarControlTest, adjustDiscardsTheCachedValue) {
+    create(0);
+    ASSERT_TRUE(m_carControl->setRangeControllerValue("heater", "temperature", 22));
+    ASSERT_TRUE(m_carControl->adjustRangeControllerValue("heater", "temperature", 1));
+    double rangeValue = 1;
+    ASSERT_TRUE(m_carControl->getRangeControllerValue("heater", "temperature", rangeValue));
+    EXPECT_EQ(1, rangeValue);
+}
+
+TEST_F(AASBCarControlTest, singleValueInBatchWindowUsesCapabilityMessage) {
+    create(50);
+    ASSERT_TRUE(m_carControl->turnPowerControllerOn("heater"));
+    auto sent = requests();
+    ASSERT_EQ(1u, sent.size());
+    EXPECT_EQ("SetControllerValue", sent[0].action);
+    EXPECT_EQ("heater", sent[0].payload["endpointId"]);
+}
+
+TEST_F(AASBCarControlTest, concurrentValuesAreSentInOneBatch) {
+    json failedValue = {{"capabilityType", "TOGGLE"}, {"endpointId", "heater"}, {"instanceId", "recirculate"}};
+    create(200, {{"success", false}, {"failedValues", json::array({failedValue})}});
+
+    auto power = std::async(std::launch::async, [this] { return m_carControl->turnPowerControllerOn("heater"); });
+    auto toggle = std::async(
+        std::launch::async, [this] { return m_carControl->turnToggleControllerOn("heater", "recirculate"); });
+    EXPECT_TRUE(power.get());
+    EXPECT_FALSE(toggle.get());
+
+    auto sent = requests();
+    ASSERT_EQ(1u, sent.size());
+    EXPECT_EQ("SetControllerValues", sent[0].action);
+    EXPECT_EQ(2u, sent[0].payload["values"].size());
+
+    // only the value the platform confirmed answers state queries
+    bool isOn = false;
+    ASSERT_TRUE(m_carControl->isPowerControllerOn("heater", isOn));
+    EXPECT_TRUE(isOn);
+    isOn = false;
+    ASSERT_TRUE(m_carControl->isToggleControllerOn("heater", "recirculate", isOn));
+    EXPECT_FALSE(isOn);
+}
+
+TEST_F(AASBCarControlTest, requestsAfterTheWindowOpenANewBatch) {
+    create(20);
+    ASSERT_TRUE(m_carControl->turnPowerControllerOn("heater"));
+    ASSERT_TRUE(m_carControl->turnPowerControllerOff("heater"));
+    auto sent = requests();
+    ASSERT_EQ(2u, sent.size());
+    EXPECT_TRUE(sent[0].payload["turnOn"].get<bool>());
+    EXPECT_FALSE(sent[1].payload["turnOn"].get<bool>());
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,169 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+#include <unistd.h>
+
+#include <AACE/Engine/CarControl/ConfigurationSnapshot.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using ConfigurationSnapshot = aace::engine::carControl::ConfigurationSnapshot;
+using json = nlohmann::json;
+
+/// The offset of the format version in the snapshot header
+static constexpr size_t VERSION_OFFSET = 4;
+
+/// The size of the snapshot header preceding the CBOR payload
+static constexpr size_t HEADER_SIZE = 24;
+
+class ConfigurationSnapshotTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        char path[] = "/tmp/ConfigurationSnapshotTestXXXXXX";
+        ASSERT_NE(nullptr, ::mkdtemp(path));
+        m_directory = path;
+        m_path = m_directory + "/snapshot.bin";
+        m_model = {
+            {"configuration", {{"endpoints", {{{"endpointId", "heater"}, {"assetId", "Alexa.Device.Heater"}}}}}},
+            {"zones", json::object()},
+            {"assets", {{"Alexa.Device.Heater", {{{"name", "heater"}, {"locale", "en-US"}}}}}}};
+    }
+
+    void TearDown() override {
+        std::remove(m_path.c_str());
+        std::remove((m_directory + "/assets.json").c_str());
+        ::rmdir(m_directory.c_str());
+    }
+
+protected:
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    std::string m_directory;
+    std::string m_path;
+    json m_model;
+};
+
+TEST_F(ConfigurationSnapshotTest, writeAndRead) {
+    ASSERT_TRUE(ConfigurationSnapshot::write(m_path, 42, m_model));
+
+    json model;
+    ASSERT_TRUE(ConfigurationSnapshot::read(m_path, 42, model));
+    EXPECT_EQ(m_model, model);
+    EXPECT_FALSE(std::ifstream(m_path + ".tmp").good()) << "The temporary file should be renamed";
+}
+
+TEST_F(ConfigurationSnapshotTest, missingSnapshotIsNotRead) {
+    json model;
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model));
+    EXPECT_TRUE(model.is_null());
+}
+
+TEST_F(ConfigurationSnapshotTest, inputHashMismatchIsNotRead) {
+    ASSERT_TRUE(ConfigurationSnapshot::write(m_path, 42, m_model));
+
+    json model;
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 43, model));
+    EXPECT_TRUE(model.is_null());
+}
+
+TEST_F(ConfigurationSnapshotTest, truncatedSnapshotIsNotRead) {
+    ASSERT_TRUE(ConfigurationSnapshot::write(m_path, 42, m_model));
+    auto content = readFile(m_path);
+    json model;
+
+    writeFile(m_path, content.substr(0, content.size() - 1));
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model));
+
+    writeFile(m_path, content.substr(0, 8));
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model)) << "The header itself is truncated";
+    EXPECT_TRUE(model.is_null());
+}
+
+TEST_F(ConfigurationSnapshotTest, corruptSnapshotIsNotRead) {
+    ASSERT_TRUE(ConfigurationSnapshot::write(m_path, 42, m_model));
+    auto content = readFile(m_path);
+    json model;
+
+    auto badMagic = content;
+    badMagic[0] = 'X';
+    writeFile(m_path, badMagic);
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model));
+
+    // an invalid CBOR payload of the expected size
+    auto badPayload = content;
+    std::fill(badPayload.begin() + HEADER_SIZE, badPayload.end(), '\xff');
+    writeFile(m_path, badPayload);
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model));
+    EXPECT_TRUE(model.is_null());
+}
+
+TEST_F(ConfigurationSnapshotTest, snapshotOfAnotherVersionIsNotRead) {
+    ASSERT_TRUE(ConfigurationSnapshot::write(m_path, 42, m_model));
+    auto content = readFile(m_path);
+
+    uint32_t version = ConfigurationSnapshot::FORMAT_VERSION + 1;
+    content.replace(VERSION_OFFSET, sizeof(version), reinterpret_cast<const char*>(&version), sizeof(version));
+    writeFile(m_path, content);
+
+    json model;
+    EXPECT_FALSE(ConfigurationSnapshot::read(m_path, 42, model));
+    EXPECT_TRUE(model.is_null());
+}
+
+TEST_F(ConfigurationSnapshotTest, fileHashChangesWithTheFile) {
+    auto path = m_directory + "/assets.json";
+    uint64_t hash = ConfigurationSnapshot::HASH_SEED;
+    EXPECT_FALSE(ConfigurationSnapshot::hashFile(path, hash)) << "A missing file can't be hashed";
+
+    writeFile(path, "{\"assets\":[]}");
+    uint64_t first = ConfigurationSnapshot::HASH_SEED;
+    ASSERT_TRUE(ConfigurationSnapshot::hashFile(path, first));
+    uint64_t unchanged = ConfigurationSnapshot::HASH_SEED;
+    ASSERT_TRUE(ConfigurationSnapshot::hashFile(path, unchanged));
+    EXPECT_EQ(first, unchanged);
+
+    writeFile(path, "{\"assets\":[{}]}");
+    uint64_t changed = ConfigurationSnapshot::HASH_SEED;
+    ASSERT_TRUE(ConfigurationSnapshot::hashFile(path, changed));
+    EXPECT_NE(first, changed);
+
+    uint64_t chained = 42;
+    ASSERT_TRUE(ConfigurationSnapshot::hashFile(path, chained));
+    EXPECT_NE(changed, chained) << "The hash should chain from the preceding inputs";
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,137 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/CarControl/ControllerStateCache.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using ControllerStateCache = aace::engine::carControl::ControllerStateCache;
+
+TEST(ControllerStateCacheTest, nothingIsCachedInitially) {
+    ControllerStateCache cache;
+    bool isOn = true;
+    double rangeValue = 1;
+    std::string modeValue = "unchanged";
+    EXPECT_FALSE(cache.getPowerState("heater", isOn));
+    EXPECT_FALSE(cache.getToggleState("heater", "intensity", isOn));
+    EXPECT_FALSE(cache.getRangeValue("heater", "temperature", rangeValue));
+    EXPECT_FALSE(cache.getModeValue("heater", "mode", modeValue));
+    EXPECT_TRUE(isOn);
+    EXPECT_EQ(1, rangeValue);
+    EXPECT_EQ("unchanged", modeValue);
+}
+
+TEST(ControllerStateCacheTest, returnsTheLastValue) {
+    ControllerStateCache cache;
+    cache.setPowerState("heater", true);
+    cache.setPowerState("heater", false);
+    cache.setToggleState("heater", "recirculate", true);
+    cache.setRangeValue("heater", "temperature", 21.5);
+    cache.setModeValue("heater", "mode", "AUTO");
+
+    bool isOn = true;
+    ASSERT_TRUE(cache.getPowerState("heater", isOn));
+    EXPECT_FALSE(isOn);
+    ASSERT_TRUE(cache.getToggleState("heater", "recirculate", isOn));
+    EXPECT_TRUE(isOn);
+    double rangeValue = 0;
+    ASSERT_TRUE(cache.getRangeValue("heater", "temperature", rangeValue));
+    EXPECT_EQ(21.5, rangeValue);
+    std::string modeValue;
+    ASSERT_TRUE(cache.getModeValue("heater", "mode", modeValue));
+    EXPECT_EQ("AUTO", modeValue);
+}
+
+TEST(ControllerStateCacheTest, valuesAreKeyedByEndpointAndInstance) {
+    ControllerStateCache cache;
+    cache.setToggleState("driver.seat", "heater", true);
+    cache.setToggleState("passenger.seat", "heater", false);
+
+    bool isOn = false;
+    ASSERT_TRUE(cache.getToggleState("driver.seat", "heater", isOn));
+    EXPECT_TRUE(isOn);
+    ASSERT_TRUE(cache.getToggleState("passenger.seat", "heater", isOn));
+    EXPECT_FALSE(isOn);
+    EXPECT_FALSE(cache.getToggleState("driver.seat", "cooler", isOn));
+    EXPECT_FALSE(cache.getPowerState("driver.seat", isOn)) << "The power state is not a toggle";
+}
+
+TEST(ControllerStateCacheTest, valueOfAnotherTypeIsNotReturned) {
+    ControllerStateCache cache;
+    cache.setRangeValue("fan", "speed", 3);
+
+    bool isOn = false;
+    std::string modeValue;
+    EXPECT_FALSE(cache.getToggleState("fan", "speed", isOn));
+    EXPECT_FALSE(cache.getModeValue("fan", "speed", modeValue));
+
+    cache.setModeValue("fan", "speed", "HIGH");
+    double rangeValue = 0;
+    EXPECT_FALSE(cache.getRangeValue("fan", "speed", rangeValue)) << "The new type should replace the old value";
+    ASSERT_TRUE(cache.getModeValue("fan", "speed", modeValue));
+    EXPECT_EQ("HIGH", modeValue);
+}
+
+TEST(ControllerStateCacheTest, invalidateAndClear) {
+    ControllerStateCache cache;
+    cache.setPowerState("fan", true);
+    cache.setRangeValue("fan", "speed", 3);
+    cache.setRangeValue("heater", "temperature", 20);
+
+    cache.invalidate("fan", "speed");
+    double rangeValue = 0;
+    bool isOn = false;
+    EXPECT_FALSE(cache.getRangeValue("fan", "speed", rangeValue));
+    EXPECT_TRUE(cache.getPowerState("fan", isOn));
+
+    cache.invalidate("fan", "");
+    EXPECT_FALSE(cache.getPowerState("fan", isOn));
+    EXPECT_TRUE(cache.getRangeValue("heater", "temperature", rangeValue));
+
+    cache.clear();
+    EXPECT_FALSE(cache.getRangeValue("heater", "temperature", rangeValue));
+}
+
+TEST(ControllerStateCacheTest, concurrentUpdatesAndQueries) {
+    ControllerStateCache cache;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; thread++) {
+        threads.emplace_back([&cache, thread] {
+            auto instance = "instance" + std::to_string(thread);
+            for (int i = 0; i < 1000; i++) {
+                cache.setRangeValue("endpoint", instance, i);
+                double value = -1;
+                EXPECT_TRUE(cache.getRangeValue("endpoint", instance, value));
+                EXPECT_EQ(i, value);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
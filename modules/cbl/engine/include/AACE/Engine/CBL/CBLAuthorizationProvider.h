@@ -23,6 +23,8 @@
 #include <string>
 #include <thread>
 #include <atomic>
+#include <utility>
+#include <vector>
 
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
@@ -95,12 +97,14 @@ public:
     /// @{
     void deregister() override;
     std::string getAuthToken() override;
+    std::chrono::steady_clock::time_point getAuthTokenExpirationTime() override;
     void onAuthFailure(const std::string& token) override;
     /// @}
 
     /// @name PropertyListenerInterface
     /// @{
     void propertyChanged(const std::string& name, const std::string& newValue) override;
+    void propertiesChanged(const std::vector<std::pair<std::string, std::string>>& changes) override;
     /// @}
 
     /**
@@ -1360,11 +1360,12 @@ AuthObserverInterface::Error CBLAuthorizationProvider::receiveTokenResponse(
         }
 
         setRefreshToken(refreshToken);
-        m_tokenExpirationTime = m_requestTime + std::chrono::seconds(expiresInSeconds);
-        m_timeToRefresh = m_tokenExpirationTime - m_configuration->getAccessTokenRefreshHeadStart();
+        auto tokenExpirationTime = m_requestTime + std::chrono::seconds(expiresInSeconds);
+        m_timeToRefresh = tokenExpirationTime - m_configuration->getAccessTokenRefreshHeadStart();
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_accessToken = accessToken;
+            m_tokenExpirationTime = tokenExpirationTime;
         }
 
         return AuthObserverInterface::Error::SUCCESS;
@@ -1500,6 +1501,11 @@ std::string CBLAuthorizationProvider::getAuthToken() {
     }
 }
 
+std::chrono::steady_clock::time_point CBLAuthorizationProvider::getAuthTokenExpirationTime() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tokenExpirationTime;
+}
+
 void CBLAuthorizationProvider::onAuthFailure(const std::string& token) {
     AACE_DEBUG(LX(TAG));
     try {
@@ -1537,6 +1543,16 @@ void CBLAuthorizationProvider::propertyChanged(const std::string& name, const st
     }
 }
 
+void CBLAuthorizationProvider::propertiesChanged(const std::vector<std::pair<std::string, std::string>>& changes) {
+    AACE_DEBUG(LX(TAG).d("count", changes.size()));
+    std::lock_guard<std::mutex> lock(m_localeMutex);
+    for (auto& change : changes) {
+        if (change.first == aace::alexa::property::LOCALE) {
+            m_locale = change.second;
+        }
+    }
+}
+
 }  // namespace cbl
 }  // namespace engine
 }  // namespace aace
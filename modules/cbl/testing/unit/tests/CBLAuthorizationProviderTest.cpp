@@ -79,6 +79,7 @@ public:
         removeListener,
         void(const std::string& name, std::shared_ptr<engine::propertyManager::PropertyListenerInterface> listener));
     MOCK_METHOD3(setProperty, bool(const std::string&, const std::string&, const bool&));
+    MOCK_METHOD2(setProperties, bool(const std::vector<std::pair<std::string, std::string>>&, const bool&));
     MOCK_METHOD1(getProperty, std::string(const std::string& name));
 };
 
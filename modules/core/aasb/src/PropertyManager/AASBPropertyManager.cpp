@@ -18,6 +18,7 @@
 
 #include <AASB/Message/PropertyManager/PropertyManager/GetPropertyMessage.h>
 #include <AASB/Message/PropertyManager/PropertyManager/SetPropertyMessage.h>
+#include <AASB/Message/PropertyManager/PropertyManager/SetPropertiesMessage.h>
 #include <AASB/Message/PropertyManager/PropertyManager/PropertyState.h>
 #include <AASB/Message/PropertyManager/PropertyManager/PropertyStateChangedMessage.h>
 #include <AASB/Message/PropertyManager/PropertyManager/PropertyChangedMessage.h>
@@ -73,6 +74,27 @@ bool AASBPropertyManager::initialize(
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::propertyManager::propertyManager::SetPropertiesMessage::topic(),
+            aasb::message::propertyManager::propertyManager::SetPropertiesMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::propertyManager::propertyManager::SetPropertiesMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    std::vector<std::pair<std::string, std::string>> properties;
+                    for (auto& property : payload.properties) {
+                        properties.emplace_back(property.name, property.value);
+                    }
+                    sp->setProperties(properties);
+
+                    AACE_INFO(LX(TAG, "SetPropertiesMessage").m("MessageRouted"));
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "SetPropertiesMessage").d("reason", ex.what()));
+                }
+            });
+
         messageBroker->subscribe(
             aasb::message::propertyManager::propertyManager::GetPropertyMessage::topic(),
             aasb::message::propertyManager::propertyManager::GetPropertyMessage::action(),
@@ -123,6 +123,37 @@ JNIEXPORT jboolean JNICALL Java_com_amazon_aace_propertyManager_PropertyManager_
     }
 }
 
+JNIEXPORT jboolean JNICALL Java_com_amazon_aace_propertyManager_PropertyManager_setProperties(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jobjectArray names,
+    jobjectArray values) {
+    try {
+        auto propertyManagerBinder = PROPERTYMANAGER_BINDER(ref);
+        ThrowIfNull(propertyManagerBinder, "invalidPropertyManagerBinder");
+        ThrowIfNull(names, "invalidNames");
+        ThrowIfNull(values, "invalidValues");
+
+        int size = env->GetArrayLength(names);
+        ThrowIf(size != env->GetArrayLength(values), "namesAndValuesSizeMismatch");
+
+        std::vector<std::pair<std::string, std::string>> properties;
+        for (int j = 0; j < size; j++) {
+            properties.emplace_back(
+                JString((jstring)env->GetObjectArrayElement(names, j)).toStdStr(),
+                JString((jstring)env->GetObjectArrayElement(values, j)).toStdStr());
+        }
+
+        ThrowIfNot(propertyManagerBinder->getPropertyManager()->setProperties(properties), "engineSetPropertiesFailed");
+
+        return true;
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_propertyManager_PropertyManager_setProperties", ex.what());
+        return false;
+    }
+}
+
 JNIEXPORT jstring JNICALL Java_com_amazon_aace_propertyManager_PropertyManager_getProperty(
     JNIEnv* env,
     jobject /* this */,
@@ -85,9 +85,28 @@ abstract public class PropertyManager extends PlatformInterface {
         return setProperty(getNativeRef(), name, value);
     }
 
+    /**
+     * Sets several property values in the Engine together. The properties are
+     * set in order, and if one of them cannot be set, the properties already set
+     * are restored to their previous values. setProperties() is an asynchronous
+     * operation and the Engine will call propertyStateChanged() with the status
+     * of each property when it is completed.
+     *
+     * @param names The names used by the Engine to identify the properties.
+     *        Each name must be one of the property constants recognized by
+     *        the Engine, e.g. the properties in
+     *        @c com.amazon.aace.alexa.AlexaProperties.java
+     * @param values The property settings, in the same order as @c names
+     * @return @c true if the properties will be set, else @c false if a property
+     *         is not recognized by the Engine, in which case no property is set.
+     */
+    public final boolean setProperties(String[] names, String[] values) {
+        return setProperties(getNativeRef(), names, values);
+    }
+
     /**
      * Notifies the platform implementation of the status of a property change
-     * after a call to setProperty().
+     * after a call to setProperty() or setProperties().
      *
      * @param name The name used by the Engine to identify the property.
      * @param value The property value.
@@ -114,7 +133,8 @@ abstract public class PropertyManager extends PlatformInterface {
      * Notifies the platform implementation of a property setting change in the
      * Engine.
      * @note This will not be called if the property setting change was
-     * initiated by @c PropertyManager.setProperty()
+     * initiated by @c PropertyManager.setProperty() or
+     * @c PropertyManager.setProperties()
      *
      * @param name The name used by the Engine to identify the property.
      * @param newValue The new value of the property
@@ -134,5 +154,6 @@ abstract public class PropertyManager extends PlatformInterface {
     private native long createBinder();
     private native void disposeBinder(long nativeRef);
     private native boolean setProperty(long nativeRef, String name, String value);
+    private native boolean setProperties(long nativeRef, String[] names, String[] values);
     private native String getProperty(long nativeRef, String name);
 }
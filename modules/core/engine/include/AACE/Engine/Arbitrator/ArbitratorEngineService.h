@@ -67,6 +67,7 @@ protected:
     bool configure(std::shared_ptr<std::istream> configuration) override;
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     // platform interface registration
@@ -53,6 +53,7 @@ protected:
     bool initialize() override;
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     // platform interface registration
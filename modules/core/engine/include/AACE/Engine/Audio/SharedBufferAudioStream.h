@@ -0,0 +1,74 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_AUDIO_SHARED_BUFFER_AUDIO_STREAM_H
+#define AACE_ENGINE_AUDIO_SHARED_BUFFER_AUDIO_STREAM_H
+
+#include <istream>
+#include <memory>
+#include <vector>
+
+#include <AACE/Audio/AudioStream.h>
+
+namespace aace {
+namespace engine {
+namespace audio {
+
+/**
+ * An @c AudioStream reading from an immutable in-memory buffer. The buffer is shared by every stream created from
+ * it, so a sound loaded once can be played any number of times without reading or copying its source again.
+ */
+class SharedBufferAudioStream : public aace::audio::AudioStream {
+public:
+    using Buffer = std::vector<char>;
+
+private:
+    SharedBufferAudioStream(
+        std::shared_ptr<const Buffer> buffer,
+        const AudioFormat& audioFormat,
+        const std::vector<aace::audio::AudioStreamProperty>& properties);
+
+public:
+    /**
+     * Reads a stream to its end into a buffer which can be shared by @c SharedBufferAudioStream instances.
+     *
+     * @param stream The stream to read.
+     * @return The buffer, or @c nullptr if the stream could not be read.
+     */
+    static std::shared_ptr<const Buffer> load(std::shared_ptr<std::istream> stream);
+
+    static std::shared_ptr<SharedBufferAudioStream> create(
+        std::shared_ptr<const Buffer> buffer,
+        const AudioFormat& audioFormat = aace::audio::AudioFormat::UNKNOWN,
+        const std::vector<aace::audio::AudioStreamProperty>& properties = {});
+
+    // aace::audio::AudioStream
+    ssize_t read(char* data, const size_t size) override;
+    bool isClosed() override;
+    AudioFormat getAudioFormat() override;
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override;
+
+private:
+    std::shared_ptr<const Buffer> m_buffer;
+    AudioFormat m_audioFormat;
+    std::vector<aace::audio::AudioStreamProperty> m_properties;
+    size_t m_offset;
+};
+
+}  // namespace audio
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_AUDIO_SHARED_BUFFER_AUDIO_STREAM_H
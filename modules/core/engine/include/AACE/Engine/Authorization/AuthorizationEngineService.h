@@ -51,6 +51,7 @@ public:
 protected:
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     // platform interface registration
@@ -17,6 +17,7 @@
 #define AACE_ENGINE_CORE_ENGINE_IMPL_H
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -69,6 +70,10 @@ public:
     std::shared_ptr<aace::core::MessageStream> openStream(
         const std::string& streamId,
         aace::core::MessageStream::Mode mode) override;
+    bool openSharedMemoryStream(
+        const std::string& streamId,
+        aace::core::MessageStream::Mode mode,
+        SharedMemoryStream& stream) override;
     /// @}
 
     /// Create the engine
@@ -79,6 +84,15 @@ public:
      **/
     std::string getProperty_version();
 
+    /**
+     * Returns the order in which the setup, start and stop phases handle the services. Each step lists the
+     * services handled together: a step with more than one service is handled concurrently, and a step is only
+     * handled once the previous step has finished.
+     *
+     * @return The types of the services handled in each step
+     */
+    std::vector<std::vector<std::string>> getServicePhaseSchedule();
+
 protected:
     /// @name @c aace::engine::core::EngineContext functions.
     /// @{
@@ -89,6 +103,25 @@ private:
     bool initialize();
     bool checkServices();
 
+    /**
+     * Splits the ordered service list into the steps of a lifecycle phase. Services that opt in with
+     * @c EngineService::isConcurrentLifecycleSafe(), and whose dependencies all opt in as well, are handled
+     * first in a single concurrent step. The remaining services follow in dependency order: each service that
+     * has not opted in is a step of its own, and consecutive opted in services share a concurrent step.
+     */
+    std::vector<std::vector<std::shared_ptr<EngineService>>> buildServicePhaseSchedule();
+
+    /**
+     * Runs @c handler for each service in the steps of @c buildServicePhaseSchedule(), stopping at the first
+     * failure. A step of one service is handled on the calling thread, and a concurrent step is handled on a
+     * bounded pool of worker threads, each service once its dependencies in the step have been handled.
+     *
+     * @param phase The name of the lifecycle phase, used for logging
+     * @param handler The lifecycle event handler to call for each service
+     * @return @c true if the handler succeeded for every service
+     */
+    bool runServicePhase(const std::string& phase, std::function<bool(std::shared_ptr<EngineService>)> handler);
+
     std::shared_ptr<EngineService> getServiceFromPropertyKey(const std::string& key);
     bool registerProperties();
 
@@ -18,6 +18,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <istream>
@@ -27,6 +28,8 @@
 
 #include <iostream>
 
+#include <nlohmann/json.hpp>
+
 #include "AACE/Engine/Core/ServiceDescription.h"
 #include "AACE/Core/PlatformInterface.h"
 
@@ -56,6 +59,7 @@ public:
 
     template <class T>
     bool registerServiceFactory(ServiceFactory fn, const std::string& id = DEFAULT_SERVICE_FACTORY_ID) {
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         auto key = typeid(T).name();
         auto outer_iterator = m_serviceFactoryMap.find(key);
         if (outer_iterator == m_serviceFactoryMap.end()) {
@@ -74,6 +78,7 @@ public:
 
     template <class T>
     std::shared_ptr<T> getServiceInterface() {
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         auto key = typeid(T).name();
         auto it = m_serviceInterfaceMap.find(key);
         return it != m_serviceInterfaceMap.end() ? std::static_pointer_cast<T>(it->second.lock()) : nullptr;
@@ -83,6 +88,12 @@ protected:
     virtual bool initialize();
     virtual bool configure();
     virtual bool configure(std::shared_ptr<std::istream> configuration);
+
+    // Configures the service from its already parsed configuration node. The node is only valid for the
+    // duration of the call. The default implementation serializes the node and calls the stream overload,
+    // so services that have not moved to the parsed configuration keep working.
+    virtual bool configure(const nlohmann::json& configuration);
+
     virtual bool preRegister();
     virtual bool postRegister();
     virtual bool setup();
@@ -93,37 +104,56 @@ protected:
     virtual bool engineStarted();
     virtual bool engineStopped();
 
+    // Returns true if the service's setup, start and stop handlers may run concurrently with other services
+    // that also return true. A service should only opt in once every service it uses from those handlers is
+    // declared as a dependency, since dependencies are the only ordering the engine keeps between them. The
+    // default implementation returns false, so the service runs serially in dependency order.
+    virtual bool isConcurrentLifecycleSafe();
+
     std::shared_ptr<aace::engine::core::EngineContext> getContext();
 
     template <class T>
     std::shared_ptr<T> newFactoryInstance(
         ServiceFactory defaultFactory,
         const std::string& id = DEFAULT_SERVICE_FACTORY_ID) {
-        auto key = typeid(T).name();
-        auto outer_iterator = m_serviceFactoryMap.find(key);
-        if (outer_iterator != m_serviceFactoryMap.end()) {
-            auto inner_iterator = m_serviceFactoryMap[key].find(id);
-            if (inner_iterator != m_serviceFactoryMap[key].end()) {
-                return std::static_pointer_cast<T>(inner_iterator->second());
+        ServiceFactory factory = defaultFactory;
+        {
+            std::lock_guard<std::mutex> lock(m_serviceMapMutex);
+            auto key = typeid(T).name();
+            auto outer_iterator = m_serviceFactoryMap.find(key);
+            if (outer_iterator != m_serviceFactoryMap.end()) {
+                auto inner_iterator = outer_iterator->second.find(id);
+                if (inner_iterator != outer_iterator->second.end()) {
+                    factory = inner_iterator->second;
+                }
             }
         }
-        return std::static_pointer_cast<T>(defaultFactory());
+        return std::static_pointer_cast<T>(factory());
     }
 
     template <class T>
     std::vector<std::shared_ptr<T>> getFactoryType() {
-        std::vector<std::shared_ptr<T>> factoryList;
-        auto key = typeid(T).name();
-        if (m_serviceFactoryMap.find(key) != m_serviceFactoryMap.end()) {
-            for (auto it = m_serviceFactoryMap[key].begin(); it != m_serviceFactoryMap[key].end(); it++) {
-                factoryList.push_back(std::static_pointer_cast<T>(it->second()));
+        std::vector<ServiceFactory> factoryFunctionList;
+        {
+            std::lock_guard<std::mutex> lock(m_serviceMapMutex);
+            auto key = typeid(T).name();
+            auto outer_iterator = m_serviceFactoryMap.find(key);
+            if (outer_iterator != m_serviceFactoryMap.end()) {
+                for (auto it = outer_iterator->second.begin(); it != outer_iterator->second.end(); it++) {
+                    factoryFunctionList.push_back(it->second);
+                }
             }
         }
+        std::vector<std::shared_ptr<T>> factoryList;
+        for (auto& next : factoryFunctionList) {
+            factoryList.push_back(std::static_pointer_cast<T>(next()));
+        }
         return factoryList;
     }
 
     template <class T>
     bool registerServiceInterface(std::shared_ptr<T> serviceInterface) {
+        std::lock_guard<std::mutex> lock(m_serviceMapMutex);
         auto key = typeid(T).name();
         if (m_serviceInterfaceMap.find(key) == m_serviceInterfaceMap.end()) {
             m_serviceInterfaceMap[key] = serviceInterface;
@@ -135,7 +165,7 @@ protected:
 
 private:
     bool handleInitializeEngineEvent(std::shared_ptr<aace::engine::core::EngineContext> context);
-    bool handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration);
+    bool handleConfigureEngineEvent(const nlohmann::json& configuration);
     bool handlePreRegisterEngineEvent();
     bool handlePostRegisterEngineEvent();
     bool handleSetupEngineEvent();
@@ -160,6 +190,10 @@ private:
     // service interface map
     std::unordered_map<std::string, std::weak_ptr<void>> m_serviceInterfaceMap;
 
+    // guards the service factory and interface maps, which other services may access while this one is
+    // running a lifecycle handler
+    std::mutex m_serviceMapMutex;
+
     // allow the EngineImpl call private functions in this class
     friend class aace::engine::core::EngineImpl;
 };
@@ -36,6 +36,7 @@ public:
 protected:
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool shutdown() override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     // platform interface registration
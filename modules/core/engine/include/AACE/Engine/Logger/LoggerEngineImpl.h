@@ -58,7 +58,8 @@ public:
 private:
     std::shared_ptr<aace::logger::Logger> m_platformLoggerInterface;
 
-    // executor
+    // executor, running at low priority. On Linux threads created from the platform log handler inherit the
+    // lowered priority of the executor thread.
     aace::engine::utils::threading::Executor m_executor;
 };
 
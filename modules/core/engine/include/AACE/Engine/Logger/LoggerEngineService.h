@@ -48,6 +48,7 @@ protected:
     bool configure(std::shared_ptr<std::istream> configuration) override;
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     std::shared_ptr<aace::engine::logger::sink::Sink> createSink(const aace::engine::utils::json::Value& config);
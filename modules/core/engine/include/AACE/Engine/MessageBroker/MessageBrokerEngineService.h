@@ -42,6 +42,7 @@ public:
     // aace::egnine::message::MessageBrokerServiceInterface
     std::shared_ptr<MessageBrokerInterface> getMessageBroker() override;
     std::shared_ptr<StreamManagerInterface> getStreamManager() override;
+    std::shared_ptr<SharedMemoryStreamTransport> getSharedMemoryStreamTransport() override;
     aace::engine::core::Version getConfiguredVersion() override;
     aace::engine::core::Version getCurrentVersion() override;
     bool getAutoEnableInterfaces() override;
@@ -55,10 +56,12 @@ protected:
     bool setup() override;
     // bool start() override;
     // bool stop() override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     std::shared_ptr<MessageBrokerImpl> m_messageBroker;
     std::shared_ptr<StreamManagerImpl> m_streamManager;
+    std::shared_ptr<SharedMemoryStreamTransport> m_sharedMemoryStreamTransport;
 
     // Current message version from build infro
     aace::engine::core::Version m_currentVersion;
@@ -95,9 +95,12 @@ public:
 private:
     bool m_isShutdown = false;
 
-    // executor for deferred asynchronous message sending
-    aace::engine::utils::threading::Executor m_incomingMessageExecutor;
-    aace::engine::utils::threading::Executor m_outgoingMessageExecutor;
+    // executor for deferred asynchronous message sending, on the path of user interactions in both directions:
+    // platform requests such as starting a capture, and directives dispatched to the platform
+    aace::engine::utils::threading::Executor m_incomingMessageExecutor{
+        aace::engine::utils::threading::TaskPriority::HIGH};
+    aace::engine::utils::threading::Executor m_outgoingMessageExecutor{
+        aace::engine::utils::threading::TaskPriority::HIGH};
 
     // map of subscribers
     std::unordered_map<std::string, std::vector<MessageHandler>> m_subscriberMap;
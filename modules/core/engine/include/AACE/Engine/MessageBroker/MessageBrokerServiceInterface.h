@@ -20,6 +20,7 @@
 #include <AACE/Engine/Core/ServiceDescription.h>
 
 #include "MessageBrokerInterface.h"
+#include "SharedMemoryStreamTransport.h"
 #include "StreamManagerInterface.h"
 
 namespace aace {
@@ -33,6 +34,7 @@ public:
 public:
     virtual std::shared_ptr<MessageBrokerInterface> getMessageBroker() = 0;
     virtual std::shared_ptr<StreamManagerInterface> getStreamManager() = 0;
+    virtual std::shared_ptr<SharedMemoryStreamTransport> getSharedMemoryStreamTransport() = 0;
     virtual aace::engine::core::Version getConfiguredVersion() = 0;
     virtual aace::engine::core::Version getCurrentVersion() = 0;
     virtual bool getAutoEnableInterfaces() = 0;
@@ -0,0 +1,80 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_MESSAGE_STREAM_H
+#define AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_MESSAGE_STREAM_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include <AACE/Core/MessageStream.h>
+
+#include "SharedMemoryRing.h"
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * A @c MessageStream over one side of a @c SharedMemoryRing. A stream in @c READ mode is the consumer of the ring,
+ * and a stream in @c WRITE mode is its producer.
+ */
+class SharedMemoryMessageStream : public aace::core::MessageStream {
+public:
+    /// The default time a read waits for data, or a write waits for space.
+    static const std::chrono::milliseconds DEFAULT_TIMEOUT;
+
+private:
+    SharedMemoryMessageStream(
+        std::shared_ptr<SharedMemoryRing> ring,
+        MessageStream::Mode mode,
+        std::chrono::milliseconds timeout);
+
+public:
+    /**
+     * Creates a @c SharedMemoryMessageStream.
+     *
+     * @param ring The ring of the stream.
+     * @param mode @c READ to consume the ring, or @c WRITE to produce it.
+     * @param timeout The time a read waits for data, or a write waits for space.
+     * @return The stream, or @c nullptr if the arguments are invalid.
+     */
+    static std::shared_ptr<SharedMemoryMessageStream> create(
+        std::shared_ptr<SharedMemoryRing> ring,
+        MessageStream::Mode mode,
+        std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+
+    std::shared_ptr<SharedMemoryRing> getRing();
+
+    // aace::core::MessageStream
+    ssize_t read(char* data, size_t size) override;
+    ssize_t write(const char* data, size_t size) override;
+    void close() override;
+    bool isClosed() override;
+    MessageStream::Mode getMode() override;
+
+private:
+    std::shared_ptr<SharedMemoryRing> m_ring;
+    MessageStream::Mode m_mode;
+    std::chrono::milliseconds m_timeout;
+    std::atomic<bool> m_closed;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_MESSAGE_STREAM_H
@@ -0,0 +1,147 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_RING_H
+#define AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_RING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <sys/types.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * A single producer, single consumer byte ring in shared memory, which can be shared with another process. The ring
+ * is backed by a memfd, and each side wakes the other through an eventfd only when the other side is waiting, so
+ * streaming through the ring takes no system calls while both sides keep up.
+ *
+ * The other process attaches to the ring with the three file descriptors returned by @c getMemoryFd(),
+ * @c getDataEventFd() and @c getSpaceEventFd(), for example passed over a Unix domain socket with @c SCM_RIGHTS.
+ * The memfd is sealed against resizing, and each side bounds the indices it reads from the other side by the
+ * capacity, so a misbehaving process cannot make the other one access memory outside the ring.
+ *
+ * Shared memory rings are only supported on Linux. On other platforms @c create() and @c attach() fail.
+ */
+class SharedMemoryRing {
+public:
+    /// The largest capacity of a ring.
+    static const size_t MAX_CAPACITY;
+
+    /**
+     * Creates a ring.
+     *
+     * @param capacity The capacity of the ring in bytes, rounded up to a power of two.
+     * @return The ring, or @c nullptr if it could not be created.
+     */
+    static std::shared_ptr<SharedMemoryRing> create(size_t capacity);
+
+    /**
+     * Attaches to a ring created by another @c SharedMemoryRing, usually in another process. The ring takes
+     * ownership of the file descriptors, which are closed when the ring is destroyed, or if attaching fails.
+     *
+     * @param memoryFd The memfd of the ring.
+     * @param dataEventFd The eventfd signaled when data is written.
+     * @param spaceEventFd The eventfd signaled when data is read.
+     * @return The ring, or @c nullptr if the file descriptors are not a valid ring, or the memfd is not sealed
+     * against resizing.
+     */
+    static std::shared_ptr<SharedMemoryRing> attach(int memoryFd, int dataEventFd, int spaceEventFd);
+
+    ~SharedMemoryRing();
+
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+    /**
+     * Writes data to the ring, waiting for space while the ring is full. Must only be called by the producer.
+     *
+     * @param data The data to write.
+     * @param size The number of bytes to write.
+     * @param timeout The maximum time to wait for space.
+     * @return The number of bytes written, which is less than @c size if the timeout expired, or -1 if the reader
+     * is closed.
+     */
+    ssize_t write(const char* data, size_t size, std::chrono::milliseconds timeout);
+
+    /**
+     * Reads the data available in the ring, waiting for data while the ring is empty. Must only be called by the
+     * consumer.
+     *
+     * @param data The buffer to read into.
+     * @param size The size of the buffer.
+     * @param timeout The maximum time to wait for data.
+     * @return The number of bytes read, or 0 if the timeout expired or the end of the stream is reached.
+     */
+    ssize_t read(char* data, size_t size, std::chrono::milliseconds timeout);
+
+    /// Closes the producer side. The consumer reads the remaining data and then reaches the end of the stream.
+    void closeWriter();
+
+    /// Closes the consumer side. The producer fails to write from then on.
+    void closeReader();
+
+    bool isWriterClosed() const;
+    bool isReaderClosed() const;
+
+    /// @return @c true if the writer is closed and every byte was read.
+    bool isEndOfStream() const;
+
+    /// @return The number of bytes which can be read.
+    size_t available() const;
+
+    size_t getCapacity() const;
+    int getMemoryFd() const;
+    int getDataEventFd() const;
+    int getSpaceEventFd() const;
+
+private:
+    struct Header;
+
+    SharedMemoryRing(int memoryFd, int dataEventFd, int spaceEventFd, void* mapping, size_t mappingSize);
+
+    /// Waits until @c ready() returns @c true or the deadline passes, flagging the wait for the other side.
+    template <typename Predicate>
+    bool waitFor(
+        int eventFd,
+        std::atomic<uint32_t>& waiting,
+        Predicate ready,
+        std::chrono::steady_clock::time_point deadline);
+
+    static void signal(int eventFd);
+
+    /// @return The size of the header, which the data of the ring follows.
+    static size_t getHeaderSize();
+
+    int m_memoryFd;
+    int m_dataEventFd;
+    int m_spaceEventFd;
+    void* m_mapping;
+    size_t m_mappingSize;
+    Header* m_header;
+    char* m_data;
+    uint32_t m_capacity;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_RING_H
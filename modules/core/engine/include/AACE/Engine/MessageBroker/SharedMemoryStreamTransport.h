@@ -0,0 +1,106 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_STREAM_TRANSPORT_H
+#define AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_STREAM_TRANSPORT_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "SharedMemoryMessageStream.h"
+#include "StreamManagerInterface.h"
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * Serves the streams of the @c StreamManagerInterface to another process through shared memory rings, so an
+ * out-of-process integration can produce or consume audio without copying every chunk over a socket.
+ *
+ * Opening a stream by its ID requests its handler from the stream manager, like the platform does for an in-process
+ * stream, and returns a @c SharedMemoryRing for the other process to attach to. A stream opened in @c READ mode is
+ * read by the other process, and a stream opened in @c WRITE mode is written by it. A pump thread moves the data
+ * between the handler and the ring until either side closes.
+ */
+class SharedMemoryStreamTransport {
+public:
+    /// The default capacity of the ring of a stream.
+    static const size_t DEFAULT_RING_CAPACITY;
+
+private:
+    SharedMemoryStreamTransport(std::shared_ptr<StreamManagerInterface> streamManager);
+
+public:
+    static std::shared_ptr<SharedMemoryStreamTransport> create(std::shared_ptr<StreamManagerInterface> streamManager);
+
+    ~SharedMemoryStreamTransport();
+
+    /**
+     * Opens a stream over a shared memory ring.
+     *
+     * @param streamId The ID of the stream.
+     * @param mode @c READ if the other process reads the stream, or @c WRITE if it writes it.
+     * @param capacity The capacity of the ring.
+     * @return The ring for the other process to attach to, or @c nullptr if the stream could not be opened.
+     */
+    std::shared_ptr<SharedMemoryRing> openStream(
+        const std::string& streamId,
+        aace::core::MessageStream::Mode mode,
+        size_t capacity = DEFAULT_RING_CAPACITY);
+
+    /// Stops the pumps of the open streams and closes their rings.
+    void shutdown();
+
+private:
+    struct Pump {
+        std::thread thread;
+        std::atomic<bool> finished{false};
+    };
+
+    /// Moves the data of @c handler into @c stream, for a stream read by the other process.
+    void pumpToRing(
+        std::shared_ptr<aace::core::MessageStream> handler,
+        std::shared_ptr<SharedMemoryMessageStream> stream);
+
+    /// Moves the data of @c stream into @c handler, for a stream written by the other process.
+    void pumpFromRing(
+        std::shared_ptr<aace::core::MessageStream> handler,
+        std::shared_ptr<SharedMemoryMessageStream> stream);
+
+    /// Waits until the transport shuts down or the timeout expires. @return @c false if the transport shut down.
+    bool waitForShutdown(std::chrono::milliseconds timeout);
+
+    /// Joins the pumps which have finished.
+    void reapPumpsLocked();
+
+    std::weak_ptr<StreamManagerInterface> m_streamManager;
+    std::list<std::unique_ptr<Pump>> m_pumps;
+    std::atomic<bool> m_shutdown;
+    std::mutex m_mutex;
+    std::condition_variable m_shutdownCondition;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_SHARED_MEMORY_STREAM_TRANSPORT_H
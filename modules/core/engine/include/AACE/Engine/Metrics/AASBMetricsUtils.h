@@ -38,6 +38,31 @@ using DataPointAdder = std::function<void(const std::string, const std::string,
  */
 std::string serializeMetricEvent(const MetricEvent& metricEvent);
 
+/**
+ * Append the serialized representation of the specified @c MetricEvent, as
+ * returned by @c serializeMetricEvent(), to @a out.
+ *
+ * @param [out] out The string to append to
+ * @param metricEvent The metric to serialize
+ */
+void appendSerializedMetricEvent(std::string& out, const MetricEvent& metricEvent);
+
+/**
+ * Returns the @c MetricsUpload.Agent<ID> AASB message containing the
+ * serialized representation of each of the specified metrics. The message is
+ * written directly to a single string without building an intermediate JSON
+ * document.
+ *
+ * @param messageId The ID of the AASB message
+ * @param agentId The agent ID of the agent associated with the metrics
+ * @param metricEvents The metrics to include in the message
+ * @return The AASB message as a string
+ */
+std::string serializeMetricsUploadMessage(
+    const std::string& messageId,
+    unsigned int agentId,
+    const std::vector<MetricEvent>& metricEvents);
+
 /**
  * Parse header values from the specified metric. The metric string must be
  * the serialized representation as defined for a single metric in the
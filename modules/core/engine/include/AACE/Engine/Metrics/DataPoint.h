@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_METRICS_DATAPOINT_H
 #define AACE_ENGINE_METRICS_DATAPOINT_H
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <stdexcept>
@@ -100,16 +101,44 @@ public:
      */
     DataPoint(const std::string& name, const std::string& value, DataType dataType, uint32_t sampleCount = 1);
 
+    /**
+     * Constructor for a numeric data point. The value is kept as a native
+     * integer and only formatted as a string when requested.
+     *
+     * @param name Name of the data point.
+     * @param value Numeric value of the data point.
+     * @param dataType Type of the data point. Must be @c DataType::COUNTER or
+     *        @c DataType::DURATION.
+     * @param sampleCount The number of data samples comprising this data.
+     */
+    DataPoint(const std::string& name, uint64_t value, DataType dataType, uint32_t sampleCount = 1);
+
     /**
      * @return The data point name
      */
-    std::string getName() const;
+    const std::string& getName() const;
 
     /**
      * @return The data point value as a string
      */
     std::string getValue() const;
 
+    /**
+     * @return @c true if the value of the data point is stored as a native
+     *         integer, @c false if it is stored as a string
+     */
+    bool isNumeric() const;
+
+    /**
+     * Get the value of a numeric data point. For a @c DataType::COUNTER or
+     * @c DataType::DURATION data point constructed from a string, the string
+     * is converted.
+     *
+     * @return The data point value as an integer, or 0 if the value is not
+     *         numeric
+     */
+    uint64_t getNumericValue() const;
+
     /**
      * @return The data point type
      */
@@ -130,8 +159,12 @@ public:
 private:
     /// The data point name
     std::string m_name;
-    /// The data point value as a string
+    /// The data point value as a string. Empty for numeric data points.
     std::string m_value;
+    /// The data point value as an integer. Used if @c m_isNumeric is @c true.
+    uint64_t m_numericValue;
+    /// Whether the value is stored in @c m_numericValue
+    bool m_isNumeric;
     /// The data point type
     DataType m_dataType;
     /// The number of samples
@@ -0,0 +1,218 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_METRICS_METRIC_AGGREGATOR_H
+#define AACE_ENGINE_METRICS_METRIC_AGGREGATOR_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <AACE/Engine/Metrics/MetricEvent.h>
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+/**
+ * A counter that accumulates increments in process until the owning
+ * @c MetricAggregator collects it at the end of a flush window. Incrementing
+ * the counter is lock-free and safe to call from any thread.
+ */
+class AggregatedCounter {
+public:
+    /// Constructor
+    AggregatedCounter();
+
+    /**
+     * Add @a value to the counter.
+     *
+     * @param value The amount to add
+     */
+    void increment(uint64_t value = 1);
+
+    /**
+     * Read the counter value and reset it to zero.
+     *
+     * @return The value accumulated since the last call
+     */
+    uint64_t collect();
+
+private:
+    /// The accumulated value
+    std::atomic<uint64_t> m_value;
+};
+
+/**
+ * A timer that accumulates duration samples into a fixed histogram with
+ * power-of-two millisecond buckets until the owning @c MetricAggregator
+ * collects it at the end of a flush window. Recording a sample is lock-free
+ * and safe to call from any thread.
+ */
+class AggregatedTimer {
+public:
+    /// The number of histogram buckets
+    static constexpr size_t NUM_BUCKETS = 32;
+
+    /**
+     * A point in time copy of the histogram.
+     */
+    struct Snapshot {
+        /// The number of recorded samples
+        uint64_t count;
+        /// The sum of the recorded samples in milliseconds
+        uint64_t sum;
+        /// The largest recorded sample in milliseconds
+        uint64_t max;
+        /// The number of samples per bucket
+        std::array<uint64_t, NUM_BUCKETS> buckets;
+
+        /**
+         * Estimate a percentile from the histogram. The result is the upper
+         * bound of the bucket containing the requested rank, capped at
+         * @c max.
+         *
+         * @param percentile The percentile in the range (0, 100]
+         * @return The estimated value in milliseconds, or 0 if there are no
+         *         samples
+         */
+        uint64_t getPercentile(double percentile) const;
+    };
+
+    /// Constructor
+    AggregatedTimer();
+
+    /**
+     * Record a duration sample.
+     *
+     * @param duration The duration to record. Negative values are recorded
+     *        as zero.
+     */
+    void record(std::chrono::milliseconds duration);
+
+    /**
+     * Read the histogram and reset it.
+     *
+     * @return The samples recorded since the last call
+     */
+    Snapshot collect();
+
+    /**
+     * Get the index of the histogram bucket for a sample. Bucket 0 holds
+     * samples of 0 ms and bucket @c i holds samples in the range
+     * [2^(i-1), 2^i) ms. The last bucket is unbounded.
+     *
+     * @param valueMs The sample in milliseconds
+     * @return The bucket index
+     */
+    static size_t bucketIndex(uint64_t valueMs);
+
+private:
+    /// The number of samples per bucket
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> m_buckets;
+    /// The sum of the recorded samples in milliseconds
+    std::atomic<uint64_t> m_sum;
+    /// The largest recorded sample in milliseconds
+    std::atomic<uint64_t> m_max;
+};
+
+/**
+ * The @c MetricAggregator owns the @c AggregatedCounter and
+ * @c AggregatedTimer instances of high-rate metrics. Hot paths obtain a
+ * handle once and then only perform atomic updates; the aggregated values
+ * are converted to @c MetricEvent objects once per flush window by
+ * @c collect().
+ */
+class MetricAggregator {
+public:
+    /// Suffix of the data point holding the 50th percentile of a timer
+    static const std::string SUFFIX_P50;
+    /// Suffix of the data point holding the 90th percentile of a timer
+    static const std::string SUFFIX_P90;
+    /// Suffix of the data point holding the 99th percentile of a timer
+    static const std::string SUFFIX_P99;
+    /// Suffix of the data point holding the maximum of a timer
+    static const std::string SUFFIX_MAX;
+
+    /**
+     * Get the counter for the specified metric data point, creating it if
+     * necessary. Callers should keep the returned handle rather than looking
+     * it up for each increment.
+     *
+     * @param programName The program name of the metric
+     * @param sourceName The source name of the metric
+     * @param dataPointName The name of the counter data point
+     * @return The counter, or @c nullptr if any name is empty
+     */
+    std::shared_ptr<AggregatedCounter> getCounter(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName);
+
+    /**
+     * Get the timer for the specified metric data point, creating it if
+     * necessary. Callers should keep the returned handle rather than looking
+     * it up for each sample.
+     *
+     * @param programName The program name of the metric
+     * @param sourceName The source name of the metric
+     * @param dataPointName The name of the duration data point
+     * @return The timer, or @c nullptr if any name is empty
+     */
+    std::shared_ptr<AggregatedTimer> getTimer(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName);
+
+    /**
+     * Collect and reset every counter and timer. One @c MetricEvent is
+     * created per program and source that has recorded data in the window.
+     * A counter produces a @c DataType::COUNTER data point with the window
+     * total. A timer produces a @c DataType::DURATION data point with the
+     * mean and the number of samples as sample count, plus data points with
+     * the @c SUFFIX_P50, @c SUFFIX_P90, @c SUFFIX_P99 and @c SUFFIX_MAX
+     * suffixes.
+     *
+     * @return The aggregated metric events
+     */
+    std::vector<MetricEvent> collect();
+
+private:
+    /// The counters and timers of a single program and source
+    struct SourceAggregates {
+        /// Counters keyed by data point name
+        std::map<std::string, std::shared_ptr<AggregatedCounter>> counters;
+        /// Timers keyed by data point name
+        std::map<std::string, std::shared_ptr<AggregatedTimer>> timers;
+    };
+
+    /// Aggregates keyed by program and source name
+    std::map<std::pair<std::string, std::string>, SourceAggregates> m_aggregates;
+
+    /// Serializes access to @c m_aggregates
+    std::mutex m_mutex;
+};
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_METRICS_METRIC_AGGREGATOR_H
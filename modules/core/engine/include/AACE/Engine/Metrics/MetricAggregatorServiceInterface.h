@@ -0,0 +1,71 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_METRICS_METRIC_AGGREGATOR_SERVICE_INTERFACE_H
+#define AACE_ENGINE_METRICS_METRIC_AGGREGATOR_SERVICE_INTERFACE_H
+
+#include <memory>
+#include <string>
+
+#include <AACE/Engine/Metrics/MetricAggregator.h>
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+/**
+ * An interface to obtain in-process aggregated counters and timers for
+ * high-rate metrics. Aggregated values are recorded as @c MetricEvent objects
+ * once per flush window instead of one event per occurrence.
+ */
+class MetricAggregatorServiceInterface {
+public:
+    /**
+     * Destructor
+     */
+    virtual ~MetricAggregatorServiceInterface() = default;
+
+    /**
+     * Get the aggregated counter for the specified metric data point.
+     *
+     * @param programName The program name of the metric
+     * @param sourceName The source name of the metric
+     * @param dataPointName The name of the counter data point
+     * @return The counter, or @c nullptr if it cannot be created
+     */
+    virtual std::shared_ptr<AggregatedCounter> getAggregatedCounter(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName) = 0;
+
+    /**
+     * Get the aggregated timer for the specified metric data point.
+     *
+     * @param programName The program name of the metric
+     * @param sourceName The source name of the metric
+     * @param dataPointName The name of the duration data point
+     * @return The timer, or @c nullptr if it cannot be created
+     */
+    virtual std::shared_ptr<AggregatedTimer> getAggregatedTimer(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName) = 0;
+};
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_METRICS_METRIC_AGGREGATOR_SERVICE_INTERFACE_H
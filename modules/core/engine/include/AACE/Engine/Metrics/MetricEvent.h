@@ -52,6 +52,24 @@ public:
         const std::unordered_map<std::string, DataPoint>& dataPoints,
         std::chrono::steady_clock::time_point timestamp);
 
+    /**
+     * Constructor taking ownership of the data points.
+     *
+     * @param programName The program name of the metric.
+     * @param sourceName The source name of the metric.
+     * @param metricContext The contextual properties related to recording the
+     *        metric.
+     * @param dataPoints A map of @c DataPoint objects, keyed by data point
+     *        name.
+     * @param timestamp The timestamp at which this metric event was created.
+     */
+    MetricEvent(
+        const std::string& programName,
+        const std::string& sourceName,
+        MetricContext metricContext,
+        std::unordered_map<std::string, DataPoint>&& dataPoints,
+        std::chrono::steady_clock::time_point timestamp);
+
     /**
      * Get the program name of the metric.
      *
@@ -90,6 +108,13 @@ public:
      */
     std::vector<DataPoint> getDataPoints() const;
 
+    /**
+     * Get the data points for the metric event without copying them.
+     *
+     * @return The map of @c DataPoint, keyed by data point name
+     */
+    const std::unordered_map<std::string, DataPoint>& getDataPointMap() const;
+
     /**
      * Get the timestamp of when the metric event was created as a system clock
      * time point.
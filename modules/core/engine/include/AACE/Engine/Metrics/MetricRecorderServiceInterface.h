@@ -42,6 +42,17 @@ public:
      * @param metricEvent The metric event to record
      */
     virtual void recordMetric(const MetricEvent& metricEvent) = 0;
+
+    /**
+     * Record a @c MetricEvent so it routes to an uploader, taking ownership
+     * of the event to avoid copying its data points.
+     *
+     * @note The implementation must be non-blocking.
+     * @param metricEvent The metric event to record
+     */
+    virtual void recordMetric(MetricEvent&& metricEvent) {
+        recordMetric(static_cast<const MetricEvent&>(metricEvent));
+    }
 };
 
 /**
@@ -24,11 +24,16 @@
 #include <AACE/Engine/Logger/LoggerEngineService.h>
 #include <AACE/Engine/MessageBroker/Message.h>
 #include <AACE/Engine/Metrics/AbstractMetricsDispatcher.h>
+#include <AACE/Engine/Metrics/MetricAggregator.h>
+#include <AACE/Engine/Metrics/MetricAggregatorServiceInterface.h>
 #include <AACE/Engine/Metrics/MetricsUploadConfiguration.h>
 #include <AACE/Engine/Metrics/MetricsConfigServiceInterface.h>
 #include <AACE/Engine/Metrics/MetricsDispatcherInterface.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
+#include <AACE/Engine/PropertyManager/PropertyDescription.h>
 #include <AACE/Engine/Utils/Agent/AgentId.h>
+#include <AACE/Engine/Utils/Timing/Timer.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
 #include <AACE/Engine/Vehicle/VehicleEngineService.h>
 
 using AgentIdType = aace::engine::utils::agent::AgentIdType;
@@ -43,6 +48,7 @@ class MetricsEngineService
         : public aace::engine::core::EngineService
         , public aace::engine::metrics::MetricRecorderServiceInterface
         , public aace::engine::metrics::MetricsConfigServiceInterface
+        , public aace::engine::metrics::MetricAggregatorServiceInterface
         , public std::enable_shared_from_this<MetricsEngineService> {
 public:
     DESCRIBE(
@@ -55,6 +61,7 @@ public:
     /// aace::engine::metrics::MetricRecorderServiceInterface
     /// @{
     void recordMetric(const MetricEvent& metricEvent) override;
+    void recordMetric(MetricEvent&& metricEvent) override;
     /// @}
 
     /// aace::engine::metrics::MetricsConfigServiceInterface
@@ -65,6 +72,18 @@ public:
     DimensionsMap getCustomCommonDimensions() override;
     /// @}
 
+    /// aace::engine::metrics::MetricAggregatorServiceInterface
+    /// @{
+    std::shared_ptr<AggregatedCounter> getAggregatedCounter(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName) override;
+    std::shared_ptr<AggregatedTimer> getAggregatedTimer(
+        const std::string& programName,
+        const std::string& sourceName,
+        const std::string& dataPointName) override;
+    /// @}
+
     /// Destructor
     ~MetricsEngineService() = default;
 
@@ -74,8 +93,10 @@ protected:
     bool configure(std::shared_ptr<std::istream> configuration) override;
     bool configure() override;
     bool preRegister() override;
+    bool start() override;
     bool stop() override;
     bool shutdown() override;
+    bool isConcurrentLifecycleSafe() override;
     /// @}
 
 private:
@@ -88,6 +109,41 @@ private:
     */
     void processInboundSubmitMessage(const aace::engine::messageBroker::Message& message);
 
+    /**
+     * Route a @c MetricEvent to the processor of its agent.
+     * Calling thread must be the @c m_executor thread.
+     */
+    void recordMetricExec(const MetricEvent& metricEvent);
+
+    /**
+     * Record the metrics accumulated in @c m_aggregator since the previous
+     * flush window.
+     */
+    void flushAggregatedMetrics();
+
+    /**
+     * Record the duration of a trace span in the aggregated timer of the
+     * span. Called by @c aace::engine::utils::tracing::Tracer on the thread
+     * which completed the span.
+     */
+    void recordTraceSpan(
+        const char* category,
+        const char* name,
+        aace::engine::utils::tracing::Tracer::Clock::duration duration);
+
+    /// Write the recorded trace events to the configured trace file, if any.
+    void writeTraceFile();
+
+    /// Setter and getter of the @c aace::core::property::TRACING_ENABLED property
+    /// @{
+    bool setProperty_tracingEnabled(
+        const std::string& value,
+        bool& changed,
+        bool& async,
+        const aace::engine::propertyManager::PropertyDescription::SetterCallback& callbackFunction);
+    std::string getProperty_tracingEnabled();
+    /// @}
+
     /**
      * Use the DSN and supplied hash salt to create a stable anonymous unique
      * identifier for the device.
@@ -112,12 +168,28 @@ private:
      */
     std::unordered_map<AgentIdType, std::unique_ptr<MetricProcessor>> m_metricProcessors;
 
-    /// Executor to process recorded metrics asynchronously
+    /// Executor to process recorded metrics asynchronously at low priority. On Linux threads created from its
+    /// tasks inherit the lowered priority of the executor thread.
     aace::engine::utils::threading::Executor m_executor;
 
     /// Mutex to protect @c m_metricProcessors
     std::mutex m_processorsMutex;
 
+    /// Aggregates high-rate counters and timers between flushes
+    MetricAggregator m_aggregator;
+
+    /// The period in seconds between flushes of @c m_aggregator
+    unsigned int m_aggregationPeriodSeconds;
+
+    /// Timer to flush @c m_aggregator periodically
+    aace::engine::utils::timing::Timer m_aggregationTimer;
+
+    /// Path of the file the trace events are written to when tracing stops
+    std::string m_traceFilePath;
+
+    /// Identifies this instance in the per-thread caches of trace span timers
+    uint64_t m_traceGeneration;
+
     /// Path on device to store metrics before upload.
     std::string m_storagePath;
 
@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_LISTENER_INTERFACE_H
 #define AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_LISTENER_INTERFACE_H
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace aace {
 namespace engine {
 namespace propertyManager {
@@ -41,6 +45,24 @@ public:
      * @param [in] newValue The new value of the property
      */
     virtual void propertyChanged(const std::string& name, const std::string& newValue) = 0;
+
+    /**
+     * Notifies the listener about the value changes of properties set together in
+     * a single @c PropertyManagerServiceInterface::setProperties() batch. The
+     * listener receives one notification for the batch with the changed properties
+     * for which it is registered. The default implementation calls
+     * @c propertyChanged() for each property, so a listener which triggers
+     * expensive work on a change should override it to do the work once.
+     * @note The listener should return immediately from this method.
+     *
+     * @param [in] changes The names and new values of the changed properties,
+     *        in the order they were set
+     */
+    virtual void propertiesChanged(const std::vector<std::pair<std::string, std::string>>& changes) {
+        for (auto& change : changes) {
+            propertyChanged(change.first, change.second);
+        }
+    }
 };
 
 }  // namespace propertyManager
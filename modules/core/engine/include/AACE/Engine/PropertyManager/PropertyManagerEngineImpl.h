@@ -43,6 +43,7 @@ public:
 
     // PropertyManagerEngineInterface
     virtual bool onSetProperty(const std::string& name, const std::string& value) override;
+    virtual bool onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) override;
     virtual std::string onGetProperty(const std::string& name) override;
 
     /**
@@ -46,6 +46,9 @@ public:
     virtual bool addListener(const std::string& name, std::shared_ptr<PropertyListenerInterface> listener) override;
     virtual void removeListener(const std::string& name, std::shared_ptr<PropertyListenerInterface> listener) override;
     virtual bool setProperty(const std::string& name, const std::string& value, const bool& fromPlatform) override;
+    virtual bool setProperties(
+        const std::vector<std::pair<std::string, std::string>>& properties,
+        const bool& fromPlatform) override;
     virtual std::string getProperty(const std::string& name) override;
 
     // Callback function to notify the PropertyManagerEngineService the result
@@ -60,6 +63,7 @@ protected:
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool initialize() override;
     bool shutdown() override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     // platform interface registration
@@ -75,6 +79,18 @@ private:
     // propertyChanged() on every PropertyListenerInterface.
     void notifyPropertyChangeListeners(const std::string& key, const std::string& propertyValue);
 
+    // Notifies the listeners about the property changes of a batch by calling
+    // propertiesChanged() once on every PropertyListenerInterface registered
+    // for at least one of the changed properties.
+    void notifyPropertyChangeListeners(const std::vector<std::pair<std::string, std::string>>& changes);
+
+    // Applies a batch of properties on the executor, restoring the properties
+    // already set by the batch if one of them fails.
+    bool applyProperties(
+        const std::vector<std::pair<std::string, std::string>>& properties,
+        const std::vector<PropertyDescription>& descriptions,
+        bool fromPlatform);
+
     // Notifies the platform and listeners about a successful set property
     // operation. Expects m_propertyManagerEngineImpl to be not null.
     void handleSetSuccess(
@@ -99,6 +115,23 @@ private:
         m_propertyListenerMap;
 
     std::mutex m_listenerMutex;
+
+    // A set property operation which is queued on the executor. Successive
+    // sets of a property are coalesced into the queued operation, so only the
+    // latest value is applied.
+    struct PendingSet {
+        std::string value;
+        bool fromPlatform;
+
+        // Values set by the platform which were replaced before they were
+        // applied, reported as failed since they are never applied.
+        std::vector<std::string> supersededValues;
+    };
+
+    // Map to store property name and its queued set property operation.
+    std::unordered_map<std::string, std::shared_ptr<PendingSet>> m_pendingSets;
+    std::mutex m_pendingMutex;
+
     std::shared_ptr<PropertyManagerEngineImpl> m_propertyManagerEngineImpl;
 
     aace::engine::utils::threading::Executor m_executor;
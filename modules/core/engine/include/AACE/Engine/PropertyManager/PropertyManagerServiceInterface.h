@@ -100,6 +100,29 @@ public:
      */
     virtual bool setProperty(const std::string& name, const std::string& value, const bool& fromPlatform = false) = 0;
 
+    /**
+     * Sets a batch of property values in the Engine as a single transaction.
+     * The properties are set in order, and no other property is set while the
+     * batch is applied. If a property in the batch cannot be set, the properties
+     * already set by the batch are restored to their previous values. When the
+     * batch succeeds, each listener is notified once with
+     * @c PropertyListenerInterface::propertiesChanged() for the changed
+     * properties for which it is registered.
+     *
+     * @param [in] properties The names and values of the properties to set.
+     *        Each name must be one of the property constants recognized
+     *        by the Engine; for example, the properties in
+     *        @c aace::alexa::property::AlexaProperties.h
+     * @param [in] fromPlatform Flag to denote if the call to setProperties()
+     *        originated from the platform. If @c false, notify the platform via the
+     *        @c aace::propertyManager::PropertyManager::propertyChanged().
+     * @return @c true if the batch was accepted, else @c false if a property is
+     *         not registered or is read-only, in which case no property is set.
+     */
+    virtual bool setProperties(
+        const std::vector<std::pair<std::string, std::string>>& properties,
+        const bool& fromPlatform = false) = 0;
+
     /**
      * Retrieves the setting for the property identified by
      * @c name from the Engine. This can be called by any internal
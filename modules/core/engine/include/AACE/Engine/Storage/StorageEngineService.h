@@ -35,6 +35,7 @@ public:
 
 protected:
     bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool isConcurrentLifecycleSafe() override;
 
 private:
     std::shared_ptr<LocalStorageInterface> m_localStorage;
@@ -77,6 +77,7 @@ std::shared_ptr<rapidjson::Document> parse(
     std::shared_ptr<std::istream> stream,
     rapidjson::Type type = rapidjson::kObjectType);
 std::shared_ptr<rapidjson::Document> parse(const std::string& value, rapidjson::Type type = rapidjson::kObjectType);
+std::shared_ptr<rapidjson::Document> toDocument(const Value& root, rapidjson::Type type = rapidjson::kObjectType);
 
 std::string toString(const rapidjson::Document& document, bool prettyPrint = false);
 
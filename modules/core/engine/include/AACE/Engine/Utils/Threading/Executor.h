@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_UTILS_THREADING_EXECUTOR_H_
 #define AACE_ENGINE_UTILS_THREADING_EXECUTOR_H_
 
+#include <chrono>
 #include <future>
 #include <utility>
 
@@ -29,6 +30,10 @@ namespace threading {
 
 /**
  * An Executor is used to run callable types asynchronously.
+ *
+ * Tasks are submitted with a @c TaskPriority, which defaults to the priority of the executor. Queued tasks of a
+ * higher priority run first, and the priority of the executor also sets the scheduling priority of its thread where
+ * the platform permits it.
  */
 class Executor {
 public:
@@ -37,6 +42,17 @@ public:
      */
     Executor();
 
+    /**
+     * Constructs an Executor with a default task priority.
+     *
+     * @param defaultPriority The priority of tasks submitted without one, which also sets the scheduling priority of
+     *     the executor thread.
+     * @param starvationThreshold The time a task may wait before it runs ahead of higher priority tasks.
+     */
+    explicit Executor(
+        TaskPriority defaultPriority,
+        std::chrono::milliseconds starvationThreshold = TaskQueue::DEFAULT_STARVATION_THRESHOLD);
+
     /**
      * Destructs an Executor.
      */
@@ -53,6 +69,18 @@ public:
     template <typename Task, typename... Args>
     auto submit(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Submits a callable type to be executed on an Executor thread with a priority. The future must be checked for
+     * validity before waiting on it.
+     *
+     * @param priority The priority of the task.
+     * @param task A callable type representing a task.
+     * @param args The arguments to call the task with.
+     * @returns A @c std::future for the return value of the task.
+     */
+    template <typename Task, typename... Args>
+    auto submit(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+
     /**
      * Submits a callable type (function, lambda expression, bind expression, or another function object) to the front
      * of the internal queue to be executed on an Executor thread. The future must be checked for validity before
@@ -76,7 +104,13 @@ public:
     /// Returns whether or not the executor is shutdown.
     bool isShutdown();
 
+    /// Returns the priority of tasks submitted without one.
+    TaskPriority getDefaultPriority() const;
+
 private:
+    /// The priority of tasks submitted without one.
+    const TaskPriority m_defaultPriority;
+
     /// The queue of tasks to execute.
     std::shared_ptr<TaskQueue> m_taskQueue;
 
@@ -86,12 +120,17 @@ private:
 
 template <typename Task, typename... Args>
 auto Executor::submit(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->push(task, std::forward<Args>(args)...);
+    return m_taskQueue->push(m_defaultPriority, task, std::forward<Args>(args)...);
+}
+
+template <typename Task, typename... Args>
+auto Executor::submit(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
+    return m_taskQueue->push(priority, task, std::forward<Args>(args)...);
 }
 
 template <typename Task, typename... Args>
 auto Executor::submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->pushToFront(task, std::forward<Args>(args)...);
+    return m_taskQueue->pushToFront(m_defaultPriority, task, std::forward<Args>(args)...);
 }
 
 }  // namespace threading
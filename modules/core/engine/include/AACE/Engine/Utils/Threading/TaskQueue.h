@@ -16,7 +16,9 @@
 #ifndef AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_H_
 #define AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_H_
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <functional>
@@ -31,14 +33,40 @@ namespace utils {
 namespace threading {
 
 /**
- * A TaskQueue contains a queue of tasks to run
+ * The priority class of a task. Tasks of a higher class run before any queued task of a lower class, and tasks of
+ * the same class run in the order in which they were queued.
+ */
+enum class TaskPriority {
+    /// Background work which may be deferred, such as metrics or logging.
+    LOW,
+    /// The default class.
+    NORMAL,
+    /// Work on the path of a user interaction.
+    HIGH,
+    /// Latency-critical work, such as handling the wakeword.
+    CRITICAL
+};
+
+/**
+ * A TaskQueue contains a queue of tasks to run for each @c TaskPriority.
+ *
+ * A task of a lower class is not starved by a steady stream of higher class tasks. Once it has waited longer than the
+ * starvation threshold, it runs before the higher class tasks.
  */
 class TaskQueue {
 public:
+    /// The clock used to measure how long tasks wait in the queue.
+    using Clock = std::chrono::steady_clock;
+
+    /// The default time a task may wait before it runs ahead of higher class tasks.
+    static constexpr std::chrono::milliseconds DEFAULT_STARVATION_THRESHOLD{500};
+
     /**
      * Constructs an empty TaskQueue.
+     *
+     * @param starvationThreshold The time a task may wait before it runs ahead of higher class tasks.
      */
-    TaskQueue();
+    TaskQueue(std::chrono::milliseconds starvationThreshold = DEFAULT_STARVATION_THRESHOLD);
 
     /**
      * Pushes a task on the back of the queue. If the queue is shutdown, the task will be dropped, and an invalid
@@ -52,6 +80,19 @@ public:
     template <typename Task, typename... Args>
     auto push(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Pushes a task on the back of the queue of a priority class. If the queue is shutdown, the task will be dropped,
+     * and an invalid future will be returned.
+     *
+     * @param priority The priority class of the task.
+     * @param task A task to push to the back of the queue.
+     * @param args The arguments to call the task with.
+     * @returns A @c std::future to access the return value of the task. If the queue is shutdown, the task will be
+     *     dropped, and an invalid future will be returned.
+     */
+    template <typename Task, typename... Args>
+    auto push(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+
     /**
      * Pushes a task on the front of the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
@@ -65,8 +106,23 @@ public:
     auto pushToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
     /**
-     * Returns and removes the task at the front of the queue. If there are no tasks, this call will block until there
-     * is one. A @c nullptr will be returned if there are no more tasks expected.
+     * Pushes a task on the front of the queue of a priority class. If the queue is shutdown, the task will be
+     * dropped, and an invalid future will be returned.
+     *
+     * @param priority The priority class of the task.
+     * @param task A task to push to the front of the queue.
+     * @param args The arguments to call the task with.
+     * @returns A @c std::future to access the return value of the task. If the queue is shutdown, the task will be
+     *     dropped, and an invalid future will be returned.
+     */
+    template <typename Task, typename... Args>
+    auto pushToFront(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+
+    /**
+     * Returns and removes the task at the front of the highest priority class with queued tasks, unless a task of a
+     * lower class has waited longer than the starvation threshold, in which case the task which waited the longest
+     * is returned. If there are no tasks, this call will block until there is one. A @c nullptr will be returned if
+     * there are no more tasks expected.
      *
      * @returns A task which the caller assumes ownership of, or @c nullptr if the TaskQueue expects no more tasks.
      */
@@ -86,14 +142,24 @@ public:
      */
     bool isShutdown();
 
+    /// The number of @c TaskPriority classes.
+    static constexpr size_t NUM_PRIORITIES = static_cast<size_t>(TaskPriority::CRITICAL) + 1;
+
 private:
+    /// A task and the time at which it was queued.
+    struct QueuedTask {
+        std::unique_ptr<std::function<void()>> task;
+        Clock::time_point queued;
+    };
+
     /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::unique_ptr<std::function<void()>>>;
+    using Queue = std::deque<QueuedTask>;
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
      *
+     * @param priority The priority class of the task.
      * @param front If @c true, push to the front of the queue, else push to the back.
      * @param task A task to push to the front or back of the queue.
      * @param args The arguments to call the task with.
@@ -101,10 +167,19 @@ private:
      *     dropped, and an invalid future will be returned.
      */
     template <typename Task, typename... Args>
-    auto pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+    auto pushTo(TaskPriority priority, bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+
+    /// @return Whether any class has queued tasks. @c m_queueMutex must be held.
+    bool hasTasksLocked() const;
+
+    /// @return The index in @c m_queues of the class of the next task to run. @c m_queueMutex must be held.
+    size_t nextQueueLocked() const;
 
-    /// The queue of tasks
-    Queue m_queue;
+    /// The time a task may wait before it runs ahead of higher class tasks.
+    const std::chrono::milliseconds m_starvationThreshold;
+
+    /// The queues of tasks, indexed by @c TaskPriority.
+    std::array<Queue, NUM_PRIORITIES> m_queues;
 
     /// A condition variable to wait for new tasks to be placed on the queue.
     std::condition_variable m_queueChanged;
@@ -119,13 +194,25 @@ private:
 template <typename Task, typename... Args>
 auto TaskQueue::push(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
     bool front = true;
-    return pushTo(!front, std::forward<Task>(task), std::forward<Args>(args)...);
+    return pushTo(TaskPriority::NORMAL, !front, std::forward<Task>(task), std::forward<Args>(args)...);
+}
+
+template <typename Task, typename... Args>
+auto TaskQueue::push(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
+    bool front = true;
+    return pushTo(priority, !front, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
 template <typename Task, typename... Args>
 auto TaskQueue::pushToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
     bool front = true;
-    return pushTo(front, std::forward<Task>(task), std::forward<Args>(args)...);
+    return pushTo(TaskPriority::NORMAL, front, std::forward<Task>(task), std::forward<Args>(args)...);
+}
+
+template <typename Task, typename... Args>
+auto TaskQueue::pushToFront(TaskPriority priority, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
+    bool front = true;
+    return pushTo(priority, front, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
 /**
@@ -160,7 +247,8 @@ inline void forwardPromise<void>(std::shared_ptr<std::promise<void>> promise, st
 }
 
 template <typename Task, typename... Args>
-auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
+auto TaskQueue::pushTo(TaskPriority priority, bool front, Task task, Args&&... args)
+    -> std::future<decltype(task(args...))> {
     // Remove arguments from the tasks type by binding the arguments to the task.
     auto boundTask = std::bind(std::forward<Task>(task), std::forward<Args>(args)...);
 
@@ -203,7 +291,11 @@ auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<dec
     {
         std::lock_guard<std::mutex> queueLock{m_queueMutex};
         if (!m_shutdown) {
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), new std::function<void()>(translated_task));
+            auto& queue = m_queues[static_cast<size_t>(priority)];
+            queue.emplace(
+                front ? queue.begin() : queue.end(),
+                QueuedTask{std::unique_ptr<std::function<void()>>(new std::function<void()>(translated_task)),
+                           Clock::now()});
         } else {
             using FutureType = decltype(task(args...));
             return std::future<FutureType>();
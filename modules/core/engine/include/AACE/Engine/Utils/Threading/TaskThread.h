@@ -36,8 +36,9 @@ public:
      * Constructs a TaskThread to read from the given TaskQueue. This does not start the thread.
      *
      * @params taskQueue A TaskQueue to take tasks from to execute.
+     * @params priority The priority class which sets the scheduling priority of the thread.
      */
-    TaskThread(std::shared_ptr<TaskQueue> taskQueue);
+    TaskThread(std::shared_ptr<TaskQueue> taskQueue, TaskPriority priority = TaskPriority::NORMAL);
 
     /**
      * Destructs the TaskThread.
@@ -62,9 +63,21 @@ private:
      */
     void processTasksLoop();
 
+    /**
+     * Sets the scheduling priority of the calling thread from @c m_priority, relative to the priority of the
+     * process, where the platform permits it. On Linux any thread started from a task inherits the priority of
+     * the executor thread, so a thread created by a task on a @c LOW executor runs at the lowered priority
+     * unless it resets its own. Executor threads reset it themselves, but restoring a higher priority needs
+     * CAP_SYS_NICE or a sufficient RLIMIT_NICE.
+     */
+    void applyThreadPriority();
+
     /// A weak pointer to the TaskQueue, if the task queue is no longer accessible, there is no reason to execute tasks.
     std::weak_ptr<TaskQueue> m_taskQueue;
 
+    /// The priority class which sets the scheduling priority of the thread.
+    const TaskPriority m_priority;
+
     /// A flag to message the task thread to stop executing.
     std::atomic_bool m_shutdown;
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_TIMING_SCHEDULED_TIMER_DELEGATE_H
+#define AACE_ENGINE_UTILS_TIMING_SCHEDULED_TIMER_DELEGATE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <AACE/Engine/Utils/Timing/TimerDelegateInterface.h>
+#include <AACE/Engine/Utils/Timing/TimerScheduler.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateInterface which runs its task on a shared @c TimerScheduler instead of a thread of its own.
+ */
+class ScheduledTimerDelegate : public aace::engine::utils::timing::TimerDelegateInterface {
+public:
+    /// @name TimerDelegateInterface Functions
+    /// @{
+    void start(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task) override;
+    void stop() override;
+    bool activate() override;
+    bool isActive() const override;
+    /// @}
+
+    /**
+     * Constructor.
+     *
+     * @param scheduler The scheduler to run the task on.
+     * @param slack The time by which a task call may be delayed to run it together with other timers.
+     */
+    ScheduledTimerDelegate(std::shared_ptr<TimerScheduler> scheduler, std::chrono::nanoseconds slack);
+
+    /// Destructor.
+    ~ScheduledTimerDelegate() override;
+
+private:
+    /// The scheduler to run the task on.
+    std::shared_ptr<TimerScheduler> m_scheduler;
+
+    /// The time by which a task call may be delayed.
+    const std::chrono::nanoseconds m_slack;
+
+    /// The scheduled task. Access is synchronized with @c m_callMutex.
+    std::shared_ptr<TimerScheduler::Entry> m_entry;
+
+    /// The mutex for synchronizing calls into ScheduledTimerDelegate.
+    mutable std::mutex m_callMutex;
+
+    /// Flag which indicates that a @c Timer is active.
+    std::atomic<bool> m_running;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_TIMING_SCHEDULED_TIMER_DELEGATE_H
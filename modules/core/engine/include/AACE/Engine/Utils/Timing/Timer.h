@@ -25,7 +25,8 @@
 
 #include "AACE/Engine/Core/EngineMacros.h"
 
-#include "AACE/Engine/Utils/Timing/TimerDelegate.h"
+#include "AACE/Engine/Utils/Timing/TimerDelegateInterface.h"
+#include "AACE/Engine/Utils/Timing/TimerScheduler.h"
 
 namespace aace {
 namespace engine {
@@ -33,7 +34,8 @@ namespace utils {
 namespace timing {
 
 /**
- * A @c Timer is used to schedule a callable type to run in the future.
+ * A @c Timer is used to schedule a callable type to run in the future. The task is called on the thread of a
+ * @c TimerScheduler shared by every @c Timer, so it should not block.
  */
 class Timer {
 public:
@@ -67,6 +69,16 @@ public:
      */
     Timer();
 
+    /**
+     * Constructs a @c Timer whose task calls may be delayed by up to @c slack, so the scheduler can run them
+     * together with the calls of other timers. This is intended for low priority timers, such as the ones
+     * flushing metrics.
+     *
+     * @param slack The time by which a task call may be delayed.
+     * @param scheduler The scheduler to run the task on, or @c nullptr to use the engine-wide scheduler.
+     */
+    explicit Timer(std::chrono::nanoseconds slack, std::shared_ptr<TimerScheduler> scheduler = nullptr);
+
     /**
      * Destructs a @c Timer.
      */
@@ -0,0 +1,174 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_TIMING_TIMER_SCHEDULER_H
+#define AACE_ENGINE_UTILS_TIMING_TIMER_SCHEDULER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/Utils/Timing/TimerDelegateInterface.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+/**
+ * Runs the tasks of every @c Timer from a single thread. Scheduled tasks are kept in a min-heap ordered by the
+ * time at which they must run, and the thread sleeps until the earliest of those times.
+ *
+ * A task may be scheduled with a slack, which allows its call to be delayed by up to the slack so it runs together
+ * with other tasks. Whenever the thread wakes up, it runs every task whose time has come, which reduces the number
+ * of wakeups of an otherwise idle system.
+ *
+ * Tasks run on the scheduler thread, one at a time, so a task must not block waiting for another timer.
+ *
+ * A scheduler created with @c createWithVirtualClock() has no thread. Its time only moves forward when @c advance()
+ * is called, which runs the due tasks on the calling thread. This is used to test timers deterministically.
+ */
+class TimerScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using PeriodType = TimerDelegateInterface::PeriodType;
+
+    /// A task scheduled with the @c TimerScheduler
+    struct Entry;
+
+    /**
+     * Gets the engine-wide scheduler. Its thread is started by the first call, and the scheduler is never destroyed
+     * so timers can be stopped during static destruction.
+     *
+     * @return The engine-wide scheduler
+     */
+    static std::shared_ptr<TimerScheduler> getInstance();
+
+    /**
+     * Creates a scheduler with a virtual clock, which starts at the epoch of @c Clock.
+     *
+     * @return The scheduler
+     */
+    static std::shared_ptr<TimerScheduler> createWithVirtualClock();
+
+    /// Destructor.
+    ~TimerScheduler();
+
+    /**
+     * Schedules a task. The arguments have the semantics of @c TimerDelegateInterface::start().
+     *
+     * @param delay The non-negative time to wait before making the first @c task call.
+     * @param period The non-negative time to wait between subsequent @c task calls.
+     * @param periodType The type of period to use when making subsequent task calls.
+     * @param maxCount The desired number of times to call task, or @c TimerDelegateInterface::FOREVER.
+     * @param slack The time by which a task call may be delayed to run it together with other tasks.
+     * @param task The task.
+     * @param onFinished Called by the scheduler after the last task call, unless the task was cancelled.
+     * @return The scheduled entry, which is used to cancel the task.
+     */
+    std::shared_ptr<Entry> schedule(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::chrono::nanoseconds slack,
+        std::function<void()> task,
+        std::function<void()> onFinished);
+
+    /**
+     * Cancels a scheduled task. If the task is running on another thread, this blocks until the task call
+     * completes. When it is called from the task itself, it prevents further calls without blocking.
+     *
+     * @param entry The entry returned by @c schedule().
+     */
+    void cancel(const std::shared_ptr<Entry>& entry);
+
+    /// @return The current time of the scheduler clock
+    Clock::time_point now();
+
+    /**
+     * Moves the virtual clock forward, running the tasks which become due on the calling thread.
+     *
+     * @param duration The duration to move the clock by
+     * @return @c true if the clock moved, or @c false if the scheduler does not have a virtual clock.
+     */
+    bool advance(std::chrono::nanoseconds duration);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param virtualClock Whether the scheduler has a virtual clock instead of a thread.
+     */
+    TimerScheduler(bool virtualClock);
+
+    /// The loop of the scheduler thread.
+    void run();
+
+    /**
+     * Runs every scheduled task which is due at @c time, and schedules their next calls.
+     *
+     * @param lock The lock of @c m_mutex, which is released while a task runs.
+     * @param time The current time.
+     */
+    void runDueLocked(std::unique_lock<std::mutex>& lock, Clock::time_point time);
+
+    /// @return The current time. @c m_mutex must be held when the scheduler has a virtual clock.
+    Clock::time_point nowLocked();
+
+    /// Adds an entry to @c m_queue. @c m_mutex must be held.
+    void pushLocked(const std::shared_ptr<Entry>& entry);
+
+    /// Whether the scheduler has a virtual clock.
+    const bool m_virtualClock;
+
+    /// The current time of the virtual clock.
+    Clock::time_point m_virtualNow;
+
+    /// The min-heap of scheduled entries, ordered by the latest time at which they may run.
+    std::vector<std::shared_ptr<Entry>> m_queue;
+
+    /// The entry whose task is running, if any.
+    std::shared_ptr<Entry> m_runningEntry;
+
+    /// The thread running @c m_runningEntry.
+    std::thread::id m_runningThread;
+
+    /// Whether the scheduler is shutting down.
+    bool m_shutdown;
+
+    /// Serializes access to the scheduler state.
+    std::mutex m_mutex;
+
+    /// Wakes the scheduler thread when an earlier entry is scheduled or the scheduler shuts down.
+    std::condition_variable m_wakeTrigger;
+
+    /// Notified when a task call completes.
+    std::condition_variable m_taskCompleted;
+
+    /// The scheduler thread, unless the scheduler has a virtual clock.
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_TIMING_TIMER_SCHEDULER_H
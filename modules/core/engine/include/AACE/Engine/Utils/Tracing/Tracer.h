@@ -0,0 +1,184 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_TRACING_TRACER_H
+#define AACE_ENGINE_UTILS_TRACING_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace tracing {
+
+/**
+ * The engine-wide tracer. Trace events are recorded into a fixed size ring buffer owned by the recording thread, so
+ * recording an event does not allocate and only contends with an export of the trace. When the ring buffer of a
+ * thread is full, its oldest events are overwritten.
+ *
+ * Tracing is disabled by default. While it is disabled, a span costs a single relaxed atomic load. The category and
+ * name of an event are not copied, so they must be string literals or otherwise outlive the tracer.
+ *
+ * The recorded events are exported in the Chrome trace event JSON format, which is read by @c chrome://tracing and
+ * the Perfetto UI. Span durations are also passed to the span observer, which the metrics service uses to maintain
+ * latency histograms.
+ */
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Observes the duration of every completed span
+    using SpanObserver = std::function<void(const char* category, const char* name, Clock::duration duration)>;
+
+    /// The default capacity of the ring buffer of a thread, in events
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 4096;
+
+    /// @return @c true if tracing is enabled
+    static bool isEnabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Enables or disables tracing. The events recorded while tracing was enabled are kept until they are cleared.
+     *
+     * @param enabled Whether tracing is enabled
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * Sets the capacity of the ring buffers of the threads which record their first event after this call.
+     *
+     * @param size The capacity of a thread ring buffer, in events
+     */
+    static void setBufferSize(size_t size);
+
+    /**
+     * Sets the span observer, replacing the current observer.
+     *
+     * @param observer The span observer, or @c nullptr to remove the current observer
+     */
+    static void setSpanObserver(SpanObserver observer);
+
+    /**
+     * Records a completed span, and passes its duration to the span observer.
+     *
+     * @param category The category of the span
+     * @param name The name of the span
+     * @param start The start time of the span
+     * @param end The end time of the span
+     */
+    static void complete(const char* category, const char* name, Clock::time_point start, Clock::time_point end);
+
+    /**
+     * Records an instant event, which marks a point in time such as the detection of a wakeword.
+     *
+     * @param category The category of the event
+     * @param name The name of the event
+     */
+    static void instant(const char* category, const char* name);
+
+    /**
+     * Passes a duration to the span observer without recording a trace event. This is used for latencies which do
+     * not map to a span of the current thread, such as the time a task waited in a queue.
+     *
+     * @param category The category of the latency
+     * @param name The name of the latency
+     * @param duration The duration
+     */
+    static void observe(const char* category, const char* name, Clock::duration duration);
+
+    /**
+     * Writes the recorded events in the Chrome trace event JSON format.
+     *
+     * @param stream The stream to write to
+     * @return The number of events written
+     */
+    static size_t writeChromeTrace(std::ostream& stream);
+
+    /**
+     * Writes the recorded events in the Chrome trace event JSON format to a file.
+     *
+     * @param path The path of the file
+     * @return @c true if the file was written
+     */
+    static bool writeChromeTrace(const std::string& path);
+
+    /// Removes the recorded events of every thread
+    static void clear();
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+/**
+ * A span, recorded as a completed event when it ends or is destroyed. A span is only recorded if tracing was
+ * enabled when it started.
+ */
+class Span {
+public:
+    Span(const char* category, const char* name) : m_category(category), m_name(name), m_active(Tracer::isEnabled()) {
+        if (m_active) {
+            m_start = Tracer::Clock::now();
+        }
+    }
+
+    ~Span() {
+        end();
+    }
+
+    /// Ends the span before it is destroyed
+    void end() {
+        if (m_active) {
+            m_active = false;
+            Tracer::complete(m_category, m_name, m_start, Tracer::Clock::now());
+        }
+    }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+private:
+    const char* m_category;
+    const char* m_name;
+    bool m_active;
+    Tracer::Clock::time_point m_start;
+};
+
+}  // namespace tracing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#define AACE_TRACE_CONCAT_INNER(a, b) a##b
+#define AACE_TRACE_CONCAT(a, b) AACE_TRACE_CONCAT_INNER(a, b)
+
+/// Traces the enclosing scope as a span
+#define AACE_TRACE_SPAN(category, name) \
+    aace::engine::utils::tracing::Span AACE_TRACE_CONCAT(aaceTraceSpan, __LINE__)(category, name)
+
+/// Records an instant trace event
+#define AACE_TRACE_INSTANT(category, name)                                 \
+    do {                                                                   \
+        if (aace::engine::utils::tracing::Tracer::isEnabled()) {           \
+            aace::engine::utils::tracing::Tracer::instant(category, name); \
+        }                                                                  \
+    } while (false)
+
+#endif  // AACE_ENGINE_UTILS_TRACING_TRACER_H
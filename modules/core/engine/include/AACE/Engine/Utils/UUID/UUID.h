@@ -16,6 +16,8 @@
 #ifndef AACE_ENGINE_UTILS_UUID_H_
 #define AACE_ENGINE_UTILS_UUID_H_
 
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace aace {
@@ -23,6 +25,44 @@ namespace engine {
 namespace utils {
 namespace uuid {
 
+/**
+ * A variant 1, version 4 UUID in its 128-bit binary form. It can be used as a hash key in place of its 36 character
+ * string form.
+ */
+struct UUID {
+    /// The most significant 64 bits, which are the first 16 hex digits of the string form.
+    uint64_t high = 0;
+    /// The least significant 64 bits, which are the last 16 hex digits of the string form.
+    uint64_t low = 0;
+
+    /// Generates a random UUID, with the generator of the calling thread.
+    static UUID generate();
+
+    /**
+     * Parses the string form of a UUID, in upper or lower case.
+     *
+     * @param text The string form of the UUID.
+     * @param [out] uuid The parsed UUID.
+     * @return @c true if @c text is a UUID, @c false otherwise.
+     */
+    static bool fromString(const std::string& text, UUID& uuid);
+
+    /// Returns the lower case string form of the UUID.
+    std::string toString() const;
+
+    bool operator==(const UUID& other) const {
+        return high == other.high && low == other.low;
+    }
+
+    bool operator!=(const UUID& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const UUID& other) const {
+        return high < other.high || (high == other.high && low < other.low);
+    }
+};
+
 /**
  * Generates a variant 1, version 4 universally unique identifier (UUID) consisting of 32 hexadecimal digits.
  * The UUID generated is of the format xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx where M indicates the version, and the two
@@ -30,6 +70,8 @@ namespace uuid {
  * variant 1.
  * @see https://tools.ietf.org/html/rfc4122.
  *
+ * Each thread draws from its own generator, so concurrent calls do not contend on a lock.
+ *
  * @return A uuid as a string.
  */
 const std::string generateUUID();
@@ -41,4 +83,16 @@ bool compare(const std::string& uuid1, const std::string& uuid2);
 }  // namespace engine
 }  // namespace aace
 
+namespace std {
+
+template <>
+struct hash<aace::engine::utils::uuid::UUID> {
+    size_t operator()(const aace::engine::utils::uuid::UUID& uuid) const {
+        // the bits are random, so folding the halves distributes as well as the generator does
+        return static_cast<size_t>(uuid.high ^ (uuid.low * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+}  // namespace std
+
 #endif  // AACE_ENGINE_UTILS_UUID_H_
@@ -63,6 +63,7 @@ protected:
     bool initialize() override;
     bool configure(std::shared_ptr<std::istream> configuration) override;
     bool configure() override;
+    bool isConcurrentLifecycleSafe() override;
     /// @}
 
 private:
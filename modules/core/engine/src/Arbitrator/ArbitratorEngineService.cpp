@@ -47,6 +47,11 @@ bool ArbitratorEngineService::configure(std::shared_ptr<std::istream> configurat
     }
 }
 
+bool ArbitratorEngineService::isConcurrentLifecycleSafe() {
+    // the arbitrator is created with its platform interface, so there is nothing to set up, start or stop
+    return true;
+}
+
 bool ArbitratorEngineService::shutdown() {
     if (m_arbitratorEngineImpl != nullptr) {
         m_arbitratorEngineImpl->doShutDown();
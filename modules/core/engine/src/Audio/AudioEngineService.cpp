@@ -45,6 +45,11 @@ bool AudioEngineService::initialize() {
     }
 }
 
+bool AudioEngineService::isConcurrentLifecycleSafe() {
+    // audio channels are created on demand, so there is nothing to set up, start or stop
+    return true;
+}
+
 bool AudioEngineService::registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
     try {
         ReturnIf(registerPlatformInterfaceType<aace::audio::AudioInputProvider>(platformInterface), true);
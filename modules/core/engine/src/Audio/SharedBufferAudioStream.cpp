@@ -0,0 +1,101 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <AACE/Engine/Audio/SharedBufferAudioStream.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace audio {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.audio.SharedBufferAudioStream");
+
+/// The size of the chunks a stream is loaded in.
+static const size_t LOAD_CHUNK_SIZE = 4096;
+
+SharedBufferAudioStream::SharedBufferAudioStream(
+    std::shared_ptr<const Buffer> buffer,
+    const aace::audio::AudioFormat& audioFormat,
+    const std::vector<aace::audio::AudioStreamProperty>& properties) :
+        m_buffer(buffer), m_audioFormat(audioFormat), m_properties(properties), m_offset(0) {
+}
+
+std::shared_ptr<const SharedBufferAudioStream::Buffer> SharedBufferAudioStream::load(
+    std::shared_ptr<std::istream> stream) {
+    try {
+        ThrowIfNull(stream, "invalidStream");
+        ThrowIfNot(stream->good(), "streamNotReadable");
+
+        auto buffer = std::make_shared<Buffer>();
+        while (!stream->eof()) {
+            auto offset = buffer->size();
+            buffer->resize(offset + LOAD_CHUNK_SIZE);
+            stream->read(buffer->data() + offset, LOAD_CHUNK_SIZE);
+            ThrowIf(stream->bad(), "readFailed");
+            buffer->resize(offset + static_cast<size_t>(stream->gcount()));
+
+            // the ResourceStream used for the alert and timer sounds needs this to read correctly
+            stream->tellg();
+        }
+        buffer->shrink_to_fit();
+
+        return buffer;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<SharedBufferAudioStream> SharedBufferAudioStream::create(
+    std::shared_ptr<const Buffer> buffer,
+    const aace::audio::AudioFormat& audioFormat,
+    const std::vector<aace::audio::AudioStreamProperty>& properties) {
+    try {
+        ThrowIfNull(buffer, "invalidBuffer");
+        return std::shared_ptr<SharedBufferAudioStream>(new SharedBufferAudioStream(buffer, audioFormat, properties));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+ssize_t SharedBufferAudioStream::read(char* data, const size_t size) {
+    auto count = std::min(size, m_buffer->size() - m_offset);
+    if (count > 0) {
+        std::memcpy(data, m_buffer->data() + m_offset, count);
+        m_offset += count;
+    }
+    return static_cast<ssize_t>(count);
+}
+
+bool SharedBufferAudioStream::isClosed() {
+    return m_offset == m_buffer->size();
+}
+
+aace::audio::AudioFormat SharedBufferAudioStream::getAudioFormat() {
+    return m_audioFormat;
+}
+
+std::vector<aace::audio::AudioStreamProperty> SharedBufferAudioStream::getProperties() {
+    return m_properties;
+}
+
+}  // namespace audio
+}  // namespace engine
+}  // namespace aace
@@ -41,6 +41,11 @@ bool AuthorizationEngineService::shutdown() {
     return true;
 }
 
+bool AuthorizationEngineService::isConcurrentLifecycleSafe() {
+    // providers are registered by other services, so there is nothing to set up, start or stop
+    return true;
+}
+
 bool AuthorizationEngineService::registerPlatformInterface(
     std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
     try {
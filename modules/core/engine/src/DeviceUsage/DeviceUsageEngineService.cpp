@@ -40,6 +40,11 @@ bool DeviceUsageEngineService::initialize() {
     }
 }
 
+bool DeviceUsageEngineService::isConcurrentLifecycleSafe() {
+    // the device usage handler is only registered, so there is nothing to set up, start or stop
+    return true;
+}
+
 bool DeviceUsageEngineService::shutdown() {
     AACE_INFO(LX(TAG));
     if (m_deviceUsageEngineImpl != nullptr) {
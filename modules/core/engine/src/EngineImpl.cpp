@@ -13,13 +13,23 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <forward_list>
 #ifndef NO_SIGPIPE
 #include <csignal>
 #endif
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <AACE/Engine/Metrics/CounterDataPointBuilder.h>
 #include <AACE/Engine/Metrics/StringDataPointBuilder.h>
 #include <AACE/Engine/Metrics/MetricEventBuilder.h>
@@ -78,6 +88,9 @@ static const std::string METRIC_LIFECYCLE_STAGE_STOP = "Stop";
 /// Shutdown stage metric dimension
 static const std::string METRIC_LIFECYCLE_STAGE_SHUTDOWN = "Shutdown";
 
+/// Maximum number of worker threads used to run a service lifecycle phase
+static const unsigned int MAX_SERVICE_PHASE_WORKER_COUNT = 4;
+
 /**
  * Records a metric with the specified data.
  * Uses the default context for Engine.
@@ -284,19 +297,25 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
             // parse the next configuration stream
             auto nextConfig = json::toJson(nextStream->getStream());
 
-            // merge the document with the main configuration
+            // merge the document with the main configuration, taking the first document as is
             ThrowIfNot(json::isType(nextConfig, json::Type::object), "invalidConfigurationStream");
-            ThrowIfNot(aace::engine::utils::json::merge(mergedConfiguration, nextConfig), "mergeConfigurationFailed");
+            if (mergedConfiguration.is_null()) {
+                mergedConfiguration = std::move(nextConfig);
+            } else {
+                ThrowIfNot(
+                    aace::engine::utils::json::merge(mergedConfiguration, nextConfig), "mergeConfigurationFailed");
+            }
         }
 
         // iterate through registered engine services and call configure() for each module
         if (mergedConfiguration.is_null() == false) {
+            // each service is handed a view of its node in the merged configuration rather than a copy
+            const json::Value emptyServiceConfig;
             for (auto nextService : m_orderedServiceList) {
-                auto serviceConfig =
-                    json::get(mergedConfiguration, nextService->getDescription().getType(), json::Type::object);
+                auto it = mergedConfiguration.find(nextService->getDescription().getType());
+                bool hasServiceConfig = it != mergedConfiguration.end() && it->is_object();
                 ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(
-                        serviceConfig != nullptr ? json::toStream(serviceConfig) : nullptr),
+                    nextService->handleConfigureEngineEvent(hasServiceConfig ? *it : emptyServiceConfig),
                     "Service failed to configure: " + nextService->getDescription().getType());
             }
         } else {
@@ -454,19 +473,21 @@ bool EngineImpl::start() {
                 ThrowIfNot(next->handlePostRegisterEngineEvent(), "handlePostRegisterEngineEvent");
             }
 
-            // iterate through registered engine modules and call handleSetupEngineEvent() for each module
-            for (auto next : m_orderedServiceList) {
-                ThrowIfNot(next->handleSetupEngineEvent(), "handleSetupEngineEventFailed");
-            }
+            // call handleSetupEngineEvent() for each module once its dependencies have been setup
+            ThrowIfNot(
+                runServicePhase(
+                    "setup", [](std::shared_ptr<EngineService> service) { return service->handleSetupEngineEvent(); }),
+                "handleSetupEngineEventFailed");
 
             // set the engine setup flag to true
             m_setup = true;
         }
 
-        // iterate through registered engine modules and call handleStartEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStartEngineEvent(), "handleStartEngineEventFailed");
-        }
+        // call handleStartEngineEvent() for each module once its dependencies have been started
+        ThrowIfNot(
+            runServicePhase(
+                "start", [](std::shared_ptr<EngineService> service) { return service->handleStartEngineEvent(); }),
+            "handleStartEngineEventFailed");
 
         // iterate through registered engine services and call handleEngineStartedEngineEvent() for each service
         for (auto next : m_orderedServiceList) {
@@ -501,10 +522,11 @@ bool EngineImpl::stop() {
         }
         m_stopDuration.withName(METRIC_LIFECYCLE_LATENCY_KEY).startTimer();
 
-        // iterate through registered engine modules and call stop() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStopEngineEvent(), "handleStopEngineEventFailed");
-        }
+        // call handleStopEngineEvent() for each module once its dependencies have been stopped
+        ThrowIfNot(
+            runServicePhase(
+                "stop", [](std::shared_ptr<EngineService> service) { return service->handleStopEngineEvent(); }),
+            "handleStopEngineEventFailed");
 
         // iterate through registered engine services and call engineStopped() for each service
         for (auto next : m_orderedServiceList) {
@@ -529,6 +551,200 @@ bool EngineImpl::stop() {
     }
 }
 
+/**
+ * Calls @c handler for @c service and logs how long it took.
+ */
+static bool runServiceHandler(
+    const std::string& phase,
+    std::shared_ptr<EngineService> service,
+    const std::function<bool(std::shared_ptr<EngineService>)>& handler) {
+    auto serviceStart = std::chrono::steady_clock::now();
+    bool success = false;
+    try {
+        success = handler(service);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("service", service->getDescription().getType()));
+    }
+    auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - serviceStart);
+    AACE_DEBUG(LX(TAG)
+                   .m(phase)
+                   .d("service", service->getDescription().getType())
+                   .d("success", success)
+                   .d("durationMs", duration.count()));
+    if (!success) {
+        AACE_ERROR(
+            LX(TAG).m(phase).d("reason", "handleServiceEventFailed").d("service", service->getDescription().getType()));
+    }
+    return success;
+}
+
+/**
+ * Calls @c handler for a batch of services that have opted in to concurrent lifecycle handling. The batch is a
+ * step of the phase schedule, so any dependency outside of the batch has already been handled. Within
+ * the batch a service is handled once its dependencies have been handled, on a bounded pool of worker threads.
+ */
+static bool runConcurrentServiceBatch(
+    const std::string& phase,
+    const std::vector<std::shared_ptr<EngineService>>& batch,
+    const std::function<bool(std::shared_ptr<EngineService>)>& handler) {
+    auto batchSize = batch.size();
+
+    // for each service count the dependencies in the batch that must be handled first, and record which
+    // services are waiting on it
+    std::unordered_map<std::string, size_t> serviceIndexMap;
+    for (size_t j = 0; j < batchSize; j++) {
+        serviceIndexMap[batch[j]->getDescription().getType()] = j;
+    }
+    std::vector<size_t> pendingDependencyCount(batchSize, 0);
+    std::vector<std::vector<size_t>> dependentList(batchSize);
+    for (size_t j = 0; j < batchSize; j++) {
+        for (auto& next : batch[j]->getDescription().getDependencies()) {
+            auto it = serviceIndexMap.find(next.getType());
+            if (it != serviceIndexMap.end()) {
+                pendingDependencyCount[j]++;
+                dependentList[it->second].push_back(j);
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable trigger;
+    std::deque<size_t> readyQueue;
+    size_t completedCount = 0;
+    bool failed = false;
+
+    for (size_t j = 0; j < batchSize; j++) {
+        if (pendingDependencyCount[j] == 0) {
+            readyQueue.push_back(j);
+        }
+    }
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            trigger.wait(lock, [&]() { return failed || completedCount == batchSize || !readyQueue.empty(); });
+            if (failed || completedCount == batchSize) {
+                return;
+            }
+
+            auto index = readyQueue.front();
+            readyQueue.pop_front();
+            lock.unlock();
+
+            bool success = runServiceHandler(phase, batch[index], handler);
+
+            lock.lock();
+            completedCount++;
+            if (success) {
+                for (auto dependent : dependentList[index]) {
+                    if (--pendingDependencyCount[dependent] == 0) {
+                        readyQueue.push_back(dependent);
+                    }
+                }
+            } else {
+                failed = true;
+            }
+            trigger.notify_all();
+        }
+    };
+
+    // run the batch on the calling thread and as many additional workers as the batch and hardware allow
+    unsigned int workerCount =
+        std::max(1u, std::min(std::thread::hardware_concurrency(), MAX_SERVICE_PHASE_WORKER_COUNT));
+    workerCount = static_cast<unsigned int>(std::min<size_t>(workerCount, batchSize));
+    std::vector<std::thread> workerThreads;
+    for (unsigned int j = 1; j < workerCount; j++) {
+        workerThreads.emplace_back(worker);
+    }
+    worker();
+    for (auto& next : workerThreads) {
+        next.join();
+    }
+
+    return !failed && completedCount == batchSize;
+}
+
+std::vector<std::vector<std::shared_ptr<EngineService>>> EngineImpl::buildServicePhaseSchedule() {
+    std::vector<std::vector<std::shared_ptr<EngineService>>> schedule;
+
+    // opted in services declare everything they use, so the ones that only depend on other opted in services
+    // can be handled ahead of the services that have not opted in, all in the first step
+    std::vector<std::shared_ptr<EngineService>> leadingStep;
+    std::unordered_set<std::string> leadingServices;
+    std::vector<std::shared_ptr<EngineService>> remainingServices;
+    for (auto& next : m_orderedServiceList) {
+        bool leading = next->isConcurrentLifecycleSafe();
+        for (auto& dependency : next->getDescription().getDependencies()) {
+            leading = leading && leadingServices.count(dependency.getType()) > 0;
+        }
+        if (leading) {
+            leadingStep.push_back(next);
+            leadingServices.insert(next->getDescription().getType());
+        } else {
+            remainingServices.push_back(next);
+        }
+    }
+    if (!leadingStep.empty()) {
+        schedule.push_back(leadingStep);
+    }
+
+    // the remaining services are handled in dependency order, a service that has not opted in acting as a barrier
+    std::vector<std::shared_ptr<EngineService>> step;
+    for (auto& next : remainingServices) {
+        if (next->isConcurrentLifecycleSafe()) {
+            step.push_back(next);
+            continue;
+        }
+        if (!step.empty()) {
+            schedule.push_back(step);
+            step.clear();
+        }
+        schedule.push_back({next});
+    }
+    if (!step.empty()) {
+        schedule.push_back(step);
+    }
+
+    return schedule;
+}
+
+std::vector<std::vector<std::string>> EngineImpl::getServicePhaseSchedule() {
+    std::vector<std::vector<std::string>> schedule;
+    for (auto& step : buildServicePhaseSchedule()) {
+        std::vector<std::string> types;
+        for (auto& next : step) {
+            types.push_back(next->getDescription().getType());
+        }
+        schedule.push_back(types);
+    }
+    return schedule;
+}
+
+bool EngineImpl::runServicePhase(
+    const std::string& phase,
+    std::function<bool(std::shared_ptr<EngineService>)> handler) {
+    auto phaseStart = std::chrono::steady_clock::now();
+    auto schedule = buildServicePhaseSchedule();
+    bool success = true;
+
+    for (auto it = schedule.begin(); success && it != schedule.end(); it++) {
+        success = it->size() > 1 ? runConcurrentServiceBatch(phase, *it, handler)
+                                 : runServiceHandler(phase, it->front(), handler);
+    }
+
+    auto phaseDuration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - phaseStart);
+    AACE_INFO(LX(TAG)
+                  .m(phase)
+                  .d("services", m_orderedServiceList.size())
+                  .d("steps", schedule.size())
+                  .d("success", success)
+                  .d("durationMs", phaseDuration.count()));
+
+    return success;
+}
+
 std::shared_ptr<EngineServiceContext> EngineImpl::getService(const std::string& type) {
     auto it = m_registeredServiceMap.find(type);
     return it != m_registeredServiceMap.end() ? std::make_shared<EngineServiceContext>(it->second) : nullptr;
@@ -640,6 +856,38 @@ std::shared_ptr<aace::core::MessageStream> EngineImpl::openStream(
     }
 }
 
+bool EngineImpl::openSharedMemoryStream(
+    const std::string& streamId,
+    aace::core::MessageStream::Mode mode,
+    SharedMemoryStream& stream) {
+    std::vector<int> descriptors;
+    try {
+        auto messageBrokerService = m_messageBrokerService.lock();
+        ThrowIfNull(messageBrokerService, "invalidMessageBrokerService");
+        auto transport = messageBrokerService->getSharedMemoryStreamTransport();
+        ThrowIfNull(transport, "invalidSharedMemoryStreamTransport");
+        auto ring = transport->openStream(streamId, mode);
+        ThrowIfNull(ring, "openSharedMemoryStreamFailed");
+
+        // the ring keeps its own descriptors for as long as the stream is pumped, so the caller gets duplicates
+        for (auto fd : {ring->getMemoryFd(), ring->getDataEventFd(), ring->getSpaceEventFd()}) {
+            auto duplicate = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+            ThrowIf(duplicate < 0, "duplicateFileDescriptorFailed");
+            descriptors.push_back(duplicate);
+        }
+        stream.memoryFd = descriptors[0];
+        stream.dataEventFd = descriptors[1];
+        stream.spaceEventFd = descriptors[2];
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("streamId", streamId));
+        for (auto fd : descriptors) {
+            close(fd);
+        }
+        return false;
+    }
+}
+
 }  // namespace core
 }  // namespace engine
 }  // namespace aace
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/Core/EngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
 namespace engine {
@@ -62,10 +63,10 @@ bool EngineService::handleInitializeEngineEvent(std::shared_ptr<aace::engine::co
     }
 }
 
-bool EngineService::handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration) {
+bool EngineService::handleConfigureEngineEvent(const nlohmann::json& configuration) {
     try {
         ThrowIfNot(m_initialized, "serviceNotInitialized");
-        ThrowIfNot(configuration != nullptr ? configure(configuration) : configure(), "configureServiceFailed");
+        ThrowIfNot(configuration.is_null() ? configure() : configure(configuration), "configureServiceFailed");
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "handleConfigureEngineEvent").d("reason", ex.what()));
@@ -220,6 +221,11 @@ bool EngineService::configure(std::shared_ptr<std::istream> configuration) {
     return true;
 }
 
+bool EngineService::configure(const nlohmann::json& configuration) {
+    std::shared_ptr<std::istream> stream = aace::engine::utils::json::toStream(configuration, false);
+    return configure(stream);
+}
+
 bool EngineService::preRegister() {
     return true;
 }
@@ -256,6 +262,10 @@ bool EngineService::engineStopped() {
     return true;
 }
 
+bool EngineService::isConcurrentLifecycleSafe() {
+    return false;
+}
+
 std::shared_ptr<aace::engine::core::EngineContext> EngineService::getContext() {
     return m_context;
 }
@@ -71,6 +71,11 @@ bool LocationEngineService::shutdown() {
     return true;
 }
 
+bool LocationEngineService::isConcurrentLifecycleSafe() {
+    // the location provider is only registered, so there is nothing to set up, start or stop
+    return true;
+}
+
 }  // namespace location
 }  // namespace engine
 }  // namespace aace
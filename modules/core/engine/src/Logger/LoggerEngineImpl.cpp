@@ -25,7 +25,8 @@ namespace engine {
 namespace logger {
 
 LoggerEngineImpl::LoggerEngineImpl(std::shared_ptr<aace::logger::Logger> platformLoggerInterface) :
-        m_platformLoggerInterface(platformLoggerInterface) {
+        m_platformLoggerInterface(platformLoggerInterface),
+        m_executor(aace::engine::utils::threading::TaskPriority::LOW) {
 }
 
 std::shared_ptr<LoggerEngineImpl> LoggerEngineImpl::create(
@@ -64,6 +64,11 @@ bool LoggerEngineService::initialize() {
     }
 }
 
+bool LoggerEngineService::isConcurrentLifecycleSafe() {
+    // the loggers are configured before setup, so there is nothing to set up, start or stop
+    return true;
+}
+
 bool LoggerEngineService::configure(std::shared_ptr<std::istream> configuration) {
     try {
         auto root = json::toJson(configuration);
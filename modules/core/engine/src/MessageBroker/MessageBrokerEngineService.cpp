@@ -49,6 +49,10 @@ bool MessageBrokerEngineService::initialize() {
         m_streamManager = StreamManagerImpl::create();
         ThrowIfNull(m_streamManager, "invalidStreamManager");
 
+        // serves the streams to out-of-process integrations over shared memory
+        m_sharedMemoryStreamTransport = SharedMemoryStreamTransport::create(m_streamManager);
+        ThrowIfNull(m_sharedMemoryStreamTransport, "invalidSharedMemoryStreamTransport");
+
         ThrowIfNot(
             registerServiceInterface<MessageBrokerServiceInterface>(shared_from_this()),
             "registerMessageBrokerServiceInterfaceFailed");
@@ -60,8 +64,14 @@ bool MessageBrokerEngineService::initialize() {
     }
 }
 
+bool MessageBrokerEngineService::isConcurrentLifecycleSafe() {
+    // the broker is created in initialize() and setup() does nothing else
+    return true;
+}
+
 bool MessageBrokerEngineService::shutdown() {
     try {
+        m_sharedMemoryStreamTransport->shutdown();
         m_messageBroker->shutdown();
         return true;
     } catch (std::exception& ex) {
@@ -141,6 +151,10 @@ std::shared_ptr<StreamManagerInterface> MessageBrokerEngineService::getStreamMan
     return m_streamManager;
 }
 
+std::shared_ptr<SharedMemoryStreamTransport> MessageBrokerEngineService::getSharedMemoryStreamTransport() {
+    return m_sharedMemoryStreamTransport;
+}
+
 aace::engine::core::Version MessageBrokerEngineService::getConfiguredVersion() {
     return m_configuredVersion;
 }
@@ -15,6 +15,7 @@
 
 #include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
 
 #include <sstream>
 
@@ -151,6 +152,7 @@ void MessageBrokerImpl::publishAsync(const PublishMessage& pm, aace::engine::uti
 
 Message MessageBrokerImpl::publishSync(const PublishMessage& pm, aace::engine::utils::threading::Executor& executor) {
     AACE_DEBUG(LX(TAG).sensitive("message", pm.msg()));
+    AACE_TRACE_SPAN("MessageBroker", "PublishSync");
     std::lock_guard<std::mutex> lock(m_wait_for_sync_response_mutex);
     if (m_isShutdown) {
         AACE_WARN(LX(TAG).m("Discarding message since MessageBroker is shutdown."));
@@ -240,6 +242,7 @@ size_t MessageBrokerImpl::notifySubscribers(const std::string& type, const Messa
 }
 
 size_t MessageBrokerImpl::notifySubscribers(const Message& message) {
+    AACE_TRACE_SPAN("MessageBroker", "Dispatch");
     size_t numSubscribersNotified = 0;
 
     // notify the subscribers that are interested in this specific message (topic:action)
@@ -0,0 +1,94 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/MessageBroker/SharedMemoryMessageStream.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.SharedMemoryMessageStream");
+
+const std::chrono::milliseconds SharedMemoryMessageStream::DEFAULT_TIMEOUT = std::chrono::milliseconds(100);
+
+SharedMemoryMessageStream::SharedMemoryMessageStream(
+    std::shared_ptr<SharedMemoryRing> ring,
+    MessageStream::Mode mode,
+    std::chrono::milliseconds timeout) :
+        m_ring(ring), m_mode(mode), m_timeout(timeout), m_closed(false) {
+}
+
+std::shared_ptr<SharedMemoryMessageStream> SharedMemoryMessageStream::create(
+    std::shared_ptr<SharedMemoryRing> ring,
+    MessageStream::Mode mode,
+    std::chrono::milliseconds timeout) {
+    try {
+        ThrowIfNull(ring, "invalidRing");
+        ThrowIf(mode == MessageStream::Mode::READ_WRITE, "invalidStreamMode");
+        return std::shared_ptr<SharedMemoryMessageStream>(new SharedMemoryMessageStream(ring, mode, timeout));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryMessageStream::getRing() {
+    return m_ring;
+}
+
+ssize_t SharedMemoryMessageStream::read(char* data, size_t size) {
+    if (m_mode != MessageStream::Mode::READ) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidOperation"));
+        return -1;
+    }
+    return m_closed ? 0 : m_ring->read(data, size, m_timeout);
+}
+
+ssize_t SharedMemoryMessageStream::write(const char* data, size_t size) {
+    if (m_mode != MessageStream::Mode::WRITE) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidOperation"));
+        return -1;
+    }
+    return m_closed ? -1 : m_ring->write(data, size, m_timeout);
+}
+
+void SharedMemoryMessageStream::close() {
+    if (m_closed.exchange(true)) {
+        return;
+    }
+    if (m_mode == MessageStream::Mode::READ) {
+        m_ring->closeReader();
+    } else {
+        m_ring->closeWriter();
+    }
+}
+
+bool SharedMemoryMessageStream::isClosed() {
+    if (m_closed) {
+        return true;
+    }
+    // the stream is closed once the other side of the ring can no longer be served
+    return m_mode == MessageStream::Mode::READ ? m_ring->isEndOfStream() : m_ring->isReaderClosed();
+}
+
+aace::core::MessageStream::Mode SharedMemoryMessageStream::getMode() {
+    return m_mode;
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
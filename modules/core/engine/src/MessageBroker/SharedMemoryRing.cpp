@@ -0,0 +1,367 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#endif
+
+#include <AACE/Engine/MessageBroker/SharedMemoryRing.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.SharedMemoryRing");
+
+// the header is shared between processes, so its atomics must not rely on a lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory rings require lock free 32-bit atomics");
+
+/// Identifies the memory of a ring.
+static const uint32_t RING_MAGIC = 0x52434141;  // "AACR"
+
+/// The version of the memory layout of a ring.
+static const uint32_t RING_VERSION = 1;
+
+/// The MFD_CLOEXEC and MFD_ALLOW_SEALING flags of memfd_create, which older C libraries do not define.
+static const unsigned int MEMFD_CLOEXEC = 0x0001U;
+static const unsigned int MEMFD_ALLOW_SEALING = 0x0002U;
+
+/// The file sealing commands and seals of fcntl, which older C libraries do not define.
+static const int FCNTL_ADD_SEALS = 1024 + 9;
+static const int FCNTL_GET_SEALS = 1024 + 10;
+static const int SEAL_SEAL = 0x0001;
+static const int SEAL_SHRINK = 0x0002;
+static const int SEAL_GROW = 0x0004;
+
+/// The seals of the memory of a ring, which keep its size fixed once both sides have mapped it.
+static const int RING_SEALS = SEAL_SHRINK | SEAL_GROW | SEAL_SEAL;
+
+/// The size of a cache line, which separates the fields written by the producer from the consumer's.
+static const size_t CACHE_LINE_SIZE = 64;
+
+// the indices are free running 32-bit counters, so the capacity must leave room for their difference
+const size_t SharedMemoryRing::MAX_CAPACITY = 1u << 30;
+
+/// The layout of the start of the shared memory, followed by the data of the ring.
+struct SharedMemoryRing::Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;
+
+    /// Written by the producer.
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> writeIndex;
+    std::atomic<uint32_t> writerClosed;
+    std::atomic<uint32_t> writerWaiting;
+
+    /// Written by the consumer.
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> readIndex;
+    std::atomic<uint32_t> readerClosed;
+    std::atomic<uint32_t> readerWaiting;
+};
+
+size_t SharedMemoryRing::getHeaderSize() {
+    return (sizeof(Header) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+/// @return The number of bytes between the indices, which a misbehaving other side cannot make exceed the capacity.
+static uint32_t getUsed(uint32_t writeIndex, uint32_t readIndex, uint32_t capacity) {
+    return std::min(writeIndex - readIndex, capacity);
+}
+
+static void closeFd(int fd) {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::create(size_t capacity) {
+    int memoryFd = -1;
+    int dataEventFd = -1;
+    int spaceEventFd = -1;
+    void* mapping = MAP_FAILED;
+    size_t mappingSize = 0;
+    try {
+        ThrowIf(capacity == 0 || capacity > MAX_CAPACITY, "invalidCapacity");
+        size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity) {
+            roundedCapacity <<= 1;
+        }
+        mappingSize = getHeaderSize() + roundedCapacity;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+        memoryFd = static_cast<int>(::syscall(SYS_memfd_create, TAG.c_str(), MEMFD_CLOEXEC | MEMFD_ALLOW_SEALING));
+        ThrowIf(memoryFd < 0, "memfdCreateFailed");
+        dataEventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        spaceEventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        ThrowIf(dataEventFd < 0 || spaceEventFd < 0, "eventfdCreateFailed");
+#else
+        Throw("unsupportedPlatform");
+#endif
+        ThrowIf(::ftruncate(memoryFd, static_cast<off_t>(mappingSize)) != 0, "ftruncateFailed");
+        // a ring that shrinks under the other side would crash it when it touches the lost pages
+        ThrowIf(::fcntl(memoryFd, FCNTL_ADD_SEALS, RING_SEALS) != 0, "addSealsFailed");
+        mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+        ThrowIf(mapping == MAP_FAILED, "mmapFailed");
+
+        auto header = new (mapping) Header();
+        header->magic = RING_MAGIC;
+        header->version = RING_VERSION;
+        header->capacity = static_cast<uint32_t>(roundedCapacity);
+        header->writeIndex = 0;
+        header->writerClosed = 0;
+        header->writerWaiting = 0;
+        header->readIndex = 0;
+        header->readerClosed = 0;
+        header->readerWaiting = 0;
+
+        return std::shared_ptr<SharedMemoryRing>(
+            new SharedMemoryRing(memoryFd, dataEventFd, spaceEventFd, mapping, mappingSize));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("capacity", capacity).d("errno", errno));
+        if (mapping != MAP_FAILED) {
+            ::munmap(mapping, mappingSize);
+        }
+        closeFd(memoryFd);
+        closeFd(dataEventFd);
+        closeFd(spaceEventFd);
+        return nullptr;
+    }
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::attach(int memoryFd, int dataEventFd, int spaceEventFd) {
+    void* mapping = MAP_FAILED;
+    size_t mappingSize = 0;
+    try {
+        ThrowIf(memoryFd < 0 || dataEventFd < 0 || spaceEventFd < 0, "invalidFileDescriptor");
+        int seals = ::fcntl(memoryFd, FCNTL_GET_SEALS);
+        ThrowIf(seals < 0 || (seals & (SEAL_SHRINK | SEAL_GROW)) != (SEAL_SHRINK | SEAL_GROW), "ringNotSealed");
+        struct stat status;
+        ThrowIf(::fstat(memoryFd, &status) != 0, "fstatFailed");
+        ThrowIf(
+            status.st_size <= static_cast<off_t>(getHeaderSize()) ||
+                status.st_size > static_cast<off_t>(getHeaderSize() + MAX_CAPACITY),
+            "invalidRingSize");
+        mappingSize = static_cast<size_t>(status.st_size);
+        mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+        ThrowIf(mapping == MAP_FAILED, "mmapFailed");
+
+        auto header = static_cast<Header*>(mapping);
+        ThrowIf(header->magic != RING_MAGIC || header->version != RING_VERSION, "invalidRingHeader");
+        // the capacity is used as an index mask, so it must be a power of two
+        uint32_t capacity = header->capacity;
+        ThrowIf(
+            capacity == 0 || (capacity & (capacity - 1)) != 0 || getHeaderSize() + capacity != mappingSize,
+            "invalidRingCapacity");
+
+        return std::shared_ptr<SharedMemoryRing>(
+            new SharedMemoryRing(memoryFd, dataEventFd, spaceEventFd, mapping, mappingSize));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("errno", errno));
+        if (mapping != MAP_FAILED) {
+            ::munmap(mapping, mappingSize);
+        }
+        closeFd(memoryFd);
+        closeFd(dataEventFd);
+        closeFd(spaceEventFd);
+        return nullptr;
+    }
+}
+
+SharedMemoryRing::SharedMemoryRing(
+    int memoryFd,
+    int dataEventFd,
+    int spaceEventFd,
+    void* mapping,
+    size_t mappingSize) :
+        m_memoryFd(memoryFd),
+        m_dataEventFd(dataEventFd),
+        m_spaceEventFd(spaceEventFd),
+        m_mapping(mapping),
+        m_mappingSize(mappingSize),
+        m_header(static_cast<Header*>(mapping)),
+        m_data(static_cast<char*>(mapping) + getHeaderSize()),
+        m_capacity(static_cast<uint32_t>(mappingSize - getHeaderSize())) {
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+    ::munmap(m_mapping, m_mappingSize);
+    closeFd(m_memoryFd);
+    closeFd(m_dataEventFd);
+    closeFd(m_spaceEventFd);
+}
+
+void SharedMemoryRing::signal(int eventFd) {
+    uint64_t value = 1;
+    // a full eventfd counter already wakes the other side, so a failed write is not an error
+    ssize_t result = ::write(eventFd, &value, sizeof(value));
+    (void)result;
+}
+
+template <typename Predicate>
+bool SharedMemoryRing::waitFor(
+    int eventFd,
+    std::atomic<uint32_t>& waiting,
+    Predicate ready,
+    std::chrono::steady_clock::time_point deadline) {
+    // flag the wait before checking the condition again, so the other side either sees the flag and signals, or
+    // changed the condition before the check
+    waiting.store(1);
+    while (!ready()) {
+        auto remaining =
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            waiting.store(0);
+            return false;
+        }
+        struct pollfd descriptor = {eventFd, POLLIN, 0};
+        ::poll(&descriptor, 1, static_cast<int>(remaining.count()));
+        uint64_t value;
+        ssize_t result = ::read(eventFd, &value, sizeof(value));
+        (void)result;
+    }
+    waiting.store(0);
+    return true;
+}
+
+ssize_t SharedMemoryRing::write(const char* data, size_t size, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    size_t written = 0;
+    while (written < size) {
+        if (m_header->readerClosed.load()) {
+            return -1;
+        }
+        uint32_t writeIndex = m_header->writeIndex.load(std::memory_order_relaxed);
+        uint32_t readIndex = m_header->readIndex.load(std::memory_order_acquire);
+        size_t space = m_capacity - getUsed(writeIndex, readIndex, m_capacity);
+        if (space == 0) {
+            auto hasSpace = [this, writeIndex]() {
+                return getUsed(writeIndex, m_header->readIndex.load(), m_capacity) < m_capacity ||
+                       m_header->readerClosed.load();
+            };
+            if (!waitFor(m_spaceEventFd, m_header->writerWaiting, hasSpace, deadline)) {
+                break;
+            }
+            continue;
+        }
+
+        size_t count = std::min(space, size - written);
+        size_t offset = writeIndex & (m_capacity - 1);
+        size_t first = std::min(count, m_capacity - offset);
+        std::memcpy(m_data + offset, data + written, first);
+        std::memcpy(m_data, data + written + first, count - first);
+        m_header->writeIndex.store(writeIndex + static_cast<uint32_t>(count));
+        written += count;
+
+        if (m_header->readerWaiting.load()) {
+            signal(m_dataEventFd);
+        }
+    }
+    return static_cast<ssize_t>(written);
+}
+
+ssize_t SharedMemoryRing::read(char* data, size_t size, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    uint32_t readIndex = m_header->readIndex.load(std::memory_order_relaxed);
+    uint32_t writeIndex;
+    while (true) {
+        // the writer is closed after its last write, so the close has to be checked before the index
+        bool writerClosed = m_header->writerClosed.load();
+        writeIndex = m_header->writeIndex.load(std::memory_order_acquire);
+        if (writeIndex != readIndex) {
+            break;
+        }
+        if (writerClosed || size == 0) {
+            return 0;
+        }
+        auto hasData = [this, readIndex]() {
+            return m_header->writeIndex.load() != readIndex || m_header->writerClosed.load();
+        };
+        if (!waitFor(m_dataEventFd, m_header->readerWaiting, hasData, deadline)) {
+            return 0;
+        }
+    }
+
+    size_t count = std::min(static_cast<size_t>(getUsed(writeIndex, readIndex, m_capacity)), size);
+    size_t offset = readIndex & (m_capacity - 1);
+    size_t first = std::min(count, m_capacity - offset);
+    std::memcpy(data, m_data + offset, first);
+    std::memcpy(data + first, m_data, count - first);
+    m_header->readIndex.store(readIndex + static_cast<uint32_t>(count));
+
+    if (m_header->writerWaiting.load()) {
+        signal(m_spaceEventFd);
+    }
+    return static_cast<ssize_t>(count);
+}
+
+void SharedMemoryRing::closeWriter() {
+    m_header->writerClosed.store(1);
+    signal(m_dataEventFd);
+}
+
+void SharedMemoryRing::closeReader() {
+    m_header->readerClosed.store(1);
+    signal(m_spaceEventFd);
+}
+
+bool SharedMemoryRing::isWriterClosed() const {
+    return m_header->writerClosed.load() != 0;
+}
+
+bool SharedMemoryRing::isReaderClosed() const {
+    return m_header->readerClosed.load() != 0;
+}
+
+bool SharedMemoryRing::isEndOfStream() const {
+    return isWriterClosed() && available() == 0;
+}
+
+size_t SharedMemoryRing::available() const {
+    return getUsed(m_header->writeIndex.load(), m_header->readIndex.load(), m_capacity);
+}
+
+size_t SharedMemoryRing::getCapacity() const {
+    return m_capacity;
+}
+
+int SharedMemoryRing::getMemoryFd() const {
+    return m_memoryFd;
+}
+
+int SharedMemoryRing::getDataEventFd() const {
+    return m_dataEventFd;
+}
+
+int SharedMemoryRing::getSpaceEventFd() const {
+    return m_spaceEventFd;
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,197 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <AACE/Engine/MessageBroker/SharedMemoryStreamTransport.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.SharedMemoryStreamTransport");
+
+/// About a second of 16 kHz 16-bit audio.
+const size_t SharedMemoryStreamTransport::DEFAULT_RING_CAPACITY = 32 * 1024;
+
+/// The size of the chunks the pumps move.
+static const size_t PUMP_CHUNK_SIZE = 4096;
+
+/// The longest time a pump waits before reading a handler again which had no data.
+static const std::chrono::milliseconds MAX_PUMP_IDLE_WAIT = std::chrono::milliseconds(10);
+
+SharedMemoryStreamTransport::SharedMemoryStreamTransport(std::shared_ptr<StreamManagerInterface> streamManager) :
+        m_streamManager(streamManager), m_shutdown(false) {
+}
+
+std::shared_ptr<SharedMemoryStreamTransport> SharedMemoryStreamTransport::create(
+    std::shared_ptr<StreamManagerInterface> streamManager) {
+    try {
+        ThrowIfNull(streamManager, "invalidStreamManager");
+        return std::shared_ptr<SharedMemoryStreamTransport>(new SharedMemoryStreamTransport(streamManager));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+SharedMemoryStreamTransport::~SharedMemoryStreamTransport() {
+    shutdown();
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryStreamTransport::openStream(
+    const std::string& streamId,
+    aace::core::MessageStream::Mode mode,
+    size_t capacity) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ThrowIf(m_shutdown, "transportShutdown");
+        ThrowIf(mode == aace::core::MessageStream::Mode::READ_WRITE, "invalidStreamMode");
+        reapPumpsLocked();
+
+        auto streamManager = m_streamManager.lock();
+        ThrowIfNull(streamManager, "invalidStreamManager");
+
+        // create the ring before requesting the handler, since the handler can only be requested once
+        auto ring = SharedMemoryRing::create(capacity);
+        ThrowIfNull(ring, "createRingFailed");
+
+        auto handler = streamManager->requestStreamHandler(streamId, mode);
+        ThrowIfNull(handler, "requestStreamHandlerFailed");
+
+        // the engine side of the ring is the opposite of the other process' side
+        bool toRing = mode == aace::core::MessageStream::Mode::READ;
+        auto stream = SharedMemoryMessageStream::create(
+            ring, toRing ? aace::core::MessageStream::Mode::WRITE : aace::core::MessageStream::Mode::READ);
+        ThrowIfNull(stream, "createStreamFailed");
+
+        std::unique_ptr<Pump> pump(new Pump());
+        auto pumpPtr = pump.get();
+        pump->thread = std::thread([this, handler, stream, toRing, pumpPtr] {
+            if (toRing) {
+                pumpToRing(handler, stream);
+            } else {
+                pumpFromRing(handler, stream);
+            }
+            stream->close();
+            pumpPtr->finished = true;
+        });
+        m_pumps.push_back(std::move(pump));
+
+        AACE_DEBUG(LX(TAG).d("streamId", streamId).d("mode", mode).d("capacity", ring->getCapacity()));
+
+        return ring;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("streamId", streamId).d("mode", mode));
+        return nullptr;
+    }
+}
+
+void SharedMemoryStreamTransport::pumpToRing(
+    std::shared_ptr<aace::core::MessageStream> handler,
+    std::shared_ptr<SharedMemoryMessageStream> stream) {
+    std::vector<char> buffer(PUMP_CHUNK_SIZE);
+    std::chrono::milliseconds idleWait(0);
+    while (!m_shutdown && !stream->isClosed()) {
+        auto count = handler->read(buffer.data(), buffer.size());
+        if (count < 0 || (count == 0 && handler->isClosed())) {
+            return;
+        }
+        if (count == 0) {
+            // a handler backed by a blocking reader has already waited for data, so it is read again at once, and
+            // only a handler which keeps returning nothing is read less often
+            if (idleWait.count() > 0 && !waitForShutdown(idleWait)) {
+                return;
+            }
+            idleWait = std::min(std::max(idleWait * 2, std::chrono::milliseconds(1)), MAX_PUMP_IDLE_WAIT);
+            continue;
+        }
+        idleWait = std::chrono::milliseconds(0);
+        // the ring applies back pressure while the other process catches up
+        ssize_t offset = 0;
+        while (offset < count) {
+            auto written = stream->write(buffer.data() + offset, count - offset);
+            if (written < 0 || m_shutdown) {
+                return;
+            }
+            offset += written;
+        }
+    }
+}
+
+void SharedMemoryStreamTransport::pumpFromRing(
+    std::shared_ptr<aace::core::MessageStream> handler,
+    std::shared_ptr<SharedMemoryMessageStream> stream) {
+    std::vector<char> buffer(PUMP_CHUNK_SIZE);
+    while (!m_shutdown && !handler->isClosed()) {
+        auto count = stream->read(buffer.data(), buffer.size());
+        if (count > 0) {
+            // a handler may accept part of the chunk, so the rest is written until it has all been taken
+            ssize_t offset = 0;
+            while (offset < count) {
+                auto written = handler->write(buffer.data() + offset, count - offset);
+                if (written < 0 || m_shutdown || (written == 0 && handler->isClosed())) {
+                    return;
+                }
+                if (written == 0 && !waitForShutdown(MAX_PUMP_IDLE_WAIT)) {
+                    return;
+                }
+                offset += written;
+            }
+        } else if (stream->isClosed()) {
+            // the other process closed the stream and every byte was written to the handler
+            handler->close();
+            return;
+        }
+    }
+}
+
+bool SharedMemoryStreamTransport::waitForShutdown(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return !m_shutdownCondition.wait_for(lock, timeout, [this] { return m_shutdown.load(); });
+}
+
+void SharedMemoryStreamTransport::reapPumpsLocked() {
+    for (auto it = m_pumps.begin(); it != m_pumps.end();) {
+        if ((*it)->finished) {
+            (*it)->thread.join();
+            it = m_pumps.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void SharedMemoryStreamTransport::shutdown() {
+    std::list<std::unique_ptr<Pump>> pumps;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        pumps.swap(m_pumps);
+    }
+    m_shutdownCondition.notify_all();
+    for (auto& pump : pumps) {
+        if (pump->thread.joinable()) {
+            pump->thread.join();
+        }
+    }
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
@@ -15,15 +15,11 @@
 #include <chrono>
 #include <string>
 
-#include <nlohmann/json.hpp>
-
 #include "AACE/Engine/Metrics/AASBMetricsDispatcher.h"
 #include "AACE/Engine/Metrics/AASBMetricsUtils.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include <AACE/Engine/Utils/UUID/UUID.h>
 
-using json = nlohmann::json;
-
 namespace aace {
 namespace engine {
 namespace metrics {
@@ -31,6 +27,9 @@ namespace metrics {
 /// String to identify log entries originating from this file.
 static const std::string TAG("aace.engine.metrics.AASBMetricsDispatcher");
 
+/// How long a publish of buffered metrics may be delayed to coalesce it with other timers
+static const std::chrono::seconds DISPATCH_TIMER_SLACK(1);
+
 AASBMetricsDispatcher::AASBMetricsDispatcher(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
     unsigned int agentId,
@@ -41,7 +40,8 @@ AASBMetricsDispatcher::AASBMetricsDispatcher(
         AbstractMetricsDispatcher(agentId, hasPreDispatchRules, maxMetricsInBuffer),
         m_messageBroker{messageBroker},
         m_publishSeconds{publishPeriod},
-        m_minMetricsInMessage{minMetricsInMessage} {
+        m_minMetricsInMessage{minMetricsInMessage},
+        m_dispatchTimer{DISPATCH_TIMER_SLACK} {
     AACE_INFO(LX(TAG)
                   .m("Initialized dispatcher")
                   .d("agentId", m_agentId)
@@ -141,37 +141,14 @@ void AASBMetricsDispatcher::publishBufferAsAASBLocked() {
         return;
     }
 
-    json entries = json::array();
-    for (const MetricEvent& metric : m_dispatchBuffer) {
-        try {
-            entries.push_back(serializeMetricEvent(metric));
-        } catch (json::exception& ex) {
-            AACE_ERROR(
-                LX(TAG).m("Failed to add entry. Dropping metric").d("agentId", m_agentId).d("reason", ex.what()));
-        }
-    }
-    m_dispatchBuffer.clear();
-    if (entries.empty()) {
-        AACE_ERROR(LX(TAG)
-                       .m("Failed to add every metric from buffer. No AASB message will be dispatched")
-                       .d("agentId", m_agentId));
-        return;
-    }
-
     try {
-        json message = {
-            {"header",
-             {
-                 {"version", "4.3"},
-                 {"messageType", "Publish"},
-                 {"id", aace::engine::utils::uuid::generateUUID()},
-                 {"messageDescription", {{"topic", "MetricsUpload"}, {"action", "Agent" + std::to_string(m_agentId)}}},
-             }},
-            {"payload", {{"metrics", entries}}}};
-        std::string messageStr = message.dump();
+        std::string messageStr =
+            serializeMetricsUploadMessage(aace::engine::utils::uuid::generateUUID(), m_agentId, m_dispatchBuffer);
+        m_dispatchBuffer.clear();
         AACE_VERBOSE(LX(TAG).m("Dispatching metrics").d("message", messageStr));
         m_messageBroker->publish(messageStr).send();
     } catch (std::exception& ex) {
+        m_dispatchBuffer.clear();
         AACE_ERROR(LX(TAG).m("Dispatch failed").d("reason", ex.what()));
     }
 }
@@ -12,11 +12,7 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
-#include <regex>
 #include <string>
-#include <sstream>
-
-#include <nlohmann/json.hpp>
 
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Metrics/AASBMetricsUtils.h>
@@ -25,8 +21,6 @@
 #include <AACE/Engine/Metrics/MetricsConstants.h>
 #include <AACE/Engine/Utils/Timing/ClockUtils.h>
 
-using json = nlohmann::json;
-
 namespace aace {
 namespace engine {
 namespace metrics {
@@ -34,50 +28,131 @@ namespace metrics {
 /// String to identify log entries originating from this file.
 static const std::string TAG("aace.engine.metrics.AASBMetricsUtils");
 
-/// Regex to match data points in the AASB-serialized metric
-static const std::regex DATA_REGEX("([^;=,:]+)=([^;=,]+);([^;=,:]+);([0-9]+),");
+/// Initial capacity of a serialized metric
+static constexpr size_t SERIALIZED_METRIC_RESERVE = 256;
 
-std::string serializeMetricEvent(const MetricEvent& metricEvent) {
-    auto time_ms = aace::engine::utils::timing::timePointMillisSinceEpoch(metricEvent.getSystemClockTimestamp());
-    const std::string timestamp = std::to_string(time_ms);
+/**
+ * Append the decimal representation of @a value to @a out without creating
+ * intermediate strings.
+ */
+static void appendUnsigned(std::string& out, uint64_t value) {
+    char buffer[20];
+    size_t length = 0;
+    do {
+        buffer[length++] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+    while (length > 0) {
+        out.push_back(buffer[--length]);
+    }
+}
+
+/**
+ * Append @a value to @a out as the contents of a JSON string, escaping
+ * quotes, backslashes, and control characters.
+ */
+static void appendJsonEscaped(std::string& out, const std::string& value) {
+    static const char* HEX_DIGITS = "0123456789abcdef";
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\r':
+                out.append("\\r");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out.append("\\u00");
+                    out.push_back(HEX_DIGITS[(c >> 4) & 0x0f]);
+                    out.push_back(HEX_DIGITS[c & 0x0f]);
+                } else {
+                    out.push_back(c);
+                }
+                break;
+        }
+    }
+}
 
+void appendSerializedMetricEvent(std::string& out, const MetricEvent& metricEvent) {
+    auto time_ms = aace::engine::utils::timing::timePointMillisSinceEpoch(metricEvent.getSystemClockTimestamp());
     const MetricContext& context = metricEvent.getMetricContext();
-    const std::string agentId = std::to_string(context.getAgentId());
-    const std::string priority = priorityToShortString(context.getPriority());
-    const std::string identity = identityTypeToShortString(context.getIdentityType());
-    const std::string program = metricEvent.getProgramName();
-    const std::string source = metricEvent.getSourceName();
-
-    const auto& dataPoints = metricEvent.getDataPoints();
-    const std::string numDataPoints = std::to_string(dataPoints.size());
-    std::stringstream ss_dp;
-    for (const auto& dp : dataPoints) {
-        const std::string name = dp.getName();
-        const std::string value = dp.getValue();
-        const std::string type = dataTypeToShortString(dp.getDataType());
-        const std::string samples = std::to_string(dp.getSampleCount());
-        // clang-format off
-        ss_dp
-            << name << EQUALS
-            << value << SEMICOLON
-            << type << SEMICOLON
-            << samples << COMMA;
-        // clang-format on
+    const auto& dataPoints = metricEvent.getDataPointMap();
+
+    appendUnsigned(out, time_ms);
+    out.append(COLON);
+    appendUnsigned(out, static_cast<uint64_t>(context.getAgentId()));
+    out.append(COLON);
+    out.append(priorityToShortString(context.getPriority()));
+    out.append(COLON);
+    out.append(identityTypeToShortString(context.getIdentityType()));
+    out.append(COLON);
+    out.append(metricEvent.getProgramName());
+    out.append(COLON);
+    out.append(metricEvent.getSourceName());
+    out.append(COLON);
+    appendUnsigned(out, dataPoints.size());
+    out.append(COLON);
+    for (const auto& entry : dataPoints) {
+        const DataPoint& dp = entry.second;
+        out.append(dp.getName());
+        out.append(EQUALS);
+        if (dp.isNumeric()) {
+            appendUnsigned(out, dp.getNumericValue());
+        } else {
+            out.append(dp.getValue());
+        }
+        out.append(SEMICOLON);
+        out.append(dataTypeToShortString(dp.getDataType()));
+        out.append(SEMICOLON);
+        appendUnsigned(out, dp.getSampleCount());
+        out.append(COMMA);
     }
+}
 
-    // clang-format off
-    std::stringstream metric;
-    metric
-        << timestamp << COLON
-        << agentId << COLON
-        << priority << COLON
-        << identity << COLON
-        << program << COLON
-        << source << COLON
-        << numDataPoints << COLON
-        << ss_dp.str();
-    // clang-format on
-    return metric.str();
+std::string serializeMetricEvent(const MetricEvent& metricEvent) {
+    std::string metric;
+    metric.reserve(SERIALIZED_METRIC_RESERVE);
+    appendSerializedMetricEvent(metric, metricEvent);
+    return metric;
+}
+
+std::string serializeMetricsUploadMessage(
+    const std::string& messageId,
+    unsigned int agentId,
+    const std::vector<MetricEvent>& metricEvents) {
+    std::string message;
+    message.reserve(SERIALIZED_METRIC_RESERVE * (metricEvents.size() + 1));
+    message.append("{\"header\":{\"version\":\"4.3\",\"messageType\":\"Publish\",\"id\":\"");
+    appendJsonEscaped(message, messageId);
+    message.append("\",\"messageDescription\":{\"topic\":\"MetricsUpload\",\"action\":\"Agent");
+    appendUnsigned(message, agentId);
+    message.append("\"}},\"payload\":{\"metrics\":[");
+    std::string metric;
+    metric.reserve(SERIALIZED_METRIC_RESERVE);
+    bool first = true;
+    for (const auto& metricEvent : metricEvents) {
+        metric.clear();
+        appendSerializedMetricEvent(metric, metricEvent);
+        if (!first) {
+            message.push_back(',');
+        }
+        first = false;
+        message.push_back('"');
+        appendJsonEscaped(message, metric);
+        message.push_back('"');
+    }
+    message.append("]}}");
+    return message;
 }
 
 size_t parseHeader(
@@ -154,22 +229,35 @@ bool parseSerializedMetric(std::string aasbMetric, ParsedHeaderHandler headerHan
     }
     headerHandler({timestampStr, agentId, priority, identityType, programName, sourceName, dpCount});
 
-    auto dataPointsBegin = aasbMetric.cbegin() + (ssize_t)dataPointPos;
-    auto dataPointsEnd = aasbMetric.cend();
-    std::smatch data_match;
+    // Each data point has the format "<name>=<value>;<type>;<samples>,"
+    size_t pos = dataPointPos;
+    const size_t end = aasbMetric.size();
     try {
-        while (std::regex_search(dataPointsBegin, dataPointsEnd, data_match, DATA_REGEX)) {
-            ThrowIf(data_match.empty(), "Regex match is empty");
-            const std::string name = data_match[1].str();
-            ThrowIf(name.empty(), "Matched name is empty");
-            const std::string value = data_match[2].str();
-            ThrowIf(value.empty(), "Matched value is empty");
-            const std::string typeStr = data_match[3].str();
-            ThrowIf(typeStr.empty(), "Matched type empty");
-            const std::string samplesStr = data_match[4];
-            ThrowIf(samplesStr.empty(), "Matched sample count is empty");
-            uint32_t sampleCount = static_cast<uint32_t>(std::stoi(samplesStr));
-            dataPointsBegin = data_match.suffix().first;
+        while (pos < end) {
+            auto equals = aasbMetric.find('=', pos);
+            ThrowIf(equals == std::string::npos, "Missing '=' after data point name");
+            auto valueEnd = aasbMetric.find(';', equals + 1);
+            ThrowIf(valueEnd == std::string::npos, "Missing ';' after data point value");
+            auto typeEnd = aasbMetric.find(';', valueEnd + 1);
+            ThrowIf(typeEnd == std::string::npos, "Missing ';' after data point type");
+            auto samplesEnd = aasbMetric.find(',', typeEnd + 1);
+            ThrowIf(samplesEnd == std::string::npos, "Missing ',' after data point sample count");
+
+            const std::string name = aasbMetric.substr(pos, equals - pos);
+            ThrowIf(name.empty(), "Data point name is empty");
+            ThrowIf(name.find_first_of(";,:") != std::string::npos, "Invalid data point name");
+            const std::string value = aasbMetric.substr(equals + 1, valueEnd - equals - 1);
+            ThrowIf(value.empty(), "Data point value is empty");
+            ThrowIf(value.find_first_of("=,") != std::string::npos, "Invalid data point value");
+            const std::string typeStr = aasbMetric.substr(valueEnd + 1, typeEnd - valueEnd - 1);
+            ThrowIf(typeStr.empty(), "Data point type is empty");
+            ThrowIf(typeStr.find_first_of("=,:") != std::string::npos, "Invalid data point type");
+            const std::string samplesStr = aasbMetric.substr(typeEnd + 1, samplesEnd - typeEnd - 1);
+            ThrowIf(samplesStr.empty(), "Data point sample count is empty");
+            ThrowIf(
+                samplesStr.find_first_not_of("0123456789") != std::string::npos, "Invalid data point sample count");
+            uint32_t sampleCount = static_cast<uint32_t>(std::stoul(samplesStr));
+            pos = samplesEnd + 1;
             dpHandler(name, value, typeStr, sampleCount);
         }
     } catch (std::exception& ex) {
@@ -49,7 +49,7 @@ CounterDataPointBuilder& CounterDataPointBuilder::withSampleCount(uint32_t count
 }
 
 DataPoint CounterDataPointBuilder::build() {
-    return DataPoint{m_name, std::to_string(m_value), DataType::COUNTER, m_sampleCount};
+    return DataPoint{m_name, m_value, DataType::COUNTER, m_sampleCount};
 }
 
 }  // namespace metrics
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <cstdlib>
+
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Metrics/DataPoint.h"
 
@@ -24,15 +26,47 @@ namespace metrics {
 static const std::string TAG("aace.engine.metrics.DataPoint");
 
 DataPoint::DataPoint(const std::string& name, const std::string& value, DataType dataType, uint32_t sampleCount) :
-        m_name{name}, m_value{value}, m_dataType{dataType}, m_sampleCount{sampleCount} {
+        m_name{name},
+        m_value{value},
+        m_numericValue{0},
+        m_isNumeric{false},
+        m_dataType{dataType},
+        m_sampleCount{sampleCount} {
+}
+
+DataPoint::DataPoint(const std::string& name, uint64_t value, DataType dataType, uint32_t sampleCount) :
+        m_name{name},
+        m_numericValue{value},
+        m_isNumeric{dataType != DataType::STRING},
+        m_dataType{dataType},
+        m_sampleCount{sampleCount} {
+    if (!m_isNumeric) {
+        m_value = std::to_string(value);
+    }
 }
 
-std::string DataPoint::getName() const {
+const std::string& DataPoint::getName() const {
     return m_name;
 }
 
 std::string DataPoint::getValue() const {
-    return m_value;
+    return m_isNumeric ? std::to_string(m_numericValue) : m_value;
+}
+
+bool DataPoint::isNumeric() const {
+    return m_isNumeric;
+}
+
+uint64_t DataPoint::getNumericValue() const {
+    if (m_isNumeric) {
+        return m_numericValue;
+    }
+    if (m_dataType == DataType::STRING || m_value.empty()) {
+        return 0;
+    }
+    char* end = nullptr;
+    auto value = std::strtoull(m_value.c_str(), &end, 10);
+    return (end != nullptr && *end == '\0') ? static_cast<uint64_t>(value) : 0;
 }
 
 DataType DataPoint::getDataType() const {
@@ -44,7 +78,7 @@ uint32_t DataPoint::getSampleCount() const {
 }
 
 bool DataPoint::isValid() const {
-    return !m_name.empty() && !m_value.empty() && m_sampleCount != 0;
+    return !m_name.empty() && (m_isNumeric || !m_value.empty()) && m_sampleCount != 0;
 }
 
 }  // namespace metrics
@@ -65,7 +65,9 @@ DataPoint DurationDataPointBuilder::build() {
         AACE_WARN(LX("build() called while timer was still running. Stopping now"));
         stopTimer();
     }
-    return DataPoint{m_name, std::to_string(m_duration.count()), DataType::DURATION};
+    // a negative duration would wrap around to a value close to 2^64 as an unsigned value
+    auto durationMs = m_duration.count() > 0 ? static_cast<uint64_t>(m_duration.count()) : 0;
+    return DataPoint{m_name, durationMs, DataType::DURATION};
 }
 
 }  // namespace metrics
@@ -0,0 +1,182 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cmath>
+#include <unordered_map>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Metrics/MetricAggregator.h>
+#include <AACE/Engine/Utils/Agent/AgentId.h>
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.metrics.MetricAggregator");
+
+const std::string MetricAggregator::SUFFIX_P50("_p50");
+const std::string MetricAggregator::SUFFIX_P90("_p90");
+const std::string MetricAggregator::SUFFIX_P99("_p99");
+const std::string MetricAggregator::SUFFIX_MAX("_max");
+
+constexpr size_t AggregatedTimer::NUM_BUCKETS;
+
+AggregatedCounter::AggregatedCounter() : m_value{0} {
+}
+
+void AggregatedCounter::increment(uint64_t value) {
+    m_value.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t AggregatedCounter::collect() {
+    return m_value.exchange(0, std::memory_order_relaxed);
+}
+
+AggregatedTimer::AggregatedTimer() : m_sum{0}, m_max{0} {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t AggregatedTimer::bucketIndex(uint64_t valueMs) {
+    size_t index = 0;
+    while (valueMs != 0 && index < NUM_BUCKETS - 1) {
+        valueMs >>= 1;
+        index++;
+    }
+    return index;
+}
+
+void AggregatedTimer::record(std::chrono::milliseconds duration) {
+    uint64_t valueMs = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+    m_buckets[bucketIndex(valueMs)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(valueMs, std::memory_order_relaxed);
+    uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+    while (valueMs > currentMax && !m_max.compare_exchange_weak(currentMax, valueMs, std::memory_order_relaxed)) {
+    }
+}
+
+AggregatedTimer::Snapshot AggregatedTimer::collect() {
+    Snapshot snapshot;
+    snapshot.count = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        snapshot.buckets[i] = m_buckets[i].exchange(0, std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = m_sum.exchange(0, std::memory_order_relaxed);
+    snapshot.max = m_max.exchange(0, std::memory_order_relaxed);
+    return snapshot;
+}
+
+uint64_t AggregatedTimer::Snapshot::getPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        cumulative += buckets[i];
+        if (cumulative >= rank) {
+            if (i == 0) {
+                return 0;
+            }
+            if (i == NUM_BUCKETS - 1) {
+                return max;
+            }
+            uint64_t upperBound = (static_cast<uint64_t>(1) << i) - 1;
+            return upperBound < max ? upperBound : max;
+        }
+    }
+    return max;
+}
+
+std::shared_ptr<AggregatedCounter> MetricAggregator::getCounter(
+    const std::string& programName,
+    const std::string& sourceName,
+    const std::string& dataPointName) {
+    if (programName.empty() || sourceName.empty() || dataPointName.empty()) {
+        AACE_ERROR(LX(TAG).m("Invalid counter name").d("program", programName).d("source", sourceName));
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& counter = m_aggregates[std::make_pair(programName, sourceName)].counters[dataPointName];
+    if (counter == nullptr) {
+        counter = std::make_shared<AggregatedCounter>();
+    }
+    return counter;
+}
+
+std::shared_ptr<AggregatedTimer> MetricAggregator::getTimer(
+    const std::string& programName,
+    const std::string& sourceName,
+    const std::string& dataPointName) {
+    if (programName.empty() || sourceName.empty() || dataPointName.empty()) {
+        AACE_ERROR(LX(TAG).m("Invalid timer name").d("program", programName).d("source", sourceName));
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& timer = m_aggregates[std::make_pair(programName, sourceName)].timers[dataPointName];
+    if (timer == nullptr) {
+        timer = std::make_shared<AggregatedTimer>();
+    }
+    return timer;
+}
+
+std::vector<MetricEvent> MetricAggregator::collect() {
+    std::vector<MetricEvent> metricEvents;
+    auto timestamp = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& source : m_aggregates) {
+        std::unordered_map<std::string, DataPoint> dataPoints;
+        for (auto& counter : source.second.counters) {
+            auto value = counter.second->collect();
+            if (value != 0) {
+                dataPoints.emplace(counter.first, DataPoint(counter.first, value, DataType::COUNTER));
+            }
+        }
+        for (auto& timer : source.second.timers) {
+            auto snapshot = timer.second->collect();
+            if (snapshot.count == 0) {
+                continue;
+            }
+            const std::string& name = timer.first;
+            auto sampleCount = static_cast<uint32_t>(snapshot.count);
+            dataPoints.emplace(name, DataPoint(name, snapshot.sum / snapshot.count, DataType::DURATION, sampleCount));
+            dataPoints.emplace(
+                name + SUFFIX_P50, DataPoint(name + SUFFIX_P50, snapshot.getPercentile(50), DataType::DURATION));
+            dataPoints.emplace(
+                name + SUFFIX_P90, DataPoint(name + SUFFIX_P90, snapshot.getPercentile(90), DataType::DURATION));
+            dataPoints.emplace(
+                name + SUFFIX_P99, DataPoint(name + SUFFIX_P99, snapshot.getPercentile(99), DataType::DURATION));
+            dataPoints.emplace(name + SUFFIX_MAX, DataPoint(name + SUFFIX_MAX, snapshot.max, DataType::DURATION));
+        }
+        if (dataPoints.empty()) {
+            continue;
+        }
+        MetricContext context(
+            aace::engine::utils::agent::AGENT_ID_NONE, Priority::NORMAL, BufferType::NO_BUFFER, IdentityType::NORMAL);
+        metricEvents.emplace_back(
+            source.first.first, source.first.second, std::move(context), std::move(dataPoints), timestamp);
+    }
+    return metricEvents;
+}
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
@@ -36,6 +36,19 @@ MetricEvent::MetricEvent(
         m_timestamp{timestamp} {
 }
 
+MetricEvent::MetricEvent(
+    const std::string& programName,
+    const std::string& sourceName,
+    MetricContext metricContext,
+    std::unordered_map<std::string, DataPoint>&& dataPoints,
+    std::chrono::steady_clock::time_point timestamp) :
+        m_programName{programName},
+        m_sourceName{sourceName},
+        m_metricContext{std::move(metricContext)},
+        m_dataPoints{std::move(dataPoints)},
+        m_timestamp{timestamp} {
+}
+
 std::string MetricEvent::getProgramName() const {
     return m_programName;
 }
@@ -59,12 +72,17 @@ DataPoint MetricEvent::getDataPoint(const std::string& name, DataType dataType)
 
 std::vector<DataPoint> MetricEvent::getDataPoints() const {
     std::vector<DataPoint> dataPoints;
+    dataPoints.reserve(m_dataPoints.size());
     for (const auto& entry : m_dataPoints) {
         dataPoints.push_back(entry.second);
     }
     return dataPoints;
 }
 
+const std::unordered_map<std::string, DataPoint>& MetricEvent::getDataPointMap() const {
+    return m_dataPoints;
+}
+
 std::chrono::system_clock::time_point MetricEvent::getSystemClockTimestamp() const {
     return std::chrono::system_clock::now() - std::chrono::duration_cast<std::chrono::system_clock::duration>(
                                                   std::chrono::steady_clock::now() - m_timestamp);
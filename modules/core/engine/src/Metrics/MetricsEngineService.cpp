@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 #include <iomanip>
+#include <map>
 #include <sstream>
 #include <stdexcept>
 
@@ -29,6 +30,7 @@
 #include <AACE/Engine/Metrics/MetricsEngineService.h>
 #include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
 #include <AACE/Engine/Utils/Agent/AgentId.h>
+#include <AACE/Engine/Utils/String/StringUtils.h>
 #include <AACE/Engine/Vehicle/VehicleConfigServiceInterface.h>
 
 #include <nlohmann/json.hpp>
@@ -57,6 +59,27 @@ static const std::string KEY_UPLOAD_RULES("uploadRules");
 static const std::string KEY_GROUP_ID("groupId");
 static const std::string KEY_SCHEMA_ID("schemaId");
 static const std::string KEY_BUILD_TYPE("buildType");
+static const std::string KEY_AGGREGATION_PERIOD("aggregationPeriodSeconds");
+static const std::string KEY_TRACING("tracing");
+static const std::string KEY_TRACING_ENABLED("enabled");
+static const std::string KEY_TRACING_BUFFER_SIZE("bufferSize");
+static const std::string KEY_TRACING_FILE_PATH("traceFilePath");
+static const std::string KEY_TRACING_HISTOGRAMS("histograms");
+
+/// The default period in seconds between flushes of aggregated metrics
+static constexpr unsigned int DEFAULT_AGGREGATION_PERIOD_SECONDS = 60;
+
+/// How long a flush of aggregated metrics may be delayed to coalesce it with other timers
+static const std::chrono::seconds AGGREGATION_TIMER_SLACK(5);
+
+/// The program name of the aggregated timers of trace spans
+static const std::string TRACING_PROGRAM("AlexaAutoSDK");
+
+/// The prefix of the source name of the aggregated timers of trace spans, followed by the span category
+static const std::string TRACING_SOURCE_PREFIX("Tracing.");
+
+/// Distinguishes the instances of the service in the per-thread caches of trace span timers
+static std::atomic<uint64_t> s_traceGeneration{0};
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("aace.engine.metrics.MetricsEngineService");
@@ -65,7 +88,11 @@ static const std::string TAG("aace.engine.metrics.MetricsEngineService");
 REGISTER_SERVICE(MetricsEngineService);
 
 MetricsEngineService::MetricsEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_executor{aace::engine::utils::threading::TaskPriority::LOW},
+        m_aggregationPeriodSeconds{DEFAULT_AGGREGATION_PERIOD_SECONDS},
+        m_aggregationTimer{AGGREGATION_TIMER_SLACK},
+        m_traceGeneration{++s_traceGeneration} {
 }
 
 bool MetricsEngineService::configure(std::shared_ptr<std::istream> configuration) {
@@ -189,6 +216,27 @@ bool MetricsEngineService::configure(std::shared_ptr<std::istream> configuration
             }
         }
 
+        if (config.contains(KEY_AGGREGATION_PERIOD)) {
+            int aggregationPeriod = config.at(KEY_AGGREGATION_PERIOD);
+            ThrowIf(aggregationPeriod <= 0, "Value must be a positive integer. Key=" + KEY_AGGREGATION_PERIOD);
+            m_aggregationPeriodSeconds = static_cast<unsigned int>(aggregationPeriod);
+        }
+
+        bool tracingEnabled = false;
+        bool traceHistograms = true;
+        if (config.contains(KEY_TRACING)) {
+            const json& tracing = config.at(KEY_TRACING);
+            ThrowIfNot(tracing.is_object(), "Value must be an object. Key=" + KEY_TRACING);
+            tracingEnabled = tracing.value(KEY_TRACING_ENABLED, false);
+            traceHistograms = tracing.value(KEY_TRACING_HISTOGRAMS, true);
+            m_traceFilePath = tracing.value(KEY_TRACING_FILE_PATH, "");
+            if (tracing.contains(KEY_TRACING_BUFFER_SIZE)) {
+                int bufferSize = tracing.at(KEY_TRACING_BUFFER_SIZE);
+                ThrowIf(bufferSize <= 0, "Value must be a positive integer. Key=" + KEY_TRACING_BUFFER_SIZE);
+                aace::engine::utils::tracing::Tracer::setBufferSize(static_cast<size_t>(bufferSize));
+            }
+        }
+
         std::string buildType = DIMENSION_VALUE_BUILD_TYPE_RELEASE;
         if (config.contains(KEY_BUILD_TYPE)) {
             buildType = config.at(KEY_BUILD_TYPE);
@@ -198,6 +246,32 @@ bool MetricsEngineService::configure(std::shared_ptr<std::istream> configuration
         ThrowIfNot(
             populateCommonDimensions(deviceIdTag, buildType), "Failed to populate values for common metric dimensions");
 
+        auto propertyManager =
+            getContext()->getServiceInterface<aace::engine::propertyManager::PropertyManagerServiceInterface>(
+                "aace.propertyManager");
+        ThrowIfNull(propertyManager, "PropertyManager is null");
+        propertyManager->registerProperty(aace::engine::propertyManager::PropertyDescription(
+            aace::core::property::TRACING_ENABLED,
+            std::bind(
+                &MetricsEngineService::setProperty_tracingEnabled,
+                this,
+                std::placeholders::_1,
+                std::placeholders::_2,
+                std::placeholders::_3,
+                std::placeholders::_4),
+            std::bind(&MetricsEngineService::getProperty_tracingEnabled, this)));
+
+        if (traceHistograms) {
+            std::weak_ptr<MetricsEngineService> wp = shared_from_this();
+            aace::engine::utils::tracing::Tracer::setSpanObserver(
+                [wp](const char* category, const char* name, aace::engine::utils::tracing::Tracer::Clock::duration d) {
+                    if (auto sp = wp.lock()) {
+                        sp->recordTraceSpan(category, name, d);
+                    }
+                });
+        }
+        aace::engine::utils::tracing::Tracer::setEnabled(tracingEnabled);
+
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).m("Failed to parse configuration").d("reason", ex.what()));
         return false;
@@ -211,6 +285,15 @@ bool MetricsEngineService::configure(std::shared_ptr<std::istream> configuration
         AACE_ERROR(LX(TAG, "Failed to register MetricsEngineService as MetricsConfigServiceInterface"));
         return false;
     }
+    if (!registerServiceInterface<MetricAggregatorServiceInterface>(shared_from_this())) {
+        AACE_ERROR(LX(TAG, "Failed to register MetricsEngineService as MetricAggregatorServiceInterface"));
+        return false;
+    }
+    return true;
+}
+
+bool MetricsEngineService::isConcurrentLifecycleSafe() {
+    // start and stop only drive the aggregation timer, whose flush already runs concurrently with other services
     return true;
 }
 
@@ -264,8 +347,25 @@ bool MetricsEngineService::preRegister() {
     return true;
 }
 
+bool MetricsEngineService::start() {
+    AACE_DEBUG(LX(TAG).d("aggregationPeriodSeconds", m_aggregationPeriodSeconds));
+    std::chrono::seconds period(m_aggregationPeriodSeconds);
+    m_aggregationTimer.start(
+        period,
+        aace::engine::utils::timing::Timer::PeriodType::ABSOLUTE,
+        aace::engine::utils::timing::Timer::FOREVER,
+        std::bind(&MetricsEngineService::flushAggregatedMetrics, this));
+    return true;
+}
+
 bool MetricsEngineService::stop() {
     AACE_DEBUG(LX(TAG));
+    if (aace::engine::utils::tracing::Tracer::isEnabled()) {
+        writeTraceFile();
+    }
+    m_aggregationTimer.stop();
+    flushAggregatedMetrics();
+    m_executor.waitForSubmittedTasks();
     std::lock_guard<std::mutex> lock(m_processorsMutex);
     for (const auto& processor : m_metricProcessors) {
         processor.second->dispatcher->prepareForShutdown();
@@ -275,6 +375,8 @@ bool MetricsEngineService::stop() {
 
 bool MetricsEngineService::shutdown() {
     AACE_DEBUG(LX(TAG));
+    aace::engine::utils::tracing::Tracer::setEnabled(false);
+    aace::engine::utils::tracing::Tracer::setSpanObserver(nullptr);
     m_executor.waitForSubmittedTasks();
     std::lock_guard<std::mutex> lock(m_processorsMutex);
     for (const auto& processor : m_metricProcessors) {
@@ -303,49 +405,135 @@ bool dispatchIfAllowedLocked(const MetricEvent& metricEvent, const MetricProcess
 }
 
 void MetricsEngineService::recordMetric(const MetricEvent& metricEvent) {
-    m_executor.submit([this, metricEvent] {
-        std::lock_guard<std::mutex> lock(m_processorsMutex);
-        auto context = metricEvent.getMetricContext();
-        auto agentId = context.getAgentId();
-        if (m_metricProcessors.empty()) {
-            AACE_WARN(LX(TAG, "recordMetricExec")
-                          .m("Metric service is not initialized; dropping metric")
-                          .d("agentId", agentId));
-            return;
-        }
+    m_executor.submit([this, metricEvent] { recordMetricExec(metricEvent); });
+}
 
-        if (agentId == aace::engine::utils::agent::AGENT_ID_ALL) {
-            for (const auto& processor : m_metricProcessors) {
-                dispatchIfAllowedLocked(metricEvent, *(processor.second));
-            }
-            return;
-        }
+void MetricsEngineService::recordMetric(MetricEvent&& metricEvent) {
+    // Hold the event by pointer so the executor task does not copy its data points
+    auto event = std::make_shared<MetricEvent>(std::move(metricEvent));
+    m_executor.submit([this, event] { recordMetricExec(*event); });
+}
 
-        if (agentId == aace::engine::utils::agent::AGENT_ID_NONE) {
-            // Metric is not associated with an agent or the agent is not available.
-            // Submit the metric to the processor for every agent if allowed by the
-            // agent's filter
-            for (const auto& processor : m_metricProcessors) {
-                dispatchIfAllowedLocked(metricEvent, *(processor.second));
-            }
-            return;
+void MetricsEngineService::recordMetricExec(const MetricEvent& metricEvent) {
+    std::lock_guard<std::mutex> lock(m_processorsMutex);
+    const auto& context = metricEvent.getMetricContext();
+    auto agentId = context.getAgentId();
+    if (m_metricProcessors.empty()) {
+        AACE_WARN(LX(TAG, "recordMetricExec")
+                      .m("Metric service is not initialized; dropping metric")
+                      .d("agentId", agentId));
+        return;
+    }
+
+    if (agentId == aace::engine::utils::agent::AGENT_ID_ALL) {
+        for (const auto& processor : m_metricProcessors) {
+            dispatchIfAllowedLocked(metricEvent, *(processor.second));
         }
-        // Agent is known and tagged. Submit the metric to the processor of the
-        // right agent
-        auto processor = m_metricProcessors.find(agentId);
-        if (processor == m_metricProcessors.end()) {
-            AACE_WARN(LX(TAG).m("No metric processor for agent ID; dropping metric").d("agentId", agentId));
-            return;
+        return;
+    }
+
+    if (agentId == aace::engine::utils::agent::AGENT_ID_NONE) {
+        // Metric is not associated with an agent or the agent is not available.
+        // Submit the metric to the processor for every agent if allowed by the
+        // agent's filter
+        for (const auto& processor : m_metricProcessors) {
+            dispatchIfAllowedLocked(metricEvent, *(processor.second));
         }
-        bool passedFilter = dispatchIfAllowedLocked(metricEvent, *(processor->second));
-        if (!passedFilter) {
-            AACE_WARN(LX(TAG, "recordMetricExec")
-                          .m("Explicitly tagged metric not allowed by metrics filter")
-                          .d("agentId", agentId)
-                          .d("program", metricEvent.getProgramName())
-                          .d("source", metricEvent.getSourceName()));
+        return;
+    }
+    // Agent is known and tagged. Submit the metric to the processor of the
+    // right agent
+    auto processor = m_metricProcessors.find(agentId);
+    if (processor == m_metricProcessors.end()) {
+        AACE_WARN(LX(TAG).m("No metric processor for agent ID; dropping metric").d("agentId", agentId));
+        return;
+    }
+    bool passedFilter = dispatchIfAllowedLocked(metricEvent, *(processor->second));
+    if (!passedFilter) {
+        AACE_WARN(LX(TAG, "recordMetricExec")
+                      .m("Explicitly tagged metric not allowed by metrics filter")
+                      .d("agentId", agentId)
+                      .d("program", metricEvent.getProgramName())
+                      .d("source", metricEvent.getSourceName()));
+    }
+}
+
+void MetricsEngineService::flushAggregatedMetrics() {
+    auto metricEvents = m_aggregator.collect();
+    AACE_DEBUG(LX(TAG).d("numAggregatedMetrics", metricEvents.size()));
+    for (auto& metricEvent : metricEvents) {
+        recordMetric(std::move(metricEvent));
+    }
+}
+
+std::shared_ptr<AggregatedCounter> MetricsEngineService::getAggregatedCounter(
+    const std::string& programName,
+    const std::string& sourceName,
+    const std::string& dataPointName) {
+    return m_aggregator.getCounter(programName, sourceName, dataPointName);
+}
+
+std::shared_ptr<AggregatedTimer> MetricsEngineService::getAggregatedTimer(
+    const std::string& programName,
+    const std::string& sourceName,
+    const std::string& dataPointName) {
+    return m_aggregator.getTimer(programName, sourceName, dataPointName);
+}
+
+void MetricsEngineService::recordTraceSpan(
+    const char* category,
+    const char* name,
+    aace::engine::utils::tracing::Tracer::Clock::duration duration) {
+    // Cache the timers per thread so recording a span does not contend on the aggregator
+    using TimerKey = std::pair<const char*, const char*>;
+    thread_local std::map<TimerKey, std::shared_ptr<AggregatedTimer>> t_timers;
+    thread_local uint64_t t_generation = 0;
+    if (t_generation != m_traceGeneration) {
+        t_timers.clear();
+        t_generation = m_traceGeneration;
+    }
+
+    auto key = std::make_pair(category, name);
+    auto it = t_timers.find(key);
+    if (it == t_timers.end()) {
+        it = t_timers.emplace(key, m_aggregator.getTimer(TRACING_PROGRAM, TRACING_SOURCE_PREFIX + category, name))
+                 .first;
+    }
+    if (it->second != nullptr) {
+        it->second->record(std::chrono::duration_cast<std::chrono::milliseconds>(duration));
+    }
+}
+
+void MetricsEngineService::writeTraceFile() {
+    if (!m_traceFilePath.empty()) {
+        aace::engine::utils::tracing::Tracer::writeChromeTrace(m_traceFilePath);
+    }
+}
+
+bool MetricsEngineService::setProperty_tracingEnabled(
+    const std::string& value,
+    bool& changed,
+    bool& async,
+    const aace::engine::propertyManager::PropertyDescription::SetterCallback& callbackFunction) {
+    try {
+        AACE_INFO(LX(TAG).d("value", value));
+        bool enabled = aace::engine::utils::string::equal(value, "true", false);
+        ThrowIfNot(enabled || aace::engine::utils::string::equal(value, "false", false), "invalidValue");
+        ReturnIf(enabled == aace::engine::utils::tracing::Tracer::isEnabled(), true);
+        aace::engine::utils::tracing::Tracer::setEnabled(enabled);
+        if (!enabled) {
+            writeTraceFile();
         }
-    });
+        changed = true;
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+std::string MetricsEngineService::getProperty_tracingEnabled() {
+    return aace::engine::utils::tracing::Tracer::isEnabled() ? "true" : "false";
 }
 
 void MetricsEngineService::processInboundSubmitMessage(const aace::engine::messageBroker::Message& message) {
@@ -380,21 +568,18 @@ void MetricsEngineService::processInboundSubmitMessage(const aace::engine::messa
                     std::string type = datapointJson["type"];
                     ThrowIf(type.empty(), "Data point has empty type");
                     DataType dataType = dataTypeFromString(type);
-                    std::string valueStr;
                     if (dataType == DataType::STRING) {
-                        valueStr = datapointJson["value"];
+                        std::string valueStr = datapointJson["value"];
                         ThrowIf(valueStr.empty(), "String data point has empty value");
+                        builder.addDataPoint(DataPoint(name, valueStr, dataType));
                     } else if (dataType == DataType::COUNTER) {
                         uint32_t value = datapointJson["value"];
-                        valueStr = std::to_string(value);
-                        ThrowIf(valueStr.empty(), "Counter data point has empty value");
+                        builder.addDataPoint(DataPoint(name, static_cast<uint64_t>(value), dataType));
                     } else if (dataType == DataType::DURATION) {
-                        uint64_t value = datapointJson["value"];
-                        valueStr = std::to_string(value);
-                        ThrowIf(valueStr.empty(), "Duration data point has empty value");
+                        int64_t value = datapointJson["value"];
+                        ThrowIf(value < 0, "Duration data point has negative value");
+                        builder.addDataPoint(DataPoint(name, static_cast<uint64_t>(value), dataType));
                     }
-                    DataPoint dataPoint(name, valueStr, dataType);
-                    builder.addDataPoint(dataPoint);
                 }
                 AgentIdType agentId = aace::engine::utils::agent::AGENT_ID_ALEXA;
                 Priority priority = Priority::NORMAL;
@@ -78,6 +78,18 @@ bool PropertyManagerEngineImpl::onSetProperty(const std::string& name, const std
     }
 }
 
+bool PropertyManagerEngineImpl::onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) {
+    try {
+        auto m_propertyManagerServiceInterface_lock = m_propertyManagerServiceInterface.lock();
+        ThrowIfNull(m_propertyManagerServiceInterface_lock, "invalidPropertyManagerServiceInterfaceInstance");
+        ThrowIfNot(m_propertyManagerServiceInterface_lock->setProperties(properties, true), "setPropertiesFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 std::string PropertyManagerEngineImpl::onGetProperty(const std::string& name) {
     try {
         auto m_propertyManagerServiceInterface_lock = m_propertyManagerServiceInterface.lock();
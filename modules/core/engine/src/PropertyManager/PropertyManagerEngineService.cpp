@@ -47,6 +47,11 @@ bool PropertyManagerEngineService::initialize() {
         return false;
     }
 }
+
+bool PropertyManagerEngineService::isConcurrentLifecycleSafe() {
+    // properties are registered before setup, so there is nothing to set up, start or stop
+    return true;
+}
 bool PropertyManagerEngineService::registerPlatformInterface(
     std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
     try {
@@ -134,8 +139,48 @@ bool PropertyManagerEngineService::setProperty(
         auto it = m_propertyDescriptionMap.find(name);
         ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
         ThrowIfNull(it->second.setter(), "readOnlyProperty");
-        auto setterResult = m_executor.submit([this, name, value, it, fromPlatform] {
+
+        std::shared_ptr<PendingSet> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            auto pendingIt = m_pendingSets.find(name);
+            if (pendingIt != m_pendingSets.end() && pendingIt->second->fromPlatform == fromPlatform) {
+                // a set of the property is still queued, so replace its value instead of queuing another set
+                if (fromPlatform) {
+                    pendingIt->second->supersededValues.push_back(pendingIt->second->value);
+                }
+                pendingIt->second->value = value;
+                return true;
+            }
+            pending = std::make_shared<PendingSet>();
+            pending->value = value;
+            pending->fromPlatform = fromPlatform;
+            m_pendingSets[name] = pending;
+        }
+
+        auto setterResult = m_executor.submit([this, name, it, pending] {
             try {
+                std::string value;
+                std::vector<std::string> supersededValues;
+                {
+                    std::lock_guard<std::mutex> lock(m_pendingMutex);
+                    auto pendingIt = m_pendingSets.find(name);
+                    if (pendingIt != m_pendingSets.end() && pendingIt->second == pending) {
+                        m_pendingSets.erase(pendingIt);
+                    }
+                    value = pending->value;
+                    supersededValues = std::move(pending->supersededValues);
+                }
+                auto fromPlatform = pending->fromPlatform;
+
+                // the superseded values are never applied, whatever the result of the latest value
+                if (!supersededValues.empty() && m_propertyManagerEngineImpl != nullptr) {
+                    using PropertyState = aace::propertyManager::PropertyManagerEngineInterface::PropertyState;
+                    for (auto& supersededValue : supersededValues) {
+                        m_propertyManagerEngineImpl->propertyStateChanged(name, supersededValue, PropertyState::FAILED);
+                    }
+                }
+
                 bool changed = false;
                 bool async = false;
                 auto callback = [fromPlatform, this](
@@ -165,6 +210,137 @@ bool PropertyManagerEngineService::setProperty(
     }
 }
 
+bool PropertyManagerEngineService::setProperties(
+    const std::vector<std::pair<std::string, std::string>>& properties,
+    const bool& fromPlatform) {
+    try {
+        if (isRunning() == false) {
+            AACE_WARN(LX(TAG).d("reason", "setPropertiesCalledWhileEngineNotRunning"));
+        }
+        ThrowIf(properties.empty(), "emptyProperties");
+        std::vector<PropertyDescription> descriptions;
+        for (auto& property : properties) {
+            ThrowIf(property.first.empty(), "invalidPropertyName");
+            auto it = m_propertyDescriptionMap.find(property.first);
+            ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound:" + property.first);
+            ThrowIfNull(it->second.setter(), "readOnlyProperty:" + property.first);
+            descriptions.push_back(it->second);
+        }
+
+        {
+            // sets queued before the batch are applied before it, so they must not take a value set after it
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            for (auto& property : properties) {
+                m_pendingSets.erase(property.first);
+            }
+        }
+
+        m_executor.submit([this, properties, descriptions, fromPlatform] {
+            return applyProperties(properties, descriptions, fromPlatform);
+        });
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("count", properties.size()));
+        return false;
+    }
+}
+
+bool PropertyManagerEngineService::applyProperties(
+    const std::vector<std::pair<std::string, std::string>>& properties,
+    const std::vector<PropertyDescription>& descriptions,
+    bool fromPlatform) {
+    // a property set by the batch, with the value to restore if the batch fails
+    struct AppliedProperty {
+        size_t index;
+        bool changed;
+        bool async;
+        std::string previousValue;
+    };
+    std::vector<AppliedProperty> applied;
+    bool succeeded = true;
+
+    for (size_t index = 0; index < properties.size(); index++) {
+        auto& name = properties[index].first;
+        try {
+            auto previousValue = descriptions[index].getter()();
+            bool changed = false;
+            bool async = false;
+            auto callback = [fromPlatform, this](
+                                const std::string& name, const std::string& value, const std::string& state) {
+                setPropertyResultCallback(name, value, fromPlatform, state);
+            };
+            ThrowIfNot(descriptions[index].setter()(properties[index].second, changed, async, callback), "setFailed");
+            applied.push_back({index, changed, async, previousValue});
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
+            succeeded = false;
+            break;
+        }
+    }
+
+    if (!succeeded) {
+        // restore the properties already set by the batch, in reverse order. Asynchronous
+        // setters report their result through the callback and cannot be restored.
+        auto ignoreResult = [](const std::string&, const std::string&, const std::string&) {};
+        for (auto it = applied.rbegin(); it != applied.rend(); it++) {
+            if (it->changed && !it->async) {
+                bool changed = false;
+                bool async = false;
+                auto& name = properties[it->index].first;
+                auto restored = descriptions[it->index].setter()(it->previousValue, changed, async, ignoreResult);
+                if (!restored) {
+                    AACE_WARN(LX(TAG).d("reason", "restorePropertyFailed").d("name", name));
+                }
+            }
+        }
+        if (m_propertyManagerEngineImpl != nullptr) {
+            for (size_t index = 0; index < properties.size(); index++) {
+                // asynchronous setters which accepted their value report the result through the callback
+                auto async = std::any_of(applied.begin(), applied.end(), [index](const AppliedProperty& property) {
+                    return property.index == index && property.async;
+                });
+                if (!async) {
+                    handleSetFailed(fromPlatform, properties[index].first, properties[index].second);
+                }
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::pair<std::string, std::string>> changes;
+    for (auto& property : applied) {
+        // asynchronous setters report their result through the callback
+        if (property.async) {
+            continue;
+        }
+        auto& name = properties[property.index].first;
+        auto& value = properties[property.index].second;
+        if (m_propertyManagerEngineImpl != nullptr) {
+            if (fromPlatform) {
+                m_propertyManagerEngineImpl->propertyStateChanged(
+                    name, value, aace::propertyManager::PropertyManagerEngineInterface::PropertyState::SUCCEEDED);
+            } else if (property.changed) {
+                m_propertyManagerEngineImpl->handlePropertyChanged(name, value);
+            }
+        }
+        if (property.changed) {
+            // a property set more than once in the batch is notified with its last value
+            auto change = std::find_if(
+                changes.begin(), changes.end(), [&name](const std::pair<std::string, std::string>& change) {
+                    return change.first == name;
+                });
+            if (change != changes.end()) {
+                change->second = value;
+            } else {
+                changes.emplace_back(name, value);
+            }
+        }
+    }
+    notifyPropertyChangeListeners(changes);
+
+    return true;
+}
+
 void PropertyManagerEngineService::handleSetSuccess(
     const bool& changed,
     const bool& fromPlatform,
@@ -255,6 +431,43 @@ void PropertyManagerEngineService::notifyPropertyChangeListeners(
     }
 }
 
+void PropertyManagerEngineService::notifyPropertyChangeListeners(
+    const std::vector<std::pair<std::string, std::string>>& changes) {
+    try {
+        // group the changes by listener, so each listener is notified once for the batch
+        std::vector<
+            std::pair<std::shared_ptr<PropertyListenerInterface>, std::vector<std::pair<std::string, std::string>>>>
+            notifications;
+        {
+            std::lock_guard<std::mutex> lock(m_listenerMutex);
+            for (auto& change : changes) {
+                auto it = m_propertyListenerMap.find(change.first);
+                if (it == m_propertyListenerMap.end()) {
+                    continue;
+                }
+                for (auto& listener : it->second) {
+                    auto notification = std::find_if(
+                        notifications.begin(),
+                        notifications.end(),
+                        [&listener](const decltype(notifications)::value_type& notification) {
+                            return notification.first == listener;
+                        });
+                    if (notification != notifications.end()) {
+                        notification->second.push_back(change);
+                    } else {
+                        notifications.emplace_back(listener, std::vector<std::pair<std::string, std::string>>{change});
+                    }
+                }
+            }
+        }
+        for (auto& notification : notifications) {
+            notification.first->propertiesChanged(notification.second);
+        }
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("count", changes.size()));
+    }
+}
+
 void PropertyManagerEngineService::updatePropertyValue(const std::string& name, const std::string& newValue) {
     try {
         if (isRunning() == false) {
@@ -280,6 +493,10 @@ bool PropertyManagerEngineService::shutdown() {
         m_propertyManagerEngineImpl.reset();
     }
     m_executor.shutdown();
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_pendingSets.clear();
+    }
     m_propertyListenerMap.clear();
     m_propertyDescriptionMap.clear();
     return true;
@@ -62,6 +62,11 @@ bool StorageEngineService::configure(std::shared_ptr<std::istream> configuration
     }
 }
 
+bool StorageEngineService::isConcurrentLifecycleSafe() {
+    // the local storage is opened in configure(), so there is nothing to set up, start or stop
+    return true;
+}
+
 }  // namespace storage
 }  // namespace engine
 }  // namespace aace
@@ -379,6 +379,64 @@ std::shared_ptr<rapidjson::Document> parse(const std::string& value, rapidjson::
     }
 }
 
+static void copyValue(const Value& from, rapidjson::Value& into, rapidjson::Document::AllocatorType& allocator) {
+    switch (from.type()) {
+        case Type::object:
+            into.SetObject();
+            for (auto it = from.begin(); it != from.end(); it++) {
+                rapidjson::Value key(it.key().c_str(), static_cast<rapidjson::SizeType>(it.key().size()), allocator);
+                rapidjson::Value value;
+                copyValue(it.value(), value, allocator);
+                into.AddMember(key, value, allocator);
+            }
+            break;
+        case Type::array:
+            into.SetArray();
+            into.Reserve(static_cast<rapidjson::SizeType>(from.size()), allocator);
+            for (auto& next : from) {
+                rapidjson::Value value;
+                copyValue(next, value, allocator);
+                into.PushBack(value, allocator);
+            }
+            break;
+        case Type::string: {
+            auto& str = from.get_ref<const std::string&>();
+            into.SetString(str.c_str(), static_cast<rapidjson::SizeType>(str.size()), allocator);
+            break;
+        }
+        case Type::boolean:
+            into.SetBool(from.get<bool>());
+            break;
+        case Type::number_integer:
+            into.SetInt64(from.get<int64_t>());
+            break;
+        case Type::number_unsigned:
+            into.SetUint64(from.get<uint64_t>());
+            break;
+        case Type::number_float:
+            into.SetDouble(from.get<double>());
+            break;
+        default:
+            into.SetNull();
+            break;
+    }
+}
+
+std::shared_ptr<rapidjson::Document> toDocument(const Value& root, rapidjson::Type type) {
+    try {
+        auto document = std::make_shared<rapidjson::Document>();
+
+        // build the document from the parsed value without serializing it
+        copyValue(root, *document, document->GetAllocator());
+        ThrowIfNot(document->GetType() == type, "invalidDocumentType");
+
+        return document;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "toDocument").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
 std::string toString(const rapidjson::Document& document, bool prettyPrint) {
     rapidjson::StringBuffer buffer;
     if (prettyPrint) {
@@ -20,9 +20,13 @@ namespace engine {
 namespace utils {
 namespace threading {
 
-Executor::Executor() :
-        m_taskQueue{std::make_shared<TaskQueue>()},
-        m_taskThread{std::unique_ptr<TaskThread>(new TaskThread(m_taskQueue))} {
+Executor::Executor() : Executor(TaskPriority::NORMAL) {
+}
+
+Executor::Executor(TaskPriority defaultPriority, std::chrono::milliseconds starvationThreshold) :
+        m_defaultPriority{defaultPriority},
+        m_taskQueue{std::make_shared<TaskQueue>(starvationThreshold)},
+        m_taskThread{std::unique_ptr<TaskThread>(new TaskThread(m_taskQueue, defaultPriority))} {
     m_taskThread->start();
 }
 
@@ -34,7 +38,8 @@ void Executor::waitForSubmittedTasks() {
     std::promise<void> flushedPromise;
     auto flushedFuture = flushedPromise.get_future();
     auto task = [&flushedPromise]() { flushedPromise.set_value(); };
-    submit(task);
+    // the lowest priority task runs after every task queued before it
+    submit(TaskPriority::LOW, task);
     flushedFuture.get();
 }
 
@@ -47,6 +52,10 @@ bool Executor::isShutdown() {
     return m_taskQueue->isShutdown();
 }
 
+TaskPriority Executor::getDefaultPriority() const {
+    return m_defaultPriority;
+}
+
 }  // namespace threading
 }  // namespace utils
 }  // namespace engine
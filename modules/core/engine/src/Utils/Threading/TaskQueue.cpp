@@ -14,37 +14,84 @@
  */
 
 #include <AACE/Engine/Utils/Threading/TaskQueue.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace threading {
 
-TaskQueue::TaskQueue() : m_shutdown{false} {
+/// The names of the queue latency observations, indexed by @c TaskPriority.
+static const char* QUEUE_LATENCY_NAMES[TaskQueue::NUM_PRIORITIES] = {"QueueLatency.Low",
+                                                                     "QueueLatency.Normal",
+                                                                     "QueueLatency.High",
+                                                                     "QueueLatency.Critical"};
+
+constexpr std::chrono::milliseconds TaskQueue::DEFAULT_STARVATION_THRESHOLD;
+constexpr size_t TaskQueue::NUM_PRIORITIES;
+
+TaskQueue::TaskQueue(std::chrono::milliseconds starvationThreshold) :
+        m_starvationThreshold{starvationThreshold}, m_shutdown{false} {
 }
 
 std::unique_ptr<std::function<void()>> TaskQueue::pop() {
     std::unique_lock<std::mutex> queueLock{m_queueMutex};
 
-    auto shouldNotWait = [this]() { return m_shutdown || !m_queue.empty(); };
+    auto shouldNotWait = [this]() { return m_shutdown || hasTasksLocked(); };
 
     if (!shouldNotWait()) {
         m_queueChanged.wait(queueLock, shouldNotWait);
     }
 
-    if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
+    if (hasTasksLocked()) {
+        auto index = nextQueueLocked();
+        auto& queue = m_queues[index];
+        auto queuedTask = std::move(queue.front());
+        queue.pop_front();
 
-        m_queue.pop_front();
-        return task;
+        if (tracing::Tracer::isEnabled()) {
+            tracing::Tracer::observe("Executor", QUEUE_LATENCY_NAMES[index], Clock::now() - queuedTask.queued);
+        }
+        return std::move(queuedTask.task);
     }
 
     return nullptr;
 }
 
+bool TaskQueue::hasTasksLocked() const {
+    for (auto& queue : m_queues) {
+        if (!queue.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t TaskQueue::nextQueueLocked() const {
+    // the highest class with queued tasks runs first
+    size_t highest = NUM_PRIORITIES - 1;
+    while (m_queues[highest].empty()) {
+        highest--;
+    }
+
+    // unless tasks have waited too long, in which case the task which waited the longest runs
+    size_t next = highest;
+    auto oldest = Clock::now() - m_starvationThreshold;
+    for (size_t index = highest + 1; index-- > 0;) {
+        auto& queue = m_queues[index];
+        if (!queue.empty() && queue.front().queued < oldest) {
+            oldest = queue.front().queued;
+            next = index;
+        }
+    }
+    return next;
+}
+
 void TaskQueue::shutdown() {
     std::lock_guard<std::mutex> queueLock{m_queueMutex};
-    m_queue.clear();
+    for (auto& queue : m_queues) {
+        queue.clear();
+    }
     m_shutdown = true;
     m_queueChanged.notify_all();
 }
@@ -13,14 +13,39 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Utils/Threading/TaskThread.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace threading {
 
-TaskThread::TaskThread(std::shared_ptr<TaskQueue> taskQueue) : m_taskQueue{taskQueue}, m_shutdown{false} {
+/// String to identify log entries originating from this file.
+static const std::string TAG("TaskThread");
+
+#ifdef __linux__
+/// The nice values of the executor threads relative to the process, indexed by @c TaskPriority.
+static const int THREAD_NICE_OFFSETS[TaskQueue::NUM_PRIORITIES] = {10, 0, -5, -10};
+
+/// The range of nice values accepted by the kernel.
+static const int MIN_NICE_VALUE = -20;
+static const int MAX_NICE_VALUE = 19;
+#endif
+
+TaskThread::TaskThread(std::shared_ptr<TaskQueue> taskQueue, TaskPriority priority) :
+        m_taskQueue{taskQueue}, m_priority{priority}, m_shutdown{false} {
 }
 
 TaskThread::~TaskThread() {
@@ -39,7 +64,39 @@ bool TaskThread::isShutdown() {
     return m_shutdown;
 }
 
+void TaskThread::applyThreadPriority() {
+#ifdef __linux__
+    // on Linux the nice value applies to the thread identified by its tid, and a new thread inherits the nice
+    // value of the thread that created it. The target is taken relative to the main thread so a NORMAL executor
+    // created from a task running on a LOW executor does not keep the lowered priority.
+    errno = 0;
+    auto processNice = getpriority(PRIO_PROCESS, static_cast<id_t>(getpid()));
+    if (processNice == -1 && errno != 0) {
+        AACE_WARN(LX(TAG).m("Unable to get process priority").d("reason", std::strerror(errno)));
+        return;
+    }
+    auto tid = static_cast<id_t>(syscall(SYS_gettid));
+    auto threadNice = getpriority(PRIO_PROCESS, tid);
+    auto nice = std::max(
+        MIN_NICE_VALUE,
+        std::min(MAX_NICE_VALUE, processNice + THREAD_NICE_OFFSETS[static_cast<size_t>(m_priority)]));
+    if (threadNice == nice) {
+        return;
+    }
+    if (setpriority(PRIO_PROCESS, tid, nice) != 0) {
+        // raising the priority requires CAP_SYS_NICE, so the thread keeps the inherited priority without it
+        AACE_WARN(LX(TAG)
+                      .m("Unable to set thread priority")
+                      .d("nice", nice)
+                      .d("inherited", threadNice)
+                      .d("reason", std::strerror(errno)));
+    }
+#endif
+}
+
 void TaskThread::processTasksLoop() {
+    applyThreadPriority();
+
     while (!m_shutdown) {
         auto m_actualTaskQueue = m_taskQueue.lock();
 
@@ -47,6 +104,7 @@ void TaskThread::processTasksLoop() {
             auto task = m_actualTaskQueue->pop();
 
             if (task) {
+                AACE_TRACE_SPAN("Executor", "RunTask");
                 task->operator()();
             }
         } else {
@@ -0,0 +1,66 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/Utils/Timing/ScheduledTimerDelegate.h"
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+ScheduledTimerDelegate::ScheduledTimerDelegate(
+    std::shared_ptr<TimerScheduler> scheduler,
+    std::chrono::nanoseconds slack) :
+        m_scheduler{std::move(scheduler)}, m_slack{slack}, m_running{false} {
+}
+
+ScheduledTimerDelegate::~ScheduledTimerDelegate() {
+    stop();
+}
+
+void ScheduledTimerDelegate::start(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    m_scheduler->cancel(m_entry);
+    m_running = true;
+    m_entry = m_scheduler->schedule(delay, period, periodType, maxCount, m_slack, task, [this]() {
+        m_running = false;
+    });
+}
+
+void ScheduledTimerDelegate::stop() {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    m_scheduler->cancel(m_entry);
+    m_entry.reset();
+    m_running = false;
+}
+
+bool ScheduledTimerDelegate::activate() {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    return !m_running.exchange(true);
+}
+
+bool ScheduledTimerDelegate::isActive() const {
+    return m_running;
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -15,6 +15,7 @@
 
 #include <memory>
 
+#include "AACE/Engine/Utils/Timing/ScheduledTimerDelegate.h"
 #include "AACE/Engine/Utils/Timing/Timer.h"
 
 namespace aace {
@@ -25,8 +26,14 @@ namespace timing {
 /// String to identify log entries originating from this file.
 static const std::string TAG(Timer::getTag());
 
-Timer::Timer() {
-    m_timer = std::unique_ptr<TimerDelegateInterface>(new TimerDelegate());
+Timer::Timer() : Timer(std::chrono::nanoseconds::zero()) {
+}
+
+Timer::Timer(std::chrono::nanoseconds slack, std::shared_ptr<TimerScheduler> scheduler) {
+    if (scheduler == nullptr) {
+        scheduler = TimerScheduler::getInstance();
+    }
+    m_timer = std::unique_ptr<TimerDelegateInterface>(new ScheduledTimerDelegate(scheduler, slack));
 }
 
 Timer::~Timer() {
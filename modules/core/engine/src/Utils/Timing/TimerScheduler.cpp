@@ -0,0 +1,252 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/Timing/TimerScheduler.h"
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerScheduler");
+
+struct TimerScheduler::Entry {
+    /// The task to call.
+    std::function<void()> task;
+
+    /// Called after the last task call.
+    std::function<void()> onFinished;
+
+    /// The time to wait between task calls.
+    std::chrono::nanoseconds period;
+
+    /// The type of period.
+    PeriodType periodType;
+
+    /// The desired number of task calls.
+    size_t maxCount;
+
+    /// The time by which a task call may be delayed.
+    std::chrono::nanoseconds slack;
+
+    /// The number of task calls made or skipped so far.
+    size_t count;
+
+    /// Whether the next call is skipped because a task call overran an @c ABSOLUTE period.
+    bool offSchedule;
+
+    /// Whether the entry was cancelled or finished.
+    bool cancelled;
+
+    /// The earliest time of the next task call.
+    Clock::time_point deadline;
+
+    /// The latest time of the next task call.
+    Clock::time_point latest;
+};
+
+/// Orders the heap of entries so the entry which must run first is at its front.
+static bool runsLater(
+    const std::shared_ptr<TimerScheduler::Entry>& lhs,
+    const std::shared_ptr<TimerScheduler::Entry>& rhs) {
+    return lhs->latest > rhs->latest;
+}
+
+std::shared_ptr<TimerScheduler> TimerScheduler::getInstance() {
+    static auto instance = new std::shared_ptr<TimerScheduler>(new TimerScheduler(false));
+    return *instance;
+}
+
+std::shared_ptr<TimerScheduler> TimerScheduler::createWithVirtualClock() {
+    return std::shared_ptr<TimerScheduler>(new TimerScheduler(true));
+}
+
+TimerScheduler::TimerScheduler(bool virtualClock) : m_virtualClock{virtualClock}, m_shutdown{false} {
+    if (!m_virtualClock) {
+        m_thread = std::thread(&TimerScheduler::run, this);
+    }
+}
+
+TimerScheduler::~TimerScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wakeTrigger.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+std::shared_ptr<TimerScheduler::Entry> TimerScheduler::schedule(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::chrono::nanoseconds slack,
+    std::function<void()> task,
+    std::function<void()> onFinished) {
+    auto entry = std::make_shared<Entry>();
+    entry->task = std::move(task);
+    entry->onFinished = std::move(onFinished);
+    entry->period = period;
+    entry->periodType = periodType;
+    entry->maxCount = maxCount;
+    entry->slack = std::max(slack, std::chrono::nanoseconds::zero());
+    entry->count = 0;
+    entry->offSchedule = false;
+    entry->cancelled = false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry->deadline = nowLocked() + delay;
+    entry->latest = entry->deadline + entry->slack;
+    pushLocked(entry);
+    if (m_queue.front() == entry) {
+        m_wakeTrigger.notify_one();
+    }
+    return entry;
+}
+
+void TimerScheduler::cancel(const std::shared_ptr<Entry>& entry) {
+    if (entry == nullptr) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    entry->cancelled = true;
+    auto it = std::find(m_queue.begin(), m_queue.end(), entry);
+    if (it != m_queue.end()) {
+        m_queue.erase(it);
+        std::make_heap(m_queue.begin(), m_queue.end(), runsLater);
+    }
+    // Wait for a running task call, unless the task is cancelling itself
+    m_taskCompleted.wait(lock, [this, &entry]() {
+        return m_runningEntry != entry || m_runningThread == std::this_thread::get_id();
+    });
+}
+
+TimerScheduler::Clock::time_point TimerScheduler::now() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return nowLocked();
+}
+
+TimerScheduler::Clock::time_point TimerScheduler::nowLocked() {
+    return m_virtualClock ? m_virtualNow : Clock::now();
+}
+
+bool TimerScheduler::advance(std::chrono::nanoseconds duration) {
+    if (!m_virtualClock) {
+        AACE_ERROR(LX(TAG).d("reason", "notVirtualClock"));
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto target = m_virtualNow + duration;
+    while (!m_queue.empty() && m_queue.front()->latest <= target) {
+        m_virtualNow = std::max(m_virtualNow, m_queue.front()->latest);
+        runDueLocked(lock, m_virtualNow);
+    }
+    m_virtualNow = std::max(m_virtualNow, target);
+    return true;
+}
+
+void TimerScheduler::pushLocked(const std::shared_ptr<Entry>& entry) {
+    m_queue.push_back(entry);
+    std::push_heap(m_queue.begin(), m_queue.end(), runsLater);
+}
+
+void TimerScheduler::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown) {
+        if (m_queue.empty()) {
+            m_wakeTrigger.wait(lock);
+        } else {
+            m_wakeTrigger.wait_until(lock, m_queue.front()->latest);
+        }
+        if (!m_shutdown) {
+            runDueLocked(lock, Clock::now());
+        }
+    }
+}
+
+void TimerScheduler::runDueLocked(std::unique_lock<std::mutex>& lock, Clock::time_point time) {
+    // Take every entry whose deadline has passed, including the ones whose slack has not run out yet
+    auto due = std::partition(m_queue.begin(), m_queue.end(), [time](const std::shared_ptr<Entry>& entry) {
+        return entry->deadline > time;
+    });
+    if (due == m_queue.end()) {
+        return;
+    }
+    std::vector<std::shared_ptr<Entry>> dueEntries(due, m_queue.end());
+    m_queue.erase(due, m_queue.end());
+    std::make_heap(m_queue.begin(), m_queue.end(), runsLater);
+    std::stable_sort(
+        dueEntries.begin(), dueEntries.end(), [](const std::shared_ptr<Entry>& lhs, const std::shared_ptr<Entry>& rhs) {
+            return lhs->deadline < rhs->deadline;
+        });
+
+    for (auto& entry : dueEntries) {
+        // The entry may have been cancelled while an earlier task was running
+        if (entry->cancelled) {
+            continue;
+        }
+
+        if (entry->periodType == PeriodType::RELATIVE || !entry->offSchedule) {
+            m_runningEntry = entry;
+            m_runningThread = std::this_thread::get_id();
+            lock.unlock();
+            try {
+                entry->task();
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG).d("reason", ex.what()));
+            }
+            lock.lock();
+            m_runningEntry.reset();
+            m_taskCompleted.notify_all();
+            if (entry->cancelled) {
+                continue;
+            }
+        }
+
+        if (entry->maxCount != TimerDelegateInterface::FOREVER && ++entry->count >= entry->maxCount) {
+            entry->cancelled = true;
+            if (entry->onFinished) {
+                entry->onFinished();
+            }
+            continue;
+        }
+
+        auto completed = nowLocked();
+        switch (entry->periodType) {
+            case PeriodType::ABSOLUTE:
+                // Keep the cadence, and skip the next call if this call put us off schedule
+                entry->deadline += entry->period;
+                entry->offSchedule = entry->deadline < completed;
+                break;
+            case PeriodType::RELATIVE:
+                entry->deadline = completed + entry->period;
+                break;
+        }
+        entry->latest = entry->deadline + entry->slack;
+        pushLocked(entry);
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
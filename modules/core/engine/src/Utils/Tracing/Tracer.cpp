@@ -0,0 +1,300 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include <unistd.h>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Logger/ThreadMoniker.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace tracing {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.utils.tracing.Tracer");
+
+/// The maximum number of ring buffers of exited threads kept for export
+static const size_t MAX_RETIRED_BUFFERS = 32;
+
+/// Phase of a completed span in the Chrome trace event format
+static const char PHASE_COMPLETE = 'X';
+
+/// Phase of an instant event in the Chrome trace event format
+static const char PHASE_INSTANT = 'i';
+
+/// The origin of the trace timestamps
+static const Tracer::Clock::time_point s_epoch = Tracer::Clock::now();
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+/**
+ * A trace event, with its timestamps in nanoseconds since @c s_epoch.
+ */
+struct TraceEvent {
+    const char* category;
+    const char* name;
+    int64_t start;
+    int64_t duration;
+    char phase;
+};
+
+/**
+ * The ring buffer of the events recorded by a thread. The buffer is only written by its thread, the mutex is
+ * contended only while the trace is exported.
+ */
+struct ThreadBuffer {
+    ThreadBuffer(uint32_t tid, const std::string& threadName, size_t capacity) :
+            tid(tid), threadName(threadName), events(capacity), next(0), size(0), retired(false) {
+    }
+
+    void add(const TraceEvent& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events[next] = event;
+        next = (next + 1) % events.size();
+        size = std::min(size + 1, events.size());
+    }
+
+    const uint32_t tid;
+    const std::string threadName;
+    std::vector<TraceEvent> events;
+    size_t next;
+    size_t size;
+    std::atomic<bool> retired;
+    std::mutex mutex;
+};
+
+/**
+ * The ring buffers of every thread which recorded an event.
+ */
+struct Registry {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    uint32_t nextTid = 1;
+    size_t bufferSize = Tracer::DEFAULT_BUFFER_SIZE;
+    std::shared_ptr<Tracer::SpanObserver> observer;
+    std::mutex mutex;
+};
+
+static Registry& getRegistry() {
+    // the registry is never destroyed, so threads can record events during static destruction
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+/**
+ * Owns the ring buffer of a thread, and retires it when the thread exits.
+ */
+struct ThreadBufferHolder {
+    ~ThreadBufferHolder() {
+        if (buffer != nullptr) {
+            buffer->retired = true;
+        }
+    }
+
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+static thread_local ThreadBufferHolder t_threadBuffer;
+
+static ThreadBuffer& getThreadBuffer() {
+    if (t_threadBuffer.buffer == nullptr) {
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        // drop the oldest buffers of exited threads
+        size_t retired = std::count_if(
+            registry.buffers.begin(), registry.buffers.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                return buffer->retired.load();
+            });
+        for (auto it = registry.buffers.begin(); it != registry.buffers.end() && retired >= MAX_RETIRED_BUFFERS;) {
+            if ((*it)->retired) {
+                it = registry.buffers.erase(it);
+                retired--;
+            } else {
+                it++;
+            }
+        }
+
+        t_threadBuffer.buffer = std::make_shared<ThreadBuffer>(
+            registry.nextTid++, aace::engine::logger::ThreadMoniker::getThisThreadMoniker(), registry.bufferSize);
+        registry.buffers.push_back(t_threadBuffer.buffer);
+    }
+    return *t_threadBuffer.buffer;
+}
+
+static int64_t sinceEpoch(Tracer::Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - s_epoch).count();
+}
+
+static void writeString(std::ostream& stream, const char* value) {
+    stream << '"';
+    for (auto next = value; *next != '\0'; next++) {
+        auto c = *next;
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[7];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            stream << escaped;
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+static void writeMicroseconds(std::ostream& stream, int64_t nanoseconds) {
+    char value[32];
+    std::snprintf(
+        value,
+        sizeof(value),
+        "%s%lld.%03lld",
+        nanoseconds < 0 ? "-" : "",
+        static_cast<long long>(std::abs(nanoseconds) / 1000),
+        static_cast<long long>(std::abs(nanoseconds) % 1000));
+    stream << value;
+}
+
+void Tracer::setEnabled(bool enabled) {
+    AACE_INFO(LX(TAG).d("enabled", enabled));
+    s_enabled = enabled;
+}
+
+void Tracer::setBufferSize(size_t size) {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.bufferSize = std::max<size_t>(size, 1);
+}
+
+void Tracer::setSpanObserver(SpanObserver observer) {
+    auto& registry = getRegistry();
+    std::atomic_store(
+        &registry.observer, observer != nullptr ? std::make_shared<SpanObserver>(std::move(observer)) : nullptr);
+}
+
+void Tracer::complete(const char* category, const char* name, Clock::time_point start, Clock::time_point end) {
+    auto startTime = sinceEpoch(start);
+    getThreadBuffer().add({category, name, startTime, sinceEpoch(end) - startTime, PHASE_COMPLETE});
+    observe(category, name, end - start);
+}
+
+void Tracer::instant(const char* category, const char* name) {
+    getThreadBuffer().add({category, name, sinceEpoch(Clock::now()), 0, PHASE_INSTANT});
+}
+
+void Tracer::observe(const char* category, const char* name, Clock::duration duration) {
+    auto observer = std::atomic_load(&getRegistry().observer);
+    if (observer != nullptr) {
+        (*observer)(category, name, duration);
+    }
+}
+
+size_t Tracer::writeChromeTrace(std::ostream& stream) {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffers = registry.buffers;
+    }
+
+    auto pid = static_cast<long>(::getpid());
+    size_t count = 0;
+    bool first = true;
+    stream << "{\"traceEvents\":[";
+    for (auto& buffer : buffers) {
+        // copy the events, so the thread is not blocked while the events are written
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            events.reserve(buffer->size);
+            auto capacity = buffer->events.size();
+            for (size_t index = capacity + buffer->next - buffer->size; events.size() < buffer->size; index++) {
+                events.push_back(buffer->events[index % capacity]);
+            }
+        }
+        if (events.empty()) {
+            continue;
+        }
+
+        stream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+               << ",\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+        writeString(stream, buffer->threadName.c_str());
+        stream << "}}";
+        first = false;
+
+        for (auto& event : events) {
+            stream << ",\n{\"name\":";
+            writeString(stream, event.name);
+            stream << ",\"cat\":";
+            writeString(stream, event.category);
+            stream << ",\"ph\":\"" << event.phase << "\",\"ts\":";
+            writeMicroseconds(stream, event.start);
+            if (event.phase == PHASE_COMPLETE) {
+                stream << ",\"dur\":";
+                writeMicroseconds(stream, event.duration);
+            } else {
+                stream << ",\"s\":\"t\"";
+            }
+            stream << ",\"pid\":" << pid << ",\"tid\":" << buffer->tid << "}";
+        }
+        count += events.size();
+    }
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return count;
+}
+
+bool Tracer::writeChromeTrace(const std::string& path) {
+    try {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        ThrowIfNot(file.is_open(), "openFileFailed");
+        auto count = writeChromeTrace(file);
+        file.close();
+        ThrowIf(file.fail(), "writeFileFailed");
+        AACE_INFO(LX(TAG).d("path", path).d("events", count));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        return false;
+    }
+}
+
+void Tracer::clear() {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.erase(
+        std::remove_if(
+            registry.buffers.begin(),
+            registry.buffers.end(),
+            [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer->retired.load(); }),
+        registry.buffers.end());
+    for (auto& buffer : registry.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->next = 0;
+        buffer->size = 0;
+    }
+}
+
+}  // namespace tracing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
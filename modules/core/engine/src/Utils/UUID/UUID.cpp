@@ -16,120 +16,181 @@
 #include <AACE/Engine/Utils/UUID/UUID.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
-#include <random>
-#include <chrono>
-#include <sstream>
-#include <iomanip>
-#include <mutex>
-#include <climits>
 #include <algorithm>
-#include <functional>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace uuid {
 
-/// The UUID version (Version 4), shifted into the correct position in the byte.
-static const uint8_t UUID_VERSION_VALUE = 4 << 4;
+/// The UUID version (Version 4), in the third group of the string form.
+static const uint64_t UUID_VERSION_MASK = 0x000000000000f000ULL;
+static const uint64_t UUID_VERSION_VALUE = 0x0000000000004000ULL;
 
-/// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+/// The UUID variant (Variant 1), in the two most significant bits of the fourth group of the string form.
+static const uint64_t UUID_VARIANT_MASK = 0xc000000000000000ULL;
+static const uint64_t UUID_VARIANT_VALUE = 0x8000000000000000ULL;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// The length of the string form of a UUID.
+static const size_t UUID_STRING_LENGTH = 36;
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// The positions of the separators in the string form of a UUID.
+static const size_t SEPARATOR_POSITIONS[] = {8, 13, 18, 23};
 
-/// Number of bits in a hex digit.
-static const size_t BITS_IN_HEX_DIGIT = 4;
+/// Separator used between UUID fields.
+static const char SEPARATOR = '-';
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
 
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.engine.utils.uuid.UUID");
 
-/**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
- *
- * @return A hex string of length @c numDigits.
- */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    unsigned short numReplacementBits) {
-    try {
-        ThrowIf(numReplacementBits > MAX_NUM_REPLACEMENT_BITS, "replacingMoreBitsThanProvided");
-        ThrowIf(numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT), "replacingMoreBitsThanGenerated");
-
-        // Makes assumption that 1 digit = 4 bits.
-        std::vector<uint8_t> bytes(ceil(numDigits / 2.0));
-        std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-        // Replace the specified number of bits from the first byte.
-        bytes.at(0) &= (0xff >> numReplacementBits);
-        replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-        bytes.at(0) |= replacementBits;
-
-        std::ostringstream oss;
-        for (const auto& byte : bytes) {
-            oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
-        }
+/// Incremented in the child of a fork, so the threads of the child seed their generators again.
+static std::atomic<uint32_t> s_forkGeneration{0};
 
-        std::string bytesText = oss.str();
-        // Remove the last digit for odd numDigits case.
-        bytesText.resize(numDigits);
+static void onForkChild() {
+    s_forkGeneration++;
+}
 
-        return bytesText;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "generateHexWithReplacement").d("reason", ex.what()));
-        return std::string();
+static bool registerForkHandler() {
+    if (pthread_atfork(nullptr, nullptr, onForkChild) != 0) {
+        AACE_WARN(LX(TAG).d("reason", "registerForkHandlerFailed"));
+        return false;
     }
+    return true;
 }
 
-/**
- * Randomly generate a string of hex digits.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- *
- * @return A hex string of length @c numDigits.
- */
-static const std::string generateHex(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+/// The generator of a thread, seeded on the first use in the thread.
+class Generator {
+public:
+    Generator() : m_generation(s_forkGeneration.load()) {
+        seed();
+    }
+
+    UUID generate() {
+        auto generation = s_forkGeneration.load(std::memory_order_relaxed);
+        if (generation != m_generation) {
+            // the child of a fork would otherwise repeat the UUIDs of its parent
+            m_generation = generation;
+            seed();
+        }
+        UUID uuid;
+        uuid.high = (m_engine() & ~UUID_VERSION_MASK) | UUID_VERSION_VALUE;
+        uuid.low = (m_engine() & ~UUID_VARIANT_MASK) | UUID_VARIANT_VALUE;
+        return uuid;
+    }
+
+private:
+    void seed() {
+        std::vector<uint32_t> entropy;
+        try {
+            std::random_device rd;
+            for (int i = 0; i < 8; i++) {
+                entropy.push_back(rd());
+            }
+        } catch (std::exception& ex) {
+            AACE_WARN(LX(TAG).d("reason", "randomDeviceFailed").d("error", ex.what()));
+        }
+        // the time and thread distinguish the threads even when the random device is deterministic
+        auto now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        auto thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+        entropy.push_back(static_cast<uint32_t>(now));
+        entropy.push_back(static_cast<uint32_t>(static_cast<uint64_t>(now) >> 32));
+        entropy.push_back(static_cast<uint32_t>(thread));
+        entropy.push_back(static_cast<uint32_t>(static_cast<uint64_t>(thread) >> 32));
+        std::seed_seq sequence(entropy.begin(), entropy.end());
+        m_engine.seed(sequence);
+    }
+
+    std::mt19937_64 m_engine;
+    uint32_t m_generation;
+};
+
+static Generator& getGenerator() {
+    static bool forkHandlerRegistered = registerForkHandler();
+    (void)forkHandlerRegistered;
+    thread_local Generator generator;
+    return generator;
 }
 
-const std::string generateUUID() {
-    static bool seeded = false;
-    static std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t> ibe;
-    static std::mutex mutex;
-    std::unique_lock<std::mutex> lock(mutex);
-    if (!seeded) {
-        std::random_device rd;
-        ibe.seed(
-            rd() +
-            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
-                .count());
-        seeded = true;
+/// Writes the hex digits of @c value, most significant first, to @c digits.
+static void writeHex(uint64_t value, char* digits, size_t count) {
+    for (size_t i = count; i > 0; i--) {
+        digits[i - 1] = HEX_DIGITS[value & 0xf];
+        value >>= 4;
+    }
+}
+
+static int parseHexDigit(char digit) {
+    if (digit >= '0' && digit <= '9') {
+        return digit - '0';
+    }
+    if (digit >= 'a' && digit <= 'f') {
+        return digit - 'a' + 10;
+    }
+    if (digit >= 'A' && digit <= 'F') {
+        return digit - 'A' + 10;
     }
+    return -1;
+}
+
+UUID UUID::generate() {
+    return getGenerator().generate();
+}
 
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
+bool UUID::fromString(const std::string& text, UUID& uuid) {
+    if (text.size() != UUID_STRING_LENGTH) {
+        return false;
+    }
+    uint64_t halves[2] = {0, 0};
+    size_t digitCount = 0;
+    size_t separator = 0;
+    for (size_t i = 0; i < UUID_STRING_LENGTH; i++) {
+        if (separator < sizeof(SEPARATOR_POSITIONS) / sizeof(SEPARATOR_POSITIONS[0]) &&
+            i == SEPARATOR_POSITIONS[separator]) {
+            if (text[i] != SEPARATOR) {
+                return false;
+            }
+            separator++;
+            continue;
+        }
+        auto digit = parseHexDigit(text[i]);
+        if (digit < 0) {
+            return false;
+        }
+        auto& half = halves[digitCount / 16];
+        half = (half << 4) | static_cast<uint64_t>(digit);
+        digitCount++;
+    }
+    uuid.high = halves[0];
+    uuid.low = halves[1];
+    return true;
+}
 
-    lock.unlock();
+std::string UUID::toString() const {
+    char text[UUID_STRING_LENGTH];
+    writeHex(high >> 32, text, 8);
+    text[8] = SEPARATOR;
+    writeHex(high >> 16, text + 9, 4);
+    text[13] = SEPARATOR;
+    writeHex(high, text + 14, 4);
+    text[18] = SEPARATOR;
+    writeHex(low >> 48, text + 19, 4);
+    text[23] = SEPARATOR;
+    writeHex(low, text + 24, 12);
+    return std::string(text, UUID_STRING_LENGTH);
+}
 
-    return uuidText.str();
+const std::string generateUUID() {
+    return UUID::generate().toString();
 }
 
 bool compare(const std::string& uuid1, const std::string& uuid2) {
@@ -62,6 +62,11 @@ bool VehicleEngineService::initialize() {
     }
 }
 
+bool VehicleEngineService::isConcurrentLifecycleSafe() {
+    // the vehicle configuration is read in configure(), so there is nothing to set up, start or stop
+    return true;
+}
+
 bool VehicleEngineService::configure(std::shared_ptr<std::istream> configuration) {
     try {
         json config = json::parse(*configuration);
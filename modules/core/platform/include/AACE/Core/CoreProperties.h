@@ -29,6 +29,14 @@ namespace property {
  */
 static const std::string VERSION = "aace.core.version";
 
+/**
+ * This property is used with
+ * aace::propertyManager::PropertyManager::setProperty() to enable or disable
+ * Engine tracing at runtime. The value is "true" or "false". When tracing is
+ * disabled, the recorded trace is written to the configured trace file.
+ */
+static const std::string TRACING_ENABLED = "aace.core.tracing.enabled";
+
 }  // namespace property
 }  // namespace core
 }  // namespace aace
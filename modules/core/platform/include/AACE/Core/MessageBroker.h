@@ -32,6 +32,18 @@ class MessageBroker {
 public:
     using MessageHandler = std::function<void(const std::string& message)>;
 
+    /**
+     * The file descriptors of a message stream shared with another process through a ring buffer in shared memory.
+     */
+    struct SharedMemoryStream {
+        /// The sealed memory holding the ring buffer
+        int memoryFd = -1;
+        /// The event signalled when data is written to the ring buffer
+        int dataEventFd = -1;
+        /// The event signalled when data is read from the ring buffer
+        int spaceEventFd = -1;
+    };
+
     /**
      * Publishes a message to the Engine.
      *
@@ -55,6 +67,24 @@ public:
      * @param [in] mode The stream operation @ mode being requested.
      */
     virtual std::shared_ptr<MessageStream> openStream(const std::string& streamId, MessageStream::Mode mode) = 0;
+
+    /**
+     * Opens a message stream that has been registered by the Engine for another process, which reads or writes
+     * the stream through a ring buffer in shared memory instead of through this process. The Engine moves the data
+     * between the stream and the ring buffer until either side closes it.
+     *
+     * The file descriptors are owned by the caller, which passes them to the other process, for example over a
+     * Unix domain socket with @c SCM_RIGHTS, and then closes them.
+     *
+     * @param [in] streamId The @c id of the stream being opened.
+     * @param [in] mode @c READ if the other process reads the stream, or @c WRITE if it writes it.
+     * @param [out] stream The file descriptors of the ring buffer, if the stream was opened.
+     * @return @c true if the stream was opened, otherwise @c false.
+     */
+    virtual bool openSharedMemoryStream(
+        const std::string& streamId,
+        MessageStream::Mode mode,
+        SharedMemoryStream& stream) = 0;
 };
 
 }  // namespace core
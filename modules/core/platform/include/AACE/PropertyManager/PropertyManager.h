@@ -18,6 +18,8 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 #include "AACE/Core/PlatformInterface.h"
 #include "PropertyManagerEngineInterface.h"
 
@@ -63,9 +65,29 @@ public:
      */
     bool setProperty(const std::string& name, const std::string& value);
 
+    /**
+     * Sets several property values in the Engine together. The properties are
+     * set in order, and if one of them cannot be set, the properties already set
+     * are restored to their previous values. setProperties() is an asynchronous
+     * operation and the Engine will call propertyStateChanged() with the status
+     * of each property when it is completed.
+     *
+     * @param [in] properties The names and values of the properties to set.
+     *        Each name must be one of the property constants recognized by
+     *        the Engine, e.g. the properties in
+     *        @c aace::alexa::property::AlexaProperties.h.
+     * @return @c true if the properties will be set, else @c false if a property
+     *         is not recognized by the Engine, in which case no property is set.
+     */
+    bool setProperties(const std::vector<std::pair<std::string, std::string>>& properties);
+
     /**
      * Notifies the platform implementation of the status of a property change
-     * after a call to setProperty().
+     * after a call to setProperty() or setProperties().
+     *
+     * @note A value which is replaced by a later setProperty() call for the
+     * same property before the Engine applies it is reported with
+     * PropertyState::FAILED, since it is never applied.
      *
      * @param [in] name The name used by the Engine to identify the property.
      * @param [in] value The property value.
@@ -94,7 +116,8 @@ public:
      * Notifies the platform implementation of a property setting change in the
      * Engine.
      * @note This will not be called if the property setting change was
-     * initiated by @c PropertyManager::setProperty()
+     * initiated by @c PropertyManager::setProperty() or
+     * @c PropertyManager::setProperties()
      *
      * @param [in] name The name used by the Engine to identify the property.
      * @param [in] newValue The new value of the property
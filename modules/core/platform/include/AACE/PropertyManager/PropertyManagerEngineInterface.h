@@ -16,6 +16,10 @@
 #ifndef AACE_PROPERTY_MANAGER_PROPERTY_MANAGER_ENGINE_INTERFACE_H
 #define AACE_PROPERTY_MANAGER_PROPERTY_MANAGER_ENGINE_INTERFACE_H
 
+#include <string>
+#include <utility>
+#include <vector>
+
 /** @file */
 
 namespace aace {
@@ -42,6 +46,7 @@ public:
 
     };
     virtual bool onSetProperty(const std::string& name, const std::string& value) = 0;
+    virtual bool onSetProperties(const std::vector<std::pair<std::string, std::string>>& properties) = 0;
     virtual std::string onGetProperty(const std::string& name) = 0;
 };
 
@@ -25,6 +25,11 @@ bool PropertyManager::setProperty(const std::string& name, const std::string& va
                                                        : false;
 }
 
+bool PropertyManager::setProperties(const std::vector<std::pair<std::string, std::string>>& properties) {
+    return m_propertyManagerEngineInterface != nullptr ? m_propertyManagerEngineInterface->onSetProperties(properties)
+                                                       : false;
+}
+
 std::string PropertyManager::getProperty(const std::string& name) {
     return m_propertyManagerEngineInterface != nullptr ? m_propertyManagerEngineInterface->onGetProperty(name) : "";
 }
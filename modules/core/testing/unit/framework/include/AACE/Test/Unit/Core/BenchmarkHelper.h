@@ -0,0 +1,47 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_TEST_UNIT_CORE_BENCHMARK_HELPER_H
+#define AACE_TEST_UNIT_CORE_BENCHMARK_HELPER_H
+
+#include <cstddef>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+/**
+ * Helpers for the benchmarks of the unit test suites, which run quickly with the unit tests by default and can be
+ * scaled up to a real benchmark run.
+ */
+class BenchmarkHelper {
+public:
+    /**
+     * Gets a scaled iteration count, so a benchmark runs quickly by default and can be scaled up with the
+     * @c AAC_BENCHMARK_SCALE environment variable.
+     *
+     * @param count The default count
+     * @return @c count multiplied by @c AAC_BENCHMARK_SCALE
+     */
+    static size_t scale(size_t count);
+};
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
+
+#endif  // AACE_TEST_UNIT_CORE_BENCHMARK_HELPER_H
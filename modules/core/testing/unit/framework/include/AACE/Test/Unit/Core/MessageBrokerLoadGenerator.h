@@ -0,0 +1,193 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_TEST_UNIT_CORE_MESSAGE_BROKER_LOAD_GENERATOR_H
+#define AACE_TEST_UNIT_CORE_MESSAGE_BROKER_LOAD_GENERATOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/MessageBroker/Message.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AACE/Engine/MessageBroker/StreamManagerImpl.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+/**
+ * The result of a load generator run.
+ */
+struct LoadReport {
+    /// The name of the run
+    std::string name;
+
+    /// The number of messages, or stream chunks, delivered
+    size_t messages = 0;
+
+    /// The number of messages which were not delivered, or sync messages which were not replied to
+    size_t failures = 0;
+
+    /// The wall clock duration of the run
+    std::chrono::nanoseconds elapsed{0};
+
+    /// The median and 99th percentile dispatch latency
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p99{0};
+
+    /// The number of heap allocations made during the run, or zero if allocations are not counted
+    size_t allocations = 0;
+
+    /// @return The number of messages delivered per second
+    double getThroughput() const;
+
+    /// @return The number of heap allocations per delivered message
+    double getAllocationsPerMessage() const;
+};
+
+std::ostream& operator<<(std::ostream& stream, const LoadReport& report);
+
+/**
+ * Drives an in-process message mix through a @c MessageBrokerImpl and the streams of a @c StreamManagerImpl,
+ * measuring the throughput, dispatch latency and heap allocations of the message path. The generator subscribes
+ * in-process handlers for every message in the mix, which reply to the messages published synchronously, so no
+ * platform, network or audio device is needed.
+ *
+ * The dispatch latency of a message is the time from its publication to the invocation of its subscriber. The
+ * messages of a run are serialized before the run starts, so the measurements cover the broker only. Runs must
+ * not overlap, and the broker must be shut down before the generator is destroyed.
+ */
+class MessageBrokerLoadGenerator {
+public:
+    /**
+     * A message published by the generator.
+     */
+    struct MessageTemplate {
+        std::string topic;
+        std::string action;
+        aace::engine::messageBroker::Message::Direction direction;
+
+        /// Whether the message is published synchronously and replied to by its subscriber
+        bool sync;
+
+        /// The relative frequency of the message in the mix
+        unsigned weight;
+
+        /// The payload of the message
+        std::string payload;
+    };
+
+    /// Returns the current number of heap allocations made by the process
+    using AllocationCounter = std::function<size_t()>;
+
+    /**
+     * @return A mix of high rate @c AudioOutput state and position messages, @c Navigation state queries and
+     *         events, @c CarControl requests and metrics reports
+     */
+    static std::vector<MessageTemplate> getDefaultMix();
+
+    /**
+     * @param mix The messages to publish
+     * @return The messages of @c mix which are published asynchronously or synchronously
+     */
+    static std::vector<MessageTemplate> filter(const std::vector<MessageTemplate>& mix, bool sync);
+
+    /**
+     * Gets a scaled iteration count for the broker benchmarks.
+     *
+     * @param count The default count
+     * @return @c count scaled with @c BenchmarkHelper::scale()
+     */
+    static size_t scale(size_t count);
+
+    /**
+     * The broker does not remove subscribers, so it must be shut down before the generator is destroyed.
+     *
+     * @param broker The broker to publish the messages to
+     * @param mix The messages to publish
+     * @param allocationCounter The allocation counter, or @c nullptr if allocations are not counted
+     */
+    MessageBrokerLoadGenerator(
+        std::shared_ptr<aace::engine::messageBroker::MessageBrokerImpl> broker,
+        const std::vector<MessageTemplate>& mix = getDefaultMix(),
+        AllocationCounter allocationCounter = nullptr);
+
+    /**
+     * Publishes messages drawn from the mix according to their weights, and waits for them to be delivered.
+     *
+     * @param name The name of the run
+     * @param count The number of messages to publish
+     * @param publishers The number of threads publishing the messages concurrently
+     * @return The report of the run
+     */
+    LoadReport run(const std::string& name, size_t count, size_t publishers = 1);
+
+    /**
+     * Registers in-memory streams with a stream manager and requests them as the platform does, then writes
+     * chunks to the engine end of each stream and reads them from the platform end. The dispatch latency of a
+     * chunk is the time to write and read it.
+     *
+     * @param name The name of the run
+     * @param streamManager The stream manager to register the streams with
+     * @param streams The number of streams
+     * @param chunks The number of chunks written to each stream
+     * @param chunkSize The size of a chunk in bytes
+     * @return The report of the run
+     */
+    LoadReport runStreams(
+        const std::string& name,
+        std::shared_ptr<aace::engine::messageBroker::StreamManagerImpl> streamManager,
+        size_t streams,
+        size_t chunks,
+        size_t chunkSize);
+
+private:
+    void onMessage(const aace::engine::messageBroker::Message& message);
+    void publish(size_t first, size_t end, size_t stride);
+    size_t getAllocations() const;
+
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerImpl> m_broker;
+    std::vector<MessageTemplate> m_mix;
+    AllocationCounter m_allocationCounter;
+
+    /// The mix index of each message of the current run, and its serialized message and reply
+    std::vector<size_t> m_schedule;
+    std::vector<std::string> m_messages;
+    std::vector<std::string> m_replies;
+
+    /// The publication and delivery time of each message of the current run
+    std::vector<std::chrono::steady_clock::time_point> m_published;
+    std::vector<std::chrono::steady_clock::time_point> m_delivered;
+
+    std::atomic<size_t> m_deliveredCount;
+    std::atomic<size_t> m_failureCount;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
+
+#endif  // AACE_TEST_UNIT_CORE_MESSAGE_BROKER_LOAD_GENERATOR_H
@@ -41,6 +41,7 @@ public:
             const std::string& name,
             std::shared_ptr<aace::engine::propertyManager::PropertyListenerInterface> listener));
     MOCK_METHOD3(setProperty, bool(const std::string&, const std::string&, const bool&));
+    MOCK_METHOD2(setProperties, bool(const std::vector<std::pair<std::string, std::string>>&, const bool&));
     MOCK_METHOD1(getProperty, std::string(const std::string& name));
 };
 
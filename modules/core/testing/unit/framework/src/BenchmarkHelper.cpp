@@ -0,0 +1,38 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Test/Unit/Core/BenchmarkHelper.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+/// The environment variable scaling the iteration counts of the benchmarks
+static const char* BENCHMARK_SCALE_ENV = "AAC_BENCHMARK_SCALE";
+
+size_t BenchmarkHelper::scale(size_t count) {
+    auto value = std::getenv(BENCHMARK_SCALE_ENV);
+    auto factor = value != nullptr ? std::strtoul(value, nullptr, 10) : 0;
+    return count * std::max<size_t>(factor, 1);
+}
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
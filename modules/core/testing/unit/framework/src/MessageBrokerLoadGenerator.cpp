@@ -0,0 +1,407 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Test/Unit/Core/MessageBrokerLoadGenerator.h>
+#include <AACE/Test/Unit/Core/BenchmarkHelper.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+#include <set>
+#include <thread>
+#include <tuple>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+using Message = aace::engine::messageBroker::Message;
+using json = nlohmann::json;
+
+/// The time to wait for the messages of a run to be delivered
+static const std::chrono::seconds DELIVERY_TIMEOUT{30};
+
+/// The number of trailing digits of a message ID holding the index of the message in the run
+static const size_t MESSAGE_INDEX_DIGITS = 12;
+
+/// The seed of the message schedule, so runs are repeatable
+static const unsigned SCHEDULE_SEED = 1;
+
+static std::string createMessageId(size_t index, bool reply) {
+    char id[48];
+    std::snprintf(id, sizeof(id), "%08x-0000-4000-8000-%012zu", reply ? 1u : 0u, index);
+    return id;
+}
+
+static size_t getMessageIndex(const std::string& id) {
+    if (id.size() < MESSAGE_INDEX_DIGITS) {
+        return SIZE_MAX;
+    }
+    return std::strtoull(id.c_str() + id.size() - MESSAGE_INDEX_DIGITS, nullptr, 10);
+}
+
+static std::string createMessage(
+    const MessageBrokerLoadGenerator::MessageTemplate& message,
+    size_t index,
+    const std::string& payload) {
+    return json(
+               {{"header",
+                 {{"id", createMessageId(index, false)},
+                  {"messageType", "Publish"},
+                  {"version", "4.0"},
+                  {"messageDescription", {{"topic", message.topic}, {"action", message.action}}}}},
+                {"payload", json::parse(payload)}})
+        .dump();
+}
+
+static std::string createReply(const MessageBrokerLoadGenerator::MessageTemplate& message, size_t index) {
+    return json(
+               {{"header",
+                 {{"id", createMessageId(index, true)},
+                  {"messageType", "Reply"},
+                  {"version", "4.0"},
+                  {"messageDescription",
+                   {{"topic", message.topic},
+                    {"action", message.action},
+                    {"replyToId", createMessageId(index, false)}}}}},
+                {"payload", json::parse(message.payload)}})
+        .dump();
+}
+
+static std::chrono::nanoseconds getPercentile(const std::vector<std::chrono::nanoseconds>& sorted, size_t percent) {
+    return sorted.empty() ? std::chrono::nanoseconds::zero() : sorted[(sorted.size() - 1) * percent / 100];
+}
+
+//
+// LoadReport
+//
+
+double LoadReport::getThroughput() const {
+    return elapsed.count() > 0 ? messages * 1e9 / elapsed.count() : 0;
+}
+
+double LoadReport::getAllocationsPerMessage() const {
+    return messages > 0 ? static_cast<double>(allocations) / messages : 0;
+}
+
+std::ostream& operator<<(std::ostream& stream, const LoadReport& report) {
+    auto flags = stream.flags();
+    stream << std::fixed << std::setprecision(1) << "[" << report.name << "] messages=" << report.messages
+           << " failures=" << report.failures << " throughput=" << report.getThroughput() << "/s"
+           << " p50=" << report.p50.count() / 1000.0 << "us p99=" << report.p99.count() / 1000.0 << "us"
+           << " allocations/message=" << report.getAllocationsPerMessage();
+    stream.flags(flags);
+    return stream;
+}
+
+//
+// BufferedMessageStream
+//
+
+/**
+ * An in-memory pipe, written by the engine and read by the platform.
+ */
+class BufferedMessageStream : public aace::core::MessageStream {
+public:
+    ssize_t read(char* data, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto count = std::min(size, m_buffer.size() - m_position);
+        m_buffer.copy(data, count, m_position);
+        m_position += count;
+        if (m_position == m_buffer.size()) {
+            m_buffer.clear();
+            m_position = 0;
+        }
+        return count;
+    }
+
+    ssize_t write(const char* data, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed) {
+            return -1;
+        }
+        m_buffer.append(data, size);
+        return size;
+    }
+
+    void close() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+
+    bool isClosed() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_closed && m_buffer.empty();
+    }
+
+    MessageStream::Mode getMode() override {
+        return MessageStream::Mode::READ_WRITE;
+    }
+
+private:
+    std::string m_buffer;
+    size_t m_position = 0;
+    bool m_closed = false;
+    std::mutex m_mutex;
+};
+
+//
+// MessageBrokerLoadGenerator
+//
+
+std::vector<MessageBrokerLoadGenerator::MessageTemplate> MessageBrokerLoadGenerator::getDefaultMix() {
+    auto incoming = Message::Direction::INCOMING;
+    auto outgoing = Message::Direction::OUTGOING;
+    return {
+        {"AudioOutput",
+         "MediaStateChanged",
+         incoming,
+         false,
+         20,
+         R"({"channel":"AudioPlayer","token":"3b1a3f1e-0b7b-4a4b-9d3c-53c3a4e4f0a1","state":"PLAYING"})"},
+        {"AudioOutput",
+         "GetPosition",
+         outgoing,
+         true,
+         40,
+         R"({"channel":"AudioPlayer","token":"3b1a3f1e-0b7b-4a4b-9d3c-53c3a4e4f0a1","position":123456})"},
+        {"Navigation",
+         "GetNavigationState",
+         outgoing,
+         true,
+         5,
+         R"({"navigationState":"{\"state\":\"NAVIGATING\",\"waypoints\":[],\"shapes\":[]}"})"},
+        {"Navigation", "NavigationEvent", incoming, false, 5, R"({"event":"TURN_GUIDANCE_ANNOUNCED"})"},
+        {"CarControl",
+         "SetControllerValue",
+         outgoing,
+         true,
+         5,
+         R"({"capabilityType":"RANGE","endpointId":"default.fan","controllerId":"speed","value":3})"},
+        {"DeviceUsage",
+         "ReportNetworkDataUsage",
+         incoming,
+         false,
+         25,
+         R"({"usage":"{\"startTimeStamp\":1,\"endTimeStamp\":2,\"networkInterfaceType\":\"WIFI\",)"
+         R"(\"dataPlanType\":\"UNLIMITED\",\"bytesUsage\":{\"rxBytes\":1024,\"txBytes\":512}}"})"}};
+}
+
+std::vector<MessageBrokerLoadGenerator::MessageTemplate> MessageBrokerLoadGenerator::filter(
+    const std::vector<MessageTemplate>& mix,
+    bool sync) {
+    std::vector<MessageTemplate> filtered;
+    std::copy_if(mix.begin(), mix.end(), std::back_inserter(filtered), [sync](const MessageTemplate& message) {
+        return message.sync == sync;
+    });
+    return filtered;
+}
+
+size_t MessageBrokerLoadGenerator::scale(size_t count) {
+    return BenchmarkHelper::scale(count);
+}
+
+MessageBrokerLoadGenerator::MessageBrokerLoadGenerator(
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerImpl> broker,
+    const std::vector<MessageTemplate>& mix,
+    AllocationCounter allocationCounter) :
+        m_broker(broker), m_mix(mix), m_allocationCounter(allocationCounter), m_deliveredCount(0), m_failureCount(0) {
+    // subscribe to each message of the mix once, the subscriber must not outlive the generator so the broker
+    // has to be shut down before the generator is destroyed
+    std::set<std::tuple<std::string, std::string, Message::Direction>> subscribed;
+    for (auto& next : m_mix) {
+        if (subscribed.insert(std::make_tuple(next.topic, next.action, next.direction)).second) {
+            m_broker->subscribe(
+                next.topic, next.action, [this](const Message& message) { onMessage(message); }, next.direction);
+        }
+    }
+}
+
+size_t MessageBrokerLoadGenerator::getAllocations() const {
+    return m_allocationCounter != nullptr ? m_allocationCounter() : 0;
+}
+
+void MessageBrokerLoadGenerator::onMessage(const Message& message) {
+    auto index = getMessageIndex(message.messageId());
+    if (index >= m_schedule.size()) {
+        m_failureCount++;
+        return;
+    }
+
+    m_delivered[index] = std::chrono::steady_clock::now();
+    if (m_mix[m_schedule[index]].sync) {
+        m_broker->publish(m_replies[index]).send();
+    }
+
+    if (++m_deliveredCount == m_schedule.size()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_all();
+    }
+}
+
+void MessageBrokerLoadGenerator::publish(size_t first, size_t end, size_t stride) {
+    for (size_t index = first; index < end; index += stride) {
+        auto& message = m_mix[m_schedule[index]];
+        m_published[index] = std::chrono::steady_clock::now();
+        auto pm = m_broker->publish(m_messages[index], message.direction);
+        if (message.sync) {
+            if (!pm.get().valid()) {
+                m_failureCount++;
+            }
+        } else {
+            pm.send();
+        }
+    }
+}
+
+LoadReport MessageBrokerLoadGenerator::run(const std::string& name, size_t count, size_t publishers) {
+    // draw the messages of the run from the mix and serialize them up front
+    std::vector<unsigned> weights;
+    for (auto& next : m_mix) {
+        weights.push_back(next.weight);
+    }
+    std::mt19937 random(SCHEDULE_SEED);
+    std::discrete_distribution<size_t> distribution(weights.begin(), weights.end());
+
+    m_schedule.clear();
+    m_messages.clear();
+    m_replies.assign(count, "");
+    for (size_t index = 0; index < count; index++) {
+        m_schedule.push_back(distribution(random));
+        auto& message = m_mix[m_schedule.back()];
+        m_messages.push_back(createMessage(message, index, message.sync ? "{}" : message.payload));
+        if (message.sync) {
+            m_replies[index] = createReply(message, index);
+        }
+    }
+    m_published.assign(count, {});
+    m_delivered.assign(count, {});
+    m_deliveredCount = 0;
+    m_failureCount = 0;
+
+    LoadReport report;
+    report.name = name;
+
+    auto allocations = getAllocations();
+    auto start = std::chrono::steady_clock::now();
+
+    publishers = std::max<size_t>(publishers, 1);
+    std::vector<std::thread> threads;
+    for (size_t next = 1; next < publishers; next++) {
+        threads.emplace_back(&MessageBrokerLoadGenerator::publish, this, next, count, publishers);
+    }
+    publish(0, count, publishers);
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait_for(lock, DELIVERY_TIMEOUT, [this, count]() { return m_deliveredCount >= count; });
+    }
+
+    report.elapsed = std::chrono::steady_clock::now() - start;
+    report.allocations = getAllocations() - allocations;
+    report.messages = m_deliveredCount;
+    report.failures = m_failureCount + count - std::min(count, report.messages);
+
+    std::vector<std::chrono::nanoseconds> latencies;
+    for (size_t index = 0; index < count; index++) {
+        if (m_delivered[index] != std::chrono::steady_clock::time_point{}) {
+            latencies.push_back(m_delivered[index] - m_published[index]);
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    report.p50 = getPercentile(latencies, 50);
+    report.p99 = getPercentile(latencies, 99);
+
+    return report;
+}
+
+LoadReport MessageBrokerLoadGenerator::runStreams(
+    const std::string& name,
+    std::shared_ptr<aace::engine::messageBroker::StreamManagerImpl> streamManager,
+    size_t streams,
+    size_t chunks,
+    size_t chunkSize) {
+    std::string chunk(chunkSize, 'a');
+    std::vector<char> buffer(chunkSize);
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(streams * chunks);
+
+    LoadReport report;
+    report.name = name;
+
+    auto allocations = getAllocations();
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t next = 0; next < streams; next++) {
+        auto streamId = createMessageId(next, false);
+        auto stream = std::make_shared<BufferedMessageStream>();
+        if (!streamManager->registerStreamHandler(streamId, stream)) {
+            report.failures++;
+            continue;
+        }
+        auto platformStream = streamManager->requestStreamHandler(streamId, aace::core::MessageStream::Mode::READ);
+        if (platformStream == nullptr) {
+            report.failures++;
+            continue;
+        }
+
+        for (size_t index = 0; index < chunks; index++) {
+            auto written = std::chrono::steady_clock::now();
+            ssize_t count = stream->write(chunk.data(), chunk.size());
+            ssize_t read = 0;
+            while (count > 0 && read < count) {
+                auto result = platformStream->read(buffer.data() + read, buffer.size() - read);
+                if (result <= 0) {
+                    break;
+                }
+                read += result;
+            }
+            if (count != static_cast<ssize_t>(chunkSize) || read != count) {
+                report.failures++;
+                continue;
+            }
+            latencies.push_back(std::chrono::steady_clock::now() - written);
+            report.messages++;
+        }
+
+        stream->close();
+        if (!platformStream->isClosed()) {
+            report.failures++;
+        }
+    }
+
+    report.elapsed = std::chrono::steady_clock::now() - start;
+    report.allocations = getAllocations() - allocations;
+
+    std::sort(latencies.begin(), latencies.end());
+    report.p50 = getPercentile(latencies, 50);
+    report.p99 = getPercentile(latencies, 99);
+
+    return report;
+}
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -15,18 +15,209 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <AACE/Core/CoreProperties.h>
 #include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/Core/EngineService.h>
+#include <AACE/Engine/Core/EngineServiceManager.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerServiceInterface.h>
+#include <AACE/Engine/MessageBroker/SharedMemoryRing.h>
 #include <AACE/Test/Unit/Core/CoreTestHelper.h>
 
 using namespace aace::test::unit::core;
 
+/// Records the lifecycle handler calls made to the test services
+class LifecycleRecorder {
+public:
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_events.clear();
+        m_activeServices.clear();
+        m_overlappedSerialServices.clear();
+        m_failingEvent.clear();
+    }
+
+    void setFailingEvent(const std::string& event) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failingEvent = event;
+    }
+
+    bool enter(const std::string& event, const std::string& service, bool concurrent) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_activeServices.empty()) {
+            if (!concurrent) {
+                m_overlappedSerialServices.push_back(service);
+            }
+            for (auto& next : m_activeServices) {
+                if (!next.second) {
+                    m_overlappedSerialServices.push_back(next.first);
+                }
+            }
+        }
+        m_activeServices.emplace_back(service, concurrent);
+        m_events.push_back(event + ".enter." + service);
+        return event + "." + service != m_failingEvent;
+    }
+
+    void exit(const std::string& event, const std::string& service) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_activeServices.erase(
+            std::remove_if(
+                m_activeServices.begin(),
+                m_activeServices.end(),
+                [&service](const std::pair<std::string, bool>& next) { return next.first == service; }),
+            m_activeServices.end());
+        m_events.push_back(event + ".exit." + service);
+    }
+
+    // returns the position of the event in the recorded list, or -1 if it was not recorded
+    int indexOf(const std::string& event) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = std::find(m_events.begin(), m_events.end(), event);
+        return it != m_events.end() ? static_cast<int>(it - m_events.begin()) : -1;
+    }
+
+    std::vector<std::string> getOverlappedSerialServices() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_overlappedSerialServices;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_events;
+    std::vector<std::pair<std::string, bool>> m_activeServices;
+    std::vector<std::string> m_overlappedSerialServices;
+    std::string m_failingEvent;
+};
+
+static LifecycleRecorder s_recorder;
+
+/// Base class for the test services, which record their setup, start and stop calls
+class LifecycleTestService : public aace::engine::core::EngineService {
+protected:
+    LifecycleTestService(const aace::engine::core::ServiceDescription& description, bool concurrent) :
+            aace::engine::core::EngineService(description), m_concurrent(concurrent) {
+    }
+
+    bool setup() override {
+        return handle("setup");
+    }
+
+    bool start() override {
+        return handle("start");
+    }
+
+    bool stop() override {
+        return handle("stop");
+    }
+
+    bool isConcurrentLifecycleSafe() override {
+        return m_concurrent;
+    }
+
+private:
+    bool handle(const std::string& event) {
+        auto service = getDescription().getType();
+        bool success = s_recorder.enter(event, service, m_concurrent);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        s_recorder.exit(event, service);
+        return success;
+    }
+
+    bool m_concurrent;
+};
+
+/// Concurrent service without dependencies
+class TestServiceA : public LifecycleTestService {
+public:
+    DESCRIBE("aace.test.serviceA", VERSION("1.0"))
+
+    TestServiceA(const aace::engine::core::ServiceDescription& description) :
+            LifecycleTestService(description, true) {
+    }
+};
+
+/// Concurrent service depending on @c TestServiceA
+class TestServiceB : public LifecycleTestService {
+public:
+    DESCRIBE("aace.test.serviceB", VERSION("1.0"), DEPENDS(TestServiceA))
+
+    TestServiceB(const aace::engine::core::ServiceDescription& description) :
+            LifecycleTestService(description, true) {
+    }
+};
+
+/// Serial service depending on @c TestServiceB
+class TestServiceC : public LifecycleTestService {
+public:
+    DESCRIBE("aace.test.serviceC", VERSION("1.0"), DEPENDS(TestServiceB))
+
+    TestServiceC(const aace::engine::core::ServiceDescription& description) :
+            LifecycleTestService(description, false) {
+    }
+};
+
+/// Concurrent service depending on @c TestServiceC
+class TestServiceD : public LifecycleTestService {
+public:
+    DESCRIBE("aace.test.serviceD", VERSION("1.0"), DEPENDS(TestServiceC))
+
+    TestServiceD(const aace::engine::core::ServiceDescription& description) :
+            LifecycleTestService(description, true) {
+    }
+};
+
+REGISTER_SERVICE(TestServiceA)
+REGISTER_SERVICE(TestServiceB)
+REGISTER_SERVICE(TestServiceC)
+REGISTER_SERVICE(TestServiceD)
+
+/// A stream the engine serves for reading, holding the data to read
+class TestOutputStream : public aace::core::MessageStream {
+public:
+    TestOutputStream(const std::string& data) : m_data(data) {
+    }
+
+    ssize_t read(char* data, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto count = m_data.copy(data, size);
+        m_data.erase(0, count);
+        return count;
+    }
+
+    ssize_t write(const char* data, size_t size) override {
+        return -1;
+    }
+
+    void close() override {
+    }
+
+    bool isClosed() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_data.empty();
+    }
+
+    Mode getMode() override {
+        return Mode::READ;
+    }
+
+private:
+    std::string m_data;
+    std::mutex m_mutex;
+};
+
 /// Test harness for @c EngineImpl class
 class EngineImplTest : public ::testing::Test {
 public:
     void SetUp() override {
+        s_recorder.reset();
         m_engine = aace::engine::core::EngineImpl::create();
         ASSERT_NE(m_engine, nullptr) << "Create engine failed!";
     }
@@ -112,3 +303,120 @@ TEST_F(EngineImplTest, shutdown) {
     // test shutdown valid
     ASSERT_TRUE(m_engine->shutdown()) << "Shutdown engine failed!";
 }
+
+TEST_F(EngineImplTest, openSharedMemoryStream) {
+    auto messageBrokerService =
+        m_engine->getServiceInterface<aace::engine::messageBroker::MessageBrokerServiceInterface>("aace.messageBroker");
+    ASSERT_NE(messageBrokerService, nullptr);
+    ASSERT_TRUE(messageBrokerService->getStreamManager()->registerStreamHandler(
+        "output", std::make_shared<TestOutputStream>("hello")));
+
+    auto messageBroker = m_engine->getMessageBroker();
+    aace::core::MessageBroker::SharedMemoryStream stream;
+    ASSERT_FALSE(messageBroker->openSharedMemoryStream("unknown", aace::core::MessageStream::Mode::READ, stream))
+        << "Open unknown stream did not fail!";
+    ASSERT_TRUE(messageBroker->openSharedMemoryStream("output", aace::core::MessageStream::Mode::READ, stream))
+        << "Open shared memory stream failed!";
+
+    // the other process attaches to the ring with the descriptors it was passed
+    auto ring =
+        aace::engine::messageBroker::SharedMemoryRing::attach(stream.memoryFd, stream.dataEventFd, stream.spaceEventFd);
+    ASSERT_NE(ring, nullptr) << "Attach to shared memory stream failed!";
+    std::string result;
+    char data[16];
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!ring->isEndOfStream() && std::chrono::steady_clock::now() < deadline) {
+        result.append(data, ring->read(data, sizeof(data), std::chrono::milliseconds(100)));
+    }
+    ASSERT_EQ("hello", result);
+}
+
+TEST_F(EngineImplTest, serviceLifecycleFollowsDependencies) {
+    ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+    ASSERT_TRUE(m_engine->start()) << "Start engine failed!";
+    ASSERT_TRUE(m_engine->stop()) << "Stop engine failed!";
+
+    // each service is handled only after its dependencies have finished, in every phase
+    for (std::string phase : {"setup", "start", "stop"}) {
+        auto exitA = s_recorder.indexOf(phase + ".exit.aace.test.serviceA");
+        auto enterB = s_recorder.indexOf(phase + ".enter.aace.test.serviceB");
+        auto exitB = s_recorder.indexOf(phase + ".exit.aace.test.serviceB");
+        auto enterC = s_recorder.indexOf(phase + ".enter.aace.test.serviceC");
+        auto exitC = s_recorder.indexOf(phase + ".exit.aace.test.serviceC");
+        auto enterD = s_recorder.indexOf(phase + ".enter.aace.test.serviceD");
+        ASSERT_NE(exitA, -1) << phase;
+        ASSERT_LT(exitA, enterB) << phase;
+        ASSERT_LT(exitB, enterC) << phase;
+        ASSERT_LT(exitC, enterD) << phase;
+    }
+
+    // a service that has not opted in to concurrent handling never overlaps another service
+    ASSERT_TRUE(s_recorder.getOverlappedSerialServices().empty()) << "Serial service ran concurrently!";
+}
+
+TEST_F(EngineImplTest, independentCoreServicesAreHandledFirstAndConcurrently) {
+    auto schedule = m_engine->getServicePhaseSchedule();
+    ASSERT_FALSE(schedule.empty());
+
+    // returns the step handling the service, or -1 if it is not scheduled
+    auto stepOf = [&schedule](const std::string& service) {
+        for (size_t j = 0; j < schedule.size(); j++) {
+            if (std::find(schedule[j].begin(), schedule[j].end(), service) != schedule[j].end()) {
+                return static_cast<int>(j);
+            }
+        }
+        return -1;
+    };
+
+    // the core services only depend on each other, so they are all handled in the first step
+    for (std::string service :
+         {"aace.storage",
+          "aace.logger",
+          "aace.propertyManager",
+          "aace.vehicle",
+          "aace.metrics",
+          "aace.messageBroker",
+          "aace.audio",
+          "aace.test.serviceA",
+          "aace.test.serviceB"}) {
+        ASSERT_EQ(0, stepOf(service)) << service;
+    }
+
+    // a service that has not opted in is handled alone, after its dependencies, and before its dependents
+    auto stepC = stepOf("aace.test.serviceC");
+    ASSERT_GT(stepC, 0);
+    ASSERT_EQ(1u, schedule[stepC].size());
+    ASSERT_GT(stepOf("aace.test.serviceD"), stepC);
+
+    // no service is handled twice
+    std::vector<std::string> services;
+    for (auto& step : schedule) {
+        services.insert(services.end(), step.begin(), step.end());
+    }
+    std::sort(services.begin(), services.end());
+    ASSERT_EQ(services.end(), std::adjacent_find(services.begin(), services.end()));
+}
+
+TEST_F(EngineImplTest, serviceSetupFailureStopsStart) {
+    s_recorder.setFailingEvent("setup.aace.test.serviceB");
+
+    ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+    ASSERT_FALSE(m_engine->start()) << "Start engine did not fail!";
+
+    // services after the failed service are not set up, and no service is started
+    ASSERT_EQ(s_recorder.indexOf("setup.enter.aace.test.serviceC"), -1) << "Dependent service was set up!";
+    ASSERT_EQ(s_recorder.indexOf("setup.enter.aace.test.serviceD"), -1) << "Dependent service was set up!";
+    ASSERT_EQ(s_recorder.indexOf("start.enter.aace.test.serviceA"), -1) << "Service was started!";
+}
+
+TEST_F(EngineImplTest, serialServiceStartFailureStopsStart) {
+    s_recorder.setFailingEvent("start.aace.test.serviceC");
+
+    ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+    ASSERT_FALSE(m_engine->start()) << "Start engine did not fail!";
+
+    // every service was set up, but the service depending on the failed service was not started
+    ASSERT_NE(s_recorder.indexOf("setup.exit.aace.test.serviceD"), -1) << "Service was not set up!";
+    ASSERT_NE(s_recorder.indexOf("start.exit.aace.test.serviceB"), -1) << "Dependency was not started!";
+    ASSERT_EQ(s_recorder.indexOf("start.enter.aace.test.serviceD"), -1) << "Dependent service was started!";
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
+
+using namespace aace::engine::utils::threading;
+using aace::engine::utils::tracing::Tracer;
+
+static const std::chrono::seconds TIMEOUT{2};
+
+/// Test harness for @c Executor class
+class ExecutorTest : public ::testing::Test {
+public:
+    void TearDown() override {
+        Tracer::setEnabled(false);
+        Tracer::setSpanObserver(nullptr);
+        Tracer::clear();
+    }
+
+    /// Blocks the executor until @c release() is called, so the following submissions are queued
+    void block(Executor& executor) {
+        std::promise<void> blocked;
+        auto released = m_released.get_future().share();
+        executor.submit(TaskPriority::CRITICAL, [&blocked, released]() {
+            blocked.set_value();
+            released.wait();
+        });
+        ASSERT_EQ(std::future_status::ready, blocked.get_future().wait_for(TIMEOUT));
+    }
+
+    void release() {
+        m_released.set_value();
+    }
+
+    /// Submits a task recording @c name when it runs
+    void submitRecord(Executor& executor, TaskPriority priority, const std::string& name) {
+        executor.submit(priority, [this, name]() { record(name); });
+    }
+
+    void record(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_calls.push_back(name);
+    }
+
+    std::vector<std::string> getCalls() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calls;
+    }
+
+private:
+    std::promise<void> m_released;
+    std::mutex m_mutex;
+    std::vector<std::string> m_calls;
+};
+
+TEST_F(ExecutorTest, higherPriorityTasksRunFirst) {
+    Executor executor;
+    block(executor);
+    submitRecord(executor, TaskPriority::LOW, "low");
+    submitRecord(executor, TaskPriority::NORMAL, "normal");
+    submitRecord(executor, TaskPriority::HIGH, "high1");
+    submitRecord(executor, TaskPriority::CRITICAL, "critical");
+    submitRecord(executor, TaskPriority::HIGH, "high2");
+    release();
+    executor.waitForSubmittedTasks();
+
+    std::vector<std::string> expected = {"critical", "high1", "high2", "normal", "low"};
+    EXPECT_EQ(expected, getCalls());
+}
+
+TEST_F(ExecutorTest, defaultPriorityAppliesToSubmit) {
+    Executor executor(TaskPriority::LOW);
+    EXPECT_EQ(TaskPriority::LOW, executor.getDefaultPriority());
+    block(executor);
+    executor.submit([this]() { record("default"); });
+    executor.submitToFront([this]() { record("front"); });
+    submitRecord(executor, TaskPriority::NORMAL, "normal");
+    release();
+    executor.waitForSubmittedTasks();
+
+    std::vector<std::string> expected = {"normal", "front", "default"};
+    EXPECT_EQ(expected, getCalls());
+}
+
+TEST_F(ExecutorTest, starvedTaskRunsAheadOfHigherPriorityTasks) {
+    Executor executor(TaskPriority::NORMAL, std::chrono::milliseconds(50));
+    block(executor);
+    submitRecord(executor, TaskPriority::LOW, "low");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    submitRecord(executor, TaskPriority::HIGH, "high");
+    release();
+    executor.waitForSubmittedTasks();
+
+    std::vector<std::string> expected = {"low", "high"};
+    EXPECT_EQ(expected, getCalls()) << "The low priority task waited longer than the starvation threshold";
+}
+
+TEST_F(ExecutorTest, waitForSubmittedTasksWaitsForLowerPriorityTasks) {
+    Executor executor(TaskPriority::HIGH);
+    block(executor);
+    submitRecord(executor, TaskPriority::LOW, "low");
+    std::thread releaser([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release();
+    });
+    executor.waitForSubmittedTasks();
+    releaser.join();
+
+    std::vector<std::string> expected = {"low"};
+    EXPECT_EQ(expected, getCalls());
+}
+
+TEST_F(ExecutorTest, queueLatencyIsObservedPerPriority) {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    Tracer::setSpanObserver([&](const char* category, const char* name, Tracer::Clock::duration) {
+        std::lock_guard<std::mutex> lock(mutex);
+        names.push_back(std::string(category) + "." + name);
+    });
+    Tracer::setEnabled(true);
+
+    Executor executor;
+    ASSERT_EQ(std::future_status::ready, executor.submit(TaskPriority::HIGH, []() {}).wait_for(TIMEOUT));
+    ASSERT_EQ(std::future_status::ready, executor.submit([]() {}).wait_for(TIMEOUT));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> latencies;
+    for (auto& name : names) {
+        if (name.find("Executor.QueueLatency") == 0) {
+            latencies.push_back(name);
+        }
+    }
+    std::vector<std::string> expected = {"Executor.QueueLatency.High", "Executor.QueueLatency.Normal"};
+    EXPECT_EQ(expected, latencies);
+}
+
+TEST_F(ExecutorTest, shutdownDropsQueuedTasks) {
+    Executor executor;
+    block(executor);
+    auto future = executor.submit(TaskPriority::LOW, []() { return 42; });
+    std::thread releaser([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release();
+    });
+    executor.shutdown();
+    releaser.join();
+
+    EXPECT_TRUE(executor.isShutdown());
+    EXPECT_THROW(future.get(), std::future_error);
+    EXPECT_FALSE(executor.submit([]() {}).valid());
+}
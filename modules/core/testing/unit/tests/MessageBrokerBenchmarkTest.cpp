@@ -0,0 +1,236 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <AACE/Engine/MessageBroker/SharedMemoryRing.h>
+
+// testing includes
+#include <AACE/Test/Unit/Core/MessageBrokerLoadGenerator.h>
+
+// Count the heap allocations of the process, so the benchmark can report the allocations per message. The
+// replacement operators are defined in this test only, to keep them out of the other tests.
+static std::atomic<size_t> s_allocations{0};
+
+void* operator new(size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size > 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+using namespace aace::test::unit::core;
+
+/**
+ * Benchmark of the message broker and stream manager. The suite runs with small iteration counts by default so it
+ * can run with the unit tests; set @c AAC_BENCHMARK_SCALE to scale up the counts for a benchmark run.
+ */
+class MessageBrokerBenchmarkTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_broker = aace::engine::messageBroker::MessageBrokerImpl::create();
+        ASSERT_NE(m_broker, nullptr) << "Create message broker failed!";
+        m_broker->setMessageTimeout(std::chrono::milliseconds{500});
+    }
+
+    void TearDown() override {
+        // the generator's subscribers are called until the broker is shut down, so it is destroyed afterwards
+        if (m_broker != nullptr) {
+            m_broker->shutdown();
+        }
+        m_generator.reset();
+        m_broker.reset();
+    }
+
+    MessageBrokerLoadGenerator& createGenerator(const std::vector<MessageBrokerLoadGenerator::MessageTemplate>& mix) {
+        m_generator.reset(new MessageBrokerLoadGenerator(m_broker, mix, getAllocations));
+        return *m_generator;
+    }
+
+    static size_t getAllocations() {
+        return s_allocations.load(std::memory_order_relaxed);
+    }
+
+    static void report(const LoadReport& report) {
+        std::cout << report << std::endl;
+        RecordProperty("messages", static_cast<int>(report.messages));
+        RecordProperty("throughput", static_cast<int>(report.getThroughput()));
+        RecordProperty("p50Nanoseconds", static_cast<int>(report.p50.count()));
+        RecordProperty("p99Nanoseconds", static_cast<int>(report.p99.count()));
+        RecordProperty("allocationsPerMessage", static_cast<int>(report.getAllocationsPerMessage() + 0.5));
+    }
+
+protected:
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerImpl> m_broker;
+    std::unique_ptr<MessageBrokerLoadGenerator> m_generator;
+};
+
+/**
+ * Benchmark of the shared memory ring between two processes. The test forks, so the fixture does not start a
+ * broker: a child forked while the broker's threads are running could deadlock on a lock one of them holds. It is
+ * defined before the broker benchmarks, so it also runs before any of them has started a broker.
+ */
+class SharedMemoryRingBenchmarkTest : public ::testing::Test {};
+
+/**
+ * Streams audio sized chunks from this process to a child process through a shared memory ring, as an
+ * out-of-process integration consuming TTS would. Each chunk carries the time it was written, so the child measures
+ * the latency of each chunk and reports it back over a pipe.
+ */
+TEST_F(SharedMemoryRingBenchmarkTest, sharedMemoryStreamTwoProcesses) {
+    using aace::engine::messageBroker::SharedMemoryRing;
+    using Clock = std::chrono::steady_clock;
+    const size_t chunkSize = 3200;
+    const size_t ringCapacity = 64 * 1024;
+    const auto chunks = MessageBrokerLoadGenerator::scale(2000);
+    const std::chrono::milliseconds timeout{2000};
+
+    auto ring = SharedMemoryRing::create(ringCapacity);
+    ASSERT_NE(ring, nullptr);
+    int results[2];
+    ASSERT_EQ(0, pipe(results));
+
+    std::vector<std::chrono::nanoseconds> latencies(chunks);
+    std::vector<char> chunk(chunkSize);
+    int memoryFd = dup(ring->getMemoryFd());
+    int dataEventFd = dup(ring->getDataEventFd());
+    int spaceEventFd = dup(ring->getSpaceEventFd());
+
+    // no broker has been started, so the process is single threaded and the child can safely allocate
+    auto start = Clock::now();
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // the child attaches with its own descriptors, as a process receiving them over a socket would
+        auto attached = SharedMemoryRing::attach(memoryFd, dataEventFd, spaceEventFd);
+        size_t received = 0;
+        size_t offset = 0;
+        while (attached != nullptr && received < chunks) {
+            auto count = attached->read(chunk.data() + offset, chunkSize - offset, timeout);
+            if (count <= 0) {
+                break;
+            }
+            offset += count;
+            if (offset == chunkSize) {
+                Clock::rep written;
+                std::memcpy(&written, chunk.data(), sizeof(written));
+                latencies[received++] = Clock::now().time_since_epoch() - Clock::duration(written);
+                offset = 0;
+            }
+        }
+        std::sort(latencies.begin(), latencies.begin() + received);
+        int64_t report[3] = {static_cast<int64_t>(received),
+                             received > 0 ? latencies[(received - 1) * 50 / 100].count() : 0,
+                             received > 0 ? latencies[(received - 1) * 99 / 100].count() : 0};
+        _exit(::write(results[1], report, sizeof(report)) == sizeof(report) ? 0 : 1);
+    }
+    close(memoryFd);
+    close(dataEventFd);
+    close(spaceEventFd);
+    close(results[1]);
+
+    size_t failures = 0;
+    for (size_t index = 0; index < chunks; index++) {
+        auto written = Clock::now().time_since_epoch().count();
+        std::memcpy(chunk.data(), &written, sizeof(written));
+        if (ring->write(chunk.data(), chunkSize, timeout) != static_cast<ssize_t>(chunkSize)) {
+            failures++;
+            break;
+        }
+    }
+    ring->closeWriter();
+
+    int64_t childReport[3] = {0, 0, 0};
+    auto count = ::read(results[0], childReport, sizeof(childReport));
+    close(results[0]);
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    LoadReport result;
+    result.name = "sharedMemoryStreamTwoProcesses";
+    result.messages = static_cast<size_t>(childReport[0]);
+    result.failures = failures;
+    result.elapsed = Clock::now() - start;
+    result.p50 = std::chrono::nanoseconds(childReport[1]);
+    result.p99 = std::chrono::nanoseconds(childReport[2]);
+    MessageBrokerBenchmarkTest::report(result);
+
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(childReport)), count);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_EQ(chunks, result.messages);
+    EXPECT_EQ(0u, result.failures);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, publishAsyncMessageMix) {
+    auto mix = MessageBrokerLoadGenerator::filter(MessageBrokerLoadGenerator::getDefaultMix(), false);
+    auto& generator = createGenerator(mix);
+    auto count = MessageBrokerLoadGenerator::scale(2000);
+
+    auto result = generator.run("publishAsyncMessageMix", count);
+    report(result);
+    EXPECT_EQ(count, result.messages);
+    EXPECT_EQ(0u, result.failures);
+    EXPECT_GT(result.allocations, 0u);
+    EXPECT_LE(result.p50, result.p99);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, publishSyncWithReplyingSubscribers) {
+    auto mix = MessageBrokerLoadGenerator::filter(MessageBrokerLoadGenerator::getDefaultMix(), true);
+    auto& generator = createGenerator(mix);
+    auto count = MessageBrokerLoadGenerator::scale(500);
+
+    auto result = generator.run("publishSyncWithReplyingSubscribers", count);
+    report(result);
+    EXPECT_EQ(count, result.messages);
+    EXPECT_EQ(0u, result.failures);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, mixedLoadWithConcurrentPublishers) {
+    auto& generator = createGenerator(MessageBrokerLoadGenerator::getDefaultMix());
+    auto count = MessageBrokerLoadGenerator::scale(2000);
+
+    auto result = generator.run("mixedLoadWithConcurrentPublishers", count, 4);
+    report(result);
+    EXPECT_EQ(count, result.messages);
+    EXPECT_EQ(0u, result.failures);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, messageStreamReadWrite) {
+    auto streamManager = aace::engine::messageBroker::StreamManagerImpl::create();
+    ASSERT_NE(streamManager, nullptr);
+    auto& generator = createGenerator({});
+    auto streams = MessageBrokerLoadGenerator::scale(20);
+
+    auto result = generator.runStreams("messageStreamReadWrite", streamManager, streams, 100, 4096);
+    report(result);
+    EXPECT_EQ(streams * 100, result.messages);
+    EXPECT_EQ(0u, result.failures);
+}
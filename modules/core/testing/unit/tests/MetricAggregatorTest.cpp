@@ -0,0 +1,187 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/Metrics/AASBMetricsUtils.h>
+#include <AACE/Engine/Metrics/CounterDataPointBuilder.h>
+#include <AACE/Engine/Metrics/DurationDataPointBuilder.h>
+#include <AACE/Engine/Metrics/MetricAggregator.h>
+#include <AACE/Engine/Metrics/MetricEventBuilder.h>
+#include <AACE/Engine/Metrics/StringDataPointBuilder.h>
+
+using namespace aace::engine::metrics;
+using json = nlohmann::json;
+
+static const std::string TEST_PROGRAM = "AlexaAutoSDK";
+static const std::string TEST_SOURCE = "MessageBroker";
+
+/// Test harness for @c MetricAggregator class
+class MetricAggregatorTest : public ::testing::Test {
+protected:
+    MetricAggregator m_aggregator;
+};
+
+TEST_F(MetricAggregatorTest, emptyWindowProducesNoMetrics) {
+    m_aggregator.getCounter(TEST_PROGRAM, TEST_SOURCE, "PublishCount");
+    m_aggregator.getTimer(TEST_PROGRAM, TEST_SOURCE, "DispatchLatency");
+    EXPECT_TRUE(m_aggregator.collect().empty()) << "Unused counters and timers should not produce metrics";
+}
+
+TEST_F(MetricAggregatorTest, invalidNameReturnsNull) {
+    EXPECT_EQ(nullptr, m_aggregator.getCounter(TEST_PROGRAM, "", "PublishCount"));
+    EXPECT_EQ(nullptr, m_aggregator.getTimer(TEST_PROGRAM, TEST_SOURCE, ""));
+}
+
+TEST_F(MetricAggregatorTest, sameNameReturnsSameHandle) {
+    auto first = m_aggregator.getCounter(TEST_PROGRAM, TEST_SOURCE, "PublishCount");
+    auto second = m_aggregator.getCounter(TEST_PROGRAM, TEST_SOURCE, "PublishCount");
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(MetricAggregatorTest, counterAggregatesAcrossThreads) {
+    auto counter = m_aggregator.getCounter(TEST_PROGRAM, TEST_SOURCE, "PublishCount");
+    ASSERT_NE(nullptr, counter);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([counter] {
+            for (int i = 0; i < 1000; i++) {
+                counter->increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto metrics = m_aggregator.collect();
+    ASSERT_EQ(1u, metrics.size());
+    EXPECT_EQ(TEST_PROGRAM, metrics[0].getProgramName());
+    EXPECT_EQ(TEST_SOURCE, metrics[0].getSourceName());
+    auto dataPoint = metrics[0].getDataPoint("PublishCount", DataType::COUNTER);
+    EXPECT_EQ(DataType::COUNTER, dataPoint.getDataType());
+    EXPECT_EQ(4000u, dataPoint.getNumericValue());
+    EXPECT_EQ("4000", dataPoint.getValue());
+
+    // the window is reset after collection
+    EXPECT_TRUE(m_aggregator.collect().empty());
+}
+
+TEST_F(MetricAggregatorTest, timerProducesHistogramDataPoints) {
+    auto timer = m_aggregator.getTimer(TEST_PROGRAM, TEST_SOURCE, "DispatchLatency");
+    ASSERT_NE(nullptr, timer);
+    for (int i = 1; i <= 100; i++) {
+        timer->record(std::chrono::milliseconds(i));
+    }
+
+    auto metrics = m_aggregator.collect();
+    ASSERT_EQ(1u, metrics.size());
+    const auto& dataPoints = metrics[0].getDataPointMap();
+    EXPECT_EQ(5u, dataPoints.size());
+
+    auto mean = metrics[0].getDataPoint("DispatchLatency", DataType::DURATION);
+    EXPECT_EQ(50u, mean.getNumericValue());
+    EXPECT_EQ(100u, mean.getSampleCount());
+    auto max = metrics[0].getDataPoint("DispatchLatency" + MetricAggregator::SUFFIX_MAX, DataType::DURATION);
+    EXPECT_EQ(100u, max.getNumericValue());
+    auto p50 = metrics[0].getDataPoint("DispatchLatency" + MetricAggregator::SUFFIX_P50, DataType::DURATION);
+    EXPECT_EQ(63u, p50.getNumericValue()) << "p50 should be the upper bound of the [32, 64) bucket";
+    auto p99 = metrics[0].getDataPoint("DispatchLatency" + MetricAggregator::SUFFIX_P99, DataType::DURATION);
+    EXPECT_EQ(100u, p99.getNumericValue()) << "Percentiles are capped at the maximum sample";
+}
+
+TEST_F(MetricAggregatorTest, bucketIndexBoundaries) {
+    EXPECT_EQ(0u, AggregatedTimer::bucketIndex(0));
+    EXPECT_EQ(1u, AggregatedTimer::bucketIndex(1));
+    EXPECT_EQ(2u, AggregatedTimer::bucketIndex(2));
+    EXPECT_EQ(2u, AggregatedTimer::bucketIndex(3));
+    EXPECT_EQ(3u, AggregatedTimer::bucketIndex(4));
+    EXPECT_EQ(AggregatedTimer::NUM_BUCKETS - 1, AggregatedTimer::bucketIndex(UINT64_MAX));
+}
+
+TEST_F(MetricAggregatorTest, negativeDurationIsRecordedAsZero) {
+    auto dataPoint = DurationDataPointBuilder(std::chrono::milliseconds(-5)).withName("DispatchLatency").build();
+    EXPECT_EQ(0u, dataPoint.getNumericValue()) << "A negative duration must not wrap around";
+    EXPECT_EQ("0", dataPoint.getValue());
+
+    auto timer = m_aggregator.getTimer(TEST_PROGRAM, TEST_SOURCE, "DispatchLatency");
+    timer->record(std::chrono::milliseconds(-5));
+    auto metrics = m_aggregator.collect();
+    ASSERT_EQ(1u, metrics.size());
+    auto max = metrics[0].getDataPoint("DispatchLatency" + MetricAggregator::SUFFIX_MAX, DataType::DURATION);
+    EXPECT_EQ(0u, max.getNumericValue());
+}
+
+TEST(AASBMetricsUtilsTest, serializeAndParseRoundTrip) {
+    auto metric = MetricEventBuilder()
+                      .withSourceName(TEST_SOURCE)
+                      .withAlexaAgentId()
+                      .addDataPoint(CounterDataPointBuilder{}.withName("PublishCount").increment(42).build())
+                      .addDataPoint(StringDataPointBuilder{}.withName("Topic").withValue("AudioOutput").build())
+                      .build();
+    std::string serialized = serializeMetricEvent(metric);
+
+    std::vector<std::string> header;
+    std::map<std::string, std::string> values;
+    bool parsed = parseSerializedMetric(
+        serialized,
+        [&header](const std::vector<std::string>& fields) { header = fields; },
+        [&values](const std::string name, const std::string value, const std::string type, uint32_t samples) {
+            values[name] = value + ";" + type + ";" + std::to_string(samples);
+        });
+    ASSERT_TRUE(parsed);
+    ASSERT_EQ(7u, header.size());
+    EXPECT_EQ(TEST_PROGRAM, header[4]);
+    EXPECT_EQ(TEST_SOURCE, header[5]);
+    EXPECT_EQ("2", header[6]);
+    EXPECT_EQ("42;CT;1", values["PublishCount"]);
+    EXPECT_EQ("AudioOutput;STR;1", values["Topic"]);
+}
+
+TEST(AASBMetricsUtilsTest, parseRejectsMalformedDataPoint) {
+    bool parsed = parseSerializedMetric(
+        "1:2:NRML:NRML:AlexaAutoSDK:Source:1:Count=1;CT",
+        [](const std::vector<std::string>&) {},
+        [](const std::string, const std::string, const std::string, uint32_t) {});
+    EXPECT_FALSE(parsed);
+}
+
+TEST(AASBMetricsUtilsTest, uploadMessageIsValidJson) {
+    std::vector<MetricEvent> metrics;
+    metrics.push_back(MetricEventBuilder()
+                          .withSourceName(TEST_SOURCE)
+                          .addDataPoint(StringDataPointBuilder{}.withName("Quoted").withValue("say \"hi\"\\").build())
+                          .build());
+    metrics.push_back(MetricEventBuilder()
+                          .withSourceName(TEST_SOURCE)
+                          .addDataPoint(CounterDataPointBuilder{}.withName("PublishCount").increment(1).build())
+                          .build());
+    auto message = json::parse(serializeMetricsUploadMessage("test-id", 2, metrics));
+    EXPECT_EQ("Publish", message["header"]["messageType"]);
+    EXPECT_EQ("test-id", message["header"]["id"]);
+    EXPECT_EQ("MetricsUpload", message["header"]["messageDescription"]["topic"]);
+    EXPECT_EQ("Agent2", message["header"]["messageDescription"]["action"]);
+    ASSERT_EQ(2u, message["payload"]["metrics"].size());
+    // compare everything after the timestamp
+    std::string expected = serializeMetricEvent(metrics[0]);
+    std::string actual = message["payload"]["metrics"][0];
+    EXPECT_EQ(expected.substr(expected.find(':')), actual.substr(actual.find(':')));
+}
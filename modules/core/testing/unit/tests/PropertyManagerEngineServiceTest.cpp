@@ -0,0 +1,345 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
+#include <AACE/PropertyManager/PropertyManager.h>
+
+// testing includes
+#include <AACE/Test/Unit/Core/CoreTestHelper.h>
+
+using namespace aace::test::unit::core;
+using namespace aace::engine::propertyManager;
+
+using PropertyChanges = std::vector<std::pair<std::string, std::string>>;
+
+static const std::chrono::seconds TIMEOUT{2};
+
+/// Listener recording the property change notifications it receives
+class TestPropertyListener : public PropertyListenerInterface {
+public:
+    void propertyChanged(const std::string& name, const std::string& newValue) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_notifications.push_back({{name, newValue}});
+    }
+
+    void propertiesChanged(const PropertyChanges& changes) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_notifications.push_back(changes);
+    }
+
+    std::vector<PropertyChanges> getNotifications() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_notifications;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<PropertyChanges> m_notifications;
+};
+
+/// Platform implementation recording the property state changes the Engine reports
+class TestPlatformPropertyManager : public aace::propertyManager::PropertyManager {
+public:
+    using StateChange = std::tuple<std::string, std::string, PropertyState>;
+
+    void propertyStateChanged(const std::string& name, const std::string& value, const PropertyState state) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stateChanges.emplace_back(name, value, state);
+    }
+
+    void propertyChanged(const std::string&, const std::string&) override {
+    }
+
+    std::vector<StateChange> getStateChanges() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stateChanges;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<StateChange> m_stateChanges;
+};
+
+/// Test harness for @c PropertyManagerEngineService class
+class PropertyManagerEngineServiceTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_engine = aace::engine::core::EngineImpl::create();
+        ASSERT_NE(m_engine, nullptr) << "Create engine failed!";
+        ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+        auto context = std::static_pointer_cast<aace::engine::core::EngineContext>(m_engine);
+        m_propertyManager = context->getServiceInterface<PropertyManagerServiceInterface>("aace.propertyManager");
+        ASSERT_NE(m_propertyManager, nullptr);
+    }
+
+    void TearDown() override {
+        m_propertyManager.reset();
+        if (m_engine != nullptr) {
+            m_engine->shutdown();
+            m_engine.reset();
+        }
+    }
+
+    /// Registers a property stored in this harness, whose setter fails for the value "invalid"
+    void registerProperty(const std::string& name, const std::string& value) {
+        m_values[name] = value;
+        ASSERT_TRUE(m_propertyManager->registerProperty(PropertyDescription(
+            name,
+            [this, name](const std::string& value, bool& changed, bool&, const PropertyDescription::SetterCallback&) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_setCalls.push_back({name, value});
+                if (value == "invalid") {
+                    return false;
+                }
+                changed = m_values[name] != value;
+                m_values[name] = value;
+                return true;
+            },
+            [this, name]() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_values[name];
+            })));
+    }
+
+    /// Registers a property whose setter completes asynchronously, keeping the callback to report its result
+    void registerAsyncProperty(const std::string& name) {
+        ASSERT_TRUE(m_propertyManager->registerProperty(PropertyDescription(
+            name,
+            [this, name](
+                const std::string& value, bool&, bool& async, const PropertyDescription::SetterCallback& callback) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_setCalls.push_back({name, value});
+                m_asyncCallback = callback;
+                async = true;
+                return true;
+            },
+            []() { return ""; })));
+    }
+
+    void completeAsyncSet(const std::string& name, const std::string& value, const std::string& state) {
+        PropertyDescription::SetterCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            callback = m_asyncCallback;
+        }
+        ASSERT_TRUE(callback != nullptr);
+        callback(name, value, state);
+    }
+
+    /// Registers a property whose setter blocks the property manager executor until @c release() is called
+    void registerBlockingProperty(const std::string& name) {
+        auto released = m_released.get_future().share();
+        ASSERT_TRUE(m_propertyManager->registerProperty(PropertyDescription(
+            name,
+            [this, released](const std::string&, bool&, bool&, const PropertyDescription::SetterCallback&) {
+                m_blocked.set_value();
+                released.wait();
+                return true;
+            },
+            []() { return ""; })));
+    }
+
+    void release() {
+        m_released.set_value();
+    }
+
+    /// Waits for the operations queued on the property manager executor
+    void waitForExecutor() {
+        std::promise<void> done;
+        auto name = "aace.test.flush" + std::to_string(m_flushCount++);
+        ASSERT_TRUE(m_propertyManager->registerProperty(PropertyDescription(
+            name,
+            [&done](const std::string&, bool&, bool&, const PropertyDescription::SetterCallback&) {
+                done.set_value();
+                return true;
+            },
+            []() { return ""; })));
+        ASSERT_TRUE(m_propertyManager->setProperty(name, "flush"));
+        ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(TIMEOUT)) << "Executor did not complete";
+    }
+
+    std::string getValue(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_values[name];
+    }
+
+    PropertyChanges getSetCalls() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_setCalls;
+    }
+
+protected:
+    std::shared_ptr<aace::engine::core::EngineImpl> m_engine;
+    std::shared_ptr<PropertyManagerServiceInterface> m_propertyManager;
+    std::promise<void> m_blocked;
+    std::promise<void> m_released;
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::string> m_values;
+    PropertyChanges m_setCalls;
+    PropertyDescription::SetterCallback m_asyncCallback;
+    int m_flushCount = 0;
+};
+
+TEST_F(PropertyManagerEngineServiceTest, batchNotifiesEachListenerOnce) {
+    registerProperty("aace.test.locale", "en-US");
+    registerProperty("aace.test.timezone", "America/Vancouver");
+    registerProperty("aace.test.wakeword", "ENABLED");
+    auto listener = std::make_shared<TestPropertyListener>();
+    ASSERT_TRUE(m_propertyManager->addListener("aace.test.locale", listener));
+    ASSERT_TRUE(m_propertyManager->addListener("aace.test.timezone", listener));
+    ASSERT_TRUE(m_propertyManager->addListener("aace.test.wakeword", listener));
+
+    ASSERT_TRUE(m_propertyManager->setProperties({{"aace.test.locale", "fr-CA"},
+                                                  {"aace.test.timezone", "America/Montreal"},
+                                                  {"aace.test.wakeword", "ENABLED"}}));
+    waitForExecutor();
+
+    EXPECT_EQ("fr-CA", getValue("aace.test.locale"));
+    EXPECT_EQ("America/Montreal", getValue("aace.test.timezone"));
+    auto notifications = listener->getNotifications();
+    ASSERT_EQ(1u, notifications.size()) << "Listener should be notified once for the batch";
+    PropertyChanges expected = {{"aace.test.locale", "fr-CA"}, {"aace.test.timezone", "America/Montreal"}};
+    EXPECT_EQ(expected, notifications[0]) << "Only the changed properties should be notified";
+}
+
+TEST_F(PropertyManagerEngineServiceTest, failedBatchRestoresProperties) {
+    registerProperty("aace.test.locale", "en-US");
+    registerProperty("aace.test.timezone", "America/Vancouver");
+    auto listener = std::make_shared<TestPropertyListener>();
+    ASSERT_TRUE(m_propertyManager->addListener("aace.test.locale", listener));
+
+    ASSERT_TRUE(m_propertyManager->setProperties({{"aace.test.locale", "fr-CA"}, {"aace.test.timezone", "invalid"}}));
+    waitForExecutor();
+
+    EXPECT_EQ("en-US", getValue("aace.test.locale")) << "Property set by the failed batch should be restored";
+    EXPECT_EQ("America/Vancouver", getValue("aace.test.timezone"));
+    EXPECT_TRUE(listener->getNotifications().empty());
+}
+
+TEST_F(PropertyManagerEngineServiceTest, batchWithUnknownPropertyIsRejected) {
+    registerProperty("aace.test.locale", "en-US");
+
+    EXPECT_FALSE(m_propertyManager->setProperties({{"aace.test.locale", "fr-CA"}, {"aace.test.unknown", "value"}}));
+    EXPECT_FALSE(m_propertyManager->setProperties({}));
+    waitForExecutor();
+
+    EXPECT_EQ("en-US", getValue("aace.test.locale"));
+    EXPECT_TRUE(getSetCalls().empty());
+}
+
+TEST_F(PropertyManagerEngineServiceTest, queuedSetsAreCoalesced) {
+    registerBlockingProperty("aace.test.blocking");
+    registerProperty("aace.test.locale", "en-US");
+
+    // block the executor so the following sets are queued
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.blocking", "block"));
+    ASSERT_EQ(std::future_status::ready, m_blocked.get_future().wait_for(TIMEOUT));
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.locale", "fr-CA"));
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.locale", "de-DE"));
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.locale", "ja-JP"));
+    release();
+    waitForExecutor();
+
+    PropertyChanges expected = {{"aace.test.locale", "ja-JP"}};
+    EXPECT_EQ(expected, getSetCalls()) << "Only the latest queued value should be applied";
+}
+
+TEST_F(PropertyManagerEngineServiceTest, setQueuedAfterBatchIsNotCoalescedIntoEarlierSet) {
+    registerBlockingProperty("aace.test.blocking");
+    registerProperty("aace.test.locale", "en-US");
+
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.blocking", "block"));
+    ASSERT_EQ(std::future_status::ready, m_blocked.get_future().wait_for(TIMEOUT));
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.locale", "fr-CA"));
+    ASSERT_TRUE(m_propertyManager->setProperties({{"aace.test.locale", "de-DE"}}));
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.locale", "ja-JP"));
+    release();
+    waitForExecutor();
+
+    EXPECT_EQ("ja-JP", getValue("aace.test.locale")) << "The last set should win";
+    EXPECT_EQ(3u, getSetCalls().size());
+}
+
+TEST_F(PropertyManagerEngineServiceTest, platformBatchReportsEachProperty) {
+    using PropertyState = TestPlatformPropertyManager::PropertyState;
+    auto platform = std::make_shared<TestPlatformPropertyManager>();
+    ASSERT_TRUE(m_engine->registerPlatformInterface(platform));
+    registerProperty("aace.test.locale", "en-US");
+    registerProperty("aace.test.timezone", "America/Vancouver");
+
+    ASSERT_TRUE(platform->setProperties({{"aace.test.locale", "fr-CA"}, {"aace.test.timezone", "America/Montreal"}}));
+    EXPECT_FALSE(platform->setProperties({{"aace.test.unknown", "value"}}));
+    waitForExecutor();
+
+    EXPECT_EQ("fr-CA", getValue("aace.test.locale"));
+    EXPECT_EQ("America/Montreal", getValue("aace.test.timezone"));
+    std::vector<TestPlatformPropertyManager::StateChange> expected = {
+        std::make_tuple("aace.test.locale", "fr-CA", PropertyState::SUCCEEDED),
+        std::make_tuple("aace.test.timezone", "America/Montreal", PropertyState::SUCCEEDED)};
+    EXPECT_EQ(expected, platform->getStateChanges());
+}
+
+TEST_F(PropertyManagerEngineServiceTest, failedPlatformBatchLeavesAsyncPropertiesToTheirCallback) {
+    using PropertyState = TestPlatformPropertyManager::PropertyState;
+    auto platform = std::make_shared<TestPlatformPropertyManager>();
+    ASSERT_TRUE(m_engine->registerPlatformInterface(platform));
+    registerAsyncProperty("aace.test.wakeword");
+    registerProperty("aace.test.locale", "en-US");
+
+    ASSERT_TRUE(platform->setProperties({{"aace.test.wakeword", "DISABLED"}, {"aace.test.locale", "invalid"}}));
+    waitForExecutor();
+
+    std::vector<TestPlatformPropertyManager::StateChange> expected = {
+        std::make_tuple("aace.test.locale", "invalid", PropertyState::FAILED)};
+    EXPECT_EQ(expected, platform->getStateChanges()) << "Only the synchronous property should be reported failed";
+
+    completeAsyncSet("aace.test.wakeword", "DISABLED", "SUCCEEDED");
+    waitForExecutor();
+    expected.emplace_back("aace.test.wakeword", "DISABLED", PropertyState::SUCCEEDED);
+    EXPECT_EQ(expected, platform->getStateChanges()) << "The asynchronous property should report its own result";
+}
+
+TEST_F(PropertyManagerEngineServiceTest, supersededPlatformSetsAreReportedFailed) {
+    using PropertyState = TestPlatformPropertyManager::PropertyState;
+    auto platform = std::make_shared<TestPlatformPropertyManager>();
+    ASSERT_TRUE(m_engine->registerPlatformInterface(platform));
+    registerBlockingProperty("aace.test.blocking");
+    registerProperty("aace.test.locale", "en-US");
+
+    ASSERT_TRUE(m_propertyManager->setProperty("aace.test.blocking", "block"));
+    ASSERT_EQ(std::future_status::ready, m_blocked.get_future().wait_for(TIMEOUT));
+    ASSERT_TRUE(platform->setProperty("aace.test.locale", "fr-CA"));
+    ASSERT_TRUE(platform->setProperty("aace.test.locale", "de-DE"));
+    ASSERT_TRUE(platform->setProperty("aace.test.locale", "ja-JP"));
+    release();
+    waitForExecutor();
+
+    std::vector<TestPlatformPropertyManager::StateChange> expected = {
+        std::make_tuple("aace.test.locale", "fr-CA", PropertyState::FAILED),
+        std::make_tuple("aace.test.locale", "de-DE", PropertyState::FAILED),
+        std::make_tuple("aace.test.locale", "ja-JP", PropertyState::SUCCEEDED)};
+    EXPECT_EQ(expected, platform->getStateChanges()) << "Only the applied value should be reported as succeeded";
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Audio/IStreamAudioStream.h>
+#include <AACE/Engine/Audio/SharedBufferAudioStream.h>
+
+// testing includes
+#include <AACE/Test/Unit/Core/BenchmarkHelper.h>
+
+using namespace aace::engine::audio;
+using aace::test::unit::core::BenchmarkHelper;
+
+/// The size of an earcon, about a second of 16 kHz 16-bit PCM
+static const size_t EARCON_SIZE = 32000;
+
+/// The size of the reads of a typical audio output provider
+static const size_t READ_SIZE = 4096;
+
+/// Test harness for @c SharedBufferAudioStream class
+class SharedBufferAudioStreamTest : public ::testing::Test {
+public:
+    static std::string createSound(size_t size) {
+        std::string sound(size, '\0');
+        for (size_t i = 0; i < size; i++) {
+            sound[i] = static_cast<char>(i % 251);
+        }
+        return sound;
+    }
+
+    /// Reads a stream to its end, as an audio output provider does
+    static std::string readAll(aace::audio::AudioStream& stream) {
+        std::string result;
+        char data[READ_SIZE];
+        while (!stream.isClosed()) {
+            auto count = stream.read(data, sizeof(data));
+            if (count <= 0) {
+                break;
+            }
+            result.append(data, static_cast<size_t>(count));
+        }
+        return result;
+    }
+
+    /// @return The median of the durations
+    static std::chrono::nanoseconds median(std::vector<std::chrono::nanoseconds> durations) {
+        std::sort(durations.begin(), durations.end());
+        return durations[durations.size() / 2];
+    }
+};
+
+TEST_F(SharedBufferAudioStreamTest, readsLoadedStream) {
+    auto sound = createSound(EARCON_SIZE + 123);
+    auto buffer = SharedBufferAudioStream::load(std::make_shared<std::istringstream>(sound));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(sound.size(), buffer->size());
+
+    auto stream = SharedBufferAudioStream::create(buffer);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(sound, readAll(*stream));
+    EXPECT_TRUE(stream->isClosed());
+    char data[1];
+    EXPECT_EQ(0, stream->read(data, sizeof(data)));
+}
+
+TEST_F(SharedBufferAudioStreamTest, streamsShareTheBuffer) {
+    auto sound = createSound(EARCON_SIZE);
+    auto buffer = SharedBufferAudioStream::load(std::make_shared<std::istringstream>(sound));
+    ASSERT_NE(nullptr, buffer);
+
+    auto first = SharedBufferAudioStream::create(buffer, aace::audio::AudioFormat::UNKNOWN, {{"cache-id", "tone"}});
+    auto second = SharedBufferAudioStream::create(buffer);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    // each stream keeps its own position
+    char data[100];
+    EXPECT_EQ(100, first->read(data, sizeof(data)));
+    EXPECT_EQ(sound, readAll(*second));
+    EXPECT_EQ(sound.substr(100), readAll(*first));
+
+    auto properties = first->getProperties();
+    ASSERT_EQ(1u, properties.size());
+    EXPECT_EQ("tone", properties[0].getValue());
+}
+
+TEST_F(SharedBufferAudioStreamTest, emptyBufferIsClosed) {
+    auto buffer = SharedBufferAudioStream::load(std::make_shared<std::istringstream>(""));
+    ASSERT_NE(nullptr, buffer);
+    auto stream = SharedBufferAudioStream::create(buffer);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_TRUE(stream->isClosed());
+}
+
+TEST_F(SharedBufferAudioStreamTest, invalidArgumentsFail) {
+    EXPECT_EQ(nullptr, SharedBufferAudioStream::load(nullptr));
+    auto badStream = std::make_shared<std::istringstream>("");
+    badStream->setstate(std::ios::badbit);
+    EXPECT_EQ(nullptr, SharedBufferAudioStream::load(badStream));
+    EXPECT_EQ(nullptr, SharedBufferAudioStream::create(nullptr));
+}
+
+/**
+ * Benchmark of the earcon start latency: the time from creating the stream of an earcon to reading its first
+ * chunk. An @c IStreamAudioStream reads from a new source stream on each play, while a @c SharedBufferAudioStream
+ * reads from the loaded buffer. Set @c AAC_BENCHMARK_SCALE to scale up the number of plays.
+ */
+TEST_F(SharedBufferAudioStreamTest, earconStartLatencyBenchmark) {
+    auto sound = createSound(EARCON_SIZE);
+    auto buffer = SharedBufferAudioStream::load(std::make_shared<std::istringstream>(sound));
+    ASSERT_NE(nullptr, buffer);
+    auto plays = BenchmarkHelper::scale(200);
+
+    std::vector<std::chrono::nanoseconds> streamed;
+    std::vector<std::chrono::nanoseconds> shared;
+    char data[READ_SIZE];
+    for (size_t i = 0; i < plays; i++) {
+        auto start = std::chrono::steady_clock::now();
+        auto stream = IStreamAudioStream::create(std::make_shared<std::istringstream>(sound));
+        ASSERT_EQ(static_cast<ssize_t>(READ_SIZE), stream->read(data, sizeof(data)));
+        streamed.push_back(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        auto cached = SharedBufferAudioStream::create(buffer);
+        ASSERT_EQ(static_cast<ssize_t>(READ_SIZE), cached->read(data, sizeof(data)));
+        shared.push_back(std::chrono::steady_clock::now() - start);
+    }
+
+    auto streamedMedian = median(streamed);
+    auto sharedMedian = median(shared);
+    std::cout << "earconStartLatency plays=" << plays << " istreamP50Ns=" << streamedMedian.count()
+              << " sharedBufferP50Ns=" << sharedMedian.count() << std::endl;
+    RecordProperty("istreamP50Nanoseconds", static_cast<int>(streamedMedian.count()));
+    RecordProperty("sharedBufferP50Nanoseconds", static_cast<int>(sharedMedian.count()));
+}
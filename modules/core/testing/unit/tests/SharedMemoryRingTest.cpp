@@ -0,0 +1,366 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AACE/Engine/MessageBroker/SharedMemoryMessageStream.h>
+#include <AACE/Engine/MessageBroker/SharedMemoryRing.h>
+#include <AACE/Engine/MessageBroker/SharedMemoryStreamTransport.h>
+#include <AACE/Engine/MessageBroker/StreamManagerImpl.h>
+
+using namespace aace::engine::messageBroker;
+using Mode = aace::core::MessageStream::Mode;
+
+static const std::chrono::milliseconds NO_WAIT{0};
+static const std::chrono::seconds TIMEOUT{2};
+
+/// The offsets of the capacity and of the producer's index in the shared memory of a ring
+static const size_t CAPACITY_OFFSET = 8;
+static const size_t WRITE_INDEX_OFFSET = 64;
+
+/// A stream handler of the engine, buffering what it is written and serving what it is given to read
+class TestStreamHandler : public aace::core::MessageStream {
+public:
+    TestStreamHandler(Mode mode, const std::string& data = "", bool keepOpen = false) :
+            m_mode(mode), m_data(data), m_keepOpen(keepOpen) {
+    }
+
+    ssize_t read(char* data, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto count = m_data.copy(data, size);
+        m_data.erase(0, count);
+        return count;
+    }
+
+    ssize_t write(const char* data, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size = std::min(size, m_maxWriteSize);
+        m_data.append(data, size);
+        return size;
+    }
+
+    /// Limits the bytes taken by each write, as a handler backed by a bounded buffer would
+    void setMaxWriteSize(size_t size) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_maxWriteSize = size;
+    }
+
+    void close() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+
+    bool isClosed() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mode == Mode::READ ? m_data.empty() && (m_closed || !m_keepOpen) : m_closed;
+    }
+
+    Mode getMode() override {
+        return m_mode;
+    }
+
+    std::string getData() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_data;
+    }
+
+private:
+    Mode m_mode;
+    std::string m_data;
+    bool m_keepOpen;
+    bool m_closed = false;
+    size_t m_maxWriteSize = SIZE_MAX;
+    std::mutex m_mutex;
+};
+
+/// Test harness for @c SharedMemoryRing class
+class SharedMemoryRingTest : public ::testing::Test {
+public:
+    /// Reads @c ring until the end of the stream
+    static std::string readAll(SharedMemoryRing& ring) {
+        std::string result;
+        char data[100];
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (!ring.isEndOfStream() && std::chrono::steady_clock::now() < deadline) {
+            auto count = ring.read(data, sizeof(data), std::chrono::milliseconds(100));
+            result.append(data, count);
+        }
+        return result;
+    }
+
+    static std::string createData(size_t size) {
+        std::string data(size, '\0');
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<char>('a' + i % 26);
+        }
+        return data;
+    }
+};
+
+TEST_F(SharedMemoryRingTest, readsWhatIsWrittenAcrossTheWrap) {
+    auto ring = SharedMemoryRing::create(100);
+    ASSERT_NE(nullptr, ring);
+    EXPECT_EQ(128u, ring->getCapacity()) << "The capacity should be rounded up to a power of two";
+
+    char data[128];
+    for (int round = 0; round < 5; round++) {
+        auto chunk = createData(100);
+        ASSERT_EQ(100, ring->write(chunk.data(), chunk.size(), NO_WAIT));
+        EXPECT_EQ(100u, ring->available());
+        ASSERT_EQ(100, ring->read(data, sizeof(data), NO_WAIT));
+        EXPECT_EQ(chunk, std::string(data, 100));
+    }
+    EXPECT_EQ(0, ring->read(data, sizeof(data), NO_WAIT));
+}
+
+TEST_F(SharedMemoryRingTest, writeStopsWhenFull) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    auto data = createData(100);
+    EXPECT_EQ(64, ring->write(data.data(), data.size(), std::chrono::milliseconds(10)));
+}
+
+TEST_F(SharedMemoryRingTest, closeEndsTheStream) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    ASSERT_EQ(5, ring->write("hello", 5, NO_WAIT));
+    ring->closeWriter();
+    EXPECT_FALSE(ring->isEndOfStream()) << "The written data should be read before the end of the stream";
+    EXPECT_EQ("hello", readAll(*ring));
+    EXPECT_TRUE(ring->isEndOfStream());
+
+    ring->closeReader();
+    EXPECT_EQ(-1, ring->write("hello", 5, NO_WAIT));
+}
+
+TEST_F(SharedMemoryRingTest, blockedSidesAreWoken) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    auto data = createData(10000);
+    std::thread producer([&ring, &data] {
+        size_t offset = 0;
+        while (offset < data.size()) {
+            auto written = ring->write(data.data() + offset, data.size() - offset, TIMEOUT);
+            if (written <= 0) {
+                break;
+            }
+            offset += written;
+        }
+        ring->closeWriter();
+    });
+    EXPECT_EQ(data, readAll(*ring));
+    producer.join();
+}
+
+TEST_F(SharedMemoryRingTest, attachSharesTheRing) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    auto attached =
+        SharedMemoryRing::attach(dup(ring->getMemoryFd()), dup(ring->getDataEventFd()), dup(ring->getSpaceEventFd()));
+    ASSERT_NE(nullptr, attached);
+    EXPECT_EQ(ring->getCapacity(), attached->getCapacity());
+
+    ASSERT_EQ(5, attached->write("hello", 5, NO_WAIT));
+    attached->closeWriter();
+    EXPECT_EQ("hello", readAll(*ring));
+
+    EXPECT_EQ(nullptr, SharedMemoryRing::attach(-1, -1, -1));
+    EXPECT_EQ(nullptr, SharedMemoryRing::create(0));
+}
+
+TEST_F(SharedMemoryRingTest, attachRejectsUnsealedMemory) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    struct stat status;
+    ASSERT_EQ(0, fstat(ring->getMemoryFd(), &status));
+
+    // a copy of a valid ring, which its creator could still shrink
+    int memoryFd = static_cast<int>(syscall(SYS_memfd_create, "unsealed", 0));
+    ASSERT_GE(memoryFd, 0);
+    std::vector<char> contents(status.st_size);
+    ASSERT_EQ(status.st_size, pread(ring->getMemoryFd(), contents.data(), contents.size(), 0));
+    ASSERT_EQ(status.st_size, pwrite(memoryFd, contents.data(), contents.size(), 0));
+    EXPECT_EQ(nullptr, SharedMemoryRing::attach(memoryFd, dup(ring->getDataEventFd()), dup(ring->getSpaceEventFd())));
+}
+
+TEST_F(SharedMemoryRingTest, attachRejectsInvalidCapacity) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    struct stat status;
+    ASSERT_EQ(0, fstat(ring->getMemoryFd(), &status));
+    auto memory = static_cast<char*>(
+        mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->getMemoryFd(), 0));
+    ASSERT_NE(MAP_FAILED, memory);
+    auto capacity = reinterpret_cast<uint32_t*>(memory + CAPACITY_OFFSET);
+    ASSERT_EQ(64u, *capacity);
+
+    auto attach = [&ring]() {
+        return SharedMemoryRing::attach(
+            dup(ring->getMemoryFd()), dup(ring->getDataEventFd()), dup(ring->getSpaceEventFd()));
+    };
+    *capacity = 63;
+    EXPECT_EQ(nullptr, attach()) << "The capacity should be a power of two";
+    *capacity = 32;
+    EXPECT_EQ(nullptr, attach()) << "The capacity should match the size of the memory";
+    *capacity = 64;
+    EXPECT_NE(nullptr, attach());
+    munmap(memory, status.st_size);
+}
+
+TEST_F(SharedMemoryRingTest, readIsBoundedByTheCapacity) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    struct stat status;
+    ASSERT_EQ(0, fstat(ring->getMemoryFd(), &status));
+    auto memory = static_cast<char*>(
+        mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->getMemoryFd(), 0));
+    ASSERT_NE(MAP_FAILED, memory);
+
+    // a misbehaving producer claims to have written more than the ring holds
+    *reinterpret_cast<uint32_t*>(memory + WRITE_INDEX_OFFSET) = 4 * 64;
+    EXPECT_EQ(64u, ring->available());
+    char data[1024];
+    EXPECT_EQ(64, ring->read(data, sizeof(data), NO_WAIT));
+    munmap(memory, status.st_size);
+}
+
+TEST_F(SharedMemoryRingTest, messageStreamUsesOneSideOfTheRing) {
+    auto ring = SharedMemoryRing::create(64);
+    ASSERT_NE(nullptr, ring);
+    EXPECT_EQ(nullptr, SharedMemoryMessageStream::create(ring, Mode::READ_WRITE));
+    auto writer = SharedMemoryMessageStream::create(ring, Mode::WRITE);
+    auto reader = SharedMemoryMessageStream::create(ring, Mode::READ, NO_WAIT);
+    ASSERT_NE(nullptr, writer);
+    ASSERT_NE(nullptr, reader);
+
+    char data[10];
+    EXPECT_EQ(-1, writer->read(data, sizeof(data)));
+    EXPECT_EQ(5, writer->write("hello", 5));
+    writer->close();
+    EXPECT_FALSE(reader->isClosed());
+    EXPECT_EQ(5, reader->read(data, sizeof(data)));
+    EXPECT_TRUE(reader->isClosed());
+
+    reader->close();
+    EXPECT_TRUE(writer->isClosed());
+}
+
+TEST_F(SharedMemoryRingTest, transportServesStreamsReadByAnotherProcess) {
+    auto streamManager = StreamManagerImpl::create();
+    auto transport = SharedMemoryStreamTransport::create(streamManager);
+    ASSERT_NE(nullptr, transport);
+    auto data = createData(20000);
+    ASSERT_TRUE(streamManager->registerStreamHandler("output", std::make_shared<TestStreamHandler>(Mode::READ, data)));
+
+    auto ring = transport->openStream("output", Mode::READ, 1024);
+    ASSERT_NE(nullptr, ring);
+    EXPECT_EQ(data, readAll(*ring));
+    EXPECT_EQ(nullptr, transport->openStream("output", Mode::READ)) << "The handler should only be served once";
+    transport->shutdown();
+}
+
+TEST_F(SharedMemoryRingTest, transportServesStreamsWrittenByAnotherProcess) {
+    auto streamManager = StreamManagerImpl::create();
+    auto transport = SharedMemoryStreamTransport::create(streamManager);
+    ASSERT_NE(nullptr, transport);
+    auto handler = std::make_shared<TestStreamHandler>(Mode::WRITE);
+    ASSERT_TRUE(streamManager->registerStreamHandler("input", handler));
+
+    auto ring = transport->openStream("input", Mode::WRITE, 1024);
+    ASSERT_NE(nullptr, ring);
+    auto data = createData(20000);
+    size_t offset = 0;
+    while (offset < data.size()) {
+        auto written = ring->write(data.data() + offset, data.size() - offset, TIMEOUT);
+        ASSERT_GT(written, 0);
+        offset += written;
+    }
+    ring->closeWriter();
+
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (!handler->isClosed() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_TRUE(handler->isClosed()) << "The handler should be closed when the other process closes the stream";
+    EXPECT_EQ(data, handler->getData());
+    transport->shutdown();
+}
+
+TEST_F(SharedMemoryRingTest, transportWritesEveryByteToHandlersTakingPartOfAChunk) {
+    auto streamManager = StreamManagerImpl::create();
+    auto transport = SharedMemoryStreamTransport::create(streamManager);
+    ASSERT_NE(nullptr, transport);
+    auto handler = std::make_shared<TestStreamHandler>(Mode::WRITE);
+    handler->setMaxWriteSize(7);
+    ASSERT_TRUE(streamManager->registerStreamHandler("input", handler));
+
+    auto ring = transport->openStream("input", Mode::WRITE, 1024);
+    ASSERT_NE(nullptr, ring);
+    auto data = createData(5000);
+    size_t offset = 0;
+    while (offset < data.size()) {
+        auto written = ring->write(data.data() + offset, data.size() - offset, TIMEOUT);
+        ASSERT_GT(written, 0);
+        offset += written;
+    }
+    ring->closeWriter();
+
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (!handler->isClosed() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_TRUE(handler->isClosed());
+    EXPECT_EQ(data, handler->getData());
+    transport->shutdown();
+}
+
+TEST_F(SharedMemoryRingTest, transportPumpsDataThatArrivesLater) {
+    auto streamManager = StreamManagerImpl::create();
+    auto transport = SharedMemoryStreamTransport::create(streamManager);
+    ASSERT_NE(nullptr, transport);
+    auto handler = std::make_shared<TestStreamHandler>(Mode::READ, "", true);
+    ASSERT_TRUE(streamManager->registerStreamHandler("output", handler));
+
+    auto ring = transport->openStream("output", Mode::READ, 1024);
+    ASSERT_NE(nullptr, ring);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    handler->write("hello", 5);
+
+    std::string result;
+    char data[10];
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (result.size() < 5 && std::chrono::steady_clock::now() < deadline) {
+        result.append(data, ring->read(data, sizeof(data), std::chrono::milliseconds(100)));
+    }
+    EXPECT_EQ("hello", result);
+
+    auto start = std::chrono::steady_clock::now();
+    transport->shutdown();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500))
+        << "Shutdown should wake an idle pump";
+}
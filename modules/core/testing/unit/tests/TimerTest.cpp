@@ -0,0 +1,167 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/Utils/Timing/Timer.h>
+#include <AACE/Engine/Utils/Timing/TimerScheduler.h>
+
+using namespace aace::engine::utils::timing;
+using namespace std::chrono;
+
+/// Test harness for @c Timer class, using a scheduler with a virtual clock
+class TimerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_scheduler = TimerScheduler::createWithVirtualClock();
+    }
+
+    /// @return The virtual time elapsed since the test started
+    milliseconds elapsed() {
+        return duration_cast<milliseconds>(m_scheduler->now().time_since_epoch());
+    }
+
+protected:
+    std::shared_ptr<TimerScheduler> m_scheduler;
+};
+
+TEST_F(TimerTest, oneShotTimerRunsOnceAfterDelay) {
+    Timer timer(nanoseconds::zero(), m_scheduler);
+    auto future = timer.start(milliseconds(100), []() { return 42; });
+    ASSERT_TRUE(future.valid());
+    EXPECT_TRUE(timer.isActive());
+
+    m_scheduler->advance(milliseconds(99));
+    EXPECT_NE(future.wait_for(seconds::zero()), std::future_status::ready);
+
+    m_scheduler->advance(milliseconds(1));
+    ASSERT_EQ(future.wait_for(seconds::zero()), std::future_status::ready);
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_FALSE(timer.isActive());
+}
+
+TEST_F(TimerTest, periodicTimerStopsAfterMaxCount) {
+    Timer timer(nanoseconds::zero(), m_scheduler);
+    std::vector<milliseconds> calls;
+    ASSERT_TRUE(timer.start(milliseconds(50), milliseconds(100), Timer::PeriodType::ABSOLUTE, 3, [&]() {
+        calls.push_back(elapsed());
+    }));
+
+    m_scheduler->advance(seconds(1));
+    std::vector<milliseconds> expected = {milliseconds(50), milliseconds(150), milliseconds(250)};
+    EXPECT_EQ(calls, expected);
+    EXPECT_FALSE(timer.isActive());
+}
+
+TEST_F(TimerTest, absoluteTimerSkipsCallsAfterOverrun) {
+    Timer timer(nanoseconds::zero(), m_scheduler);
+    std::vector<milliseconds> calls;
+    ASSERT_TRUE(timer.start(milliseconds(100), Timer::PeriodType::ABSOLUTE, Timer::FOREVER, [&]() {
+        calls.push_back(elapsed());
+        if (calls.size() == 1) {
+            // the first call overruns the period
+            m_scheduler->advance(milliseconds(150));
+        }
+    }));
+
+    m_scheduler->advance(milliseconds(100));
+    m_scheduler->advance(milliseconds(100));
+    m_scheduler->advance(milliseconds(100));
+    timer.stop();
+
+    std::vector<milliseconds> expected = {milliseconds(100), milliseconds(300), milliseconds(400)};
+    EXPECT_EQ(calls, expected) << "The call at 200ms should be skipped after the overrun";
+}
+
+TEST_F(TimerTest, relativeTimerWaitsAfterEachCall) {
+    Timer timer(nanoseconds::zero(), m_scheduler);
+    std::vector<milliseconds> calls;
+    ASSERT_TRUE(timer.start(milliseconds(100), Timer::PeriodType::RELATIVE, Timer::FOREVER, [&]() {
+        calls.push_back(elapsed());
+    }));
+
+    m_scheduler->advance(milliseconds(130));
+    m_scheduler->advance(milliseconds(100));
+    timer.stop();
+    m_scheduler->advance(seconds(1));
+
+    std::vector<milliseconds> expected = {milliseconds(100), milliseconds(200)};
+    EXPECT_EQ(calls, expected);
+    EXPECT_FALSE(timer.isActive());
+}
+
+TEST_F(TimerTest, stopFromTaskPreventsFurtherCalls) {
+    Timer timer(nanoseconds::zero(), m_scheduler);
+    int count = 0;
+    ASSERT_TRUE(timer.start(milliseconds(10), Timer::PeriodType::ABSOLUTE, Timer::FOREVER, [&]() {
+        if (++count == 2) {
+            timer.stop();
+        }
+    }));
+
+    m_scheduler->advance(seconds(1));
+    EXPECT_EQ(count, 2);
+    EXPECT_FALSE(timer.isActive());
+}
+
+TEST_F(TimerTest, slackCoalescesTimers) {
+    Timer urgentTimer(nanoseconds::zero(), m_scheduler);
+    Timer lowPriorityTimer(milliseconds(500), m_scheduler);
+    milliseconds urgentCall{-1};
+    milliseconds lowPriorityCall{-1};
+
+    lowPriorityTimer.start(milliseconds(100), [&]() { lowPriorityCall = elapsed(); });
+    urgentTimer.start(milliseconds(300), [&]() { urgentCall = elapsed(); });
+
+    m_scheduler->advance(seconds(1));
+    EXPECT_EQ(urgentCall, milliseconds(300));
+    EXPECT_EQ(lowPriorityCall, milliseconds(300)) << "The low priority call should run with the urgent call";
+}
+
+TEST_F(TimerTest, slackBoundsTheDelay) {
+    Timer lowPriorityTimer(milliseconds(500), m_scheduler);
+    milliseconds lowPriorityCall{-1};
+
+    lowPriorityTimer.start(milliseconds(100), [&]() { lowPriorityCall = elapsed(); });
+
+    m_scheduler->advance(seconds(1));
+    EXPECT_EQ(lowPriorityCall, milliseconds(600));
+}
+
+TEST_F(TimerTest, timersShareTheEngineScheduler) {
+    Timer timer1;
+    Timer timer2;
+    auto future1 = timer1.start(milliseconds(20), []() { return std::this_thread::get_id(); });
+    auto future2 = timer2.start(milliseconds(10), []() { return std::this_thread::get_id(); });
+
+    ASSERT_EQ(future1.wait_for(seconds(2)), std::future_status::ready);
+    ASSERT_EQ(future2.wait_for(seconds(2)), std::future_status::ready);
+    auto thread = future1.get();
+    EXPECT_EQ(thread, future2.get());
+    EXPECT_NE(thread, std::this_thread::get_id());
+}
+
+TEST_F(TimerTest, stopBreaksPromiseOfPendingCall) {
+    Timer timer;
+    auto future = timer.start(seconds(10), []() { return 42; });
+    timer.stop();
+    EXPECT_FALSE(timer.isActive());
+    EXPECT_THROW(future.get(), std::future_error);
+}
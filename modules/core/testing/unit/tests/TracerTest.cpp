@@ -0,0 +1,133 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
+
+using namespace aace::engine::utils::tracing;
+using json = nlohmann::json;
+
+/// Test harness for @c Tracer class
+class TracerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        Tracer::clear();
+        Tracer::setEnabled(true);
+    }
+
+    void TearDown() override {
+        Tracer::setEnabled(false);
+        Tracer::setSpanObserver(nullptr);
+        Tracer::setBufferSize(Tracer::DEFAULT_BUFFER_SIZE);
+        Tracer::clear();
+    }
+
+    /// Exports the trace, and returns its events other than the thread name metadata
+    static std::vector<json> getEvents() {
+        std::stringstream stream;
+        Tracer::writeChromeTrace(stream);
+        auto trace = json::parse(stream.str());
+        std::vector<json> events;
+        for (auto& event : trace.at("traceEvents")) {
+            if (event.at("ph") != "M") {
+                events.push_back(event);
+            }
+        }
+        return events;
+    }
+};
+
+TEST_F(TracerTest, disabledTracingRecordsNothing) {
+    Tracer::setEnabled(false);
+    {
+        AACE_TRACE_SPAN("Test", "Span");
+        AACE_TRACE_INSTANT("Test", "Instant");
+    }
+    EXPECT_TRUE(getEvents().empty());
+}
+
+TEST_F(TracerTest, spansAndInstantsAreExported) {
+    {
+        AACE_TRACE_SPAN("Test", "Outer");
+        AACE_TRACE_INSTANT("Test", "Instant \"quoted\"");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    auto events = getEvents();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ("Instant \"quoted\"", events[0].at("name"));
+    EXPECT_EQ("i", events[0].at("ph"));
+    EXPECT_EQ("Outer", events[1].at("name"));
+    EXPECT_EQ("Test", events[1].at("cat"));
+    EXPECT_EQ("X", events[1].at("ph"));
+    EXPECT_GE(events[1].at("dur").get<double>(), 2000.0) << "Duration should be in microseconds";
+    EXPECT_LE(events[1].at("ts").get<double>(), events[0].at("ts").get<double>());
+}
+
+TEST_F(TracerTest, spanStartedWhileDisabledIsNotRecorded) {
+    Tracer::setEnabled(false);
+    Span span("Test", "Span");
+    Tracer::setEnabled(true);
+    span.end();
+    EXPECT_TRUE(getEvents().empty());
+}
+
+TEST_F(TracerTest, ringBufferKeepsNewestEvents) {
+    Tracer::setBufferSize(4);
+    std::thread thread([] {
+        static const char* names[] = {"0", "1", "2", "3", "4", "5"};
+        for (auto name : names) {
+            Tracer::instant("Test", name);
+        }
+    });
+    thread.join();
+
+    auto events = getEvents();
+    ASSERT_EQ(4u, events.size());
+    EXPECT_EQ("2", events[0].at("name"));
+    EXPECT_EQ("5", events[3].at("name"));
+}
+
+TEST_F(TracerTest, observerReceivesSpanDurations) {
+    std::vector<std::string> names;
+    Tracer::Clock::duration total{0};
+    Tracer::setSpanObserver([&](const char* category, const char* name, Tracer::Clock::duration duration) {
+        names.push_back(std::string(category) + "." + name);
+        total += duration;
+    });
+
+    { AACE_TRACE_SPAN("Test", "Span"); }
+    Tracer::observe("Executor", "QueueLatency", std::chrono::milliseconds(5));
+    AACE_TRACE_INSTANT("Test", "Instant");
+
+    ASSERT_EQ(2u, names.size());
+    EXPECT_EQ("Test.Span", names[0]);
+    EXPECT_EQ("Executor.QueueLatency", names[1]);
+    EXPECT_GE(total, std::chrono::milliseconds(5));
+}
+
+TEST_F(TracerTest, clearRemovesEvents) {
+    AACE_TRACE_INSTANT("Test", "Instant");
+    ASSERT_EQ(1u, getEvents().size());
+    Tracer::clear();
+    EXPECT_TRUE(getEvents().empty());
+}
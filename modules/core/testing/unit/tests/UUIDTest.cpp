@@ -0,0 +1,189 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+// testing includes
+#include <AACE/Test/Unit/Core/BenchmarkHelper.h>
+
+using namespace aace::engine::utils::uuid;
+using namespace aace::test::unit::core;
+
+static const size_t BENCHMARK_THREADS = 8;
+
+/// Test harness for UUID generation
+class UUIDTest : public ::testing::Test {
+public:
+    static bool isVersion4(const std::string& uuid) {
+        static const std::string HEX = "0123456789abcdef";
+        if (uuid.size() != 36 || uuid[8] != '-' || uuid[13] != '-' || uuid[18] != '-' || uuid[23] != '-') {
+            return false;
+        }
+        for (size_t i = 0; i < uuid.size(); i++) {
+            if (uuid[i] != '-' && HEX.find(uuid[i]) == std::string::npos) {
+                return false;
+            }
+        }
+        return uuid[14] == '4' && std::string("89ab").find(uuid[19]) != std::string::npos;
+    }
+
+    /// The generation this implementation replaced, a locked generator formatting with streams
+    static std::string generateLockedStreamUUID() {
+        static std::mt19937 engine{std::random_device()()};
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::ostringstream uuid;
+        uuid << std::hex << std::setfill('0') << std::setw(8) << engine() << "-";
+        uuid << std::setw(4) << (engine() & 0xffff) << "-" << std::setw(4) << ((engine() & 0x0fff) | 0x4000) << "-";
+        uuid << std::setw(4) << ((engine() & 0x3fff) | 0x8000) << "-";
+        uuid << std::setw(8) << engine() << std::setw(4) << (engine() & 0xffff);
+        return uuid.str();
+    }
+
+    /// Returns the mean time of a generation with @c threads threads generating concurrently
+    template <typename Generate>
+    static double measureNanoseconds(size_t threads, size_t count, Generate generate) {
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < threads; i++) {
+            workers.emplace_back([count, &generate] {
+                size_t length = 0;
+                for (size_t j = 0; j < count; j++) {
+                    length += generate().size();
+                }
+                EXPECT_EQ(36 * count, length);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (threads * count);
+    }
+};
+
+TEST_F(UUIDTest, generatesVersion4Variant1) {
+    for (int i = 0; i < 1000; i++) {
+        auto uuid = generateUUID();
+        ASSERT_TRUE(isVersion4(uuid)) << uuid;
+    }
+}
+
+TEST_F(UUIDTest, binaryFormRoundTrips) {
+    auto uuid = UUID::generate();
+    auto text = uuid.toString();
+    EXPECT_TRUE(isVersion4(text)) << text;
+
+    UUID parsed;
+    ASSERT_TRUE(UUID::fromString(text, parsed));
+    EXPECT_EQ(uuid, parsed);
+
+    std::string upper = text;
+    for (auto& c : upper) {
+        c = static_cast<char>(std::toupper(c));
+    }
+    ASSERT_TRUE(UUID::fromString(upper, parsed));
+    EXPECT_EQ(uuid, parsed);
+    EXPECT_TRUE(compare(text, upper));
+
+    ASSERT_TRUE(UUID::fromString("01234567-89ab-4def-8123-456789abcdef", parsed));
+    EXPECT_EQ(0x0123456789ab4defULL, parsed.high);
+    EXPECT_EQ(0x8123456789abcdefULL, parsed.low);
+    EXPECT_EQ("01234567-89ab-4def-8123-456789abcdef", parsed.toString());
+
+    EXPECT_FALSE(UUID::fromString("", parsed));
+    EXPECT_FALSE(UUID::fromString("01234567-89ab-4def-8123-456789abcdeg", parsed));
+    EXPECT_FALSE(UUID::fromString("01234567_89ab-4def-8123-456789abcdef", parsed));
+    EXPECT_FALSE(UUID::fromString("0123456789ab-4def-8123-456789abcdef0", parsed));
+}
+
+TEST_F(UUIDTest, threadsGenerateDistinctUUIDs) {
+    const size_t count = 10000;
+    std::vector<std::vector<UUID>> generated(4);
+    std::vector<std::thread> threads;
+    for (auto& uuids : generated) {
+        threads.emplace_back([&uuids, count] {
+            for (size_t i = 0; i < count; i++) {
+                uuids.push_back(UUID::generate());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::unordered_set<UUID> distinct;
+    for (auto& uuids : generated) {
+        distinct.insert(uuids.begin(), uuids.end());
+    }
+    EXPECT_EQ(generated.size() * count, distinct.size());
+}
+
+TEST_F(UUIDTest, forkedChildDoesNotRepeatParent) {
+    // use the generator of this thread before forking, so the child inherits its state
+    generateUUID();
+
+    int pipeFds[2];
+    ASSERT_EQ(0, pipe(pipeFds));
+    auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        auto uuid = generateUUID();
+        auto written = write(pipeFds[1], uuid.data(), uuid.size());
+        _exit(written == static_cast<ssize_t>(uuid.size()) ? 0 : 1);
+    }
+    auto parentUUID = generateUUID();
+    char childUUID[36];
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(childUUID)), read(pipeFds[0], childUUID, sizeof(childUUID)));
+    int status = 0;
+    waitpid(pid, &status, 0);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+    EXPECT_NE(parentUUID, std::string(childUUID, sizeof(childUUID)));
+}
+
+TEST_F(UUIDTest, contendedGenerationBenchmark) {
+    auto count = BenchmarkHelper::scale(20000);
+
+    auto lockedSingle = measureNanoseconds(1, count, generateLockedStreamUUID);
+    auto lockedContended = measureNanoseconds(BENCHMARK_THREADS, count, generateLockedStreamUUID);
+    auto threadLocalSingle = measureNanoseconds(1, count, generateUUID);
+    auto threadLocalContended = measureNanoseconds(BENCHMARK_THREADS, count, generateUUID);
+
+    std::cout << "uuidGeneration count=" << count << " threads=" << BENCHMARK_THREADS
+              << " lockedStreamNs=" << lockedSingle << " lockedStreamContendedNs=" << lockedContended
+              << " threadLocalNs=" << threadLocalSingle << " threadLocalContendedNs=" << threadLocalContended
+              << std::endl;
+    RecordProperty("lockedStreamContendedNanoseconds", static_cast<int>(lockedContended));
+    RecordProperty("threadLocalContendedNanoseconds", static_cast<int>(threadLocalContended));
+    EXPECT_LT(threadLocalContended, lockedContended);
+}
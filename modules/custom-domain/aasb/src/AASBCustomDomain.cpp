@@ -17,6 +17,7 @@
 #include <AACE/Engine/Core/EngineMacros.h>
 
 #include <AASB/Message/CustomDomain/CustomDomain/CancelDirectiveMessage.h>
+#include <AASB/Message/CustomDomain/CustomDomain/ContextChangedMessage.h>
 #include <AASB/Message/CustomDomain/CustomDomain/GetContextMessage.h>
 #include <AASB/Message/CustomDomain/CustomDomain/HandleDirectiveMessage.h>
 #include <AASB/Message/CustomDomain/CustomDomain/ReportDirectiveHandlingResultMessage.h>
@@ -80,6 +81,21 @@ bool AASBCustomDomain::initialize(std::shared_ptr<aace::engine::messageBroker::M
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::customDomain::customDomain::ContextChangedMessage::topic(),
+            aasb::message::customDomain::customDomain::ContextChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::customDomain::customDomain::ContextChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->contextChanged(payload.contextNamespace, payload.customContext);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            });
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "initialize").d("reason", ex.what()));
@@ -202,6 +202,19 @@ abstract public class CustomDomain extends PlatformInterface {
         sendEvent(getNativeRef(), eventNamespace, name, payload, requiresContext, correlationToken, customContext);
     }
 
+    /**
+     * Notifies the engine that the context of a namespace changed. Once the context of a namespace is pushed, the
+     * engine answers the context requests of the namespace from the pushed context and only calls @c getContext()
+     * after the context is invalidated.
+     *
+     * @param [in] contextNamespace The namespace of the context.
+     * @param [in] customContext The context corresponding to @a contextNamespace, in the format described in
+     *         @c getContext(), or an empty string to invalidate the pushed context.
+     */
+    public final void contextChanged(String contextNamespace, String customContext) {
+        contextChanged(getNativeRef(), contextNamespace, customContext);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -218,4 +231,5 @@ abstract public class CustomDomain extends PlatformInterface {
             boolean requiresContext, String correlationToken, String customContext);
     private native void reportDirectiveHandlingResult(
             long nativeRef, String directiveNamespace, String messageId, ResultType result);
+    private native void contextChanged(long nativeRef, String contextNamespace, String customContext);
 }
\ No newline at end of file
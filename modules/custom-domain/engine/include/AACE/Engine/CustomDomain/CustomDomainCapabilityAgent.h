@@ -141,6 +141,14 @@ public:
         const std::string& correlationToken = "",
         const std::string& customContext = "");
 
+    /**
+     * Updates the cached context of this interface with the context pushed by the platform. Once the platform
+     * pushes its context, context requests are answered from the cache and the platform is only queried with
+     * @c getContext() after the cache is invalidated.
+     * @param customContext A string of the context of this interface, or an empty string to invalidate the cache.
+     */
+    void contextChanged(const std::string& customContext);
+
     /**
      * Callback method on the result of directive handling from platform.
      * @param messageId An ID that uniquely identifies the directive.
@@ -188,19 +196,25 @@ private:
         const alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken contextRequestToken);
 
     /**
-     * Parse the given context in string and update the cache.
+     * Maps CapabilityTag (representing a state name) to the corresponding state. The state values are stored
+     * serialized, so a context is parsed once and the states are provided without copying the map.
+     */
+    using StatesMap = std::
+        unordered_map<alexaClientSDK::avsCommon::avs::CapabilityTag, alexaClientSDK::avsCommon::avs::CapabilityState>;
+
+    /**
+     * Parse the given context in string.
      * @param customContext The context for this namespace in string
-     * @param contextRequestToken The token of the current context request
+     * @return The states of the context, or @c nullptr if the context is invalid
      */
-    bool parseAndUpdateContext(
-        const std::string& customContext,
-        const alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken contextRequestToken);
+    std::shared_ptr<const StatesMap> parseContext(const std::string& customContext);
 
     /**
-     * Check if the context is available in candidate cache.
+     * Get the states of the context in candidate cache, and remove the candidate from the cache.
      * @param contextRequestToken The token of the current context request
+     * @return The states of the candidate context, or @c nullptr if no valid candidate is available
      */
-    bool getCandidateContextIfAvailable(
+    std::shared_ptr<const StatesMap> getCandidateContextIfAvailable(
         const alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken contextRequestToken);
 
     /**
@@ -237,13 +251,8 @@ private:
     /// The agent manager
     std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> m_agentManager;
 
-    /** 
-     * Maps CapabilityTag (representing a state name) to the corresponding state.
-     */
-    using StatesMap = std::
-        unordered_map<alexaClientSDK::avsCommon::avs::CapabilityTag, alexaClientSDK::avsCommon::avs::CapabilityState>;
-
-    using ContextRequestState = std::pair<alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken, StatesMap>;
+    using ContextRequestState =
+        std::pair<alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken, std::shared_ptr<const StatesMap>>;
 
     /**
      * Caches the context request token with its states being queried by Context Manager. It will be updated every time when Context Manager
@@ -251,6 +260,15 @@ private:
      */
     ContextRequestState m_stateProviderCache;
 
+    /**
+     * The states of the last context of this namespace, shared by the context requests until the platform pushes
+     * a new context or invalidates it. @c nullptr if the context must be queried from the platform.
+     */
+    std::shared_ptr<const StatesMap> m_contextCache;
+
+    /// Whether the platform pushes its context changes, so a queried context can be cached until it is invalidated
+    bool m_contextPushed = false;
+
     /**
      * Maps context request tokens  to candidate context (sent with sendEvent() call) for this namespace. When querying context, this map
      * will be firstly checked before query from the device.
@@ -294,65 +294,97 @@ void CustomDomainCapabilityAgent::executeProvideState(
         return;
     }
 
-    // Refresh the cache
-    if (m_stateProviderCache.first != contextRequestToken) {
-        // Check candidate cache first
-        if (!getCandidateContextIfAvailable(contextRequestToken)) {
-            // If no candidate is available, query device instead
-            auto namespaceContext = m_customDomainHandler->getContext(m_namespace);
-            if (!parseAndUpdateContext(namespaceContext, contextRequestToken)) {
+    // Refresh the states of the request once, for the first state requested with the token
+    if (m_stateProviderCache.first != contextRequestToken || m_stateProviderCache.second == nullptr) {
+        // Check candidate cache first, then the context cache
+        auto states = getCandidateContextIfAvailable(contextRequestToken);
+        if (states == nullptr) {
+            states = m_contextCache;
+        }
+        if (states == nullptr) {
+            // If no context is available, query device instead
+            states = parseContext(m_customDomainHandler->getContext(m_namespace));
+            if (states == nullptr) {
                 AACE_ERROR(LX(TAG, "executeProvideState").d("reason", "invalidContextFormat"));
                 m_contextManager->provideStateUnavailableResponse(stateProviderName, contextRequestToken, false);
                 return;
             }
+            if (m_contextPushed) {
+                // the platform notifies the context changes, so the queried context is valid until the next one
+                m_contextCache = states;
+            }
         }
+        m_stateProviderCache = std::make_pair(contextRequestToken, states);
     }
 
     // Provide State
-    auto stateMap = m_stateProviderCache.second;
-    m_contextManager->provideStateResponse(
-        stateProviderName, stateMap[NamespaceAndName{stateProviderName}], contextRequestToken);
+    auto& states = *m_stateProviderCache.second;
+    auto it = states.find(NamespaceAndName{stateProviderName});
+    if (it != states.end() && it->second.timeOfSample.getTime_Unix() != 0) {
+        m_contextManager->provideStateResponse(stateProviderName, it->second, contextRequestToken);
+        return;
+    }
+    // the parsed states are shared by later requests, so a state without its own time of sample is sampled now
+    CapabilityState state = it != states.end() ? it->second : CapabilityState();
+    state.timeOfSample = timing::TimePoint::now();
+    m_contextManager->provideStateResponse(stateProviderName, state, contextRequestToken);
+}
+
+void CustomDomainCapabilityAgent::contextChanged(const std::string& customContext) {
+    AACE_INFO(LX(TAG));
+    m_executor.submit([this, customContext] {
+        m_contextPushed = true;
+        if (customContext.empty()) {
+            AACE_DEBUG(LX(TAG, "contextChanged").m("contextInvalidated"));
+            m_contextCache.reset();
+            return;
+        }
+        // an invalid context invalidates the cache, so the context is queried from the device instead
+        m_contextCache = parseContext(customContext);
+    });
 }
 
 bool CustomDomainCapabilityAgent::canStateBeRetrieved() {
     return true;
 }
 
-bool CustomDomainCapabilityAgent::getCandidateContextIfAvailable(const ContextRequestToken contextRequestToken) {
-    if (m_sendEventStateCache.find(contextRequestToken) == m_sendEventStateCache.end()) {
+std::shared_ptr<const CustomDomainCapabilityAgent::StatesMap> CustomDomainCapabilityAgent::
+    getCandidateContextIfAvailable(const ContextRequestToken contextRequestToken) {
+    auto it = m_sendEventStateCache.find(contextRequestToken);
+    if (it == m_sendEventStateCache.end()) {
         AACE_DEBUG(LX(TAG).m("requestedContextNotAvailable").d("token", contextRequestToken));
-        return false;
+        return nullptr;
     }
-    bool result = parseAndUpdateContext(m_sendEventStateCache[contextRequestToken], contextRequestToken);
+    auto states = parseContext(it->second);
 
     // Clear used candidate context
-    m_sendEventStateCache.erase(contextRequestToken);
-    return result;
+    m_sendEventStateCache.erase(it);
+    return states;
 }
 
-bool CustomDomainCapabilityAgent::parseAndUpdateContext(
-    const std::string& customContext,
-    const ContextRequestToken contextRequestToken) {
+std::shared_ptr<const CustomDomainCapabilityAgent::StatesMap> CustomDomainCapabilityAgent::parseContext(
+    const std::string& customContext) {
     try {
         ThrowIf(customContext.empty(), "invalidContextProvided");
         auto contextJson = json::parse(customContext);
         ThrowIfNot(contextJson.contains("context") && contextJson["context"].is_array(), "invalidContextProvided");
 
-        StatesMap statesMap;
+        auto statesMap = std::make_shared<StatesMap>();
         for (auto& state : contextJson["context"]) {
             // Parse
             ThrowIfNot(state.contains("name") && state["name"].is_string(), "invalidStateName");
             ThrowIfNot(state.contains("value"), "invalidStateValue");
-            auto stateName = state["name"];
-            auto value = state["value"];
+            auto& stateName = state["name"];
+            auto& value = state["value"];
 
             if (m_states.find(NamespaceAndName{m_namespace, stateName}) == m_states.end()) {
                 // Skip the unknown state
-                AACE_ERROR(LX(TAG, "parseAndUpdateContext").m("unknownStateProvided"));
+                AACE_ERROR(LX(TAG, "parseContext").m("unknownStateProvided"));
                 continue;
             }
 
-            timing::TimePoint timeOfSample = timing::TimePoint::now();
+            // left unset unless the platform gives it, so the state is sampled when it is provided
+            timing::TimePoint timeOfSample;
             if (state.contains("timeOfSample") && state["timeOfSample"].is_string()) {
                 timeOfSample.setTime_ISO_8601(state["timeOfSample"]);
             }
@@ -363,17 +395,15 @@ bool CustomDomainCapabilityAgent::parseAndUpdateContext(
             }
 
             // Update StatesMap
-            statesMap[NamespaceAndName{m_namespace, stateName}] =
+            (*statesMap)[NamespaceAndName{m_namespace, stateName}] =
                 CapabilityState{value.dump(), timeOfSample, uncertaintyInMilliseconds};
         }
 
-        // Update m_stateProviderCache
-        m_stateProviderCache = std::make_pair(contextRequestToken, statesMap);
-        return true;
+        return statesMap;
 
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "parseAndUpdateContext").d("reason", ex.what()));
-        return false;
+        AACE_ERROR(LX(TAG, "parseContext").d("reason", ex.what()));
+        return nullptr;
     }
 }
 
@@ -510,6 +540,8 @@ void CustomDomainCapabilityAgent::doShutdown() {
     }
     m_contextManager.reset();
     m_sendEventStateCache.clear();
+    m_stateProviderCache.second.reset();
+    m_contextCache.reset();
     m_pendingEvents.clear();
     m_pendingDirectives.clear();
     m_states.clear();
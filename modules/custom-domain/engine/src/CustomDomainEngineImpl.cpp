@@ -248,6 +248,16 @@ void CustomDomainEngineImpl::onSendEvent(
     m_capabilityAgentMap[eventNamespace]->sendEvent(name, payload, requiresContext, correlationToken, customContext);
 }
 
+void CustomDomainEngineImpl::onContextChanged(const std::string& contextNamespace, const std::string& customContext) {
+    AACE_INFO(LX(TAG).d("namespace", contextNamespace));
+    auto it = m_capabilityAgentMap.find(contextNamespace);
+    if (it == m_capabilityAgentMap.end()) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidNamespace").d("namespace", contextNamespace));
+        return;
+    }
+    it->second->contextChanged(customContext);
+}
+
 }  // namespace customDomain
 }  // namespace engine
 }  // namespace aace
@@ -166,6 +166,17 @@ public:
         const std::string& correlationToken = "",
         const std::string& customContext = "");
 
+    /**
+    * Notifies the engine that the context of a namespace changed. Once the context of a namespace is pushed,
+    * the engine answers the context requests of the namespace from the pushed context and only calls
+    * @c getContext() after the context is invalidated.
+    *
+    * @param [in] contextNamespace The namespace of the context.
+    * @param [in] customContext The context corresponding to @a contextNamespace, in the format described in
+    * @c getContext(), or an empty string to invalidate the pushed context.
+    */
+    void contextChanged(const std::string& contextNamespace, const std::string& customContext);
+
     /**
     * @internal
     * Sets the Engine interface delegate
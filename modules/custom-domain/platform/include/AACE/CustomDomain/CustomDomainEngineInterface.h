@@ -58,6 +58,8 @@ public:
         const std::string& directiveNamespace,
         const std::string& messageId,
         ResultType result) = 0;
+
+    virtual void onContextChanged(const std::string& contextNamespace, const std::string& customContext) = 0;
 };
 
 }  // namespace customDomain
@@ -43,6 +43,12 @@ void CustomDomain::reportDirectiveHandlingResult(
     }
 }
 
+void CustomDomain::contextChanged(const std::string& contextNamespace, const std::string& customContext) {
+    if (m_customDomainEngineInterface != nullptr) {
+        m_customDomainEngineInterface->onContextChanged(contextNamespace, customContext);
+    }
+}
+
 void CustomDomain::setEngineInterface(std::shared_ptr<CustomDomainEngineInterface> customDomainEngineInterface) {
     m_customDomainEngineInterface = customDomainEngineInterface;
 }
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <future>
+#include <thread>
 
 #include <AVSCommon/SDKInterfaces/test/MockContextManager.h>
 #include <AVSCommon/SDKInterfaces/test/MockExceptionEncounteredSender.h>
@@ -308,6 +309,130 @@ TEST_F(CustomDomainCapabilityAgentTest, testProvideMultipleState) {
     m_wakeSetCompletedFuture.wait_for(TIMEOUT);
 }
 
+TEST_F(CustomDomainCapabilityAgentTest, testProvideStateFromPushedContext) {
+    alexaClientSDK::avsCommon::utils::WaitEvent waitEvent;
+
+    EXPECT_CALL(*m_mockContextManager, addStateProvider(testing::_, ::testing::NotNull())).Times(testing::Exactly(2));
+    std::vector<std::string> states{"TEST_STATE_1", "TEST_STATE_2"};
+    auto capAgent = aace::engine::customDomain::CustomDomainCapabilityAgent::create(
+        "TEST_NAMESPACE",
+        "TEST_VERSION",
+        states,
+        m_mockHandler,
+        m_mockExceptionSender,
+        m_mockContextManager,
+        m_mockMessageSender);
+    ASSERT_NE(nullptr, capAgent);
+    EXPECT_CALL(*m_mockContextManager, provideStateResponse(testing::_, testing::_, testing::_))
+        .Times(testing::Exactly(4))
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::InvokeWithoutArgs([&waitEvent]() { waitEvent.wakeUp(); }));
+    EXPECT_CALL(*m_mockHandler, getContext(testing::_)).Times(testing::Exactly(0));
+
+    capAgent->contextChanged(TEST_CONTEXT);
+    for (ContextRequestToken token : {42, 43}) {
+        for (const auto& state : states) {
+            capAgent->provideState(NamespaceAndName{"TEST_NAMESPACE", state}, token);
+        }
+    }
+    EXPECT_TRUE(waitEvent.wait(TIMEOUT));
+}
+
+TEST_F(CustomDomainCapabilityAgentTest, testInvalidatedContextIsQueriedOnce) {
+    alexaClientSDK::avsCommon::utils::WaitEvent waitEvent;
+
+    EXPECT_CALL(*m_mockContextManager, addStateProvider(testing::_, ::testing::NotNull())).Times(testing::Exactly(2));
+    std::vector<std::string> states{"TEST_STATE_1", "TEST_STATE_2"};
+    auto capAgent = aace::engine::customDomain::CustomDomainCapabilityAgent::create(
+        "TEST_NAMESPACE",
+        "TEST_VERSION",
+        states,
+        m_mockHandler,
+        m_mockExceptionSender,
+        m_mockContextManager,
+        m_mockMessageSender);
+    ASSERT_NE(nullptr, capAgent);
+    EXPECT_CALL(*m_mockContextManager, provideStateResponse(testing::_, testing::_, testing::_))
+        .Times(testing::Exactly(4))
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::InvokeWithoutArgs([&waitEvent]() { waitEvent.wakeUp(); }));
+    EXPECT_CALL(*m_mockHandler, getContext(testing::_))
+        .Times(testing::Exactly(1))
+        .WillOnce(testing::Return(TEST_CONTEXT));
+
+    capAgent->contextChanged(TEST_CONTEXT);
+    capAgent->contextChanged("");
+    for (ContextRequestToken token : {42, 43}) {
+        for (const auto& state : states) {
+            capAgent->provideState(NamespaceAndName{"TEST_NAMESPACE", state}, token);
+        }
+    }
+    EXPECT_TRUE(waitEvent.wait(TIMEOUT));
+}
+
+TEST_F(CustomDomainCapabilityAgentTest, testCachedContextIsSampledForEachRequest) {
+    // clang-format off
+    static const std::string SAMPLED_CONTEXT = R"(
+        {
+            "context": [
+            {
+                "name": "TEST_STATE_1",
+                "value": "test"
+            },
+            {
+                "name": "TEST_STATE_2",
+                "value": "test",
+                "timeOfSample": "2021-01-01T00:00:00.000Z"
+            }
+            ]
+        }
+    )";
+    // clang-format on
+
+    EXPECT_CALL(*m_mockContextManager, addStateProvider(testing::_, ::testing::NotNull())).Times(testing::Exactly(2));
+    std::vector<std::string> states{"TEST_STATE_1", "TEST_STATE_2"};
+    auto capAgent = aace::engine::customDomain::CustomDomainCapabilityAgent::create(
+        "TEST_NAMESPACE",
+        "TEST_VERSION",
+        states,
+        m_mockHandler,
+        m_mockExceptionSender,
+        m_mockContextManager,
+        m_mockMessageSender);
+    ASSERT_NE(nullptr, capAgent);
+    EXPECT_CALL(*m_mockHandler, getContext(testing::_)).Times(testing::Exactly(0));
+    capAgent->contextChanged(SAMPLED_CONTEXT);
+
+    // provides the states of a request and returns them in the order they were requested
+    auto provideStates = [&](ContextRequestToken token) {
+        alexaClientSDK::avsCommon::utils::WaitEvent waitEvent;
+        std::vector<CapabilityState> provided(2);
+        EXPECT_CALL(*m_mockContextManager, provideStateResponse(testing::_, testing::_, token))
+            .Times(testing::Exactly(2))
+            .WillOnce(testing::SaveArg<1>(&provided[0]))
+            .WillOnce(testing::DoAll(
+                testing::SaveArg<1>(&provided[1]), testing::InvokeWithoutArgs([&waitEvent]() { waitEvent.wakeUp(); })));
+        for (const auto& state : states) {
+            capAgent->provideState(NamespaceAndName{"TEST_NAMESPACE", state}, token);
+        }
+        EXPECT_TRUE(waitEvent.wait(TIMEOUT));
+        return provided;
+    };
+
+    auto first = provideStates(42);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    auto second = provideStates(43);
+
+    // the cached state is sampled again for the later request, unless the platform gave its time of sample
+    EXPECT_LT(first[0].timeOfSample.getTime_Unix(), second[0].timeOfSample.getTime_Unix());
+    EXPECT_EQ("2021-01-01T00:00:00.000Z", first[1].timeOfSample.getTime_ISO_8601());
+    EXPECT_EQ("2021-01-01T00:00:00.000Z", second[1].timeOfSample.getTime_ISO_8601());
+}
+
 TEST_F(CustomDomainCapabilityAgentTest, testCancelDirective) {
     auto attachmentManager = std::make_shared<testing::StrictMock<aace::test::unit::avs::MockAttachmentManager>>();
     auto avsMessageHeader = std::make_shared<alexaClientSDK::avsCommon::avs::AVSMessageHeader>(
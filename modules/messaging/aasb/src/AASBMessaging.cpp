@@ -17,8 +17,11 @@
 #include <AACE/Engine/Core/EngineMacros.h>
 
 #include <AASB/Message/Messaging/Messaging/ConnectionState.h>
+#include <AASB/Message/Messaging/Messaging/ConversationRemovedMessage.h>
+#include <AASB/Message/Messaging/Messaging/ConversationUpdatedMessage.h>
 #include <AASB/Message/Messaging/Messaging/ConversationsReportMessage.h>
 #include <AASB/Message/Messaging/Messaging/ErrorCode.h>
+#include <AASB/Message/Messaging/Messaging/MessagesStatusChangedMessage.h>
 #include <AASB/Message/Messaging/Messaging/PermissionState.h>
 #include <AASB/Message/Messaging/Messaging/SendMessageFailedMessage.h>
 #include <AASB/Message/Messaging/Messaging/SendMessageMessage.h>
@@ -67,6 +70,51 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::messageBroker::Mess
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::messaging::messaging::ConversationUpdatedMessage::topic(),
+            aasb::message::messaging::messaging::ConversationUpdatedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::messaging::messaging::ConversationUpdatedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->conversationUpdated(payload.conversation);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::messaging::messaging::ConversationRemovedMessage::topic(),
+            aasb::message::messaging::messaging::ConversationRemovedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::messaging::messaging::ConversationRemovedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->conversationRemoved(payload.conversationId);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::messaging::messaging::MessagesStatusChangedMessage::topic(),
+            aasb::message::messaging::messaging::MessagesStatusChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::messaging::messaging::MessagesStatusChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->messagesStatusChanged(payload.conversationId, payload.status);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            });
+
         messageBroker->subscribe(
             aasb::message::messaging::messaging::SendMessageFailedMessage::topic(),
             aasb::message::messaging::messaging::SendMessageFailedMessage::action(),
@@ -205,6 +205,53 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_messaging_Messaging_conversationsRep
     }
 }
 
+JNIEXPORT void JNICALL Java_com_amazon_aace_messaging_Messaging_conversationUpdated(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring conversation) {
+    try {
+        auto messagingBinder = MESSAGING_BINDER(ref);
+        ThrowIfNull(messagingBinder, "invalidMessagingBinder");
+
+        messagingBinder->getMessaging()->conversationUpdated(JString(conversation).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, __func__, ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_messaging_Messaging_conversationRemoved(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring conversationId) {
+    try {
+        auto messagingBinder = MESSAGING_BINDER(ref);
+        ThrowIfNull(messagingBinder, "invalidMessagingBinder");
+
+        messagingBinder->getMessaging()->conversationRemoved(JString(conversationId).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, __func__, ex.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_messaging_Messaging_messagesStatusChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring conversationId,
+    jstring status) {
+    try {
+        auto messagingBinder = MESSAGING_BINDER(ref);
+        ThrowIfNull(messagingBinder, "invalidMessagingBinder");
+
+        messagingBinder->getMessaging()->messagesStatusChanged(
+            JString(conversationId).toStdStr(), JString(status).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, __func__, ex.what());
+    }
+}
+
 JNIEXPORT void JNICALL Java_com_amazon_aace_messaging_Messaging_updateMessagingEndpointState(
     JNIEnv* env,
     jobject /* this */,
@@ -295,6 +295,41 @@ abstract public class Messaging extends PlatformInterface {
         conversationsReport(getNativeRef(), token, conversations);
     }
 
+    /**
+     * Notifies the Engine that a conversation with unread messages was added or changed, such as when a new message
+     * is received. Once the platform implementation reports conversations incrementally, the Engine keeps the
+     * conversations report and answers @c uploadConversations requests itself, so every change must be reported
+     * with @c conversationUpdated, @c conversationRemoved and @c messagesStatusChanged. Use @c conversationsReport
+     * to resynchronize all conversations.
+     *
+     * @param [in] conversation A JSON object representing the conversation, in the format of a single entry of the
+     * @c conversationsReport array.
+     */
+    final protected void conversationUpdated(String conversation) {
+        conversationUpdated(getNativeRef(), conversation);
+    }
+
+    /**
+     * Notifies the Engine that a conversation no longer has unread messages or was deleted.
+     *
+     * @param [in] conversationId The identifier of the conversation.
+     */
+    final protected void conversationRemoved(String conversationId) {
+        conversationRemoved(getNativeRef(), conversationId);
+    }
+
+    /**
+     * Notifies the Engine that the status of messages in a conversation changed on the messaging endpoint. Read
+     * messages are removed from the conversation.
+     *
+     * @param [in] conversationId The identifier of the conversation.
+     * @param [in] status The message identifiers and their status, in the same format as in
+     * @c updateMessagesStatus.
+     */
+    final protected void messagesStatusChanged(String conversationId, String status) {
+        messagesStatusChanged(getNativeRef(), conversationId, status);
+    }
+
     /**
      * Notifies the cloud that the @c updateMessagesStatus request succeeded.
      *
@@ -344,6 +379,9 @@ abstract public class Messaging extends PlatformInterface {
     private native void sendMessageSucceeded(long nativeRef, String token);
     private native void sendMessageFailed(long nativeRef, String token, ErrorCode code, String message);
     private native void conversationsReport(long nativeRef, String token, String conversations);
+    private native void conversationUpdated(long nativeRef, String conversation);
+    private native void conversationRemoved(long nativeRef, String conversationId);
+    private native void messagesStatusChanged(long nativeRef, String conversationId, String status);
     private native void updateMessagesStatusSucceeded(long nativeRef, String token);
     private native void updateMessagesStatusFailed(long nativeRef, String token, ErrorCode code, String message);
     private native void updateMessagingEndpointState(long nativeRef, ConnectionState isConnected,
@@ -0,0 +1,120 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGING_CONVERSATION_STORE_H
+#define AACE_ENGINE_MESSAGING_CONVERSATION_STORE_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace messaging {
+
+/**
+ * The conversations with unread messages reported by the messaging endpoint, keyed by conversation ID.
+ *
+ * Each conversation is kept parsed together with its serialized form, so an incremental update only parses
+ * the changed conversation and the conversations report is assembled from the serialized conversations
+ * without parsing the others again. Every change increments the store version, which tells whether the
+ * cloud has the latest report. Conversations are reported in the order they were first added.
+ *
+ * The store is not thread safe.
+ */
+class ConversationStore {
+public:
+    ConversationStore();
+
+    /**
+     * Replace all conversations with a full conversations report.
+     *
+     * @param conversations The JSON array of conversations
+     * @throw std::exception if @c conversations is not a valid conversations report, in which case the store
+     *        is not changed
+     */
+    void reset(const std::string& conversations);
+
+    /**
+     * Add a conversation, or replace the conversation with the same ID.
+     *
+     * @param conversation The JSON conversation object
+     * @return @c true if the store changed
+     * @throw std::exception if @c conversation is not a valid conversation
+     */
+    bool updateConversation(const std::string& conversation);
+
+    /**
+     * Remove a conversation.
+     *
+     * @param conversationId The ID of the conversation
+     * @return @c true if the conversation was in the store
+     */
+    bool removeConversation(const std::string& conversationId);
+
+    /**
+     * Remove messages which are no longer unread from a conversation. A conversation left without unread
+     * messages is removed.
+     *
+     * @param conversationId The ID of the conversation
+     * @param messageIds The IDs of the read messages
+     * @return @c true if the store changed
+     */
+    bool markMessagesRead(const std::string& conversationId, const std::vector<std::string>& messageIds);
+
+    /// @return The version of the store, incremented with every change
+    uint64_t getVersion() const;
+
+    /// @return The number of conversations in the store
+    size_t size() const;
+
+    /// @return The JSON array of all conversations
+    const std::string& getReport();
+
+private:
+    struct Conversation {
+        nlohmann::json value;
+        std::string serialized;
+    };
+
+    using ConversationList = std::list<Conversation>;
+
+    static std::string getId(const nlohmann::json& conversation);
+
+    /// The conversations in report order
+    ConversationList m_conversations;
+
+    /// The conversations by ID
+    std::unordered_map<std::string, ConversationList::iterator> m_index;
+
+    /// The version of the store
+    uint64_t m_version;
+
+    /// The last assembled report
+    std::string m_report;
+
+    /// The version of @c m_report
+    uint64_t m_reportVersion;
+};
+
+}  // namespace messaging
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGING_CONVERSATION_STORE_H
@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_MESSAGING_MESSAGING_ENGINE_IMPL_H
 #define AACE_ENGINE_MESSAGING_MESSAGING_ENGINE_IMPL_H
 
+#include <mutex>
+#include <unordered_map>
+
 #include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/Endpoints/EndpointCapabilitiesRegistrarInterface.h>
 #include <AVSCommon/SDKInterfaces/ExceptionEncounteredSenderInterface.h>
@@ -26,6 +29,7 @@
 
 #include "AACE/Messaging/Messaging.h"
 #include "AACE/Messaging/MessagingEngineInterface.h"
+#include "ConversationStore.h"
 
 namespace aace {
 namespace engine {
@@ -79,6 +83,9 @@ public:
     /// @name MessagingEngineInterface
     /// @{
     void onConversationsReport(const std::string& token, const std::string& conversations) override;
+    void onConversationUpdated(const std::string& conversation) override;
+    void onConversationRemoved(const std::string& conversationId) override;
+    void onMessagesStatusChanged(const std::string& conversationId, const std::string& status) override;
     void onSendMessageFailed(const std::string& token, ErrorCode code, const std::string& message) override;
     void onSendMessageSucceeded(const std::string& token) override;
     void onUpdateMessagesStatusFailed(const std::string& token, ErrorCode code, const std::string& message) override;
@@ -132,11 +139,56 @@ private:
     alexaClientSDK::capabilityAgents::messaging::MessagingCapabilityAgent::PermissionState convertPermissionState(
         PermissionState permission);
 
+    /**
+     * Switch to incremental conversation reporting, seeding the conversation store with the last full report.
+     * Must be called with @c m_conversationMutex locked.
+     */
+    void enableIncrementalReporting();
+
+    /**
+     * Upload the conversations report from the conversation store if it changed since the last upload, or
+     * unconditionally when replying to an @c uploadConversations request.
+     *
+     * @param token The token of the @c uploadConversations request, otherwise an empty string
+     */
+    void uploadStoredConversations(const std::string& token);
+
+    /**
+     * Parse the IDs of the read messages from a message status JSON.
+     *
+     * @param status The JSON object containing the @c statusMap
+     */
+    static std::vector<std::string> getReadMessageIds(const nlohmann::json& status);
+
     /// Auto SDK Messaging platform interface handler instance
     std::shared_ptr<aace::messaging::Messaging> m_messagingPlatformInterface;
 
     /// AVS MessagingCapabilityAgent instance
     std::shared_ptr<alexaClientSDK::capabilityAgents::messaging::MessagingCapabilityAgent> m_messagingCapabilityAgent;
+
+    /// The read messages of each pending @c updateMessagesStatus request, applied to the store once it succeeds
+    struct PendingStatusUpdate {
+        std::string conversationId;
+        std::vector<std::string> messageIds;
+    };
+
+    /// Serializes access to the conversation store
+    std::mutex m_conversationMutex;
+
+    /// The conversations reported incrementally by the platform
+    ConversationStore m_conversationStore;
+
+    /// Whether the platform reports conversations incrementally
+    bool m_incrementalReporting;
+
+    /// The last full conversations report, until the platform reports conversations incrementally
+    std::string m_lastConversationsReport;
+
+    /// The store version last uploaded to the cloud
+    uint64_t m_uploadedVersion;
+
+    /// The pending @c updateMessagesStatus requests by token
+    std::unordered_map<std::string, PendingStatusUpdate> m_pendingStatusUpdates;
 };
 
 }  // namespace messaging
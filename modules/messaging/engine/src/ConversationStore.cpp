@@ -0,0 +1,164 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "AACE/Engine/Messaging/ConversationStore.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace messaging {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messaging.ConversationStore");
+
+using json = nlohmann::json;
+
+ConversationStore::ConversationStore() : m_version(0), m_report("[]"), m_reportVersion(0) {
+}
+
+std::string ConversationStore::getId(const json& conversation) {
+    ThrowIfNot(conversation.is_object(), "conversationNotObject");
+    auto it = conversation.find("id");
+    ThrowIf(it == conversation.end() || !it->is_string(), "invalidConversationId");
+    return it->get<std::string>();
+}
+
+void ConversationStore::reset(const std::string& conversations) {
+    auto report = json::parse(conversations);
+    ThrowIfNot(report.is_array(), "conversationsNotArray");
+
+    ConversationList updated;
+    std::unordered_map<std::string, ConversationList::iterator> index;
+    for (auto& conversation : report) {
+        auto id = getId(conversation);
+        ThrowIf(index.count(id) > 0, "duplicateConversationId");
+        auto serialized = conversation.dump();
+        index[id] = updated.insert(updated.end(), {std::move(conversation), std::move(serialized)});
+    }
+
+    m_conversations.swap(updated);
+    m_index.swap(index);
+    m_version++;
+    AACE_DEBUG(LX(TAG).d("conversations", m_conversations.size()).d("version", m_version));
+}
+
+bool ConversationStore::updateConversation(const std::string& conversation) {
+    auto value = json::parse(conversation);
+    auto id = getId(value);
+    auto serialized = value.dump();
+
+    auto it = m_index.find(id);
+    if (it == m_index.end()) {
+        m_index[id] = m_conversations.insert(m_conversations.end(), {std::move(value), std::move(serialized)});
+    } else if (it->second->serialized != serialized) {
+        it->second->value = std::move(value);
+        it->second->serialized = std::move(serialized);
+    } else {
+        return false;
+    }
+
+    m_version++;
+    return true;
+}
+
+bool ConversationStore::removeConversation(const std::string& conversationId) {
+    auto it = m_index.find(conversationId);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    m_conversations.erase(it->second);
+    m_index.erase(it);
+    m_version++;
+    return true;
+}
+
+bool ConversationStore::markMessagesRead(
+    const std::string& conversationId,
+    const std::vector<std::string>& messageIds) {
+    auto it = m_index.find(conversationId);
+    if (it == m_index.end() || messageIds.empty()) {
+        return false;
+    }
+
+    auto& conversation = it->second->value;
+    auto messages = conversation.find("messages");
+    if (messages == conversation.end() || !messages->is_array()) {
+        return false;
+    }
+
+    std::unordered_set<std::string> read(messageIds.begin(), messageIds.end());
+    auto end = std::remove_if(messages->begin(), messages->end(), [&read](const json& message) {
+        auto id = message.find("id");
+        return id != message.end() && id->is_string() && read.count(id->get_ref<const std::string&>()) > 0;
+    });
+    auto removed = static_cast<size_t>(std::distance(end, messages->end()));
+    if (removed == 0) {
+        return false;
+    }
+    messages->erase(end, messages->end());
+
+    if (messages->empty()) {
+        return removeConversation(conversationId);
+    }
+
+    auto unread = conversation.find("unreadMessageCount");
+    if (unread != conversation.end() && unread->is_number_unsigned()) {
+        auto count = unread->get<size_t>();
+        *unread = count > removed ? count - removed : 0;
+    }
+    it->second->serialized = conversation.dump();
+    m_version++;
+    return true;
+}
+
+uint64_t ConversationStore::getVersion() const {
+    return m_version;
+}
+
+size_t ConversationStore::size() const {
+    return m_conversations.size();
+}
+
+const std::string& ConversationStore::getReport() {
+    if (m_reportVersion != m_version) {
+        size_t length = 2;
+        for (auto& conversation : m_conversations) {
+            length += conversation.serialized.size() + 1;
+        }
+
+        std::string report;
+        report.reserve(length);
+        report += '[';
+        for (auto& conversation : m_conversations) {
+            if (report.size() > 1) {
+                report += ',';
+            }
+            report += conversation.serialized;
+        }
+        report += ']';
+
+        m_report = std::move(report);
+        m_reportVersion = m_version;
+    }
+    return m_report;
+}
+
+}  // namespace messaging
+}  // namespace engine
+}  // namespace aace
@@ -41,7 +41,9 @@ using namespace alexaClientSDK::capabilityAgents::messaging;
 
 MessagingEngineImpl::MessagingEngineImpl(std::shared_ptr<aace::messaging::Messaging> messagingPlatformInterface) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
-        m_messagingPlatformInterface(messagingPlatformInterface) {
+        m_messagingPlatformInterface(messagingPlatformInterface),
+        m_incrementalReporting(false),
+        m_uploadedVersion(0) {
 }
 
 bool MessagingEngineImpl::initialize(
@@ -157,6 +159,12 @@ void MessagingEngineImpl::updateMessagesStatus(
                 auto conversationId = messageJson["conversationId"].get<std::string>();
                 if (messageJson.find("statusMap") != messageJson.end()) {
                     auto statusMap = messageJson["statusMap"].dump();
+                    {
+                        std::lock_guard<std::mutex> lock(m_conversationMutex);
+                        if (m_incrementalReporting) {
+                            m_pendingStatusUpdates[token] = {conversationId, getReadMessageIds(messageJson)};
+                        }
+                    }
                     m_messagingPlatformInterface->updateMessagesStatus(token, conversationId, statusMap);
                 } else {
                     AACE_ERROR(LX(TAG).d("missingStatusMap", payload));
@@ -175,7 +183,15 @@ void MessagingEngineImpl::uploadConversations(
     MessagingEndpoint endpoint,
     const std::string& payload) {
     AACE_INFO(LX(TAG).sensitive("payload", payload));
-    if (m_messagingPlatformInterface != nullptr) {
+    bool incrementalReporting;
+    {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        incrementalReporting = m_incrementalReporting;
+    }
+    if (incrementalReporting) {
+        // the store is kept up to date by the platform, so answer the request without a round trip
+        uploadStoredConversations(token);
+    } else if (m_messagingPlatformInterface != nullptr) {
         m_messagingPlatformInterface->uploadConversations(token);
     }
 }
@@ -183,10 +199,112 @@ void MessagingEngineImpl::uploadConversations(
 void MessagingEngineImpl::onConversationsReport(const std::string& token, const std::string& conversations) {
     if (m_messagingCapabilityAgent != nullptr) {
         AACE_INFO(LX(TAG).d("token", token).sensitive("conversations", conversations));
+        {
+            std::lock_guard<std::mutex> lock(m_conversationMutex);
+            if (m_incrementalReporting) {
+                // resynchronize the store with the full report
+                try {
+                    m_conversationStore.reset(conversations);
+                    m_uploadedVersion = m_conversationStore.getVersion();
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            } else {
+                // kept unparsed until the platform starts reporting incrementally
+                m_lastConversationsReport = conversations;
+            }
+        }
         m_messagingCapabilityAgent->conversationsReport(token, conversations);
     }
 }
 
+void MessagingEngineImpl::onConversationUpdated(const std::string& conversation) {
+    AACE_INFO(LX(TAG).sensitive("conversation", conversation));
+    try {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        enableIncrementalReporting();
+        ReturnIfNot(m_conversationStore.updateConversation(conversation));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return;
+    }
+    uploadStoredConversations("");
+}
+
+void MessagingEngineImpl::onConversationRemoved(const std::string& conversationId) {
+    AACE_INFO(LX(TAG).d("conversationId", conversationId));
+    {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        enableIncrementalReporting();
+        ReturnIfNot(m_conversationStore.removeConversation(conversationId));
+    }
+    uploadStoredConversations("");
+}
+
+void MessagingEngineImpl::onMessagesStatusChanged(const std::string& conversationId, const std::string& status) {
+    AACE_INFO(LX(TAG).d("conversationId", conversationId).sensitive("status", status));
+    try {
+        auto messageIds = getReadMessageIds(json::parse(status));
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        enableIncrementalReporting();
+        ReturnIfNot(m_conversationStore.markMessagesRead(conversationId, messageIds));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return;
+    }
+    uploadStoredConversations("");
+}
+
+void MessagingEngineImpl::enableIncrementalReporting() {
+    if (!m_incrementalReporting) {
+        m_incrementalReporting = true;
+        if (!m_lastConversationsReport.empty()) {
+            // start from the conversations the cloud already has
+            try {
+                m_conversationStore.reset(m_lastConversationsReport);
+                m_uploadedVersion = m_conversationStore.getVersion();
+            } catch (std::exception& ex) {
+                AACE_WARN(LX(TAG).d("reason", ex.what()));
+            }
+            m_lastConversationsReport.clear();
+        }
+    }
+}
+
+void MessagingEngineImpl::uploadStoredConversations(const std::string& token) {
+    std::string report;
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        version = m_conversationStore.getVersion();
+        if (token.empty() && m_uploadedVersion == version) {
+            return;
+        }
+        report = m_conversationStore.getReport();
+        m_uploadedVersion = version;
+    }
+    if (m_messagingCapabilityAgent != nullptr) {
+        AACE_DEBUG(LX(TAG).d("token", token).d("version", version).d("size", report.size()));
+        m_messagingCapabilityAgent->conversationsReport(token, report);
+    }
+}
+
+std::vector<std::string> MessagingEngineImpl::getReadMessageIds(const json& status) {
+    std::vector<std::string> messageIds;
+    auto statusMap = status.find("statusMap");
+    if (statusMap != status.end() && statusMap->is_object()) {
+        auto read = statusMap->find("read");
+        if (read != statusMap->end() && read->is_array()) {
+            for (auto& id : *read) {
+                if (id.is_string()) {
+                    messageIds.push_back(id.get<std::string>());
+                }
+            }
+        }
+    }
+    return messageIds;
+}
+
 void MessagingEngineImpl::onSendMessageFailed(const std::string& token, ErrorCode code, const std::string& message) {
     if (m_messagingCapabilityAgent != nullptr) {
         AACE_INFO(LX(TAG).d("token", token).d("code", static_cast<int>(code)).d("message", message));
@@ -205,6 +323,10 @@ void MessagingEngineImpl::onUpdateMessagesStatusFailed(
     const std::string& token,
     ErrorCode code,
     const std::string& message) {
+    {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        m_pendingStatusUpdates.erase(token);
+    }
     if (m_messagingCapabilityAgent != nullptr) {
         AACE_INFO(LX(TAG).d("token", token).d("code", static_cast<int>(code)).d("message", message));
         m_messagingCapabilityAgent->updateMessagesStatusFailed(token, convertErrorCode(code), message);
@@ -212,6 +334,15 @@ void MessagingEngineImpl::onUpdateMessagesStatusFailed(
 }
 
 void MessagingEngineImpl::onUpdateMessagesStatusSucceeded(const std::string& token) {
+    {
+        std::lock_guard<std::mutex> lock(m_conversationMutex);
+        auto it = m_pendingStatusUpdates.find(token);
+        if (it != m_pendingStatusUpdates.end()) {
+            // the cloud requested the update, so it already knows these messages are read
+            m_conversationStore.markMessagesRead(it->second.conversationId, it->second.messageIds);
+            m_pendingStatusUpdates.erase(it);
+        }
+    }
     if (m_messagingCapabilityAgent != nullptr) {
         AACE_INFO(LX(TAG).d("token", token));
         m_messagingCapabilityAgent->updateMessagesStatusSucceeded(token);
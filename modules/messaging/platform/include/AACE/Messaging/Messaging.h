@@ -199,6 +199,44 @@ public:
      */
     void conversationsReport(const std::string& token, const std::string& conversations);
 
+    /**
+     * Notifies the Engine that a conversation with unread messages was added or changed, such as when a new
+     * message is received. Once the platform implementation reports conversations incrementally, the Engine keeps
+     * the conversations report and answers @c uploadConversations requests itself, so the platform
+     * implementation must report every change with @c conversationUpdated, @c conversationRemoved and
+     * @c messagesStatusChanged. Use @c conversationsReport to resynchronize all conversations, for example after
+     * the messaging endpoint reconnects.
+     *
+     * @param [in] conversation A JSON object representing the conversation, in the format of a single entry of
+     * the @c conversationsReport array.
+     */
+    void conversationUpdated(const std::string& conversation);
+
+    /**
+     * Notifies the Engine that a conversation no longer has unread messages or was deleted.
+     *
+     * @param [in] conversationId The identifier of the conversation.
+     */
+    void conversationRemoved(const std::string& conversationId);
+
+    /**
+     * Notifies the Engine that the status of messages in a conversation changed on the messaging endpoint, such
+     * as when the user reads them on the phone. Read messages are removed from the conversation, and a
+     * conversation without unread messages is removed.
+     *
+     * @param [in] conversationId The identifier of the conversation.
+     * @param [in] status The message identifiers and their status, in the same format as in
+     * @c updateMessagesStatus.
+     * @code{.json}
+     * {
+     *     "statusMap" : {
+     *         "read" : [{{STRING}}],
+     *     }
+     * }
+     * @endcode
+     */
+    void messagesStatusChanged(const std::string& conversationId, const std::string& status);
+
     /**
      * Notifies the cloud that the @c updateMessagesStatus request succeeded.
      *
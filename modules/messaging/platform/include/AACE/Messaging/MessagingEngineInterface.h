@@ -60,6 +60,9 @@ public:
     };
 
     virtual void onConversationsReport(const std::string& token, const std::string& conversations) = 0;
+    virtual void onConversationUpdated(const std::string& conversation) = 0;
+    virtual void onConversationRemoved(const std::string& conversationId) = 0;
+    virtual void onMessagesStatusChanged(const std::string& conversationId, const std::string& status) = 0;
     virtual void onSendMessageFailed(const std::string& token, ErrorCode code, const std::string& message) = 0;
     virtual void onSendMessageSucceeded(const std::string& token) = 0;
     virtual void onUpdateMessagesStatusFailed(const std::string& token, ErrorCode code, const std::string& message) = 0;
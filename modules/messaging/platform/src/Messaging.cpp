@@ -24,6 +24,24 @@ void Messaging::conversationsReport(const std::string& token, const std::string&
     }
 }
 
+void Messaging::conversationUpdated(const std::string& conversation) {
+    if (m_messagingEngineInterface != nullptr) {
+        m_messagingEngineInterface->onConversationUpdated(conversation);
+    }
+}
+
+void Messaging::conversationRemoved(const std::string& conversationId) {
+    if (m_messagingEngineInterface != nullptr) {
+        m_messagingEngineInterface->onConversationRemoved(conversationId);
+    }
+}
+
+void Messaging::messagesStatusChanged(const std::string& conversationId, const std::string& status) {
+    if (m_messagingEngineInterface != nullptr) {
+        m_messagingEngineInterface->onMessagesStatusChanged(conversationId, status);
+    }
+}
+
 void Messaging::sendMessageFailed(const std::string& token, ErrorCode code, const std::string& message) {
     if (m_messagingEngineInterface != nullptr) {
         m_messagingEngineInterface->onSendMessageFailed(token, code, message);
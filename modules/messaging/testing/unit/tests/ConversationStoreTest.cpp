@@ -0,0 +1,130 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Messaging/ConversationStore.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using json = nlohmann::json;
+using ConversationStore = aace::engine::messaging::ConversationStore;
+
+static json createConversation(const std::string& id, const std::vector<std::string>& messageIds) {
+    json messages = json::array();
+    for (auto& messageId : messageIds) {
+        messages.push_back(
+            {{"id", messageId},
+             {"payload", {{"@type", "text"}, {"text", "hello"}}},
+             {"status", "unread"},
+             {"sender", {{"address", "5555555555"}, {"addressType", "PhoneNumberAddress"}}}});
+    }
+    return {{"id", id},
+            {"otherParticipants", json::array()},
+            {"messages", messages},
+            {"unreadMessageCount", messageIds.size()}};
+}
+
+static std::vector<std::string> getConversationIds(ConversationStore& store) {
+    std::vector<std::string> ids;
+    for (auto& conversation : json::parse(store.getReport())) {
+        ids.push_back(conversation["id"]);
+    }
+    return ids;
+}
+
+TEST(ConversationStoreTest, emptyReport) {
+    ConversationStore store;
+    EXPECT_EQ("[]", store.getReport());
+    EXPECT_EQ(0u, store.size());
+}
+
+TEST(ConversationStoreTest, resetReplacesConversations) {
+    ConversationStore store;
+    ASSERT_TRUE(store.updateConversation(createConversation("old", {"1"}).dump()));
+
+    json report = {createConversation("a", {"1"}), createConversation("b", {"2", "3"})};
+    store.reset(report.dump());
+    EXPECT_EQ(2u, store.size());
+    EXPECT_EQ(report, json::parse(store.getReport()));
+}
+
+TEST(ConversationStoreTest, invalidResetKeepsConversations) {
+    ConversationStore store;
+    ASSERT_TRUE(store.updateConversation(createConversation("a", {"1"}).dump()));
+    auto version = store.getVersion();
+
+    EXPECT_ANY_THROW(store.reset("{}"));
+    EXPECT_ANY_THROW(store.reset(R"([{"id":"a"},{"id":"a"}])"));
+    EXPECT_ANY_THROW(store.reset(R"([{"messages":[]}])"));
+    EXPECT_EQ(version, store.getVersion());
+    EXPECT_EQ(std::vector<std::string>({"a"}), getConversationIds(store));
+}
+
+TEST(ConversationStoreTest, updateAddsAndReplacesConversations) {
+    ConversationStore store;
+    ASSERT_TRUE(store.updateConversation(createConversation("a", {"1"}).dump()));
+    ASSERT_TRUE(store.updateConversation(createConversation("b", {"2"}).dump()));
+    auto version = store.getVersion();
+
+    // an identical update does not change the store
+    EXPECT_FALSE(store.updateConversation(createConversation("a", {"1"}).dump()));
+    EXPECT_EQ(version, store.getVersion());
+
+    // an update keeps the position of the conversation
+    EXPECT_TRUE(store.updateConversation(createConversation("a", {"1", "3"}).dump()));
+    EXPECT_GT(store.getVersion(), version);
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}), getConversationIds(store));
+    EXPECT_EQ(2u, json::parse(store.getReport())[0]["messages"].size());
+
+    EXPECT_ANY_THROW(store.updateConversation(R"({"messages":[]})"));
+}
+
+TEST(ConversationStoreTest, removeConversation) {
+    ConversationStore store;
+    ASSERT_TRUE(store.updateConversation(createConversation("a", {"1"}).dump()));
+    ASSERT_TRUE(store.updateConversation(createConversation("b", {"2"}).dump()));
+
+    EXPECT_TRUE(store.removeConversation("a"));
+    EXPECT_FALSE(store.removeConversation("a"));
+    EXPECT_EQ(std::vector<std::string>({"b"}), getConversationIds(store));
+}
+
+TEST(ConversationStoreTest, markMessagesRead) {
+    ConversationStore store;
+    ASSERT_TRUE(store.updateConversation(createConversation("a", {"1", "2", "3"}).dump()));
+    ASSERT_TRUE(store.updateConversation(createConversation("b", {"4"}).dump()));
+
+    EXPECT_TRUE(store.markMessagesRead("a", {"1", "3"}));
+    auto conversation = json::parse(store.getReport())[0];
+    ASSERT_EQ(1u, conversation["messages"].size());
+    EXPECT_EQ("2", conversation["messages"][0]["id"]);
+    EXPECT_EQ(1, conversation["unreadMessageCount"]);
+
+    auto version = store.getVersion();
+    EXPECT_FALSE(store.markMessagesRead("a", {"1"}));
+    EXPECT_FALSE(store.markMessagesRead("unknown", {"1"}));
+    EXPECT_EQ(version, store.getVersion());
+
+    // a conversation without unread messages is removed
+    EXPECT_TRUE(store.markMessagesRead("b", {"4"}));
+    EXPECT_EQ(std::vector<std::string>({"a"}), getConversationIds(store));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
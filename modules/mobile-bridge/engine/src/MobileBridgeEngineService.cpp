@@ -47,6 +47,11 @@ bool MobileBridgeEngineService::configure(std::shared_ptr<std::istream> configur
     return true;
 }
 
+bool MobileBridgeEngineService::isConcurrentLifecycleSafe() {
+    // setup, start and stop only log
+    return true;
+}
+
 bool MobileBridgeEngineService::setup() {
     AACE_INFO(LX(TAG));
     try {
@@ -230,4 +230,19 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_navigation_Navigation_showAlternativ
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_showAlternativeRoutesSucceeded", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_navigation_Navigation_navigationStateChanged(
+    JNIEnv* env,
+    jobject,
+    jlong ref,
+    jstring navigationState) {
+    try {
+        auto navigationBinder = NAVIGATION_BINDER(ref);
+        ThrowIfNull(navigationBinder, "invalidNavigationBinder");
+
+        navigationBinder->getNavigation()->navigationStateChanged(JString(navigationState).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_navigation_Navigation_navigationStateChanged", ex.what());
+    }
+}
 }
@@ -706,6 +706,18 @@ abstract public class Navigation extends PlatformInterface {
         showAlternativeRoutesSucceeded(getNativeRef(), payload);
     }
 
+    /**
+     * Notifies the Engine that the navigation state changed. The Engine caches the state and uses it for the
+     * NavigationState context instead of calling getNavigationState() for each request, so the platform should call
+     * this method whenever its state changes after the first call.
+     *
+     * @param navigationState The NavigationState JSON payload in the format described in getNavigationState(). An
+     * empty string defaults the payload to NOT_NAVIGATING.
+     */
+    final protected void navigationStateChanged(String navigationState) {
+        navigationStateChanged(getNativeRef(), navigationState);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -721,6 +733,7 @@ abstract public class Navigation extends PlatformInterface {
     private native void navigationError(long nativeRef, ErrorType type, ErrorCode code, String description);
     private native void navigationEvent(long nativeRef, EventName event);
     private native void showAlternativeRoutesSucceeded(long nativeRef, String payload);
+    private native void navigationStateChanged(long nativeRef, String navigationState);
 }
 
 // END OF FILE
@@ -31,6 +31,7 @@
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 
 #include "NavigationHandlerInterface.h"
+#include "NavigationStateCache.h"
 
 namespace aace {
 namespace engine {
@@ -51,7 +52,8 @@ public:
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager,
         const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        size_t maxShapes = NavigationStateCache::MAXIMUM_SHAPES);
 
     /**
      * Destructor.
@@ -95,6 +97,14 @@ public:
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description);
 
+    /**
+     * Update the cached navigation state with a state pushed by the platform. Once a state has been pushed,
+     * the state is no longer requested from the platform for each context request.
+     *
+     * @param [in] navigationState The navigation state JSON
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
 private:
     NavigationCapabilityAgent(
         const std::shared_ptr<aace::engine::navigation::NavigationHandlerInterface>& navigationHandler,
@@ -103,7 +113,8 @@ private:
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager,
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
         const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        size_t maxShapes);
 
     // @name RequiresShutdown Functions
     /// @{
@@ -186,6 +197,12 @@ private:
         aace::navigation::NavigationEngineInterface::ErrorType type,
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description);
+    void executeNavigationStateChanged(const std::string& navigationState);
+
+    /**
+     * Request the navigation state from the platform unless the platform pushes its state changes
+     */
+    void refreshNavigationState(AgentId::IdType agentId);
 
     // Convert ErrorCode enum to string based on the error type
     std::string getNavigationErrorCode(aace::navigation::NavigationEngineInterface::ErrorCode code);
@@ -201,11 +218,6 @@ private:
     void showPreviousWaypointsError(AgentId::IdType agentId, std::string code, std::string description);
     void navigateToPreviousWaypointError(AgentId::IdType agentId, std::string code, std::string description);
 
-    /**
-     * Check Navigation State for validity
-     */
-    bool isNavigationStateValid(std::string navigationState);
-
     /**
      * @name Executor Thread Variables
      *
@@ -215,6 +227,18 @@ private:
     /// @{
     /// A set of observers to be notified when a @c StartNavigation directive is received
     std::shared_ptr<NavigationHandlerInterface> m_navigationHandler;
+
+    /// The last valid navigation state
+    NavigationStateCache m_navigationStateCache;
+
+    /// Whether the platform pushes navigation state changes
+    bool m_navigationStatePushed;
+
+    /// Whether the NavigationState context has been set
+    bool m_navigationStateReported;
+
+    /// The hash of the NavigationState context payload last set
+    uint64_t m_reportedNavigationStateHash;
     /// @}
 
     /// Set of capability configurations that will get published using the Capabilities API
@@ -229,9 +253,6 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The last known NavigationState payload
-    std::string m_navigationStatePayload;
-
     /// The metric recorder.
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
 
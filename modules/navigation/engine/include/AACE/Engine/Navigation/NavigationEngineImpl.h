@@ -56,7 +56,8 @@ class NavigationEngineImpl
 private:
     NavigationEngineImpl(
         std::shared_ptr<aace::navigation::Navigation> navigationPlatformInterface,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        size_t maxShapePoints);
 
     bool initialize(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
@@ -77,7 +78,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        const std::string& navigationProviderName);
+        const std::string& navigationProviderName,
+        size_t maxShapePoints = NavigationStateCache::MAXIMUM_SHAPES);
 
     /// @name @c NavigationHandlerInterface functions.
     /// @{
@@ -104,6 +106,7 @@ public:
         NavigationEngineInterface::ErrorCode code,
         const std::string& description) override;
     void onShowAlternativeRoutesSucceeded(const std::string& payload) override;
+    void onNavigationStateChanged(const std::string& navigationState) override;
     /// @}
 
 protected:
@@ -127,6 +130,7 @@ private:
     std::shared_ptr<DisplayManagerCapabilityAgent> m_displayManagerCapabilityAgent;
     std::shared_ptr<navigationassistance::NavigationAssistanceCapabilityAgent> m_navigationAssistanceCapabilityAgent;
     std::string m_navigationProviderName;
+    size_t m_maxShapePoints;
 
     NavigationEngineInterface::EventName getEventFromError(NavigationEngineInterface::ErrorType type);
     void setEventAgent(NavigationEngineInterface::EventName event, AgentId::IdType agentId);
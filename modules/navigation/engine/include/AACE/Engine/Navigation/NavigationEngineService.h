@@ -54,6 +54,9 @@ private:
 
     // Capability meta data for provider name passed by platform config
     std::string m_navigationProviderName;
+
+    // Maximum number of route shape points reported in the navigation state
+    size_t m_maxShapePoints;
 };
 
 }  // namespace navigation
@@ -0,0 +1,106 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
+#define AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+/**
+ * Holds the last valid navigation state reported by the platform in the form it is sent in the
+ * @c NavigationState context.
+ *
+ * Each update is validated once and its route shape is decimated to at most the configured number of
+ * points with the Douglas-Peucker algorithm, so the points that best preserve the shape of the route are
+ * kept. Changes are detected with a hash of the reported and the cached state rather than by comparing
+ * payloads. The cache is not thread safe.
+ */
+class NavigationStateCache {
+public:
+    /// The maximum number of shapes accepted in the @c NavigationState context
+    static constexpr size_t MAXIMUM_SHAPES = 100;
+
+    /**
+     * Constructor.
+     *
+     * @param maxShapes The maximum number of shapes to keep from a reported state, between 2 and
+     *        @c MAXIMUM_SHAPES
+     */
+    NavigationStateCache(size_t maxShapes = MAXIMUM_SHAPES);
+
+    /**
+     * Update the cache with the navigation state reported by the platform. An empty state is treated as
+     * not navigating. An update identical to the previous one is not parsed again.
+     *
+     * @param navigationState The navigation state JSON
+     * @return @c true if the state is valid, or @c false if it is invalid and the cache was not changed
+     */
+    bool update(const std::string& navigationState);
+
+    /// @return The cached state as sent in the @c NavigationState context
+    const std::string& getPayload() const;
+
+    /// @return The hash of the cached payload
+    uint64_t getPayloadHash() const;
+
+    /// @return The waypoints of the cached state
+    const nlohmann::json& getWaypoints() const;
+
+    /// @return The shapes of the cached state
+    const nlohmann::json& getShapes() const;
+
+    /**
+     * Reduce @c shapes to at most @c maxShapes points with the Douglas-Peucker algorithm. The first and
+     * last points are always kept. Shapes that are not [latitude, longitude] pairs are truncated instead.
+     *
+     * @param [in,out] shapes The array of shapes to decimate
+     * @param maxShapes The maximum number of shapes to keep
+     */
+    static void decimateShapes(nlohmann::json& shapes, size_t maxShapes);
+
+private:
+    void validate(nlohmann::json& state);
+
+    /// The maximum number of shapes to keep from a reported state
+    size_t m_maxShapes;
+
+    /// The hash of the last reported state, used to skip identical updates
+    uint64_t m_reportedHash;
+
+    /// Whether a state has been reported since construction
+    bool m_hasReportedState;
+
+    /// The validated and decimated state
+    nlohmann::json m_state;
+
+    /// The serialized state
+    std::string m_payload;
+
+    /// The hash of @c m_payload
+    uint64_t m_payloadHash;
+};
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_CACHE_H
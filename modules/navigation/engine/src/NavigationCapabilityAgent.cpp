@@ -16,7 +16,6 @@
 #include <stdexcept>
 
 #include <string>
-#include <rapidjson/error/en.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
@@ -26,6 +25,7 @@
 #include <AACE/Engine/Metrics/CounterDataPointBuilder.h>
 #include <AACE/Engine/Metrics/MetricEventBuilder.h>
 #include <AACE/Engine/Metrics/StringDataPointBuilder.h>
+#include <AACE/Engine/Utils/Tracing/Tracer.h>
 
 #include "AACE/Engine/Navigation/NavigationCapabilityAgent.h"
 
@@ -69,27 +69,6 @@ static const std::string NAVIGATION_CAPABILITY_INTERFACE_VERSION = "2.0";
 /// Navigation interface provider name key
 static const std::string CAPABILITY_INTERFACE_NAVIGATION_PROVIDER_NAME_KEY = "provider";
 
-/// NavigationState state accepted values
-static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
-static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
-static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
-
-// Waypoint Type accepted values
-static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
-static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
-static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
-
-/// Default when provided NavigationState is empty
-// clang-format off
-static const std::string DEFAULT_NAVIGATION_STATE_PAYLOAD = R"({
-	"state": ")" + NAVIGATION_STATE_NOT_NAVIGATING + R"(",
-	"waypoints": [],
-	"shapes": []
-})";
-
-//// max number of shapes allowable in context
-static const int MAXIMUM_SHAPES_IN_CONTEXT = 100;
-
 // Navigation Event Strings
 static const std::string START_NAVIGATION_SUCCESS = "StartNavigationSuccess";
 static const std::string SHOW_PREVIOUS_WAYPOINTS_SUCCESS = "ShowPreviousWaypointsSuccess";
@@ -209,7 +188,7 @@ static void submitNavigationControlErrorMetric(
 static std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration> getNavigationCapabilityConfiguration( const std::string& navigationProviderName );
 
 std::shared_ptr<NavigationCapabilityAgent> NavigationCapabilityAgent::create( const std::shared_ptr<NavigationHandlerInterface>& navigationHandler, const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface>& exceptionSender, const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
-const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager, const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder, const std::string& navigationProviderName )
+const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager, const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder, const std::string& navigationProviderName, size_t maxShapes )
 {
     try
     {
@@ -219,7 +198,7 @@ const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerIn
         ThrowIfNull( contextManager, "nullContextManager" );
         ThrowIfNull( metricRecorder, "nullMetricRecorder" );
 
-        auto navigationCapabilityAgent = std::shared_ptr<NavigationCapabilityAgent>( new NavigationCapabilityAgent( navigationHandler, exceptionSender, contextManager, messageSender, metricRecorder, navigationProviderName ) );
+        auto navigationCapabilityAgent = std::shared_ptr<NavigationCapabilityAgent>( new NavigationCapabilityAgent( navigationHandler, exceptionSender, contextManager, messageSender, metricRecorder, navigationProviderName, maxShapes ) );
 
         ThrowIfNull( navigationCapabilityAgent, "nullNavigationCapabilityAgent" );
 
@@ -288,10 +267,15 @@ NavigationCapabilityAgent::NavigationCapabilityAgent(
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager,
         const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
         const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder,
-        const std::string& navigationProviderName ) :
+        const std::string& navigationProviderName,
+        size_t maxShapes ) :
             alexaClientSDK::avsCommon::avs::CapabilityAgent{ NAMESPACE, exceptionSender },
             alexaClientSDK::avsCommon::utils::RequiresShutdown{"NavigationCapabilityAgent"},
             m_navigationHandler{ navigationHandler },
+            m_navigationStateCache{ maxShapes },
+            m_navigationStatePushed{ false },
+            m_navigationStateReported{ false },
+            m_reportedNavigationStateHash{ 0 },
             m_contextManager{ contextManager },
             m_messageSender{ messageSender },
             m_metricRecorder{metricRecorder} {
@@ -441,29 +425,27 @@ void NavigationCapabilityAgent::navigationError( AgentId::IdType agentId, aace::
     });
 }
 
+void NavigationCapabilityAgent::navigationStateChanged( const std::string& navigationState )
+{
+    m_executor.submit( [this, navigationState] {
+        executeNavigationStateChanged( navigationState );
+    });
+}
+
 void NavigationCapabilityAgent::executeProvideState( const NamespaceAndName& stateProviderName, const unsigned int stateRequestToken )
 {
+    AACE_TRACE_SPAN( "ContextProvider", "Navigation" );
     try
     {
         ThrowIfNull( m_contextManager, "contextManagerIsNull" );
-        bool payloadChanged = false;
-        std::string payload;
-        auto agentId = stateProviderName.getAgentId();
 
-        payload = m_navigationHandler->getNavigationState(agentId);
+        refreshNavigationState( stateProviderName.getAgentId() );
 
-        if( payload.empty() && m_navigationStatePayload.compare(DEFAULT_NAVIGATION_STATE_PAYLOAD) != 0 ) {
-            payload = DEFAULT_NAVIGATION_STATE_PAYLOAD;
-            payloadChanged = true;
-        } else if ( !payload.empty() && payload.compare( m_navigationStatePayload ) != 0 ){
-            payloadChanged = true;
-        }
-
-        if( payloadChanged ) {
-            if ( isNavigationStateValid( payload )  ) {
-                // set the context NavigationState
-                ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
-            }
+        if( !m_navigationStateReported || m_navigationStateCache.getPayloadHash() != m_reportedNavigationStateHash ) {
+            // set the context NavigationState
+            ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStateCache.getPayload(), alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
+            m_reportedNavigationStateHash = m_navigationStateCache.getPayloadHash();
+            m_navigationStateReported = true;
         } else {
             // send empty if no change
             ThrowIf( m_contextManager->setState( NAVIGATION_STATE, "", alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateEmptyPayloadFailed" );
@@ -474,6 +456,22 @@ void NavigationCapabilityAgent::executeProvideState( const NamespaceAndName& sta
     }
 }
 
+void NavigationCapabilityAgent::executeNavigationStateChanged( const std::string& navigationState )
+{
+    AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
+    m_navigationStatePushed = true;
+    if( !m_navigationStateCache.update( navigationState ) ) {
+        AACE_ERROR(LX(TAG).d("reason","invalidNavigationState"));
+    }
+}
+
+void NavigationCapabilityAgent::refreshNavigationState( AgentId::IdType agentId )
+{
+    if( !m_navigationStatePushed ) {
+        m_navigationStateCache.update( m_navigationHandler->getNavigationState( agentId ) );
+    }
+}
+
 void NavigationCapabilityAgent::executeNavigationEvent( AgentId::IdType agentId, aace::navigation::NavigationEngineInterface::EventName event )
 {
     switch( event ){
@@ -549,34 +547,13 @@ void NavigationCapabilityAgent::startNavigationSuccess(AgentId::IdType agentId)
             m_startNavDurationData.withName(METRIC_NAVIGATION_LATENCY).stopTimer().build();
     submitNavigationControlSuccessMetric(m_metricRecorder, agentId, latencyDataPoint, START_NAVIGATION.name);
 
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState(agentId);
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
+    refreshNavigationState( agentId );
+    nlohmann::json payload = {
+        { "waypoints", m_navigationStateCache.getWaypoints() },
+        { "shapes", m_navigationStateCache.getShapes() }
+    };
 
-    context.Parse( navigationState.c_str() );
-
-    rapidjson::Document waypointsArray( rapidjson::kArrayType );
-    if ( context.HasMember( "waypoints" ) ) {
-        for (auto &point : context["waypoints"].GetArray()) {
-            waypointsArray.PushBack(point, allocator);
-        }
-    }
-    payload.AddMember( "waypoints", waypointsArray, allocator );
-
-    rapidjson::Document shapesArray( rapidjson::kArrayType );
-    if ( context.HasMember( "shapes" ) ) {
-        for ( auto& point : context["shapes"].GetArray() ) {
-            shapesArray.PushBack( point, allocator );
-        }
-    }
-    payload.AddMember( "shapes", shapesArray, allocator );
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-    ThrowIfNot(payload.Accept( writer ), "failedToWriteJsonDocument" );
-    auto navEvent = buildJsonEventString( START_NAVIGATION_SUCCESS, "", buffer.GetString() );
+    auto navEvent = buildJsonEventString( START_NAVIGATION_SUCCESS, "", payload.dump() );
     auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>(agentId,  navEvent.second);
     m_messageSender->sendMessage( request );
 }
@@ -603,26 +580,13 @@ void NavigationCapabilityAgent::navigateToPreviousWaypointSuccess(AgentId::IdTyp
             m_navToPreviousDurationData.withName(METRIC_NAVIGATION_LATENCY).stopTimer().build();
     submitNavigationControlSuccessMetric(m_metricRecorder, agentId, latencyDataPoint, NAVIGATE_TO_PREVIOUS_WAYPOINT.name);
 
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState(agentId);
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
-
-    context.Parse( navigationState.c_str() );
+    refreshNavigationState( agentId );
+    auto& waypoints = m_navigationStateCache.getWaypoints();
+    nlohmann::json payload = {
+        { "waypoint", waypoints.empty() ? nlohmann::json::object() : waypoints[0] }
+    };
 
-    rapidjson::Document waypointObject( rapidjson::kObjectType );
-    if ( context.HasMember( "waypoints" ) && context["waypoints"].GetArray().Size() > 0 ) {
-        payload.AddMember( "waypoint", context["waypoints"].GetArray()[0].GetObject(), allocator );
-    } else {
-        payload.AddMember( "waypoint", waypointObject, allocator );
-    }
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-    ThrowIfNot(payload.Accept( writer ), "failedToWriteJsonDocument" );
-
-    auto navEvent = buildJsonEventString( NAVIGATE_TO_PREVIOUS_WAYPOINTS_SUCCESS, "", buffer.GetString() );
+    auto navEvent = buildJsonEventString( NAVIGATE_TO_PREVIOUS_WAYPOINTS_SUCCESS, "", payload.dump() );
     auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>(agentId,  navEvent.second);
     m_messageSender->sendMessage( request );
 }
@@ -692,122 +656,6 @@ void NavigationCapabilityAgent::showPreviousWaypointsError( AgentId::IdType agen
     m_messageSender->sendMessage( request );
 }
 
-bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationState )
-{
-    AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
-    try
-    {
-        rapidjson::Document document;
-        document.Parse<0>( navigationState.c_str() );
-
-        if( document.HasParseError() ) {
-            rapidjson::ParseErrorCode ok = document.GetParseError();
-            AACE_ERROR(LX(TAG).d( "HasParseError", GetParseError_En(ok) ) );
-            Throw( "parseError" );
-        }
-
-        ThrowIfNot( document.HasMember("state"), "stateKeyMissing");
-
-        if( document[ "state" ].IsNull() || !document[ "state" ].IsString() ) {
-            Throw( "stateNotValid" );
-        }
-        std::string state = document[ "state" ].GetString();
-        if( ( state.compare(NAVIGATION_STATE_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_NOT_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_UNKNOWN) != 0 ) ) {
-            Throw( "stateValueNotValid" );
-        }
-        if ( document.HasMember("waypoints") ) {
-            if( !document[ "waypoints" ].IsArray() ) {
-                Throw( "waypointsArrayNotValid" );
-            }
-
-            auto waypoints = document["waypoints"].GetArray();
-            for ( size_t i = 0; i < waypoints.Size() ; i++ ) {
-                auto waypoint  = waypoints[i].GetObject();
-                ThrowIfNot( waypoint.HasMember("type"), "waypointTypeMissing");
-
-                std::string waypointType = waypoint["type"].GetString();
-                if( waypoint[ "type" ].IsNull() || !waypoint[ "type" ].IsString() ) {
-                    Throw( "waypointTypeNotValid" );
-                }
-                if( ( waypointType.compare(WAYPOINT_TYPE_SOURCE) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_INTERIM) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_DESTINATION) != 0 ) ) {
-                    Throw( "waypointTypeValueNotValid" );
-                }
-                if ( waypoint.HasMember("estimatedTimeOfArrival") ) {
-                    auto estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"].GetObject();
-                    ThrowIfNot( estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
-                    if ( ( estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString() ) ||
-                         ( estimatedTimeOfArrival.HasMember("predicted") && !estimatedTimeOfArrival["predicted"].IsString() ) ) {
-
-                        Throw( "estimatedTimeOfArrivalNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("address") ) {
-                    auto address = waypoint["address"].GetObject();
-                    if ( ( address.HasMember("addressLine1") && !address["addressLine1"].IsString() ) ||
-                         ( address.HasMember("addressLine2") && !address["addressLine2"].IsString() ) ||
-                         ( address.HasMember("addressLine3") && !address["addressLine3"].IsString() ) ||
-                         ( address.HasMember("city") && !address["city"].IsString() ) ||
-                         ( address.HasMember("stateOrRegion") && !address["stateOrRegion"].IsString() ) ||
-                         ( address.HasMember("countryCode") && !address["countryCode"].IsString() ) ||
-                         ( address.HasMember("districtOrCounty") && !address["districtOrCounty"].IsString() ) ||
-                         ( address.HasMember("postalCode") && !address["postalCode"].IsString() )
-                    ) {
-                        Throw( "AddressNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("name") ) {
-                    if ( waypoint[ "name" ].IsNull() || !waypoint[ "name" ].IsString() ) {
-                        Throw( "waypointNameNotValid" );
-                    }
-                }
-
-                ThrowIfNot( waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
-                auto coordinate = waypoint["coordinate"].GetArray();
-                if ( coordinate[0].IsNull() ) {
-                    Throw( "LatitudeNotValid" );
-                }
-                if ( coordinate[1].IsNull() ) {
-                    Throw( "LongitudeNotValid" );
-                }
-                if ( waypoint.HasMember("pointOfInterest") ) {
-                    auto poi = waypoint["pointOfInterest"].GetObject();
-                    if ( !poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber") ) {
-                        waypoint.EraseMember("pointOfInterest");
-                    }
-                }
-            }
-        }
-        ThrowIfNot( document.HasMember("shapes"), "shapesKeyMissing" );
-
-        if( !document[ "shapes" ].IsArray() ) {
-            Throw( "shapesArrayNotValid" );
-        }
-        if ( document[ "waypoints" ].Size() != 0 && document[ "shapes" ].Size() < 2 ) {
-            AACE_WARN(LX(TAG).d("shapes","Shapes should not be less than 2 for local POI"));
-        }
-
-        if( document[ "shapes" ].Size() > MAXIMUM_SHAPES_IN_CONTEXT ) {
-            AACE_WARN(LX(TAG, "isNavigationStateValid").d("shapes", "Too many shapes in payload. Only using first 100."));
-            ThrowIfNot( document[ "shapes" ].Erase(document[ "shapes" ].Begin() + MAXIMUM_SHAPES_IN_CONTEXT, document[ "shapes" ].End()), "unable to operate on shapes Array" );
-        }
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-        document.Accept( writer );
-        navigationState = buffer.GetString();
-
-        // set current navigation state payload
-        m_navigationStatePayload = navigationState;
-        return true;
-    } catch( std::exception& ex ) {
-        AACE_ERROR(LX(TAG).d("reason",ex.what() ));
-        return false;
-    }
-}
-
 std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>> NavigationCapabilityAgent::getCapabilityConfigurations() {
     return m_capabilityConfigurations;
 }
@@ -51,10 +51,12 @@ static const std::string ALT_ROUTE_SAVINGS_UNIT_KILOMETER = "KILOMETER";
 
 NavigationEngineImpl::NavigationEngineImpl(
     std::shared_ptr<aace::navigation::Navigation> navigationPlatformInterface,
-    const std::string& navigationProviderName) :
+    const std::string& navigationProviderName,
+    size_t maxShapePoints) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_navigationPlatformInterface(navigationPlatformInterface),
-        m_navigationProviderName{navigationProviderName} {
+        m_navigationProviderName{navigationProviderName},
+        m_maxShapePoints{maxShapePoints} {
 }
 
 bool NavigationEngineImpl::initialize(
@@ -71,7 +73,8 @@ bool NavigationEngineImpl::initialize(
             messageSender,
             contextManager,
             metricRecorder,
-            m_navigationProviderName);
+            m_navigationProviderName,
+            m_maxShapePoints);
         ThrowIfNull(m_navigationCapabilityAgent, "couldNotCreateNavigationCapabilityAgent");
 
         m_navigationAssistanceCapabilityAgent = navigationassistance::NavigationAssistanceCapabilityAgent::create(
@@ -103,7 +106,8 @@ std::shared_ptr<NavigationEngineImpl> NavigationEngineImpl::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    const std::string& navigationProviderName) {
+    const std::string& navigationProviderName,
+    size_t maxShapePoints) {
     try {
         ThrowIfNull(navigationPlatformInterface, "nullNavigationPlatformInterface");
         ThrowIfNull(capabilitiesRegistrar, "nullCapabilitiesRegistrar");
@@ -112,7 +116,7 @@ std::shared_ptr<NavigationEngineImpl> NavigationEngineImpl::create(
         ThrowIfNull(metricRecorder, "nullMetricRecorder");
 
         std::shared_ptr<NavigationEngineImpl> navigationEngineImpl = std::shared_ptr<NavigationEngineImpl>(
-            new NavigationEngineImpl(navigationPlatformInterface, navigationProviderName));
+            new NavigationEngineImpl(navigationPlatformInterface, navigationProviderName, maxShapePoints));
 
         ThrowIfNot(
             navigationEngineImpl->initialize(
@@ -439,6 +443,13 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
     }
 }
 
+void NavigationEngineImpl::onNavigationStateChanged(const std::string& navigationState) {
+    AACE_DEBUG(LX(TAG));
+    if (m_navigationCapabilityAgent != nullptr) {
+        m_navigationCapabilityAgent->navigationStateChanged(navigationState);
+    }
+}
+
 void NavigationEngineImpl::handleControlDisplaySuccess(NavigationEngineInterface::EventName event) {
     aace::engine::navigation::DisplayMode mode;
     switch (event) {
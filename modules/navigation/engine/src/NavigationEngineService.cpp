@@ -38,7 +38,7 @@ static const std::string TAG("aace.navigation.NavigationEngineService");
 REGISTER_SERVICE(NavigationEngineService);
 
 NavigationEngineService::NavigationEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description), m_maxShapePoints(NavigationStateCache::MAXIMUM_SHAPES) {
 }
 
 bool NavigationEngineService::configure(std::shared_ptr<std::istream> configuration) {
@@ -57,6 +57,18 @@ bool NavigationEngineService::configure(std::shared_ptr<std::istream> configurat
             m_navigationProviderName = root["providerName"].GetString();
             AACE_DEBUG(LX(TAG, "configure").d("providerName", m_navigationProviderName));
         }
+
+        if (root.HasMember("maxShapePoints") && root["maxShapePoints"].IsUint()) {
+            m_maxShapePoints = root["maxShapePoints"].GetUint();
+            if (m_maxShapePoints > NavigationStateCache::MAXIMUM_SHAPES) {
+                AACE_WARN(LX(TAG, "configure")
+                              .d("reason", "maxShapePointsExceedsLimit")
+                              .d("maxShapePoints", m_maxShapePoints)
+                              .d("limit", NavigationStateCache::MAXIMUM_SHAPES));
+                m_maxShapePoints = NavigationStateCache::MAXIMUM_SHAPES;
+            }
+            AACE_DEBUG(LX(TAG, "configure").d("maxShapePoints", m_maxShapePoints));
+        }
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
@@ -115,7 +127,8 @@ bool NavigationEngineService::registerPlatformInterfaceType(std::shared_ptr<aace
             messageSender,
             contextManager,
             metricRecorder,
-            m_navigationProviderName);
+            m_navigationProviderName,
+            m_maxShapePoints);
         ThrowIfNull(m_navigationEngineImpl, "createNavigationEngineImplFailed");
 
         return true;
@@ -0,0 +1,313 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <vector>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include "AACE/Engine/Navigation/NavigationStateCache.h"
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.navigation.NavigationStateCache");
+
+/// NavigationState state accepted values
+static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
+static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
+static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
+
+// Waypoint Type accepted values
+static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
+static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
+static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
+
+/// Address fields which must be strings when present
+static const std::vector<std::string> ADDRESS_STRING_FIELDS = {"addressLine1",
+                                                               "addressLine2",
+                                                               "addressLine3",
+                                                               "city",
+                                                               "stateOrRegion",
+                                                               "countryCode",
+                                                               "districtOrCounty",
+                                                               "postalCode"};
+
+/// The minimum number of shapes kept by decimation, the first and last points of the route
+static constexpr size_t MINIMUM_SHAPES = 2;
+
+/// Degrees to radians
+static constexpr double RADIANS_PER_DEGREE = 3.14159265358979323846 / 180;
+
+/// The 64-bit FNV-1a offset basis
+static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/// The 64-bit FNV-1a prime
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+constexpr size_t NavigationStateCache::MAXIMUM_SHAPES;
+
+static uint64_t hash(const std::string& content) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (unsigned char c : content) {
+        hash ^= c;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static nlohmann::json defaultNavigationState() {
+    return {{"state", NAVIGATION_STATE_NOT_NAVIGATING},
+            {"waypoints", nlohmann::json::array()},
+            {"shapes", nlohmann::json::array()}};
+}
+
+/// A shape point projected onto a plane, in degrees
+struct Point {
+    double x;
+    double y;
+};
+
+/// A span of the route between two kept points, and its point farthest from the line joining them
+struct Segment {
+    size_t first;
+    size_t last;
+    size_t farthest;
+    double distance;
+
+    bool operator<(const Segment& other) const {
+        return distance < other.distance;
+    }
+};
+
+static double distanceToSegment(const Point& p, const Point& a, const Point& b) {
+    double dx = b.x - a.x;
+    double dy = b.y - a.y;
+    double lengthSquared = dx * dx + dy * dy;
+    double t = lengthSquared > 0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared : 0;
+    t = std::max(0.0, std::min(1.0, t));
+    double ex = p.x - (a.x + t * dx);
+    double ey = p.y - (a.y + t * dy);
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+static Segment makeSegment(const std::vector<Point>& points, size_t first, size_t last) {
+    Segment segment{first, last, first, -1};
+    for (size_t i = first + 1; i < last; i++) {
+        double distance = distanceToSegment(points[i], points[first], points[last]);
+        if (distance > segment.distance) {
+            segment.farthest = i;
+            segment.distance = distance;
+        }
+    }
+    return segment;
+}
+
+static bool toPoints(const nlohmann::json& shapes, std::vector<Point>& points) {
+    points.reserve(shapes.size());
+    double longitudeScale = 1;
+    for (auto& shape : shapes) {
+        if (!shape.is_array() || shape.size() < 2 || !shape[0].is_number() || !shape[1].is_number()) {
+            return false;
+        }
+        double latitude = shape[0].get<double>();
+        double longitude = shape[1].get<double>();
+        if (points.empty()) {
+            // an equirectangular projection around the start of the route is accurate enough to
+            // compare the distances of nearby points
+            longitudeScale = std::cos(latitude * RADIANS_PER_DEGREE);
+        }
+        points.push_back({longitude * longitudeScale, latitude});
+    }
+    return true;
+}
+
+void NavigationStateCache::decimateShapes(nlohmann::json& shapes, size_t maxShapes) {
+    maxShapes = std::max(maxShapes, MINIMUM_SHAPES);
+    if (!shapes.is_array() || shapes.size() <= maxShapes) {
+        return;
+    }
+
+    std::vector<Point> points;
+    if (!toPoints(shapes, points)) {
+        AACE_WARN(LX(TAG).m("Shapes are not coordinates. Only using the first shapes.").d("maxShapes", maxShapes));
+        shapes.erase(shapes.begin() + maxShapes, shapes.end());
+        return;
+    }
+
+    // Douglas-Peucker, refining the span with the largest error first so the result is the best
+    // approximation of the route for the number of points allowed
+    std::vector<bool> keep(points.size(), false);
+    keep.front() = keep.back() = true;
+    size_t kept = MINIMUM_SHAPES;
+
+    std::priority_queue<Segment> segments;
+    segments.push(makeSegment(points, 0, points.size() - 1));
+    while (kept < maxShapes && !segments.empty()) {
+        auto segment = segments.top();
+        segments.pop();
+        keep[segment.farthest] = true;
+        kept++;
+        if (segment.farthest - segment.first > 1) {
+            segments.push(makeSegment(points, segment.first, segment.farthest));
+        }
+        if (segment.last - segment.farthest > 1) {
+            segments.push(makeSegment(points, segment.farthest, segment.last));
+        }
+    }
+
+    nlohmann::json decimated = nlohmann::json::array();
+    for (size_t i = 0; i < keep.size(); i++) {
+        if (keep[i]) {
+            decimated.push_back(std::move(shapes[i]));
+        }
+    }
+    AACE_DEBUG(LX(TAG).d("shapes", shapes.size()).d("kept", decimated.size()));
+    shapes = std::move(decimated);
+}
+
+NavigationStateCache::NavigationStateCache(size_t maxShapes) :
+        m_maxShapes(std::max(MINIMUM_SHAPES, std::min(maxShapes, MAXIMUM_SHAPES))),
+        m_reportedHash(0),
+        m_hasReportedState(false),
+        m_state(defaultNavigationState()) {
+    m_payload = m_state.dump();
+    m_payloadHash = hash(m_payload);
+}
+
+bool NavigationStateCache::update(const std::string& navigationState) {
+    auto reportedHash = hash(navigationState);
+    if (m_hasReportedState && reportedHash == m_reportedHash) {
+        return true;
+    }
+
+    try {
+        nlohmann::json state = defaultNavigationState();
+        if (!navigationState.empty()) {
+            state = nlohmann::json::parse(navigationState);
+            validate(state);
+            decimateShapes(state["shapes"], m_maxShapes);
+        }
+
+        m_state = std::move(state);
+        m_payload = m_state.dump();
+        m_payloadHash = hash(m_payload);
+        m_reportedHash = reportedHash;
+        m_hasReportedState = true;
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+const std::string& NavigationStateCache::getPayload() const {
+    return m_payload;
+}
+
+uint64_t NavigationStateCache::getPayloadHash() const {
+    return m_payloadHash;
+}
+
+const nlohmann::json& NavigationStateCache::getWaypoints() const {
+    return m_state["waypoints"];
+}
+
+const nlohmann::json& NavigationStateCache::getShapes() const {
+    return m_state["shapes"];
+}
+
+void NavigationStateCache::validate(nlohmann::json& state) {
+    ThrowIfNot(state.is_object(), "stateNotObject");
+    ThrowIfNot(state.contains("state"), "stateKeyMissing");
+    ThrowIfNot(state["state"].is_string(), "stateNotValid");
+
+    auto& stateValue = state["state"].get_ref<const std::string&>();
+    if (stateValue != NAVIGATION_STATE_NAVIGATING && stateValue != NAVIGATION_STATE_NOT_NAVIGATING &&
+        stateValue != NAVIGATION_STATE_UNKNOWN) {
+        Throw("stateValueNotValid");
+    }
+
+    if (!state.contains("waypoints")) {
+        state["waypoints"] = nlohmann::json::array();
+    }
+    auto& waypoints = state["waypoints"];
+    ThrowIfNot(waypoints.is_array(), "waypointsArrayNotValid");
+
+    for (auto& waypoint : waypoints) {
+        ThrowIfNot(waypoint.is_object(), "waypointNotValid");
+        ThrowIfNot(waypoint.contains("type"), "waypointTypeMissing");
+        ThrowIfNot(waypoint["type"].is_string(), "waypointTypeNotValid");
+
+        auto& waypointType = waypoint["type"].get_ref<const std::string&>();
+        if (waypointType != WAYPOINT_TYPE_SOURCE && waypointType != WAYPOINT_TYPE_INTERIM &&
+            waypointType != WAYPOINT_TYPE_DESTINATION) {
+            Throw("waypointTypeValueNotValid");
+        }
+
+        if (waypoint.contains("estimatedTimeOfArrival")) {
+            auto& estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"];
+            ThrowIfNot(estimatedTimeOfArrival.is_object(), "estimatedTimeOfArrivalNotValid");
+            ThrowIfNot(estimatedTimeOfArrival.contains("predicted"), "predictedTimeOfArrivalMissing");
+            if (!estimatedTimeOfArrival["predicted"].is_string() ||
+                (estimatedTimeOfArrival.contains("ideal") && !estimatedTimeOfArrival["ideal"].is_string())) {
+                Throw("estimatedTimeOfArrivalNotString");
+            }
+        }
+
+        if (waypoint.contains("address")) {
+            auto& address = waypoint["address"];
+            ThrowIfNot(address.is_object(), "addressNotValid");
+            for (auto& field : ADDRESS_STRING_FIELDS) {
+                if (address.contains(field) && !address[field].is_string()) {
+                    Throw("AddressNotString");
+                }
+            }
+        }
+
+        if (waypoint.contains("name")) {
+            ThrowIfNot(waypoint["name"].is_string(), "waypointNameNotValid");
+        }
+
+        ThrowIfNot(waypoint.contains("coordinate"), "waypointcoordinateMissing");
+        auto& coordinate = waypoint["coordinate"];
+        ThrowIfNot(coordinate.is_array() && coordinate.size() >= 2, "coordinateNotValid");
+        ThrowIf(coordinate[0].is_null(), "LatitudeNotValid");
+        ThrowIf(coordinate[1].is_null(), "LongitudeNotValid");
+
+        if (waypoint.contains("pointOfInterest")) {
+            auto& poi = waypoint["pointOfInterest"];
+            if (!poi.is_object() || (!poi.contains("id") && !poi.contains("name") && !poi.contains("phoneNumber"))) {
+                waypoint.erase("pointOfInterest");
+            }
+        }
+    }
+
+    ThrowIfNot(state.contains("shapes"), "shapesKeyMissing");
+    auto& shapes = state["shapes"];
+    ThrowIfNot(shapes.is_array(), "shapesArrayNotValid");
+
+    if (!waypoints.empty() && shapes.size() < MINIMUM_SHAPES) {
+        AACE_WARN(LX(TAG).d("shapes", "Shapes should not be less than 2 for local POI"));
+    }
+}
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
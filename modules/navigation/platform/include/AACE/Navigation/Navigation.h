@@ -170,6 +170,8 @@ public:
     /**
      * Retrieve the navigation state from the platform. 
      * NOTE: You may return an empty string to default the payload to NOT_NAVIGATING
+     * NOTE: Once the platform reports its state with navigationStateChanged(), the Engine answers context requests
+     * from the reported state and no longer calls this function for each request.
      *  
      * @return the current NavigationState JSON payload
      * @code{.json}) 
@@ -448,6 +450,20 @@ public:
      */
     void showAlternativeRoutesSucceeded(const std::string& payload);
 
+    /**
+     * Notifies the Engine that the navigation state changed, such as when navigation starts or stops, the route
+     * changes, or a waypoint is reached. The Engine caches the state and uses it for the @c NavigationState context
+     * instead of calling getNavigationState() for each request, so the platform should call this function whenever
+     * its state changes after the first call.
+     *
+     * The Engine reduces the route shapes to the configured maximum number of points, keeping the points that
+     * best preserve the shape of the route.
+     *
+     * @param navigationState The NavigationState JSON payload in the format described in getNavigationState(). An
+     * empty string defaults the payload to NOT_NAVIGATING.
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
     void setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface);
 
 private:
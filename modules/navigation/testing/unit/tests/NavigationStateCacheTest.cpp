@@ -0,0 +1,146 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Navigation/NavigationStateCache.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace navigation {
+
+using NavigationStateCache = aace::engine::navigation::NavigationStateCache;
+
+// clang-format off
+static const std::string NAVIGATION_STATE = R"({
+    "state": "NAVIGATING",
+    "waypoints": [
+        {
+            "type": "SOURCE",
+            "coordinate": [37.3859, -122.0839]
+        },
+        {
+            "type": "DESTINATION",
+            "coordinate": [37.4219, -122.0840],
+            "name": "Office",
+            "pointOfInterest": {}
+        }
+    ],
+    "shapes": [[37.3859, -122.0839], [37.3900, -122.0839], [37.4219, -122.0840]]
+})";
+// clang-format on
+
+static nlohmann::json createShapes(size_t count) {
+    nlohmann::json shapes = nlohmann::json::array();
+    for (size_t i = 0; i < count; i++) {
+        shapes.push_back({37.0 + i * 0.001, -122.0 + (i % 2) * 0.0001});
+    }
+    return shapes;
+}
+
+TEST(NavigationStateCacheTest, defaultsToNotNavigating) {
+    NavigationStateCache cache;
+    auto payload = nlohmann::json::parse(cache.getPayload());
+    EXPECT_EQ("NOT_NAVIGATING", payload["state"]);
+    EXPECT_TRUE(cache.getWaypoints().empty());
+    EXPECT_TRUE(cache.getShapes().empty());
+}
+
+TEST(NavigationStateCacheTest, updateWithValidState) {
+    NavigationStateCache cache;
+    auto defaultHash = cache.getPayloadHash();
+
+    ASSERT_TRUE(cache.update(NAVIGATION_STATE));
+    EXPECT_NE(defaultHash, cache.getPayloadHash());
+    EXPECT_EQ(2u, cache.getWaypoints().size());
+    EXPECT_EQ(3u, cache.getShapes().size());
+    EXPECT_FALSE(cache.getWaypoints()[1].contains("pointOfInterest"));
+
+    ASSERT_TRUE(cache.update(""));
+    EXPECT_EQ(defaultHash, cache.getPayloadHash());
+}
+
+TEST(NavigationStateCacheTest, equivalentStatesHaveTheSameHash) {
+    NavigationStateCache cache;
+    ASSERT_TRUE(cache.update(NAVIGATION_STATE));
+    auto hash = cache.getPayloadHash();
+
+    // the same state with different formatting
+    ASSERT_TRUE(cache.update(nlohmann::json::parse(NAVIGATION_STATE).dump()));
+    EXPECT_EQ(hash, cache.getPayloadHash());
+}
+
+TEST(NavigationStateCacheTest, invalidStateKeepsPreviousState) {
+    NavigationStateCache cache;
+    ASSERT_TRUE(cache.update(NAVIGATION_STATE));
+    auto hash = cache.getPayloadHash();
+
+    EXPECT_FALSE(cache.update("{"));
+    EXPECT_FALSE(cache.update(R"({"state":"DRIVING","waypoints":[],"shapes":[]})"));
+    EXPECT_FALSE(cache.update(R"({"state":"NAVIGATING","waypoints":[{"type":"HOME"}],"shapes":[]})"));
+    EXPECT_FALSE(cache.update(R"({"state":"NAVIGATING","waypoints":[]})"));
+    EXPECT_EQ(hash, cache.getPayloadHash());
+}
+
+TEST(NavigationStateCacheTest, decimatesShapesToConfiguredMaximum) {
+    NavigationStateCache cache(10);
+    nlohmann::json state = {
+        {"state", "NAVIGATING"}, {"waypoints", nlohmann::json::array()}, {"shapes", createShapes(500)}};
+
+    ASSERT_TRUE(cache.update(state.dump()));
+    auto& shapes = cache.getShapes();
+    ASSERT_EQ(10u, shapes.size());
+    EXPECT_EQ(state["shapes"].front(), shapes.front());
+    EXPECT_EQ(state["shapes"].back(), shapes.back());
+}
+
+TEST(NavigationStateCacheTest, maximumShapesIsLimited) {
+    NavigationStateCache cache(1000);
+    nlohmann::json state = {
+        {"state", "NAVIGATING"}, {"waypoints", nlohmann::json::array()}, {"shapes", createShapes(500)}};
+
+    ASSERT_TRUE(cache.update(state.dump()));
+    EXPECT_EQ(NavigationStateCache::MAXIMUM_SHAPES, cache.getShapes().size());
+}
+
+TEST(NavigationStateCacheTest, decimationKeepsTheMostSignificantPoints) {
+    // a straight line with a single detour
+    nlohmann::json shapes = nlohmann::json::array();
+    for (int i = 0; i <= 20; i++) {
+        shapes.push_back({0.0, i * 0.01});
+    }
+    shapes[13] = {0.05, 0.13};
+
+    NavigationStateCache::decimateShapes(shapes, 5);
+    ASSERT_EQ(5u, shapes.size());
+    EXPECT_EQ(nlohmann::json({0.0, 0.0}), shapes[0]);
+    EXPECT_EQ(nlohmann::json({0.05, 0.13}), shapes[2]);
+    EXPECT_EQ(nlohmann::json({0.0, 0.2}), shapes[4]);
+}
+
+TEST(NavigationStateCacheTest, malformedShapesAreTruncated) {
+    nlohmann::json shapes = createShapes(20);
+    shapes[5] = "invalid";
+
+    NavigationStateCache::decimateShapes(shapes, 10);
+    ASSERT_EQ(10u, shapes.size());
+    EXPECT_EQ("invalid", shapes[5]);
+}
+
+}  // namespace navigation
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
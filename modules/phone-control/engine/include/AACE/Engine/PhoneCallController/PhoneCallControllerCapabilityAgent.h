@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_PHONECALLCONTROLLER_PHONECALLCONTROLLER_CAPABILITY_AGENT_H
 #define AACE_ENGINE_PHONECALLCONTROLLER_PHONECALLCONTROLLER_CAPABILITY_AGENT_H
 
+#include <atomic>
+#include <mutex>
+
 #include <AVSCommon/AVS/CapabilityAgent.h>
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/SDKInterfaces/CapabilityConfigurationInterface.h>
@@ -145,15 +148,33 @@ private:
     void releaseCommunicationsChannelFocus();
 
     void updateContextManager(const std::string& context);
+
+    /**
+     * Returns the serialized context of the phone call controller. The context is cached, and serialized again only
+     * when the state changed since the last call.
+     */
     std::string getContextString();
+    std::string buildContextString();
+    void markContextDirty();
+
     std::string getEventName(CallState state, const std::string& callId);
+
+    /**
+     * Builds an event carrying the context of the phone call controller.
+     *
+     * @param eventName The name of the event.
+     * @param payload The payload of the event.
+     * @param updateContext Whether the context manager should be updated with the context of the event.
+     */
     const std::pair<std::string, std::string> buildEventAndUpdateContext(
         const std::string& eventName,
-        const std::string& payload);
+        const std::string& payload,
+        bool updateContext = true);
 
     void addCall(std::string callId, CallState state);
     void setCallState(std::string callId, CallState state);
     void removeCall(std::string callId);
+    void setCurrentCallId(const std::string& callId);
     alexaClientSDK::avsCommon::avs::AgentId::IdType executeGetAgentByCallId(const std::string& callId, const std::string& eventName);
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> m_contextManager;
@@ -173,6 +194,15 @@ private:
         bool>
         m_deviceConfigurationMap;
     aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState m_connectionState;
+
+    /// The last serialized context, valid while @c m_contextDirty is @c false.
+    std::string m_cachedContext;
+    std::atomic<bool> m_contextDirty;
+    std::mutex m_contextMutex;
+
+    /// The call state changes submitted to the executor and not yet executed.
+    std::atomic<int> m_pendingCallStateChanges;
+
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 };
 
@@ -159,7 +159,9 @@ PhoneCallControllerCapabilityAgent::PhoneCallControllerCapabilityAgent(
         m_contextManager{contextManager},
         m_messageSender{messageSender},
         m_focusManager{focusManager},
-        m_phoneCallController{phoneCallController} {
+        m_phoneCallController{phoneCallController},
+        m_contextDirty{true},
+        m_pendingCallStateChanges{0} {
     m_capabilityConfigurations.insert(getPhoneCallControllerCapabilityConfiguration());
     m_connectionState = aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState::DISCONNECTED;
     std::string context = getContextString();
@@ -249,7 +251,7 @@ void PhoneCallControllerCapabilityAgent::handleDialDirective(std::shared_ptr<Dir
         if (m_phoneCallController->dial(info->directive->getPayload())) {
             auto agentId = info->directive->getAgentId();
             m_callMethodMap[callId] = CallMethod::DIAL;
-            m_currentCallId = callId;
+            setCurrentCallId(callId);
             m_callAgentMap[callId] = agentId;
         } else {
             removeCall(callId);
@@ -289,7 +291,7 @@ void PhoneCallControllerCapabilityAgent::handleRedialDirective(std::shared_ptr<D
         if (m_phoneCallController->redial(info->directive->getPayload())) {
             auto agentId = info->directive->getAgentId();
             m_callMethodMap[callId] = CallMethod::REDIAL;
-            m_currentCallId = callId;
+            setCurrentCallId(callId);
             m_callAgentMap[callId] = agentId;
         } else {
             removeCall(callId);
@@ -457,6 +459,7 @@ PhoneCallControllerCapabilityAgent::getCapabilityConfigurations() {
 void PhoneCallControllerCapabilityAgent::connectionStateChanged(
     aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState state) {
     m_connectionState = state;
+    markContextDirty();
     std::string context = getContextString();
     updateContextManager(context);
 }
@@ -491,6 +494,7 @@ void PhoneCallControllerCapabilityAgent::callStateChanged(
             return;
     }
 
+    m_pendingCallStateChanges++;
     m_executor.submit(
         [this, internalState, callId, callerId] { executeCallStateChanged(internalState, callId, callerId); });
 }
@@ -519,6 +523,7 @@ void PhoneCallControllerCapabilityAgent::deviceConfigurationUpdated(
         aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty,
         bool> configurationMap) {
     m_deviceConfigurationMap = configurationMap;
+    markContextDirty();
     std::string context = getContextString();
     updateContextManager(context);
 }
@@ -536,6 +541,23 @@ void PhoneCallControllerCapabilityAgent::updateContextManager(const std::string&
 }
 
 std::string PhoneCallControllerCapabilityAgent::getContextString() {
+    std::lock_guard<std::mutex> lock(m_contextMutex);
+    // the flag is cleared before serializing, so a change made meanwhile is serialized by the next call
+    if (!m_contextDirty.exchange(false)) {
+        return m_cachedContext;
+    }
+    m_cachedContext = buildContextString();
+    if (m_cachedContext.empty()) {
+        m_contextDirty = true;
+    }
+    return m_cachedContext;
+}
+
+void PhoneCallControllerCapabilityAgent::markContextDirty() {
+    m_contextDirty = true;
+}
+
+std::string PhoneCallControllerCapabilityAgent::buildContextString() {
     try {
         rapidjson::Document document(rapidjson::kObjectType);
 
@@ -596,33 +618,21 @@ std::string PhoneCallControllerCapabilityAgent::getContextString() {
 
 const std::pair<std::string, std::string> PhoneCallControllerCapabilityAgent::buildEventAndUpdateContext(
     const std::string& eventName,
-    const std::string& payload) {
+    const std::string& payload,
+    bool updateContext) {
     const std::pair<std::string, std::string> emptyPair;
     std::string context = getContextString();
-    rapidjson::Document contextPayload;
-    if (contextPayload.Parse(context.c_str()).HasParseError()) {
-        AACE_ERROR(LX(TAG).d("reason", "failedToParseContextPayload"));
+    if (context.empty()) {
+        AACE_ERROR(LX(TAG).d("reason", "failedToCreateContextPayload"));
         return emptyPair;
     }
-    rapidjson::Document document(rapidjson::kArrayType);
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-    rapidjson::Value contextObject(rapidjson::kObjectType);
-    contextObject.AddMember("payload", contextPayload, allocator);
-    rapidjson::Value header(rapidjson::kObjectType);
-    header.AddMember("namespace", rapidjson::Value(NAMESPACE.c_str(), allocator), allocator);
-    header.AddMember("name", rapidjson::Value("PhoneCallControllerState", allocator), allocator);
-    contextObject.AddMember("header", header, allocator);
-    document.PushBack(contextObject, allocator);
-
-    if (!document.Accept(writer)) {
-        AACE_ERROR(LX(TAG).d("reason", "failedToCreateContextWithHeader"));
-        return emptyPair;
+    // the serialized context is a JSON object, so it is embedded as is rather than parsed into a document again
+    std::string contextWithHeader = "[{\"payload\":" + context + ",\"header\":{\"namespace\":\"" + NAMESPACE +
+                                    "\",\"name\":\"PhoneCallControllerState\"}}]";
+    if (updateContext) {
+        updateContextManager(context);
     }
-    updateContextManager(context);
-    return buildJsonEventString(eventName, "", payload, buffer.GetString());
+    return buildJsonEventString(eventName, "", payload, contextWithHeader);
 }
 
 void PhoneCallControllerCapabilityAgent::executeOnFocusChanged(
@@ -644,6 +654,10 @@ void PhoneCallControllerCapabilityAgent::executeCallStateChanged(
     CallState state,
     const std::string& callId,
     const std::string& callerId) {
+    // a burst of call state changes updates the context manager once, with the state after the last change, while
+    // the event of every change still carries its own context
+    bool updateContext = --m_pendingCallStateChanges == 0;
+
     if (!callExist(callId)) {
         addCall(callId, CallState::IDLE);
     }
@@ -653,7 +667,7 @@ void PhoneCallControllerCapabilityAgent::executeCallStateChanged(
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
-    m_currentCallId = callId;
+    setCurrentCallId(callId);
 
     // Context Handling
     if (state == CallState::IDLE) {
@@ -702,7 +716,7 @@ void PhoneCallControllerCapabilityAgent::executeCallStateChanged(
 
     try {
         ThrowIfNot(payload.Accept(writer), "failedToWriteJsonDocument");
-        auto event = buildEventAndUpdateContext(eventName, buffer.GetString());
+        auto event = buildEventAndUpdateContext(eventName, buffer.GetString(), updateContext);
         ThrowIf(event.second.empty(), "failedToCreateEvent");
         auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>(agentId, event.second);
         m_messageSender->sendMessage(request);
@@ -964,6 +978,7 @@ std::string PhoneCallControllerCapabilityAgent::dtmfErrorToString(
 
 void PhoneCallControllerCapabilityAgent::addCall(std::string callId, CallState state) {
     m_allCallsMap[callId] = state;
+    markContextDirty();
 }
 
 PhoneCallControllerCapabilityAgent::CallState PhoneCallControllerCapabilityAgent::getCallState(std::string callId) {
@@ -972,10 +987,19 @@ PhoneCallControllerCapabilityAgent::CallState PhoneCallControllerCapabilityAgent
 
 void PhoneCallControllerCapabilityAgent::setCallState(std::string callId, CallState state) {
     m_allCallsMap[callId] = state;
+    markContextDirty();
 }
 
 void PhoneCallControllerCapabilityAgent::removeCall(std::string callId) {
     m_allCallsMap.erase(callId);
+    markContextDirty();
+}
+
+void PhoneCallControllerCapabilityAgent::setCurrentCallId(const std::string& callId) {
+    if (m_currentCallId != callId) {
+        m_currentCallId = callId;
+        markContextDirty();
+    }
 }
 
 bool PhoneCallControllerCapabilityAgent::callExist(std::string callId) {
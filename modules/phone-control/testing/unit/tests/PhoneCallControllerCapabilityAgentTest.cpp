@@ -909,6 +909,40 @@ TEST_F(PhoneCallControllerCapabilityAgentTest, testCallStateChangedInboundRingin
         aace::engine::phoneCallController::PhoneCallControllerCapabilityAgent::CallState::INBOUND_RINGING);
 }
 
+TEST_F(PhoneCallControllerCapabilityAgentTest, testCallStateChangedBurstUpdatesContextOnce) {
+    setupExpectedContextUpdate(PHONE_CONNECTED_CONTEXT, 2);  // One expect is for the last change of the burst
+    setupExpectedContextUpdate(OUTBOUND_RINGING_STARTED_CONTEXT, 1);
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(testing::_, testing::_, testing::_))
+        .Times(testing::Exactly(2))
+        .WillRepeatedly(testing::Return(true));
+
+    // the first event is held until the rest of the burst is submitted
+    std::promise<void> firstEventSentPromise;
+    std::promise<void> burstSubmittedPromise;
+    auto burstSubmittedFuture = burstSubmittedPromise.get_future();
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(testing::_))
+        .Times(testing::Exactly(3))
+        .WillOnce(testing::InvokeWithoutArgs([&firstEventSentPromise, &burstSubmittedFuture] {
+            firstEventSentPromise.set_value();
+            burstSubmittedFuture.wait_for(TIMEOUT);
+        }))
+        .WillRepeatedly(testing::Return());
+
+    m_capAgent->connectionStateChanged(
+        aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState::CONNECTED);
+    m_capAgent->callStateChanged(
+        aace::phoneCallController::PhoneCallControllerEngineInterface::CallState::OUTBOUND_RINGING, TEST_CALL_ID, "");
+    ASSERT_EQ(std::future_status::ready, firstEventSentPromise.get_future().wait_for(TIMEOUT));
+    m_capAgent->callStateChanged(
+        aace::phoneCallController::PhoneCallControllerEngineInterface::CallState::ACTIVE, TEST_CALL_ID, "");
+    m_capAgent->callStateChanged(
+        aace::phoneCallController::PhoneCallControllerEngineInterface::CallState::IDLE, TEST_CALL_ID, "");
+    burstSubmittedPromise.set_value();
+    m_wakeSetCompletedFuture.wait_for(TIMEOUT);
+
+    ASSERT_EQ(m_capAgent->callExist(TEST_CALL_ID), false);
+}
+
 }  // namespace phoneCallController
 }  // namespace unit
 }  // namespace test
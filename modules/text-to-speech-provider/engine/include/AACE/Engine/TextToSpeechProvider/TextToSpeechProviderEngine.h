@@ -89,6 +89,7 @@ public:
 
     // PropertyListenerInterface
     void propertyChanged(const std::string& key, const std::string& newValue) override;
+    void propertiesChanged(const std::vector<std::pair<std::string, std::string>>& changes) override;
 
     // ConnectionStatusObserverInterface
     void onConnectionStatusChanged(
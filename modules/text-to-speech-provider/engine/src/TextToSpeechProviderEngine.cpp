@@ -296,6 +296,16 @@ void TextToSpeechProviderEngine::propertyChanged(const std::string& key, const s
     m_currentLocale = newValue;
 }
 
+void TextToSpeechProviderEngine::propertiesChanged(const std::vector<std::pair<std::string, std::string>>& changes) {
+    AACE_INFO(LX(TAG).d("count", changes.size()));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& change : changes) {
+        if (change.first == aace::alexa::property::LOCALE) {
+            m_currentLocale = change.second;
+        }
+    }
+}
+
 void TextToSpeechProviderEngine::onConnectionStatusChanged(
     const alexaClientSDK::avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status status,
     const alexaClientSDK::avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::ChangedReason reason) {
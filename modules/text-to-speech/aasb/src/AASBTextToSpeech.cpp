@@ -21,6 +21,7 @@
 #include <AASB/Message/TextToSpeech/TextToSpeech/PrepareSpeechMessage.h>
 #include <AASB/Message/TextToSpeech/TextToSpeech/PrepareSpeechCompletedMessage.h>
 #include <AASB/Message/TextToSpeech/TextToSpeech/PrepareSpeechFailedMessage.h>
+#include <AASB/Message/TextToSpeech/TextToSpeech/PrewarmSpeechMessage.h>
 
 namespace aasb {
 namespace engine {
@@ -74,6 +75,21 @@ bool AASBTextToSpeech::initialize(
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::textToSpeech::textToSpeech::PrewarmSpeechMessage::topic(),
+            aasb::message::textToSpeech::textToSpeech::PrewarmSpeechMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::textToSpeech::textToSpeech::PrewarmSpeechMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->prewarmSpeech(payload.texts, payload.provider, payload.options);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                }
+            });
+
         messageBroker->subscribe(
             aasb::message::textToSpeech::textToSpeech::GetCapabilitiesMessage::topic(),
             aasb::message::textToSpeech::textToSpeech::GetCapabilitiesMessage::action(),
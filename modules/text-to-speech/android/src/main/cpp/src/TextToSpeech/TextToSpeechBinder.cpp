@@ -106,6 +106,20 @@ void TextToSpeechHandler::capabilitiesReceived(const std::string& requestId, con
 
 #define TEXTTOSPEECH_BINDER(ref) reinterpret_cast<aace::jni::textToSpeech::TextToSpeechBinder*>(ref)
 
+/**
+ * Convert a Java String array to a vector of strings
+ */
+static std::vector<std::string> stringArrayToVector(JNIEnv* env, jobjectArray jstrArray) {
+    std::vector<std::string> strVector;
+    int arraySize = env->GetArrayLength(jstrArray);
+    for (int j = 0; j < arraySize; j++) {
+        auto jstr = (jstring)env->GetObjectArrayElement(jstrArray, j);
+        strVector.push_back(JString(jstr).toStdStr());
+        env->DeleteLocalRef(jstr);
+    }
+    return strVector;
+}
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL Java_com_amazon_aace_textToSpeech_TextToSpeech_createBinder(JNIEnv* env, jobject obj) {
@@ -169,4 +183,26 @@ JNIEXPORT jboolean JNICALL Java_com_amazon_aace_textToSpeech_TextToSpeech_getCap
         return false;
     }
 }
+
+JNIEXPORT jboolean JNICALL Java_com_amazon_aace_textToSpeech_TextToSpeech_prewarmSpeech(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jobjectArray texts,
+    jstring provider,
+    jstring options) {
+    try {
+        auto textToSpeechBinder = TEXTTOSPEECH_BINDER(ref);
+        ThrowIfNull(textToSpeechBinder, "invalidTextToSpeechBinder");
+
+        ThrowIfNot(
+            textToSpeechBinder->getTextToSpeech()->prewarmSpeech(
+                stringArrayToVector(env, texts), JString(provider).toStdStr(), JString(options).toStdStr()),
+            "prewarmSpeechFailed");
+        return true;
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, __func__, ex.what());
+        return false;
+    }
+}
 }
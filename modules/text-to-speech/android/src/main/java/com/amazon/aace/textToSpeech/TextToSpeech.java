@@ -131,6 +131,31 @@ abstract public class TextToSpeech extends PlatformInterface {
         return getCapabilities(getNativeRef(), requestId, provider);
     }
 
+    /**
+     * Notifies the Engine to synthesize a list of phrases ahead of time and store them in the
+     * prepared speech cache, so a later @c prepareSpeech() request for any of the phrases
+     * with the same @c provider and @c options completes without a provider round trip.
+     * Phrases which are already cached are not synthesized again.
+     *
+     * This is an asynchronous call, and the platform is not notified when the phrases
+     * have been cached. The prepared speech cache must be enabled with the
+     * @c aace.textToSpeech.preparedSpeechCache configuration.
+     *
+     * @param texts The phrases in plain text or SSML format.
+     * @param provider The Text To Speech provider to be used to generate the speech assets.
+     * @param options Additional options for the speech synthesis requests, as specified
+     * for @c prepareSpeech().
+     * @return true if the request was successful, else false if an error occurred.
+     *
+     */
+    protected final boolean prewarmSpeech(String[] texts, String provider, String options) {
+        return prewarmSpeech(getNativeRef(), texts, provider, options);
+    }
+
+    protected final boolean prewarmSpeech(String[] texts, String provider) {
+        return prewarmSpeech(getNativeRef(), texts, provider, "");
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -145,4 +170,5 @@ abstract public class TextToSpeech extends PlatformInterface {
     private native void disposeBinder(long nativeRef);
     private native boolean prepareSpeech(long nativeRef, String speechId, String text, String provider, String options);
     private native boolean getCapabilities(long nativeRef, String requestId, String provider);
+    private native boolean prewarmSpeech(long nativeRef, String[] texts, String provider, String options);
 }
\ No newline at end of file
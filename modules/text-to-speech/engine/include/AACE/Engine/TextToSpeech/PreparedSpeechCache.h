@@ -0,0 +1,188 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_TEXTTOSPEECH_PREPARED_SPEECH_CACHE_H
+#define AACE_ENGINE_TEXTTOSPEECH_PREPARED_SPEECH_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/Audio/AudioStream.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+/**
+ * A bounded, disk-backed least recently used cache of prepared speech.
+ *
+ * Each entry is stored in its own file in the cache directory, named after the hash of its key. The file holds
+ * the key, the speech metadata and the audio format followed by the audio data, so a cached speech is played
+ * directly from its file. The cache index is rebuilt from the cache directory when the cache is created, using
+ * the file modification times to restore the least recently used order.
+ *
+ * The cache is thread safe. Speech recorded with @c record() is written on the cache executor, so the reader of
+ * the audio never waits for the disk.
+ */
+class PreparedSpeechCache : public std::enable_shared_from_this<PreparedSpeechCache> {
+private:
+    PreparedSpeechCache(const std::string& path, size_t maxSize);
+
+    bool initialize();
+
+public:
+    /// The default maximum total size of the cache files in bytes
+    static constexpr size_t DEFAULT_MAX_SIZE = 10 * 1024 * 1024;
+
+    /**
+     * Creates the cache, creating the cache directory if it does not exist.
+     *
+     * @param path The path of the cache directory
+     * @param maxSize The maximum total size of the cache files in bytes
+     * @return The cache, or @c nullptr if the cache directory is not usable
+     */
+    static std::shared_ptr<PreparedSpeechCache> create(const std::string& path, size_t maxSize = DEFAULT_MAX_SIZE);
+
+    /**
+     * Creates the key identifying a prepared speech. The request payload is normalized, so payloads which differ
+     * only in formatting or in the order of their properties have the same key.
+     *
+     * @param provider The text to speech provider
+     * @param text The text or SSML of the speech
+     * @param locale The locale the speech is synthesized in
+     * @param requestPayload The provider request payload, which specifies the voice
+     * @return The key of the prepared speech
+     */
+    static std::string createKey(
+        const std::string& provider,
+        const std::string& text,
+        const std::string& locale,
+        const std::string& requestPayload);
+
+    /**
+     * Gets a prepared speech and marks it as the most recently used.
+     *
+     * @param key The key of the prepared speech
+     * @param [out] metadata The metadata of the prepared speech
+     * @return The audio of the prepared speech, or @c nullptr if the speech is not cached
+     */
+    std::shared_ptr<aace::audio::AudioStream> get(const std::string& key, std::string& metadata);
+
+    /// @return @c true if the prepared speech with @c key is cached
+    bool contains(const std::string& key);
+
+    /**
+     * Adds a prepared speech, replacing the cached speech with the same key, and evicts the least recently used
+     * speeches until the cache fits its maximum size.
+     *
+     * @param key The key of the prepared speech
+     * @param metadata The metadata of the prepared speech
+     * @param audioFormat The format of the audio
+     * @param audio The audio data
+     * @return @c true if the speech was added
+     */
+    bool put(
+        const std::string& key,
+        const std::string& metadata,
+        aace::audio::AudioFormat audioFormat,
+        const std::string& audio);
+
+    /**
+     * Adds a prepared speech on the cache executor, like @c put(), without waiting for its file to be written.
+     *
+     * @param key The key of the prepared speech
+     * @param metadata The metadata of the prepared speech
+     * @param audioFormat The format of the audio
+     * @param audio The audio data
+     */
+    void putAsync(
+        const std::string& key,
+        const std::string& metadata,
+        aace::audio::AudioFormat audioFormat,
+        std::string audio);
+
+    /// Waits until the speeches added with @c putAsync() have been written
+    void waitForPendingWrites();
+
+    /**
+     * Wraps the audio of a prepared speech so it is added to the cache once it has been read to its end. The
+     * speech is not cached if the stream is abandoned before its end or an error occurs while reading it. The
+     * speech is added with @c putAsync(), so it may be cached shortly after the last read returns.
+     *
+     * @param key The key of the prepared speech
+     * @param metadata The metadata of the prepared speech
+     * @param audio The audio of the prepared speech
+     * @return The stream to read the audio from
+     */
+    std::shared_ptr<aace::audio::AudioStream> record(
+        const std::string& key,
+        const std::string& metadata,
+        std::shared_ptr<aace::audio::AudioStream> audio);
+
+    /// Removes all prepared speeches
+    void clear();
+
+    /// @return The number of cached speeches
+    size_t size();
+
+    /// @return The total size of the cache files in bytes
+    size_t getTotalSize();
+
+    /// @return The maximum total size of the cache files in bytes
+    size_t getMaxSize() const;
+
+private:
+    struct Entry {
+        std::string name;
+        size_t size;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    std::string getFilePath(const std::string& fileName) const;
+    void removeLocked(std::unordered_map<std::string, EntryList::iterator>::iterator it);
+    void evictLocked(size_t maxSize);
+
+    /// The cache directory
+    std::string m_path;
+
+    /// The maximum total size of the cache files
+    size_t m_maxSize;
+
+    /// The cached speeches, the most recently used first
+    EntryList m_entries;
+
+    /// The cached speeches by file name
+    std::unordered_map<std::string, EntryList::iterator> m_index;
+
+    /// The total size of the cache files
+    size_t m_totalSize;
+
+    std::mutex m_mutex;
+
+    /// Writes the recorded speeches, declared last so it is shut down before the cache state it uses
+    aace::engine::utils::threading::Executor m_executor;
+};
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_TEXTTOSPEECH_PREPARED_SPEECH_CACHE_H
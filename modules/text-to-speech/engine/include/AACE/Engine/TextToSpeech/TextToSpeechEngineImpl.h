@@ -19,10 +19,13 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
+#include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
 #include "AACE/TextToSpeech/TextToSpeech.h"
 #include "AACE/TextToSpeech/TextToSpeechEngineInterface.h"
+#include "PreparedSpeechCache.h"
 #include "TextToSpeechServiceInterface.h"
 
 namespace aace {
@@ -31,14 +34,30 @@ namespace textToSpeech {
 
 class TextToSpeechEngineImpl : public aace::textToSpeech::TextToSpeechEngineInterface {
 private:
-    TextToSpeechEngineImpl(std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface);
+    TextToSpeechEngineImpl(
+        std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
+        std::shared_ptr<PreparedSpeechCache> preparedSpeechCache,
+        std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+        std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager);
 
     bool initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
 
 public:
+    /**
+     * Creates the engine implementation.
+     *
+     * @param textToSpeechPlatformInterface The @c TextToSpeech platform interface
+     * @param textToSpeechServiceInterface The service providing the Text To Speech providers
+     * @param preparedSpeechCache The prepared speech cache, or @c nullptr to synthesize every request
+     * @param metricRecorder The recorder for the prepared speech cache metrics
+     * @param propertyManager The property manager providing the current locale for the prepared speech cache
+     */
     static std::shared_ptr<TextToSpeechEngineImpl> create(
         std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
+        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+        std::shared_ptr<PreparedSpeechCache> preparedSpeechCache = nullptr,
+        std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder = nullptr,
+        std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager = nullptr);
 
     // TextToSpeechEngineInterface
     bool onPrepareSpeech(
@@ -47,6 +66,8 @@ public:
         const std::string& provider,
         const std::string& options) override;
     bool onGetCapabilities(const std::string& requestId, const std::string& provider) override;
+    bool onPrewarmSpeech(const std::vector<std::string>& texts, const std::string& provider, const std::string& options)
+        override;
 
     void shutdown();
 
@@ -54,6 +75,7 @@ private:
     bool executeOnPrepareSpeech(
         const std::string& speechId,
         const std::string& text,
+        const std::string& provider,
         std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
         const std::string& options);
     bool executeOnGetCapabilities(
@@ -62,9 +84,15 @@ private:
 
     std::shared_ptr<aace::textToSpeech::TextToSpeech> m_textToSpeechPlatformInterface;
     std::weak_ptr<TextToSpeechServiceInterface> m_textToSpeechServiceInterface;
+    std::shared_ptr<PreparedSpeechCache> m_preparedSpeechCache;
+    std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
+    std::weak_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> m_propertyManager;
 
     // executor for speech synthesis requests
     aace::engine::utils::threading::Executor m_executor;
+
+    // executor for prewarming the prepared speech cache, so prewarming does not delay speech synthesis requests
+    aace::engine::utils::threading::Executor m_prewarmExecutor;
 };
 
 }  // namespace textToSpeech
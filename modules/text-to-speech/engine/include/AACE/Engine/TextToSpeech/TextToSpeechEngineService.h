@@ -49,6 +49,7 @@ public:
 protected:
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool initialize() override;
+    bool configure(const nlohmann::json& configuration) override;
     bool shutdown() override;
 
 private:
@@ -65,6 +66,12 @@ private:
     std::shared_ptr<TextToSpeechEngineImpl> m_textToSpeechEngineImpl;
     std::mutex m_textToSpeechProviderMutex;
     std::string m_preferedProvider;
+
+    // The prepared speech cache directory, or empty if the cache is disabled
+    std::string m_preparedSpeechCachePath;
+
+    // The maximum total size of the prepared speech cache files
+    size_t m_preparedSpeechCacheMaxSize = PreparedSpeechCache::DEFAULT_MAX_SIZE;
     // Map to store Text To Speech provider name and the associated Text To Speech Providers
     std::unordered_map<std::string, std::shared_ptr<TextToSpeechSynthesizerInterface>>
         m_registeredTextToSpeechProviders;
@@ -0,0 +1,437 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/TextToSpeech/PreparedSpeechCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+#include <nlohmann/json.hpp>
+
+#include "AACE/Engine/Audio/IStreamAudioStream.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.textToSpeech.PreparedSpeechCache");
+
+/// Identifies a prepared speech file
+static const char SPEECH_MAGIC[4] = {'A', 'T', 'T', 'S'};
+
+/// The version of the prepared speech file format
+static constexpr uint32_t SPEECH_FORMAT_VERSION = 1;
+
+/// The extension of prepared speech files
+static const std::string SPEECH_FILE_EXTENSION = ".speech";
+
+/// The extension of prepared speech files being written
+static const std::string TEMPORARY_FILE_EXTENSION = ".tmp";
+
+/// The 64-bit FNV-1a offset basis
+static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/// The 64-bit FNV-1a prime
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/// The fixed header preceding the key, metadata and audio of a prepared speech file
+struct SpeechHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t keySize;
+    uint32_t metadataSize;
+    uint32_t sampleRate;
+    uint8_t encoding;
+    uint8_t sampleFormat;
+    uint8_t layout;
+    uint8_t endianness;
+    uint8_t sampleSize;
+    uint8_t channels;
+    uint8_t reserved[2];
+};
+
+constexpr size_t PreparedSpeechCache::DEFAULT_MAX_SIZE;
+
+/// The file name of the prepared speech with @c key
+static std::string getName(const std::string& key) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= FNV_PRIME;
+    }
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016" PRIx64, hash);
+    return name;
+}
+
+static bool endsWith(const std::string& value, const std::string& suffix) {
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+//
+// RecordingAudioStream
+//
+
+/**
+ * Passes the audio of a prepared speech through to its reader and adds it to the cache once the reader reaches
+ * the end of the stream.
+ */
+class RecordingAudioStream : public aace::audio::AudioStream {
+public:
+    RecordingAudioStream(
+        std::weak_ptr<PreparedSpeechCache> cache,
+        const std::string& key,
+        const std::string& metadata,
+        std::shared_ptr<aace::audio::AudioStream> audio,
+        size_t maxSize) :
+            m_cache(cache), m_key(key), m_metadata(metadata), m_audio(audio), m_maxSize(maxSize), m_done(false) {
+    }
+
+    // aace::audio::AudioStream
+    ssize_t read(char* data, const size_t size) override {
+        auto count = m_audio->read(data, size);
+        if (!m_done) {
+            if (count < 0) {
+                abandon("readFailed");
+            } else if (m_recorded.size() + count > m_maxSize) {
+                abandon("speechExceedsCacheSize");
+            } else {
+                m_recorded.append(data, count);
+                if (m_audio->isClosed()) {
+                    commit();
+                }
+            }
+        }
+        return count;
+    }
+
+    bool isClosed() override {
+        return m_audio->isClosed();
+    }
+
+    AudioFormat getAudioFormat() override {
+        return m_audio->getAudioFormat();
+    }
+
+    MediaType getMediaType() override {
+        return m_audio->getMediaType();
+    }
+
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override {
+        return m_audio->getProperties();
+    }
+
+private:
+    void abandon(const std::string& reason) {
+        AACE_DEBUG(LX(TAG).m("notCachingPreparedSpeech").d("reason", reason));
+        m_recorded.clear();
+        m_recorded.shrink_to_fit();
+        m_done = true;
+    }
+
+    void commit() {
+        m_done = true;
+        auto cache = m_cache.lock();
+        if (cache != nullptr && !m_recorded.empty()) {
+            // the file is written on the cache executor, not on the thread reading the audio
+            cache->putAsync(m_key, m_metadata, m_audio->getAudioFormat(), std::move(m_recorded));
+        }
+        m_recorded.clear();
+        m_recorded.shrink_to_fit();
+    }
+
+    std::weak_ptr<PreparedSpeechCache> m_cache;
+    std::string m_key;
+    std::string m_metadata;
+    std::shared_ptr<aace::audio::AudioStream> m_audio;
+    size_t m_maxSize;
+    std::string m_recorded;
+    bool m_done;
+};
+
+//
+// PreparedSpeechCache
+//
+
+PreparedSpeechCache::PreparedSpeechCache(const std::string& path, size_t maxSize) :
+        m_path(path),
+        m_maxSize(maxSize),
+        m_totalSize(0),
+        m_executor(aace::engine::utils::threading::TaskPriority::LOW) {
+}
+
+std::shared_ptr<PreparedSpeechCache> PreparedSpeechCache::create(const std::string& path, size_t maxSize) {
+    try {
+        ThrowIf(path.empty(), "emptyPath");
+        ThrowIf(maxSize == 0, "invalidMaxSize");
+        auto cache = std::shared_ptr<PreparedSpeechCache>(new PreparedSpeechCache(path, maxSize));
+        ThrowIfNot(cache->initialize(), "initializePreparedSpeechCacheFailed");
+        return cache;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        return nullptr;
+    }
+}
+
+bool PreparedSpeechCache::initialize() {
+    try {
+        if (::mkdir(m_path.c_str(), 0700) != 0) {
+            ThrowIf(errno != EEXIST, "createDirectoryFailed");
+        }
+
+        DIR* dir = ::opendir(m_path.c_str());
+        ThrowIfNull(dir, "openDirectoryFailed");
+
+        // index the speech files, and remove the files left by interrupted writes
+        std::vector<std::pair<time_t, Entry>> entries;
+        while (struct dirent* next = ::readdir(dir)) {
+            std::string fileName = next->d_name;
+            struct stat info;
+            if (endsWith(fileName, TEMPORARY_FILE_EXTENSION)) {
+                std::remove(getFilePath(fileName).c_str());
+            } else if (
+                endsWith(fileName, SPEECH_FILE_EXTENSION) && ::stat(getFilePath(fileName).c_str(), &info) == 0 &&
+                S_ISREG(info.st_mode)) {
+                auto name = fileName.substr(0, fileName.size() - SPEECH_FILE_EXTENSION.size());
+                entries.push_back({info.st_mtime, {name, static_cast<size_t>(info.st_size)}});
+            }
+        }
+        ::closedir(dir);
+
+        std::sort(
+            entries.begin(), entries.end(), [](const std::pair<time_t, Entry>& a, const std::pair<time_t, Entry>& b) {
+                return a.first > b.first;
+            });
+        for (auto& next : entries) {
+            m_index[next.second.name] = m_entries.insert(m_entries.end(), next.second);
+            m_totalSize += next.second.size;
+        }
+        evictLocked(m_maxSize);
+
+        AACE_INFO(LX(TAG).d("entries", m_entries.size()).d("totalSize", m_totalSize).d("maxSize", m_maxSize));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("errno", errno));
+        return false;
+    }
+}
+
+std::string PreparedSpeechCache::createKey(
+    const std::string& provider,
+    const std::string& text,
+    const std::string& locale,
+    const std::string& requestPayload) {
+    // objects are serialized with their properties sorted by name
+    auto payload = requestPayload.empty() ? nlohmann::json() : nlohmann::json::parse(requestPayload);
+    return nlohmann::json({provider, locale, text, payload}).dump();
+}
+
+std::string PreparedSpeechCache::getFilePath(const std::string& fileName) const {
+    return m_path + "/" + fileName;
+}
+
+std::shared_ptr<aace::audio::AudioStream> PreparedSpeechCache::get(const std::string& key, std::string& metadata) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto name = getName(key);
+    auto it = m_index.find(name);
+    if (it == m_index.end()) {
+        return nullptr;
+    }
+
+    auto path = getFilePath(name + SPEECH_FILE_EXTENSION);
+    try {
+        auto file = std::make_shared<std::ifstream>(path, std::ios::binary);
+        ThrowIfNot(file->good(), "openSpeechFileFailed");
+
+        SpeechHeader header;
+        file->read(reinterpret_cast<char*>(&header), sizeof(header));
+        ThrowIfNot(file->good(), "readHeaderFailed");
+        ThrowIf(std::memcmp(header.magic, SPEECH_MAGIC, sizeof(header.magic)) != 0, "invalidMagic");
+        ThrowIf(header.version != SPEECH_FORMAT_VERSION, "unsupportedVersion");
+        ThrowIf(sizeof(header) + header.keySize + header.metadataSize > it->second->size, "invalidHeader");
+
+        std::string storedKey(header.keySize, '\0');
+        file->read(&storedKey[0], storedKey.size());
+        std::string storedMetadata(header.metadataSize, '\0');
+        file->read(&storedMetadata[0], storedMetadata.size());
+        ThrowIfNot(file->good(), "readSpeechFileFailed");
+
+        // a different key with the same hash
+        if (storedKey != key) {
+            AACE_DEBUG(LX(TAG).m("keyCollision").d("name", name));
+            return nullptr;
+        }
+
+        // mark the speech as the most recently used, also on disk for the next startup
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        ::utime(path.c_str(), nullptr);
+
+        metadata = std::move(storedMetadata);
+        aace::audio::AudioFormat audioFormat(
+            static_cast<aace::audio::AudioFormat::Encoding>(header.encoding),
+            static_cast<aace::audio::AudioFormat::SampleFormat>(header.sampleFormat),
+            static_cast<aace::audio::AudioFormat::Layout>(header.layout),
+            static_cast<aace::audio::AudioFormat::Endianness>(header.endianness),
+            header.sampleRate,
+            header.sampleSize,
+            header.channels);
+        return aace::engine::audio::IStreamAudioStream::create(file, audioFormat);
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).d("name", name));
+        removeLocked(it);
+        return nullptr;
+    }
+}
+
+bool PreparedSpeechCache::contains(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_index.find(getName(key)) != m_index.end();
+}
+
+bool PreparedSpeechCache::put(
+    const std::string& key,
+    const std::string& metadata,
+    aace::audio::AudioFormat audioFormat,
+    const std::string& audio) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto name = getName(key);
+    auto path = getFilePath(name + SPEECH_FILE_EXTENSION);
+    auto tempPath = getFilePath(name + TEMPORARY_FILE_EXTENSION);
+    try {
+        size_t size = sizeof(SpeechHeader) + key.size() + metadata.size() + audio.size();
+        ThrowIf(size > m_maxSize, "speechExceedsCacheSize");
+
+        SpeechHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, SPEECH_MAGIC, sizeof(header.magic));
+        header.version = SPEECH_FORMAT_VERSION;
+        header.keySize = static_cast<uint32_t>(key.size());
+        header.metadataSize = static_cast<uint32_t>(metadata.size());
+        header.sampleRate = audioFormat.getSampleRate();
+        header.encoding = static_cast<uint8_t>(audioFormat.getEncoding());
+        header.sampleFormat = static_cast<uint8_t>(audioFormat.getSampleFormat());
+        header.layout = static_cast<uint8_t>(audioFormat.getLayout());
+        header.endianness = static_cast<uint8_t>(audioFormat.getEndianness());
+        header.sampleSize = audioFormat.getSampleSize();
+        header.channels = audioFormat.getNumChannels();
+
+        // write to a temporary file and rename it so a partially written speech is never read
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            ThrowIfNot(file.good(), "openSpeechFileFailed");
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(key.data(), key.size());
+            file.write(metadata.data(), metadata.size());
+            file.write(audio.data(), audio.size());
+            file.close();
+            ThrowIfNot(file.good(), "writeSpeechFileFailed");
+        }
+
+        ThrowIf(std::rename(tempPath.c_str(), path.c_str()) != 0, "renameSpeechFileFailed");
+
+        // the file of a speech with the same name has been replaced
+        auto it = m_index.find(name);
+        if (it != m_index.end()) {
+            m_totalSize -= it->second->size;
+            m_entries.erase(it->second);
+            m_index.erase(it);
+        }
+
+        // make room for the new speech before adding it, so it is never evicted itself
+        evictLocked(m_maxSize - size);
+        m_index[name] = m_entries.insert(m_entries.begin(), {name, size});
+        m_totalSize += size;
+
+        AACE_DEBUG(LX(TAG).d("name", name).d("size", size).d("totalSize", m_totalSize));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
+        std::remove(tempPath.c_str());
+        return false;
+    }
+}
+
+void PreparedSpeechCache::putAsync(
+    const std::string& key,
+    const std::string& metadata,
+    aace::audio::AudioFormat audioFormat,
+    std::string audio) {
+    auto buffer = std::make_shared<std::string>(std::move(audio));
+    // the executor is shut down before the rest of the cache is destroyed, so the task may use this
+    m_executor.submit([this, key, metadata, audioFormat, buffer]() { put(key, metadata, audioFormat, *buffer); });
+}
+
+void PreparedSpeechCache::waitForPendingWrites() {
+    m_executor.waitForSubmittedTasks();
+}
+
+std::shared_ptr<aace::audio::AudioStream> PreparedSpeechCache::record(
+    const std::string& key,
+    const std::string& metadata,
+    std::shared_ptr<aace::audio::AudioStream> audio) {
+    if (audio == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<RecordingAudioStream>(shared_from_this(), key, metadata, audio, m_maxSize);
+}
+
+void PreparedSpeechCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    evictLocked(0);
+}
+
+size_t PreparedSpeechCache::size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t PreparedSpeechCache::getTotalSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_totalSize;
+}
+
+size_t PreparedSpeechCache::getMaxSize() const {
+    return m_maxSize;
+}
+
+void PreparedSpeechCache::removeLocked(std::unordered_map<std::string, EntryList::iterator>::iterator it) {
+    std::remove(getFilePath(it->first + SPEECH_FILE_EXTENSION).c_str());
+    m_totalSize -= it->second->size;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+}
+
+void PreparedSpeechCache::evictLocked(size_t maxSize) {
+    while (m_totalSize > maxSize && !m_entries.empty()) {
+        AACE_DEBUG(LX(TAG).m("evictingPreparedSpeech").d("name", m_entries.back().name));
+        removeLocked(m_index.find(m_entries.back().name));
+    }
+}
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
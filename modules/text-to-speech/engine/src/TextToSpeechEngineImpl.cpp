@@ -13,12 +13,17 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <thread>
 #include <unordered_map>
 
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Metrics/CounterDataPointBuilder.h"
+#include "AACE/Engine/Metrics/MetricEventBuilder.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechEngineImpl.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechSynthesizerInterface.h"
 #include "AACE/Engine/Utils/String/StringUtils.h"
+#include "AACE/Engine/Utils/UUID/UUID.h"
 #include <nlohmann/json.hpp>
 
 namespace aace {
@@ -31,6 +36,21 @@ static const std::string TAG("aace.textToSpeech.TextToSpeechEngineImpl");
 // Timeout for the prepare speech request after which the TextToSpeechEngineImpl will return with an error
 static std::chrono::milliseconds DEFAULT_REQUEST_TIMEOUT(1000);
 
+// Timeout for reading the audio of a speech prepared to prewarm the prepared speech cache
+static const std::chrono::milliseconds PREWARM_AUDIO_TIMEOUT(5000);
+
+// Delay between reads of the audio of a prewarmed speech when no data is available
+static const std::chrono::milliseconds PREWARM_AUDIO_READ_DELAY(10);
+
+// Size of the buffer used to read the audio of a prewarmed speech
+static const size_t PREWARM_AUDIO_BUFFER_SIZE = 4096;
+
+// Prefix of the speech IDs of the requests prewarming the prepared speech cache
+static const std::string PREWARM_SPEECH_ID_PREFIX = "prewarm-";
+
+// The property providing the locale speech is synthesized in when the request does not specify it
+static const std::string LOCALE_PROPERTY = "aace.alexa.setting.locale";
+
 // Error string for request timeout
 static const std::string REQUEST_TIMED_OUT = "REQUEST_TIMED_OUT";
 
@@ -50,9 +70,129 @@ static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED = "Prepa
 static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED = "PrepareSpeechFailed";
 static const std::string METRIC_TEXT_TO_SPEECH_CAPABILITIES_RECEIVED = "CapabilitiesReceived";
 
+/// Counter metrics for the prepared speech cache
+static const std::string METRIC_TEXT_TO_SPEECH_PREPARED_SPEECH_CACHE_HIT = "PreparedSpeechCacheHit";
+static const std::string METRIC_TEXT_TO_SPEECH_PREPARED_SPEECH_CACHE_MISS = "PreparedSpeechCacheMiss";
+
+/**
+ * Records whether a prepare speech request was answered from the prepared speech cache.
+ *
+ * @param metricRecorder The @c MetricRecorderServiceInterface that records Metric events
+ * @param hit @c true if the speech was cached
+ */
+static void submitPreparedSpeechCacheMetric(
+    const std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface>& metricRecorder,
+    bool hit) {
+    if (metricRecorder == nullptr) {
+        return;
+    }
+    using namespace aace::engine::metrics;
+    auto metricBuilder = MetricEventBuilder{}.withSourceName(METRIC_PROGRAM_NAME_SUFFIX);
+    metricBuilder.addDataPoint(CounterDataPointBuilder{}
+                                   .withName(METRIC_TEXT_TO_SPEECH_PREPARED_SPEECH_CACHE_HIT)
+                                   .increment(hit ? 1 : 0)
+                                   .build());
+    metricBuilder.addDataPoint(CounterDataPointBuilder{}
+                                   .withName(METRIC_TEXT_TO_SPEECH_PREPARED_SPEECH_CACHE_MISS)
+                                   .increment(hit ? 0 : 1)
+                                   .build());
+    try {
+        recordMetric(metricRecorder, metricBuilder.build());
+    } catch (std::invalid_argument& ex) {
+        AACE_ERROR(LX(TAG).m("Failed to record metric").d("reason", ex.what()));
+    }
+}
+
+/// Gets the provider request payload from the options of a speech synthesis request
+static std::string getRequestPayload(const std::string& options) {
+    if (options.empty()) {
+        return "";
+    }
+    nlohmann::json optionsPayload = nlohmann::json::parse(options);
+    if (optionsPayload.contains(REQUEST_PAYLOAD_KEY)) {
+        return optionsPayload.at(REQUEST_PAYLOAD_KEY).dump();
+    }
+    return options;
+}
+
+/// Gets the current locale, which is part of the prepared speech cache key
+static std::string getLocale(
+    std::weak_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager) {
+    auto propertyManager_lock = propertyManager.lock();
+    return propertyManager_lock != nullptr ? propertyManager_lock->getProperty(LOCALE_PROPERTY) : EMPTY_STRING;
+}
+
+/**
+ * Reads the audio of a prepared speech to its end.
+ *
+ * @param audio The audio of the prepared speech
+ * @param maxSize The maximum size of the audio
+ * @param [out] data The audio data
+ * @return @c true if the audio was read to its end
+ */
+static bool readAudio(std::shared_ptr<aace::audio::AudioStream> audio, size_t maxSize, std::string& data) {
+    auto deadline = std::chrono::steady_clock::now() + PREWARM_AUDIO_TIMEOUT;
+    char buffer[PREWARM_AUDIO_BUFFER_SIZE];
+    while (!audio->isClosed()) {
+        auto count = audio->read(buffer, sizeof(buffer));
+        if (count < 0 || data.size() + count > maxSize) {
+            return false;
+        }
+        if (count > 0) {
+            data.append(buffer, count);
+        } else if (!audio->isClosed()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(PREWARM_AUDIO_READ_DELAY);
+        }
+    }
+    return !data.empty();
+}
+
+/**
+ * Synthesizes a phrase and adds it to the prepared speech cache, unless it is cached already.
+ */
+static void prewarmSpeech(
+    const std::string& text,
+    const std::string& provider,
+    std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
+    const std::string& requestPayload,
+    std::shared_ptr<PreparedSpeechCache> preparedSpeechCache,
+    std::weak_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager) {
+    try {
+        auto key = PreparedSpeechCache::createKey(provider, text, getLocale(propertyManager), requestPayload);
+        ReturnIf(preparedSpeechCache->contains(key));
+        auto speechId = PREWARM_SPEECH_ID_PREFIX + aace::engine::utils::uuid::generateUUID();
+        auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
+        auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
+        ThrowIf(status == std::future_status::timeout, REQUEST_TIMED_OUT);
+        auto prepareSpeechResult = prepareSpeechFuture.get();
+        auto failureReason = prepareSpeechResult.getFailureReason();
+        ThrowIfNot(failureReason.empty(), failureReason);
+        auto preparedAudio = prepareSpeechResult.getPreparedAudio();
+        ThrowIfNull(preparedAudio, "nullPreparedAudio");
+        std::string audio;
+        ThrowIfNot(readAudio(preparedAudio, preparedSpeechCache->getMaxSize(), audio), "readPreparedAudioFailed");
+        ThrowIfNot(
+            preparedSpeechCache->put(
+                key, prepareSpeechResult.getSpeechMetadata(), preparedAudio->getAudioFormat(), audio),
+            "cachePreparedSpeechFailed");
+        AACE_DEBUG(LX(TAG).m("Prewarmed prepared speech").sensitive("text", text));
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).sensitive("text", text));
+    }
+}
+
 TextToSpeechEngineImpl::TextToSpeechEngineImpl(
-    std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface) :
-        m_textToSpeechPlatformInterface(textToSpeechPlatformInterface) {
+    std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
+    std::shared_ptr<PreparedSpeechCache> preparedSpeechCache,
+    std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+    std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager) :
+        m_textToSpeechPlatformInterface(textToSpeechPlatformInterface),
+        m_preparedSpeechCache(preparedSpeechCache),
+        m_metricRecorder(metricRecorder),
+        m_propertyManager(propertyManager) {
 }
 
 bool TextToSpeechEngineImpl::initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
@@ -62,12 +202,15 @@ bool TextToSpeechEngineImpl::initialize(std::shared_ptr<TextToSpeechServiceInter
 
 std::shared_ptr<TextToSpeechEngineImpl> TextToSpeechEngineImpl::create(
     std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
+    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+    std::shared_ptr<PreparedSpeechCache> preparedSpeechCache,
+    std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+    std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager) {
     try {
         ThrowIfNull(textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         ThrowIfNull(textToSpeechServiceInterface, "nullTextToSpeechServiceInterface");
-        auto textToSpeechEngineImpl =
-            std::shared_ptr<TextToSpeechEngineImpl>(new TextToSpeechEngineImpl(textToSpeechPlatformInterface));
+        auto textToSpeechEngineImpl = std::shared_ptr<TextToSpeechEngineImpl>(new TextToSpeechEngineImpl(
+            textToSpeechPlatformInterface, preparedSpeechCache, metricRecorder, propertyManager));
 
         ThrowIfNot(
             textToSpeechEngineImpl->initialize(textToSpeechServiceInterface), "initializeTextToSpeechEngineImplFailed");
@@ -99,7 +242,7 @@ bool TextToSpeechEngineImpl::onPrepareSpeech(
         ThrowIfNull(m_textToSpeechServiceInterface_lock, "nullTextToSpeechServiceInterface");
         auto textToSpeechProvider = m_textToSpeechServiceInterface_lock->getTextToSpeechProvider(provider);
         ThrowIfNull(textToSpeechProvider, "nullTextToSpeechProvider");
-        return executeOnPrepareSpeech(speechId, text, textToSpeechProvider, options);
+        return executeOnPrepareSpeech(speechId, text, provider, textToSpeechProvider, options);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
@@ -119,28 +262,78 @@ bool TextToSpeechEngineImpl::onGetCapabilities(const std::string& requestId, con
     }
 }
 
+bool TextToSpeechEngineImpl::onPrewarmSpeech(
+    const std::vector<std::string>& texts,
+    const std::string& provider,
+    const std::string& options) {
+    try {
+        AACE_INFO(LX(TAG).d("texts", texts.size()).d("provider", provider).d("options", options));
+        ThrowIfNull(m_preparedSpeechCache, "preparedSpeechCacheDisabled");
+        ThrowIf(texts.empty(), "emptyTexts");
+        ThrowIf(std::find(texts.begin(), texts.end(), EMPTY_STRING) != texts.end(), "emptyText");
+        auto m_textToSpeechServiceInterface_lock = m_textToSpeechServiceInterface.lock();
+        ThrowIfNull(m_textToSpeechServiceInterface_lock, "nullTextToSpeechServiceInterface");
+        auto textToSpeechProvider = m_textToSpeechServiceInterface_lock->getTextToSpeechProvider(provider);
+        ThrowIfNull(textToSpeechProvider, "nullTextToSpeechProvider");
+        auto requestPayload = getRequestPayload(options);
+        auto preparedSpeechCache = m_preparedSpeechCache;
+        auto propertyManager = m_propertyManager;
+        // one task per phrase, so shutdown only waits for the phrase being synthesized
+        for (auto& text : texts) {
+            m_prewarmExecutor.submit(
+                [text, provider, textToSpeechProvider, requestPayload, preparedSpeechCache, propertyManager] {
+                    prewarmSpeech(
+                        text, provider, textToSpeechProvider, requestPayload, preparedSpeechCache, propertyManager);
+                });
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
     const std::string& speechId,
     const std::string& text,
+    const std::string& provider,
     std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
     const std::string& options) {
     try {
         AACE_INFO(LX(TAG));
         ThrowIfNull(m_textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         auto textToSpeechPlatformInterface = m_textToSpeechPlatformInterface;
-        std::string requestPayload;
-        std::string requestTimeout;
-        if (!options.empty()) {
-            nlohmann::json optionsPayload = nlohmann::json::parse(options);
-            if (optionsPayload.contains(REQUEST_PAYLOAD_KEY)) {
-                requestPayload = optionsPayload.at(REQUEST_PAYLOAD_KEY).dump();
-            } else {
-                requestPayload = options;
-            }
-        }
+        auto requestPayload = getRequestPayload(options);
+        auto preparedSpeechCache = m_preparedSpeechCache;
+        auto metricRecorder = m_metricRecorder;
+        auto propertyManager = m_propertyManager;
         m_executor.submit(
-            [speechId, text, textToSpeechProvider, requestTimeout, requestPayload, textToSpeechPlatformInterface] {
+            [speechId,
+             text,
+             provider,
+             textToSpeechProvider,
+             requestPayload,
+             textToSpeechPlatformInterface,
+             preparedSpeechCache,
+             metricRecorder,
+             propertyManager] {
                 try {
+                    // a cached speech completes without a provider round trip
+                    std::string cacheKey;
+                    if (preparedSpeechCache != nullptr) {
+                        cacheKey =
+                            PreparedSpeechCache::createKey(provider, text, getLocale(propertyManager), requestPayload);
+                        std::string cachedMetadata;
+                        auto cachedSpeech = preparedSpeechCache->get(cacheKey, cachedMetadata);
+                        submitPreparedSpeechCacheMetric(metricRecorder, cachedSpeech != nullptr);
+                        if (cachedSpeech != nullptr) {
+                            AACE_DEBUG(LX(TAG).m("Completing prepare speech from cache"));
+                            textToSpeechPlatformInterface->prepareSpeechCompleted(
+                                speechId, cachedSpeech, cachedMetadata);
+                            return;
+                        }
+                    }
+
                     AACE_DEBUG(LX(TAG).m("Executing prepare speech"));
                     auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
                     auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
@@ -155,6 +348,10 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
                         if (!failureReason.empty()) {
                             textToSpeechPlatformInterface->prepareSpeechFailed(speechId, failureReason);
                         } else {
+                            // the speech is cached once the platform has read it to its end
+                            if (preparedSpeechCache != nullptr) {
+                                synthesizedSpeech = preparedSpeechCache->record(cacheKey, metadata, synthesizedSpeech);
+                            }
                             textToSpeechPlatformInterface->prepareSpeechCompleted(
                                 speechId, synthesizedSpeech, metadata);
                         }
@@ -206,6 +403,7 @@ void TextToSpeechEngineImpl::shutdown() {
         m_textToSpeechPlatformInterface->setEngineInterface(nullptr);
         m_textToSpeechPlatformInterface.reset();
     }
+    m_prewarmExecutor.shutdown();
     m_executor.shutdown();
 }
 
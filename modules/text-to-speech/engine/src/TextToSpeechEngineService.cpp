@@ -14,6 +14,8 @@
  */
 
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Metrics/MetricRecorderServiceInterface.h"
+#include "AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechEngineService.h"
 
 namespace aace {
@@ -23,6 +25,15 @@ namespace textToSpeech {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.textToSpeech.TextToSpeechEngineService");
 
+// The key for the prepared speech cache node of the configuration
+static const std::string CONFIG_KEY_PREPARED_SPEECH_CACHE = "preparedSpeechCache";
+
+// The key for the prepared speech cache directory
+static const std::string CONFIG_KEY_PATH = "path";
+
+// The key for the maximum total size in bytes of the prepared speech cache files
+static const std::string CONFIG_KEY_MAX_SIZE = "maxSize";
+
 // register the service
 REGISTER_SERVICE(TextToSpeechEngineService);
 
@@ -43,6 +54,27 @@ bool TextToSpeechEngineService::initialize() {
     }
 }
 
+bool TextToSpeechEngineService::configure(const nlohmann::json& configuration) {
+    try {
+        ThrowIfNot(configuration.is_object(), "invalidConfiguration");
+        auto cacheConfiguration = configuration.find(CONFIG_KEY_PREPARED_SPEECH_CACHE);
+        if (cacheConfiguration != configuration.end()) {
+            ThrowIfNot(cacheConfiguration->is_object(), "invalidPreparedSpeechCacheConfiguration");
+            m_preparedSpeechCachePath = cacheConfiguration->value(CONFIG_KEY_PATH, "");
+            ThrowIf(m_preparedSpeechCachePath.empty(), "missingPreparedSpeechCachePath");
+            m_preparedSpeechCacheMaxSize = cacheConfiguration->value(CONFIG_KEY_MAX_SIZE, m_preparedSpeechCacheMaxSize);
+            ThrowIf(m_preparedSpeechCacheMaxSize == 0, "invalidPreparedSpeechCacheMaxSize");
+            AACE_DEBUG(LX(TAG)
+                           .d("preparedSpeechCachePath", m_preparedSpeechCachePath)
+                           .d("preparedSpeechCacheMaxSize", m_preparedSpeechCacheMaxSize));
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 bool TextToSpeechEngineService::shutdown() {
     AACE_INFO(LX(TAG));
     if (m_textToSpeechEngineImpl != nullptr) {
@@ -70,8 +102,23 @@ bool TextToSpeechEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_textToSpeechEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_textToSpeechEngineImpl =
-            aace::engine::textToSpeech::TextToSpeechEngineImpl::create(textToSpeech, shared_from_this());
+        // the engine synthesizes every request if the prepared speech cache is not configured or not usable
+        std::shared_ptr<PreparedSpeechCache> preparedSpeechCache;
+        if (!m_preparedSpeechCachePath.empty()) {
+            preparedSpeechCache = PreparedSpeechCache::create(m_preparedSpeechCachePath, m_preparedSpeechCacheMaxSize);
+            if (preparedSpeechCache == nullptr) {
+                AACE_WARN(LX(TAG).d("reason", "createPreparedSpeechCacheFailed"));
+            }
+        }
+
+        auto metricRecorder =
+            getContext()->getServiceInterface<aace::engine::metrics::MetricRecorderServiceInterface>("aace.metrics");
+        auto propertyManager =
+            getContext()->getServiceInterface<aace::engine::propertyManager::PropertyManagerServiceInterface>(
+                "aace.propertyManager");
+
+        m_textToSpeechEngineImpl = aace::engine::textToSpeech::TextToSpeechEngineImpl::create(
+            textToSpeech, shared_from_this(), preparedSpeechCache, metricRecorder, propertyManager);
         ThrowIfNull(m_textToSpeechEngineImpl, "createTextToSpeechEngineImplFailed");
 
         return true;
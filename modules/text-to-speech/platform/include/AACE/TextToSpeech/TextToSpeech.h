@@ -17,6 +17,7 @@
 #define AACE_TEXTTOSPEECH_TEXTTOSPEECH_H
 
 #include <string>
+#include <vector>
 
 #include "AACE/Audio/AudioStream.h"
 #include "AACE/Core/PlatformInterface.h"
@@ -99,6 +100,28 @@ public:
      */
     bool getCapabilities(const std::string& requestId, const std::string& provider);
 
+    /**
+     * Notifies the Engine to synthesize a list of phrases ahead of time and store them in the
+     * prepared speech cache, so a later @c prepareSpeech() request for any of the phrases
+     * with the same @c provider and @c options completes without a provider round trip.
+     * Phrases which are already cached are not synthesized again.
+     *
+     * This is an asynchronous call, and the platform is not notified when the phrases
+     * have been cached. The prepared speech cache must be enabled with the
+     * @c aace.textToSpeech.preparedSpeechCache configuration.
+     *
+     * @param [in] texts The phrases in plain text or SSML format.
+     * @param [in] provider The Text To Speech provider to be used to generate the speech assets.
+     * @param [in] options Additional options for the speech synthesis requests, as specified
+     * for @c prepareSpeech().
+     * @return true if the request was successful, else false if an error occurred.
+     *
+     */
+    bool prewarmSpeech(
+        const std::vector<std::string>& texts,
+        const std::string& provider,
+        const std::string& options = "");
+
     /**
      * Notifies the platform implementation that the @c prepareSpeech() operation of 
      * speech asset with @c speechId was successful.
@@ -16,6 +16,9 @@
 #ifndef AACE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_INTERFACE_H
 #define AACE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_INTERFACE_H
 
+#include <string>
+#include <vector>
+
 /** @file */
 
 namespace aace {
@@ -30,6 +33,10 @@ public:
         const std::string& provider,
         const std::string& options) = 0;
     virtual bool onGetCapabilities(const std::string& requestId, const std::string& provider) = 0;
+    virtual bool onPrewarmSpeech(
+        const std::vector<std::string>& texts,
+        const std::string& provider,
+        const std::string& options) = 0;
 };
 
 }  // namespace textToSpeech
@@ -50,6 +50,20 @@ bool TextToSpeech::getCapabilities(const std::string& requestId, const std::stri
     }
 }
 
+bool TextToSpeech::prewarmSpeech(
+    const std::vector<std::string>& texts,
+    const std::string& provider,
+    const std::string& options) {
+    try {
+        auto m_ttsEngineInterface_lock = m_ttsEngineInterface.lock();
+        ThrowIfNull(m_ttsEngineInterface_lock, "nullTTSEngineInterface");
+        return m_ttsEngineInterface_lock->onPrewarmSpeech(texts, provider, options);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 void TextToSpeech::setEngineInterface(std::shared_ptr<TextToSpeechEngineInterface> ttsEngineInterface) {
     m_ttsEngineInterface = ttsEngineInterface;
 }
@@ -0,0 +1,251 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <AACE/Engine/TextToSpeech/PreparedSpeechCache.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace textToSpeech {
+
+using PreparedSpeechCache = aace::engine::textToSpeech::PreparedSpeechCache;
+using AudioFormat = aace::audio::AudioFormat;
+
+static const AudioFormat MP3_FORMAT(AudioFormat::Encoding::MP3);
+
+/**
+ * An audio stream returning its data in chunks, and no data on every other read.
+ */
+class ChunkedAudioStream : public aace::audio::AudioStream {
+public:
+    ChunkedAudioStream(const std::string& data, size_t chunkSize) :
+            m_data(data), m_chunkSize(chunkSize), m_position(0), m_reads(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        if (m_reads++ % 2 == 1 || m_position == m_data.size()) {
+            return 0;
+        }
+        auto count = std::min(std::min(size, m_chunkSize), m_data.size() - m_position);
+        m_data.copy(data, count, m_position);
+        m_position += count;
+        return count;
+    }
+
+    bool isClosed() override {
+        return m_position == m_data.size();
+    }
+
+    AudioFormat getAudioFormat() override {
+        return MP3_FORMAT;
+    }
+
+private:
+    std::string m_data;
+    size_t m_chunkSize;
+    size_t m_position;
+    size_t m_reads;
+};
+
+class PreparedSpeechCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        char path[] = "/tmp/PreparedSpeechCacheTestXXXXXX";
+        ASSERT_NE(nullptr, ::mkdtemp(path));
+        m_path = path;
+    }
+
+    void TearDown() override {
+        if (DIR* dir = ::opendir(m_path.c_str())) {
+            while (struct dirent* next = ::readdir(dir)) {
+                std::remove((m_path + "/" + next->d_name).c_str());
+            }
+            ::closedir(dir);
+        }
+        ::rmdir(m_path.c_str());
+    }
+
+    static std::string readAll(std::shared_ptr<aace::audio::AudioStream> stream) {
+        std::string data;
+        char buffer[7];
+        while (!stream->isClosed()) {
+            auto count = stream->read(buffer, sizeof(buffer));
+            if (count > 0) {
+                data.append(buffer, count);
+            }
+        }
+        return data;
+    }
+
+    std::string m_path;
+};
+
+TEST_F(PreparedSpeechCacheTest, createWithInvalidArguments) {
+    EXPECT_EQ(nullptr, PreparedSpeechCache::create(""));
+    EXPECT_EQ(nullptr, PreparedSpeechCache::create(m_path, 0));
+    EXPECT_EQ(nullptr, PreparedSpeechCache::create(m_path + "/missing/cache"));
+}
+
+TEST_F(PreparedSpeechCacheTest, keyNormalizesRequestPayload) {
+    EXPECT_EQ(
+        PreparedSpeechCache::createKey("provider", "hello", "en-US", R"({"voiceId":"Alexa","locale":"en-US"})"),
+        PreparedSpeechCache::createKey("provider", "hello", "en-US", R"({ "locale": "en-US", "voiceId": "Alexa" })"));
+    EXPECT_NE(
+        PreparedSpeechCache::createKey("provider", "hello", "en-US", ""),
+        PreparedSpeechCache::createKey("provider", "hello", "de-DE", ""));
+    EXPECT_NE(
+        PreparedSpeechCache::createKey("provider", "hello", "en-US", ""),
+        PreparedSpeechCache::createKey("provider", "hello", "en-US", R"({"voiceId":"Other"})"));
+}
+
+TEST_F(PreparedSpeechCacheTest, putAndGet) {
+    auto cache = PreparedSpeechCache::create(m_path);
+    ASSERT_NE(nullptr, cache);
+    auto key = PreparedSpeechCache::createKey("provider", "turn left", "en-US", "");
+
+    std::string metadata;
+    EXPECT_EQ(nullptr, cache->get(key, metadata));
+    EXPECT_FALSE(cache->contains(key));
+
+    ASSERT_TRUE(cache->put(key, "{\"duration\":1}", MP3_FORMAT, "audio data"));
+    EXPECT_TRUE(cache->contains(key));
+    EXPECT_EQ(1u, cache->size());
+
+    auto audio = cache->get(key, metadata);
+    ASSERT_NE(nullptr, audio);
+    EXPECT_EQ("{\"duration\":1}", metadata);
+    EXPECT_EQ(AudioFormat::Encoding::MP3, audio->getEncoding());
+    EXPECT_EQ("audio data", readAll(audio));
+}
+
+TEST_F(PreparedSpeechCacheTest, evictsLeastRecentlyUsed) {
+    auto a = PreparedSpeechCache::createKey("provider", "a", "en-US", "");
+    auto b = PreparedSpeechCache::createKey("provider", "b", "en-US", "");
+    auto c = PreparedSpeechCache::createKey("provider", "c", "en-US", "");
+    std::string audio(1000, 'x');
+
+    // room for two speeches
+    auto probe = PreparedSpeechCache::create(m_path);
+    ASSERT_TRUE(probe->put(a, "", MP3_FORMAT, audio));
+    auto entrySize = probe->getTotalSize();
+    probe->clear();
+    EXPECT_EQ(0u, probe->size());
+
+    auto cache = PreparedSpeechCache::create(m_path, entrySize * 2 + entrySize / 2);
+    ASSERT_TRUE(cache->put(a, "", MP3_FORMAT, audio));
+    ASSERT_TRUE(cache->put(b, "", MP3_FORMAT, audio));
+
+    // a is used more recently than b
+    std::string metadata;
+    ASSERT_NE(nullptr, cache->get(a, metadata));
+    ASSERT_TRUE(cache->put(c, "", MP3_FORMAT, audio));
+
+    EXPECT_TRUE(cache->contains(a));
+    EXPECT_FALSE(cache->contains(b));
+    EXPECT_TRUE(cache->contains(c));
+    EXPECT_EQ(2u, cache->size());
+    EXPECT_LE(cache->getTotalSize(), cache->getMaxSize());
+
+    // a speech larger than the cache is not added
+    EXPECT_FALSE(cache->put(b, "", MP3_FORMAT, std::string(entrySize * 3, 'x')));
+    EXPECT_EQ(2u, cache->size());
+}
+
+TEST_F(PreparedSpeechCacheTest, restoresEntriesFromDisk) {
+    auto key = PreparedSpeechCache::createKey("provider", "turn left", "en-US", "");
+    {
+        auto cache = PreparedSpeechCache::create(m_path);
+        ASSERT_TRUE(cache->put(key, "metadata", MP3_FORMAT, "audio data"));
+    }
+
+    // a file left by an interrupted write is removed
+    std::ofstream(m_path + "/0000000000000000.tmp") << "partial";
+
+    auto cache = PreparedSpeechCache::create(m_path);
+    ASSERT_NE(nullptr, cache);
+    EXPECT_EQ(1u, cache->size());
+    std::string metadata;
+    auto audio = cache->get(key, metadata);
+    ASSERT_NE(nullptr, audio);
+    EXPECT_EQ("metadata", metadata);
+    EXPECT_EQ("audio data", readAll(audio));
+    EXPECT_FALSE(std::ifstream(m_path + "/0000000000000000.tmp").good());
+}
+
+TEST_F(PreparedSpeechCacheTest, corruptFileIsRemoved) {
+    auto key = PreparedSpeechCache::createKey("provider", "turn left", "en-US", "");
+    {
+        auto cache = PreparedSpeechCache::create(m_path);
+        ASSERT_TRUE(cache->put(key, "metadata", MP3_FORMAT, "audio data"));
+    }
+    if (DIR* dir = ::opendir(m_path.c_str())) {
+        while (struct dirent* next = ::readdir(dir)) {
+            if (next->d_name[0] != '.') {
+                std::ofstream(m_path + "/" + next->d_name, std::ios::trunc) << "corrupt";
+            }
+        }
+        ::closedir(dir);
+    }
+
+    auto cache = PreparedSpeechCache::create(m_path);
+    std::string metadata;
+    EXPECT_EQ(nullptr, cache->get(key, metadata));
+    EXPECT_EQ(0u, cache->size());
+}
+
+TEST_F(PreparedSpeechCacheTest, recordCachesCompletelyReadStream) {
+    auto cache = PreparedSpeechCache::create(m_path);
+    auto key = PreparedSpeechCache::createKey("provider", "turn left", "en-US", "");
+
+    auto recorded = cache->record(key, "metadata", std::make_shared<ChunkedAudioStream>("synthesized speech", 4));
+    EXPECT_EQ(AudioFormat::Encoding::MP3, recorded->getEncoding());
+    EXPECT_EQ("synthesized speech", readAll(recorded));
+
+    // the speech is written on the cache executor
+    cache->waitForPendingWrites();
+    std::string metadata;
+    auto audio = cache->get(key, metadata);
+    ASSERT_NE(nullptr, audio);
+    EXPECT_EQ("metadata", metadata);
+    EXPECT_EQ("synthesized speech", readAll(audio));
+}
+
+TEST_F(PreparedSpeechCacheTest, recordIgnoresAbandonedStream) {
+    auto cache = PreparedSpeechCache::create(m_path);
+    auto key = PreparedSpeechCache::createKey("provider", "turn left", "en-US", "");
+
+    auto recorded = cache->record(key, "metadata", std::make_shared<ChunkedAudioStream>("synthesized speech", 4));
+    char buffer[4];
+    EXPECT_EQ(4, recorded->read(buffer, sizeof(buffer)));
+    recorded.reset();
+
+    cache->waitForPendingWrites();
+    EXPECT_FALSE(cache->contains(key));
+}
+
+}  // namespace textToSpeech
+}  // namespace unit
+}  // namespace test
+}  // namespace aace